@@ -58,35 +58,49 @@ static bool DetectRectOverlap(vx_rectangle_t& a, vx_rectangle_t& b)
 	return (c.start_x < c.end_x) && (c.start_y < c.end_y) ? true : false;
 }
 
-void agoOptimizeDramaGetDataUsageOfROI(AgoGraph * agraph, AgoData * roiMasterImage, vx_uint32& inputUsageCount, vx_uint32& outputUsageCount, vx_uint32& inoutUsageCount)
+// image ROIs of each master image: [0] from graph data list and [1] from context data list, in list order
+typedef std::unordered_map<AgoData *, std::vector<AgoData *>> AgoRoiIndex;
+
+static void agoOptimizeDramaGetRoiIndex(AgoGraph * agraph, AgoRoiIndex roiIndex[2])
+{
+	for (int isVirtual = 0; isVirtual <= 1; isVirtual++) {
+		for (AgoData * data = isVirtual ? agraph->ref.context->dataList.head : agraph->dataList.head; data; data = data->next) {
+			if (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI)
+				roiIndex[isVirtual][data->u.img.roiMasterImage].push_back(data);
+		}
+	}
+}
+
+static void agoOptimizeDramaGetDataUsageOfROI(AgoRoiIndex roiIndex[2], AgoData * roiMasterImage, vx_uint32& inputUsageCount, vx_uint32& outputUsageCount, vx_uint32& inoutUsageCount)
 {
 	std::list<vx_rectangle_t> rectList;
 	vx_uint32 outputUsageCount_ = 0;
 	for (int isVirtual = 0; isVirtual <= 1; isVirtual++) {
-		for (AgoData * data = isVirtual ? agraph->ref.context->dataList.head : agraph->dataList.head; data; data = data->next) {
-			if (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI && data->u.img.roiMasterImage == roiMasterImage) {
-				inputUsageCount += data->inputUsageCount;
-				inoutUsageCount += data->inoutUsageCount;
-				if (data->outputUsageCount > 0) {
-					if (outputUsageCount == 0) {
-						bool detectedOverlap = false;
-						for (auto it = rectList.begin(); it != rectList.end(); it++) {
-							if (DetectRectOverlap(*it, data->u.img.rect_roi)) {
-								detectedOverlap = true;
-								break;
-							}
-						}
-						rectList.push_back(data->u.img.rect_roi);
-						if (detectedOverlap) {
-							outputUsageCount_ += data->outputUsageCount;
-						}
-						else {
-							outputUsageCount_ = max(outputUsageCount_, data->outputUsageCount);
+		auto roiList = roiIndex[isVirtual].find(roiMasterImage);
+		if (roiList == roiIndex[isVirtual].end())
+			continue;
+		for (AgoData * data : roiList->second) {
+			inputUsageCount += data->inputUsageCount;
+			inoutUsageCount += data->inoutUsageCount;
+			if (data->outputUsageCount > 0) {
+				if (outputUsageCount == 0) {
+					bool detectedOverlap = false;
+					for (auto it = rectList.begin(); it != rectList.end(); it++) {
+						if (DetectRectOverlap(*it, data->u.img.rect_roi)) {
+							detectedOverlap = true;
+							break;
 						}
 					}
-					else {
+					rectList.push_back(data->u.img.rect_roi);
+					if (detectedOverlap) {
 						outputUsageCount_ += data->outputUsageCount;
 					}
+					else {
+						outputUsageCount_ = max(outputUsageCount_, data->outputUsageCount);
+					}
+				}
+				else {
+					outputUsageCount_ += data->outputUsageCount;
 				}
 			}
 		}
@@ -94,15 +108,16 @@ void agoOptimizeDramaGetDataUsageOfROI(AgoGraph * agraph, AgoData * roiMasterIma
 	outputUsageCount += outputUsageCount_;
 }
 
-void agoOptimizeDramaMarkDataUsageOfROI(AgoGraph * agraph, AgoData * roiMasterImage, vx_uint32 inputUsageCount, vx_uint32 outputUsageCount, vx_uint32 inoutUsageCount)
+static void agoOptimizeDramaMarkDataUsageOfROI(AgoRoiIndex roiIndex[2], AgoData * roiMasterImage, vx_uint32 inputUsageCount, vx_uint32 outputUsageCount, vx_uint32 inoutUsageCount)
 {
 	for (int isVirtual = 0; isVirtual <= 1; isVirtual++) {
-		for (AgoData * data = isVirtual ? agraph->ref.context->dataList.head : agraph->dataList.head; data; data = data->next) {
-			if (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI && data->u.img.roiMasterImage == roiMasterImage) {
-				data->inputUsageCount = inputUsageCount;
-				data->outputUsageCount = outputUsageCount;
-				data->inoutUsageCount = inoutUsageCount;
-			}
+		auto roiList = roiIndex[isVirtual].find(roiMasterImage);
+		if (roiList == roiIndex[isVirtual].end())
+			continue;
+		for (AgoData * data : roiList->second) {
+			data->inputUsageCount = inputUsageCount;
+			data->outputUsageCount = outputUsageCount;
+			data->inoutUsageCount = inoutUsageCount;
 		}
 	}
 }
@@ -219,22 +234,46 @@ void agoOptimizeDramaMarkDataUsage(AgoGraph * agraph)
 		}
 	}
 	// add up ROI data usage
+	AgoRoiIndex roiIndex[2];
+	agoOptimizeDramaGetRoiIndex(agraph, roiIndex);
+	if (roiIndex[0].empty() && roiIndex[1].empty())
+		return;
 	for (int isVirtual = 0; isVirtual <= 1; isVirtual++) {
 		for (AgoData * data = isVirtual ? agraph->ref.context->dataList.head : agraph->dataList.head; data; data = data->next) {
 			if (data->ref.type == VX_TYPE_IMAGE && !data->u.img.isROI) {
-				agoOptimizeDramaGetDataUsageOfROI(agraph, data, data->inputUsageCount, data->outputUsageCount, data->inoutUsageCount);
-				agoOptimizeDramaMarkDataUsageOfROI(agraph, data, data->inputUsageCount, data->outputUsageCount, data->inoutUsageCount);
+				agoOptimizeDramaGetDataUsageOfROI(roiIndex, data, data->inputUsageCount, data->outputUsageCount, data->inoutUsageCount);
+				agoOptimizeDramaMarkDataUsageOfROI(roiIndex, data, data->inputUsageCount, data->outputUsageCount, data->inoutUsageCount);
 			}
 		}
 	}
 }
 
-static int agoSetDataHierarchicalLevel(AgoData * data, vx_uint32 hierarchical_level)
+// adjacency of a graph used while computing its node hierarchy
+struct AgoHierarchyIndex {
+	AgoGraph * graph;
+	AgoRoiIndex roiIndex[2];
+	std::unordered_map<AgoData *, std::vector<AgoNode *>> consumers; // data -> nodes that take it as input
+	std::deque<AgoNode *> pending;                                  // nodes with an input that got hierarchical_level
+};
+
+static void agoQueueDataConsumers(AgoHierarchyIndex * index, AgoData * data)
+{
+	auto consumers = index->consumers.find(data);
+	if (consumers != index->consumers.end()) {
+		for (AgoNode * node : consumers->second)
+			index->pending.push_back(node);
+	}
+}
+
+static int agoSetDataHierarchicalLevel(AgoHierarchyIndex * index, AgoData * data, vx_uint32 hierarchical_level)
 {
 	data->hierarchical_level = hierarchical_level;
 	if(!hierarchical_level) {
 		data->hierarchical_life_start = data->hierarchical_life_end = 0;
 	}
+	else {
+		agoQueueDataConsumers(index, data);
+	}
 #if SHOW_DEBUG_HIERARCHICAL_LEVELS
 	if (data->hierarchical_level) {
 		char name[1024];
@@ -245,20 +284,33 @@ static int agoSetDataHierarchicalLevel(AgoData * data, vx_uint32 hierarchical_le
 	// propagate hierarchical_level to all of its children (if available)
 	for (vx_uint32 child = 0; child < data->numChildren; child++) {
 		if (data->children[child]) {
-			agoSetDataHierarchicalLevel(data->children[child], hierarchical_level);
+			agoSetDataHierarchicalLevel(index, data->children[child], hierarchical_level);
 		}
 	}
 	// propagate hierarchical_level to image-ROI master (if available)
 	if (data->ref.type == VX_TYPE_IMAGE) {
 		if (data->u.img.isROI) {
 			if (data->u.img.roiMasterImage && !data->u.img.roiMasterImage->hierarchical_level) {
-				agoSetDataHierarchicalLevel(data->u.img.roiMasterImage, hierarchical_level);
+				agoSetDataHierarchicalLevel(index, data->u.img.roiMasterImage, hierarchical_level);
 			}
 		}
 		else if (hierarchical_level) {
-			for (AgoData * pdata = data->isVirtual ? ((AgoGraph *)data->ref.scope)->dataList.head : data->ref.context->dataList.head; pdata; pdata = pdata->next) {
-				if (pdata->ref.type == VX_TYPE_IMAGE && pdata->u.img.isROI && pdata->u.img.roiMasterImage == data && !pdata->hierarchical_level) {
-					agoSetDataHierarchicalLevel(pdata, hierarchical_level);
+			if (!data->isVirtual || data->ref.scope == &index->graph->ref) {
+				AgoRoiIndex& roiIndex = index->roiIndex[data->isVirtual ? 0 : 1];
+				auto roiList = roiIndex.find(data);
+				if (roiList != roiIndex.end()) {
+					for (AgoData * pdata : roiList->second) {
+						if (!pdata->hierarchical_level) {
+							agoSetDataHierarchicalLevel(index, pdata, hierarchical_level);
+						}
+					}
+				}
+			}
+			else {
+				for (AgoData * pdata = ((AgoGraph *)data->ref.scope)->dataList.head; pdata; pdata = pdata->next) {
+					if (pdata->ref.type == VX_TYPE_IMAGE && pdata->u.img.isROI && pdata->u.img.roiMasterImage == data && !pdata->hierarchical_level) {
+						agoSetDataHierarchicalLevel(index, pdata, hierarchical_level);
+					}
 				}
 			}
 		}
@@ -277,8 +329,10 @@ static int agoSetDataHierarchicalLevel(AgoData * data, vx_uint32 hierarchical_le
 				}
 			}
 			// make sure that all siblings has hierarchical_level the parent hierarchical_level is max of all siblings
-			if (hierarchical_level_sibling_min > 0 && hierarchical_level_sibling_max > 0)
+			if (hierarchical_level_sibling_min > 0 && hierarchical_level_sibling_max > 0) {
 				data->parent->hierarchical_level = hierarchical_level_sibling_max;
+				agoQueueDataConsumers(index, data->parent);
+			}
 		}
 	}
 	return 0;
@@ -292,6 +346,20 @@ int agoOptimizeDramaComputeGraphHierarchy(AgoGraph * graph)
 
 	agoOptimizeDramaMarkDataUsage(graph);
 
+	////////////////////////////////////////////////
+	// index image ROIs and the consumers of each data
+	////////////////////////////////////////////////
+	AgoHierarchyIndex index;
+	index.graph = graph;
+	agoOptimizeDramaGetRoiIndex(graph, index.roiIndex);
+	for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+		for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
+			AgoData * data = node->paramList[arg];
+			if (data && (node->akernel->argConfig[arg] & AGO_KERNEL_ARG_INPUT_FLAG))
+				index.consumers[data].push_back(node);
+		}
+	}
+
 	////////////////////////////////////////////////
 	// make sure that there is only one writer and
 	// make sure that virtual buffers always have a writer
@@ -326,7 +394,7 @@ int agoOptimizeDramaComputeGraphHierarchy(AgoGraph * graph)
 	////////////////////////////////////////////////
 	for (int isVirtual = 0; isVirtual <= 1; isVirtual++) {
 		for (AgoData * data = isVirtual ? graph->ref.context->dataList.head : graph->dataList.head; data; data = data->next) {
-			agoSetDataHierarchicalLevel(data, 0);
+			agoSetDataHierarchicalLevel(&index, data, 0);
 		}
 	}
 
@@ -384,7 +452,7 @@ int agoOptimizeDramaComputeGraphHierarchy(AgoGraph * graph)
 #endif
 				if (outputUsageCount == 0) {
 					// mark that this data object can be input to nodes with hierarchical_level = 1
-					agoSetDataHierarchicalLevel(data, 1);
+					agoSetDataHierarchicalLevel(&index, data, 1);
 				}
 			}
 		}
@@ -418,7 +486,7 @@ int agoOptimizeDramaComputeGraphHierarchy(AgoGraph * graph)
 			for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
 				AgoData * data = node->paramList[arg];
 				if (data && (kernel->argConfig[arg] & AGO_KERNEL_ARG_OUTPUT_FLAG))
-					agoSetDataHierarchicalLevel(data, node->hierarchical_level + 1);
+					agoSetDataHierarchicalLevel(&index, data, node->hierarchical_level + 1);
 			}
 		}
 	}
@@ -428,47 +496,48 @@ int agoOptimizeDramaComputeGraphHierarchy(AgoGraph * graph)
 		return status;
 	}
 	////////////////////////////////////////////////
-	// calculate hierarchical_level for rest of the nodes
+	// calculate hierarchical_level for rest of the nodes:
+	// check all nodes once in list order, then only the nodes with an input that got hierarchical_level
 	////////////////////////////////////////////////
-	for (;;)
+	index.pending.clear();
+	for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+		if (node->hierarchical_level == 0)
+			index.pending.push_back(node);
+	}
+	while (!index.pending.empty())
 	{
-		bool found_change = false;
-		for (AgoNode * node = graph->nodeList.head; node; node = node->next)
-		{
-			if (node->hierarchical_level == 0) {
-				// find min and max hierarchical_level of inputs
-				AgoKernel * kernel = node->akernel;
-				vx_uint32 hierarchical_level_min = INT_MAX, hierarchical_level_max = 0;
-				for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
-					AgoData * data = node->paramList[arg];
-					if (data && (kernel->argConfig[arg] & AGO_KERNEL_ARG_INPUT_FLAG)) {
-						vx_uint32 hierarchical_level = data->hierarchical_level;
-						if (hierarchical_level_min > hierarchical_level)
-							hierarchical_level_min = hierarchical_level;
-						if (hierarchical_level_max < hierarchical_level)
-							hierarchical_level_max = hierarchical_level;
-					}
+		AgoNode * node = index.pending.front();
+		index.pending.pop_front();
+		if (node->hierarchical_level == 0) {
+			// find min and max hierarchical_level of inputs
+			AgoKernel * kernel = node->akernel;
+			vx_uint32 hierarchical_level_min = INT_MAX, hierarchical_level_max = 0;
+			for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
+				AgoData * data = node->paramList[arg];
+				if (data && (kernel->argConfig[arg] & AGO_KERNEL_ARG_INPUT_FLAG)) {
+					vx_uint32 hierarchical_level = data->hierarchical_level;
+					if (hierarchical_level_min > hierarchical_level)
+						hierarchical_level_min = hierarchical_level;
+					if (hierarchical_level_max < hierarchical_level)
+						hierarchical_level_max = hierarchical_level;
 				}
-				// check if all inputs have hierarchical_level set
-				if (hierarchical_level_min > 0) {
-					found_change = true;
-					// mark that node is at highest hierarchical_level of all its inputs
-					node->hierarchical_level = hierarchical_level_max;
-					num_nodes_marked++;
+			}
+			// check if all inputs have hierarchical_level set
+			if (hierarchical_level_min > 0) {
+				// mark that node is at highest hierarchical_level of all its inputs
+				node->hierarchical_level = hierarchical_level_max;
+				num_nodes_marked++;
 #if SHOW_DEBUG_HIERARCHICAL_LEVELS
-					printf("DEBUG: HIERARCHICAL NODE %3d %s\n", node->hierarchical_level, node->akernel->name);
+				printf("DEBUG: HIERARCHICAL NODE %3d %s\n", node->hierarchical_level, node->akernel->name);
 #endif
-					// set the hierarchical_level of outputs to (node->hierarchical_level + 1)
-					for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
-						AgoData * data = node->paramList[arg];
-						if (data && (kernel->argConfig[arg] & AGO_KERNEL_ARG_OUTPUT_FLAG))
-							agoSetDataHierarchicalLevel(data, node->hierarchical_level + 1);
-					}
+				// set the hierarchical_level of outputs to (node->hierarchical_level + 1)
+				for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
+					AgoData * data = node->paramList[arg];
+					if (data && (kernel->argConfig[arg] & AGO_KERNEL_ARG_OUTPUT_FLAG))
+						agoSetDataHierarchicalLevel(&index, data, node->hierarchical_level + 1);
 				}
 			}
 		}
-		if (!found_change)
-			break;
 	}
 	if (num_nodes_marked != graph->nodeList.count) {
 		vx_status status = VX_ERROR_INVALID_GRAPH;
@@ -480,36 +549,29 @@ int agoOptimizeDramaComputeGraphHierarchy(AgoGraph * graph)
 
 void agoOptimizeDramaSortGraphHierarchy(AgoGraph * graph)
 {
+	// stable bucket sort of the node list by hierarchical_level
 	if (graph->nodeList.count > 1) {
-		for (;;) {
-			bool swapped = false;
-			AgoNode * prev_node = graph->nodeList.head;
-			AgoNode * node = prev_node->next;
-			// check for the order of hierarchical_level
-			if (node->hierarchical_level < prev_node->hierarchical_level) {
-				// swap prev_node and node in the list
-				prev_node->next = node->next;
-				node->next = prev_node;
-				prev_node = node;
-				node = prev_node->next;
-				graph->nodeList.head = prev_node;
-				swapped = true;
-			}
-			for (; node->next; prev_node = prev_node->next, node = node->next) {
-				AgoNode * next_node = node->next;
-				// check for the order of hierarchical_level
-				if (next_node->hierarchical_level < node->hierarchical_level) {
-					// swap node and next_node in the list
-					node->next = next_node->next;
-					next_node->next = node;
-					prev_node->next = next_node;
-					node = next_node;
-					swapped = true;
-				}
+		vx_uint32 hierarchical_level_max = 0;
+		for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+			if (hierarchical_level_max < node->hierarchical_level)
+				hierarchical_level_max = node->hierarchical_level;
+		}
+		std::vector<AgoNode *> head(hierarchical_level_max + 1, nullptr), tail(hierarchical_level_max + 1, nullptr);
+		for (AgoNode * node = graph->nodeList.head; node;) {
+			AgoNode * next = node->next;
+			node->next = nullptr;
+			if (tail[node->hierarchical_level]) tail[node->hierarchical_level]->next = node;
+			else head[node->hierarchical_level] = node;
+			tail[node->hierarchical_level] = node;
+			node = next;
+		}
+		graph->nodeList.head = graph->nodeList.tail = nullptr;
+		for (vx_uint32 level = 0; level <= hierarchical_level_max; level++) {
+			if (head[level]) {
+				if (graph->nodeList.tail) graph->nodeList.tail->next = head[level];
+				else graph->nodeList.head = head[level];
+				graph->nodeList.tail = tail[level];
 			}
-			graph->nodeList.tail = node;
-			if (!swapped)
-				break;
 		}
 	}
 }
@@ -520,50 +582,70 @@ int agoOptimizeDrama(AgoGraph * agraph)
 #if ENABLE_DEBUG_MESSAGES
 	agoWriteGraph(agraph, NULL, 0, stdout, "input-to-drama");
 #endif
-	// perform divide
 	if (agoOptimizeDramaCheckArgs(agraph))
 		return -1;
-	if (!(agraph->optimizer_flags & AGO_GRAPH_OPTIMIZER_FLAG_NO_DIVIDE)) { 
-		if(agoOptimizeDramaDivide(agraph)) 
+
+	// use the post-merge graph from compiled graph cache, when available
+	AgoCompiledGraphCache cache = { 0 };
+	int cacheStatus = 1;
+	if (agraph->compiled_graph_cache.length() > 0 && !agoOptimizeDramaCacheKey(agraph, &cache)) {
+		cacheStatus = agoOptimizeDramaCacheLoad(agraph, &cache);
+		if (cacheStatus < 0)
 			return -1;
 	}
+	if (cacheStatus == 0) {
+		if (agoOptimizeDramaComputeGraphHierarchy(agraph))
+			return -1;
+		agoOptimizeDramaSortGraphHierarchy(agraph);
+	}
+	else {
+		// perform divide
+		if (!(agraph->optimizer_flags & AGO_GRAPH_OPTIMIZER_FLAG_NO_DIVIDE)) { 
+			if(agoOptimizeDramaDivide(agraph)) 
+				return -1;
+		}
 #if ENABLE_DEBUG_MESSAGES
-	agoWriteGraph(agraph, NULL, 0, stdout, "after-divide");
+		agoWriteGraph(agraph, NULL, 0, stdout, "after-divide");
 #endif
-	if (agoOptimizeDramaComputeGraphHierarchy(agraph))
-		return -1;
-	agoOptimizeDramaSortGraphHierarchy(agraph);
+		if (agoOptimizeDramaComputeGraphHierarchy(agraph))
+			return -1;
+		agoOptimizeDramaSortGraphHierarchy(agraph);
 
-	// perform remove
-	if (agoOptimizeDramaCheckArgs(agraph))
-		return -1;
-	if (agoOptimizeDramaRemove(agraph))
-		return -1;
+		// perform remove
+		if (agoOptimizeDramaCheckArgs(agraph))
+			return -1;
+		if (agoOptimizeDramaRemove(agraph))
+			return -1;
 #if ENABLE_DEBUG_MESSAGES
-	agoWriteGraph(agraph, NULL, 0, stdout, "after-remove");
+		agoWriteGraph(agraph, NULL, 0, stdout, "after-remove");
 #endif
-	if (agoOptimizeDramaComputeGraphHierarchy(agraph))
-		return -1;
-	agoOptimizeDramaSortGraphHierarchy(agraph);
+		if (agoOptimizeDramaComputeGraphHierarchy(agraph))
+			return -1;
+		agoOptimizeDramaSortGraphHierarchy(agraph);
 
-	// perform analyze
-	if (agoOptimizeDramaCheckArgs(agraph))
-		return -1;
-	if (agoOptimizeDramaAnalyze(agraph))
-		return -1;
+		// perform analyze
+		if (agoOptimizeDramaCheckArgs(agraph))
+			return -1;
+		if (agoOptimizeDramaAnalyze(agraph))
+			return -1;
 #if ENABLE_DEBUG_MESSAGES
-	agoWriteGraph(agraph, NULL, 0, stdout, "after-analyze");
+		agoWriteGraph(agraph, NULL, 0, stdout, "after-analyze");
 #endif
 
-	// perform merge
-	if (agoOptimizeDramaCheckArgs(agraph))
-		return -1;
-	if (agoOptimizeDramaMerge(agraph))
-		return -1;
+		// perform merge
+		if (agoOptimizeDramaCheckArgs(agraph))
+			return -1;
+		if (agoOptimizeDramaMerge(agraph))
+			return -1;
 #if ENABLE_DEBUG_MESSAGES
-	agoWriteGraph(agraph, NULL, 0, stdout, "after-merge");
+		agoWriteGraph(agraph, NULL, 0, stdout, "after-merge");
 #endif
 
+		// save the post-merge graph into compiled graph cache
+		if (cache.key)
+			agoOptimizeDramaCacheSave(agraph, &cache);
+	}
+
 	// perform alloc
 	if (agoOptimizeDramaCheckArgs(agraph))
 		return -1;
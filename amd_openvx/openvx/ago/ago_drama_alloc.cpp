@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 
 #include "ago_internal.h"
+#include <unordered_set>
 
 static int agoOptimizeDramaAllocRemoveUnusedData(AgoGraph * agraph)
 {
@@ -60,16 +61,8 @@ static int agoOptimizeDramaAllocRemoveUnusedData(AgoGraph * agraph)
     return 0;
 }
 
-#if (ENABLE_OPENCL || ENABLE_HIP)
-int agoGpuAllocBuffers(AgoGraph * graph)
+static void agoOptimizeDramaAllocMarkDataLifetime(AgoGraph * graph)
 {
-    // get default target
-    vx_uint32 bufferMergeFlags = 0;
-    char textBuffer[1024];
-    if (agoGetEnvironmentVariable("AGO_BUFFER_MERGE_FLAGS", textBuffer, sizeof(textBuffer))) {
-        bufferMergeFlags = atoi(textBuffer);
-    }
-
     // mark hierarchical level (start,end) of all data in the graph
     for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
         for (vx_uint32 i = 0; i < node->paramCount; i++) {
@@ -86,12 +79,20 @@ int agoGpuAllocBuffers(AgoGraph * graph)
             }
         }
     }
+#if (ENABLE_OPENCL || ENABLE_HIP)
     for (AgoSuperNode * supernode = graph->supernodeList; supernode; supernode = supernode->next) {
         for (AgoData * data : supernode->dataList) {
             data->hierarchical_life_start = min(data->hierarchical_life_start, supernode->hierarchical_level_start);
             data->hierarchical_life_end = max(data->hierarchical_life_end, supernode->hierarchical_level_end);
         }
     }
+#endif
+    for (AgoCpuSuperNode * supernode = graph->cpuSupernodeList; supernode; supernode = supernode->next) {
+        for (AgoData * data : supernode->dataList) {
+            data->hierarchical_life_start = min(data->hierarchical_life_start, supernode->hierarchical_level_start);
+            data->hierarchical_life_end = max(data->hierarchical_life_end, supernode->hierarchical_level_end);
+        }
+    }
     for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
         if (!node->supernode) {
             for (vx_uint32 i = 0; i < node->paramCount; i++) {
@@ -107,6 +108,144 @@ int agoGpuAllocBuffers(AgoGraph * graph)
             }
         }
     }
+}
+
+static int agoOptimizeDramaAllocCpuBuffers(AgoGraph * graph)
+{
+    // buffer merge flags are shared with agoGpuAllocBuffers: bit 0 disables buffer merging
+    vx_uint32 bufferMergeFlags = 0;
+    char textBuffer[1024];
+    if (agoGetEnvironmentVariable("AGO_BUFFER_MERGE_FLAGS", textBuffer, sizeof(textBuffer))) {
+        bufferMergeFlags = atoi(textBuffer);
+    }
+    if (bufferMergeFlags & 1)
+        return 0;
+
+    // mark hierarchical level (start,end) of all data in the graph
+    agoOptimizeDramaAllocMarkDataLifetime(graph);
+
+    // get the list of virtual images and tensors (D) that need their own CPU buffers: the data must be
+    // fully produced by a node in each execution and can't be shared as a ROI master or as part of a delay
+    // image masters keep the list of their ROIs; views of a virtual tensor are always in the graph
+    std::unordered_set<AgoData *> tensorRoiMasters;
+    for (AgoData * adata = graph->dataList.head; adata; adata = adata->next) {
+        if (adata->ref.type == VX_TYPE_TENSOR && adata->u.tensor.roiMaster)
+            tensorRoiMasters.insert(adata->u.tensor.roiMaster);
+    }
+    auto isRoiMaster = [&](AgoData * data) -> bool {
+        return !data->roiDepList.empty() || tensorRoiMasters.count(data) > 0;
+    };
+    // pipeline stages work on different frames concurrently: data of different stages can't share
+    // buffers and data accessed by more than one stage gets one copy per frame in flight
+    auto getPipelineStage = [=](vx_uint32 level) -> size_t {
+        size_t stage = 0;
+        while (graph->pipeline && stage + 1 < graph->pipeline->stageList.size() && level > graph->pipeline->stageList[stage].hierarchical_level_end)
+            stage++;
+        return stage;
+    };
+    auto isDataValidForArena = [=](AgoData * data) -> bool {
+        if (!data || !data->isVirtual || data->buffer || data->isDelayed || agoIsPartOfDelay(data))
+            return false;
+        if (agoDataSanityCheckAndUpdate(data))
+            return false;
+        if (data->device_type_unused & AGO_TARGET_AFFINITY_CPU)
+            return false;
+        if (data->outputUsageCount == 0 || data->inoutUsageCount > 0)
+            return false;
+        if (data->hierarchical_life_start > data->hierarchical_life_end)
+            return false;
+        if (getPipelineStage(data->hierarchical_life_start) != getPipelineStage(data->hierarchical_life_end))
+            return false;
+        if (data->parent && data->parent->ref.type != VX_TYPE_IMAGE && data->parent->ref.type != VX_TYPE_PYRAMID)
+            return false;
+        if (data->ref.type == VX_TYPE_IMAGE) {
+            if (data->numChildren > 0 || data->u.img.isROI || data->u.img.isUniform)
+                return false;
+        }
+        else if (data->ref.type == VX_TYPE_TENSOR) {
+            if (data->u.tensor.roiMaster)
+                return false;
+        }
+        else
+            return false;
+        return !isRoiMaster(data);
+    };
+    std::vector<AgoData *> D;
+    std::unordered_set<AgoData *> inD;
+    for (AgoData * adata = graph->dataList.head; adata; adata = adata->next) {
+        if (isDataValidForArena(adata) && inD.insert(adata).second) {
+            D.push_back(adata);
+        }
+        for (vx_uint32 i = 0; i < adata->numChildren; i++) {
+            AgoData * cdata = adata->children[i];
+            if (isDataValidForArena(cdata) && inD.insert(cdata).second) {
+                D.push_back(cdata);
+            }
+        }
+    }
+    if (D.size() < 2)
+        return 0;
+
+    // place the largest buffers first at the lowest offset that doesn't overlap with the buffers
+    // already placed whose hierarchical lifetimes overlap: keep padding between buffers, same as agoAllocMemory
+    auto getArenaSize = [=](AgoData * data) -> size_t {
+        return ALIGN32(data->size) + AGO_MEMORY_ALLOC_EXTRA_PADDING;
+    };
+    std::stable_sort(D.begin(), D.end(), [=](AgoData * a, AgoData * b) -> bool {
+        return getArenaSize(a) > getArenaSize(b);
+    });
+    std::vector<size_t> offset(D.size());
+    size_t arenaSize = 0;
+    for (size_t i = 0; i < D.size(); i++) {
+        std::vector< std::pair<size_t, size_t> > used;
+        for (size_t j = 0; j < i; j++) {
+            if ((D[i]->hierarchical_life_start <= D[j]->hierarchical_life_end && D[j]->hierarchical_life_start <= D[i]->hierarchical_life_end) ||
+                getPipelineStage(D[i]->hierarchical_life_start) != getPipelineStage(D[j]->hierarchical_life_start))
+            {
+                used.push_back(std::make_pair(offset[j], offset[j] + getArenaSize(D[j])));
+            }
+        }
+        std::sort(used.begin(), used.end());
+        size_t pos = 0;
+        for (auto& range : used) {
+            if (pos + getArenaSize(D[i]) <= range.first)
+                break;
+            pos = max(pos, range.second);
+        }
+        offset[i] = pos;
+        arenaSize = max(arenaSize, pos + getArenaSize(D[i]));
+    }
+
+    // allocate one arena for all the buffers: each buffer retains the arena so that it gets
+    // released with the last data object that uses it. The arena is shared by virtual buffers
+    // that are always written before being read, so it doesn't need to be zero initialized
+    vx_uint8 * arena = (vx_uint8 *)agoAllocMemory(arenaSize, false, graph->ref.context);
+    if (!arena) {
+        agoAddLogEntry(&graph->ref, VX_ERROR_NO_MEMORY, "ERROR: agoOptimizeDramaAllocCpuBuffers: agoAllocMemory(%d) failed\n", (vx_uint32)arenaSize);
+        return -1;
+    }
+    for (size_t i = 0; i < D.size(); i++) {
+        if (i > 0)
+            agoRetainMemory(arena);
+        D[i]->buffer = arena + offset[i];
+        D[i]->buffer_allocated = arena;
+    }
+
+    return 0;
+}
+
+#if (ENABLE_OPENCL || ENABLE_HIP)
+int agoGpuAllocBuffers(AgoGraph * graph)
+{
+    // get default target
+    vx_uint32 bufferMergeFlags = 0;
+    char textBuffer[1024];
+    if (agoGetEnvironmentVariable("AGO_BUFFER_MERGE_FLAGS", textBuffer, sizeof(textBuffer))) {
+        bufferMergeFlags = atoi(textBuffer);
+    }
+
+    // mark hierarchical level (start,end) of all data in the graph
+    agoOptimizeDramaAllocMarkDataLifetime(graph);
 
     // get the list of virtual data (D) that need GPU buffers and mark if CPU access is not needed for virtual buffers
     auto isDataValidForGd = [=](AgoData * data) -> bool {
@@ -733,6 +872,345 @@ static int agoOptimizeDramaAllocSetDefaultTargets(AgoGraph * agraph)
     return 0;
 }
 
+static int agoOptimizeDramaAllocCpuSuperNodes(AgoGraph * graph)
+{
+    // release CPU supernodes from earlier verify
+    agoResetCpuSuperNodeList(graph);
+    if (!graph->cpu_tile_fusion || (graph->optimizer_flags & AGO_GRAPH_OPTIMIZER_FLAG_NO_SUPERNODE_MERGE))
+        return 0;
+
+    // get producer and consumers of all data
+    std::map<AgoData *, AgoNode *> producer;
+    std::map<AgoData *, std::vector<AgoNode *> > consumers;
+    for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+        for (vx_uint32 i = 0; i < node->paramCount; i++) {
+            AgoData * data = node->paramList[i];
+            if (data) {
+                if (node->parameters[i].direction == VX_OUTPUT || node->parameters[i].direction == VX_BIDIRECTIONAL)
+                    producer[data] = node;
+                if (node->parameters[i].direction == VX_INPUT || node->parameters[i].direction == VX_BIDIRECTIONAL)
+                    consumers[data].push_back(node);
+            }
+        }
+    }
+
+    // nodes that can run one row tile at a time: built-in CPU kernels marked with AGO_KERNEL_OP_FLAG_CPU_TILE
+    // whose images are single-plane with same dimensions and all other parameters are inputs
+    auto getImage = [=](AgoNode * node) -> AgoData * {
+        for (vx_uint32 i = 0; i < node->paramCount; i++) {
+            if (node->paramList[i] && node->paramList[i]->ref.type == VX_TYPE_IMAGE)
+                return node->paramList[i];
+        }
+        return nullptr;
+    };
+    auto isNodeValidForTiles = [=](AgoNode * node) -> bool {
+        if (node->attr_affinity.device_type != AGO_KERNEL_FLAG_DEVICE_CPU || !node->akernel->func || node->akernel->opencl_buffer_access_enable)
+            return false;
+        if (!(node->akernel->kernOpType & AGO_KERNEL_OP_FLAG_CPU_TILE))
+            return false;
+        AgoData * img = getImage(node);
+        if (!img)
+            return false;
+        for (vx_uint32 i = 0; i < node->paramCount; i++) {
+            AgoData * data = node->paramList[i];
+            if (!data)
+                continue;
+            if (data->ref.type == VX_TYPE_IMAGE) {
+                if (node->parameters[i].direction == VX_BIDIRECTIONAL || data->numChildren > 0 || agoIsPartOfDelay(data) ||
+                    data->u.img.width != img->u.img.width || data->u.img.height != img->u.img.height)
+                    return false;
+            }
+            else if (node->parameters[i].direction != VX_INPUT)
+                return false;
+        }
+        return true;
+    };
+
+    // grow groups along producer to consumer edges: a group runs when its last node is reached in the
+    // hierarchical order, so outputs consumed outside the group must not be needed before that level
+    std::map<AgoNode *, std::vector<AgoNode *> *> groupOf;
+    std::list< std::vector<AgoNode *> > groupList;
+    auto canJoinGroup = [&](std::vector<AgoNode *> * group, AgoNode * cnode) -> bool {
+        for (AgoNode * node : *group) {
+            for (vx_uint32 i = 0; i < node->paramCount; i++) {
+                AgoData * data = node->paramList[i];
+                if (!data || node->parameters[i].direction != VX_OUTPUT)
+                    continue;
+                for (AgoNode * consumer : consumers[data]) {
+                    if (consumer != cnode && groupOf[consumer] != group && consumer->hierarchical_level <= cnode->hierarchical_level)
+                        return false;
+                }
+            }
+        }
+        return true;
+    };
+    for (AgoNode * cnode = graph->nodeList.head; cnode; cnode = cnode->next) {
+        if (!isNodeValidForTiles(cnode))
+            continue;
+        AgoData * cimg = getImage(cnode);
+        std::vector<AgoNode *> * cgroup = nullptr;
+        for (vx_uint32 i = 0; i < cnode->paramCount && !cgroup; i++) {
+            AgoData * data = cnode->paramList[i];
+            if (!data || data->ref.type != VX_TYPE_IMAGE || cnode->parameters[i].direction != VX_INPUT)
+                continue;
+            auto it = groupOf.find(producer[data]);
+            if (it != groupOf.end()) {
+                AgoData * pimg = getImage(it->first);
+                if (pimg->u.img.width == cimg->u.img.width && pimg->u.img.height == cimg->u.img.height && canJoinGroup(it->second, cnode))
+                    cgroup = it->second;
+            }
+        }
+        if (!cgroup) {
+            groupList.push_back(std::vector<AgoNode *>());
+            cgroup = &groupList.back();
+        }
+        cgroup->push_back(cnode);
+        groupOf[cnode] = cgroup;
+    }
+
+    // create a CPU supernode for each group with more than one node
+    AgoCpuSuperNode ** supernodeTail = &graph->cpuSupernodeList;
+    for (auto& group : groupList) {
+        if (group.size() < 2)
+            continue;
+        AgoCpuSuperNode * supernode = new AgoCpuSuperNode;
+        AgoData * img = getImage(group.front());
+        supernode->width = img->u.img.width;
+        supernode->height = img->u.img.height;
+        supernode->hierarchical_level_start = group.front()->hierarchical_level;
+        supernode->hierarchical_level_end = group.back()->hierarchical_level;
+        vx_uint32 tileDataCount = 0;
+        for (AgoNode * node : group) {
+            supernode->nodeList.push_back(node);
+            supernode->nodeBorder.push_back(((node->akernel->kernOpType & AGO_KERNEL_OP_TYPE_MASK) == AGO_KERNEL_OP_TYPE_FIXED_NEIGHBORS) ? node->akernel->kernOpInfo / 2 : 0);
+            supernode->nodeProducer.push_back(std::vector<vx_int32>());
+            supernode->nodeTileIndex.push_back(tileDataCount);
+            tileDataCount += node->paramCount;
+            for (vx_uint32 i = 0; i < node->paramCount; i++) {
+                AgoData * data = node->paramList[i];
+                if (!data || data->ref.type != VX_TYPE_IMAGE)
+                    continue;
+                if (std::find(supernode->dataList.begin(), supernode->dataList.end(), data) == supernode->dataList.end())
+                    supernode->dataList.push_back(data);
+                if (node->parameters[i].direction == VX_INPUT) {
+                    auto it = std::find(group.begin(), group.end(), producer[data]);
+                    supernode->nodeProducer.back().push_back(it != group.end() ? (vx_int32)(it - group.begin()) : -1);
+                }
+            }
+            node->cpuSupernode = supernode;
+        }
+        supernode->tileData = new AgoData[tileDataCount];
+        // pick tile height such that the rows of all images in a tile stay in cache
+        vx_size rowSize = 0;
+        for (AgoData * data : supernode->dataList)
+            rowSize += data->u.img.stride_in_bytes;
+        supernode->tile_height = (vx_uint32)max((vx_size)AGO_CPU_TILE_MIN_HEIGHT, AGO_CPU_TILE_WORKING_SET_SIZE / max(rowSize, (vx_size)1));
+        *supernodeTail = supernode;
+        supernodeTail = &supernode->next;
+    }
+
+    return 0;
+}
+
+static int agoOptimizeDramaAllocPipelineStages(AgoGraph * graph)
+{
+    // stop pipeline stage workers from earlier verify
+    agoResetPipeline(graph);
+    if (graph->pipeline_stages < 2 || !graph->nodeList.head)
+        return 0;
+
+    // frames in flight can't share delay slots and only CPU nodes run in stage workers
+    bool isGraphValidForPipeline = graph->autoAgeDelayList.empty();
+    for (AgoNode * node = graph->nodeList.head; node && isGraphValidForPipeline; node = node->next) {
+        if (node->attr_affinity.device_type != AGO_KERNEL_FLAG_DEVICE_CPU || node->supernode || node->akernel->opencl_buffer_access_enable)
+            isGraphValidForPipeline = false;
+        for (vx_uint32 i = 0; i < node->paramCount; i++) {
+            if (node->paramList[i] && agoIsPartOfDelay(node->paramList[i]))
+                isGraphValidForPipeline = false;
+        }
+    }
+    if (!isGraphValidForPipeline) {
+        agoAddLogEntry(&graph->ref, VX_SUCCESS, "WARNING: pipeline stages disabled: graph has delays or non-CPU nodes\n");
+        return 0;
+    }
+
+    // get hierarchical levels in execution order with estimated cost as pixels written
+    std::vector<vx_uint32> levelList;
+    std::vector<vx_uint64> levelCost;
+    for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+        if (levelList.empty() || levelList.back() != node->hierarchical_level) {
+            levelList.push_back(node->hierarchical_level);
+            levelCost.push_back(0);
+        }
+        levelCost.back()++;
+        for (vx_uint32 i = 0; i < node->paramCount; i++) {
+            AgoData * data = node->paramList[i];
+            if (data && data->ref.type == VX_TYPE_IMAGE && node->parameters[i].direction != VX_INPUT)
+                levelCost.back() += (vx_uint64)data->u.img.width * data->u.img.height;
+        }
+    }
+    auto getLevelIndex = [&](vx_uint32 level) -> size_t {
+        return std::lower_bound(levelList.begin(), levelList.end(), level) - levelList.begin();
+    };
+
+    // get first/last level index of accesses to each object (planes and ROIs are accessed through their master)
+    std::vector<AgoData *> roiMasterList;
+    for (AgoData * data = graph->dataList.head; data; data = data->next) {
+        if (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI)
+            roiMasterList.push_back(data->u.img.roiMasterImage);
+        else if (data->ref.type == VX_TYPE_TENSOR && data->u.tensor.roiMaster)
+            roiMasterList.push_back(data->u.tensor.roiMaster);
+    }
+    auto getMaster = [](AgoData * data) -> AgoData * {
+        if (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI)
+            data = data->u.img.roiMasterImage;
+        else if (data->ref.type == VX_TYPE_TENSOR && data->u.tensor.roiMaster)
+            data = data->u.tensor.roiMaster;
+        while (data->parent)
+            data = data->parent;
+        return data;
+    };
+    struct AccessInfo { size_t first, last; bool written; };
+    std::map<AgoData *, AccessInfo> accessList;
+    for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+        size_t index = getLevelIndex(node->hierarchical_level);
+        for (vx_uint32 i = 0; i < node->paramCount; i++) {
+            if (!node->paramList[i])
+                continue;
+            AgoData * data = getMaster(node->paramList[i]);
+            auto it = accessList.find(data);
+            if (it == accessList.end())
+                it = accessList.insert(std::make_pair(data, AccessInfo{ index, index, false })).first;
+            it->second.first = min(it->second.first, index);
+            it->second.last = max(it->second.last, index);
+            if (node->parameters[i].direction != VX_INPUT)
+                it->second.written = true;
+        }
+    }
+
+    // a stage boundary after level index i is allowed only if all data accessed on both sides
+    // can be given one copy per frame in flight or is never written by the graph: external images,
+    // tensors, and arrays not written by the graph must be consumed in the first stage so that
+    // vxScheduleGraph can return as soon as the first stage is done
+    auto isDataValidForCopies = [&](AgoData * data) -> bool {
+        if (!data->isVirtual || std::find(roiMasterList.begin(), roiMasterList.end(), data) != roiMasterList.end())
+            return false;
+        if (data->ref.type == VX_TYPE_IMAGE)
+            return !data->u.img.isUniform;
+        return data->ref.type == VX_TYPE_TENSOR || data->ref.type == VX_TYPE_ARRAY || data->ref.type == VX_TYPE_SCALAR;
+    };
+    std::vector<bool> isCutAllowed(levelList.size() - 1, true);
+    auto disallowCuts = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++)
+            isCutAllowed[i] = false;
+    };
+    for (auto& it : accessList) {
+        AgoData * data = it.first;
+        if (data->isVirtual) {
+            if (it.second.written && !isDataValidForCopies(data))
+                disallowCuts(it.second.first, it.second.last);
+        }
+        else if (it.second.written) {
+            disallowCuts(it.second.first, it.second.last);
+        }
+        else if (data->ref.type == VX_TYPE_IMAGE || data->ref.type == VX_TYPE_TENSOR || data->ref.type == VX_TYPE_ARRAY ||
+                 data->ref.type == VX_TYPE_PYRAMID || data->ref.type == VX_TYPE_OBJECT_ARRAY)
+        {
+            // the caller may overwrite inputs once vxScheduleGraph returns, even the ones read only in a later level
+            disallowCuts(0, it.second.last);
+        }
+    }
+    for (AgoCpuSuperNode * supernode = graph->cpuSupernodeList; supernode; supernode = supernode->next) {
+        disallowCuts(getLevelIndex(supernode->hierarchical_level_start), getLevelIndex(supernode->hierarchical_level_end));
+    }
+
+    // pick stage boundaries that split the estimated cost evenly
+    vx_uint64 totalCost = 0;
+    for (auto cost : levelCost)
+        totalCost += cost;
+    std::vector<size_t> stageStart(1, 0);
+    vx_uint64 cost = 0;
+    for (size_t i = 0; i + 1 < levelList.size() && stageStart.size() < graph->pipeline_stages; i++) {
+        cost += levelCost[i];
+        if (isCutAllowed[i] && cost * graph->pipeline_stages >= totalCost * stageStart.size())
+            stageStart.push_back(i + 1);
+    }
+    if (stageStart.size() < 2) {
+        // keep a single stage so that vxScheduleGraph still returns only after the graph inputs are consumed
+        agoAddLogEntry(&graph->ref, VX_SUCCESS, "WARNING: pipeline stages reduced to 1: no valid stage boundary in graph\n");
+    }
+    AgoPipeline * pipeline = new AgoPipeline;
+    pipeline->stageList.resize(stageStart.size());
+    std::vector<size_t> levelStage(levelList.size());
+    for (size_t stage = 0; stage < stageStart.size(); stage++) {
+        size_t end = (stage + 1 < stageStart.size()) ? stageStart[stage + 1] : levelList.size();
+        pipeline->stageList[stage].hierarchical_level_start = levelList[stageStart[stage]];
+        pipeline->stageList[stage].hierarchical_level_end = levelList[end - 1];
+        pipeline->stageList[stage].snode = nullptr;
+        pipeline->stageList[stage].enode = nullptr;
+        for (size_t i = stageStart[stage]; i < end; i++)
+            levelStage[i] = stage;
+    }
+    for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+        AgoPipelineStage& stage = pipeline->stageList[levelStage[getLevelIndex(node->hierarchical_level)]];
+        if (!stage.snode)
+            stage.snode = node;
+        if (node->next && node->next->hierarchical_level > stage.hierarchical_level_end)
+            stage.enode = node->next;
+    }
+    graph->pipeline = pipeline;
+
+    // create copies of virtual data written by one stage and accessed by later stages:
+    // frame N uses copy N % count, where count is the number of stages that access the data
+    std::map<AgoData *, std::vector<AgoData *> *> copiesOf;
+    for (auto& it : accessList) {
+        AgoData * data = it.first;
+        size_t firstStage = levelStage[it.second.first], lastStage = levelStage[it.second.last];
+        if (firstStage == lastStage || !data->isVirtual || !it.second.written)
+            continue;
+        pipeline->copyList.push_back(std::vector<AgoData *>(1, data));
+        std::vector<AgoData *> * copies = &pipeline->copyList.back();
+        char desc[MAX_DESCRIPTION_DATA_SIZE];
+        agoGetDescriptionFromData(graph->ref.context, desc, data);
+        for (size_t i = firstStage; i < lastStage; i++) {
+            AgoData * copy = agoCreateDataFromDescription(graph->ref.context, graph, desc, false);
+            if (!copy) {
+                agoAddLogEntry(&data->ref, VX_FAILURE, "ERROR: agoOptimizeDramaAllocPipelineStages: agoCreateDataFromDescription(%s) failed\n", desc);
+                return -1;
+            }
+            agoGenerateVirtualDataName(graph, "pipeline", copy->name);
+            agoAddData(&graph->dataList, copy);
+            if (data->ref.type == VX_TYPE_IMAGE) {
+                copy->u.img.rect_valid = data->u.img.rect_valid;
+                copy->u.img.color_space = data->u.img.color_space;
+                copy->u.img.channel_range = data->u.img.channel_range;
+                for (vx_uint32 child = 0; child < copy->numChildren && child < data->numChildren; child++) {
+                    copy->children[child]->u.img.rect_valid = data->children[child]->u.img.rect_valid;
+                }
+            }
+            copies->push_back(copy);
+        }
+        copiesOf[data] = copies;
+    }
+    for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+        AgoPipelineStage& stage = pipeline->stageList[levelStage[getLevelIndex(node->hierarchical_level)]];
+        for (vx_uint32 i = 0; i < node->paramCount; i++) {
+            AgoData * data = node->paramList[i];
+            if (!data)
+                continue;
+            auto it = copiesOf.find(getMaster(data));
+            if (it != copiesOf.end()) {
+                AgoPipelineParam param = { node, i, -1, it->second };
+                if (data->parent)
+                    param.child = data->siblingIndex;
+                stage.paramList.push_back(param);
+            }
+        }
+    }
+
+    return 0;
+}
+
 #if (ENABLE_OPENCL || ENABLE_HIP)
 static int agoOptimizeDramaAllocMergeSuperNodes(AgoGraph * graph)
 {
@@ -894,6 +1372,11 @@ int agoOptimizeDramaAlloc(AgoGraph * agraph)
         return -1;
     }
 
+    // group CPU nodes that can run one row tile at a time
+    if (agoOptimizeDramaAllocCpuSuperNodes(agraph) < 0) {
+        return -1;
+    }
+
 #if (ENABLE_OPENCL || ENABLE_HIP)
     if (!(agraph->optimizer_flags & AGO_GRAPH_OPTIMIZER_FLAG_NO_SUPERNODE_MERGE)) {
         // merge super nodes
@@ -909,6 +1392,16 @@ int agoOptimizeDramaAlloc(AgoGraph * agraph)
     // remove unused data
     if (agoOptimizeDramaAllocRemoveUnusedData(agraph)) return -1;
 
+    // split graph into stages that can work on consecutive frames concurrently
+    if (agoOptimizeDramaAllocPipelineStages(agraph) < 0) {
+        return -1;
+    }
+
+    // share CPU buffers of virtual data with non-overlapping lifetimes
+    if (agoOptimizeDramaAllocCpuBuffers(agraph) < 0) {
+        return -1;
+    }
+
     // make sure all buffers are allocated and initialized
     for (AgoData * adata = agraph->dataList.head; adata; adata = adata->next) {
         if (agoAllocData(adata)) {
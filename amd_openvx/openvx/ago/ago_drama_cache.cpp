@@ -0,0 +1,484 @@
+/* 
+Copyright (c) 2015 - 2024 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "ago_internal.h"
+
+#define AGO_COMPILED_GRAPH_CACHE_VERSION  1 // bump when the layout of cache files or the key changes
+
+static const char agoCompiledGraphCacheMagic[8] = { 'A', 'G', 'O', 'G', 'R', 'A', 'P', 'H' };
+
+enum {
+    AGO_COMPILED_GRAPH_REF_NULL = 0, // no data
+    AGO_COMPILED_GRAPH_REF_DATA = 1, // index into data of the graph before optimization
+    AGO_COMPILED_GRAPH_REF_NEW  = 2, // index into data created by the optimizer
+};
+
+static void agoCacheHash(vx_uint64& hash, const void * ptr, size_t size)
+{
+    // FNV-1a
+    const vx_uint8 * p = (const vx_uint8 *)ptr;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= p[i];
+        hash *= 0x100000001b3ull;
+    }
+}
+
+static void agoCacheHash(vx_uint64& hash, vx_uint32 value)
+{
+    agoCacheHash(hash, &value, sizeof(value));
+}
+
+static void agoCacheHash(vx_uint64& hash, const char * str)
+{
+    agoCacheHash(hash, str, strlen(str) + 1);
+}
+
+static std::string agoCacheFileName(AgoGraph * agraph, vx_uint64 key)
+{
+    char name[64];
+    snprintf(name, sizeof(name), "/ago-graph-%016llx.bin", (unsigned long long)key);
+    return agraph->compiled_graph_cache + name;
+}
+
+static void agoCacheKeepEntry(AgoContext * acontext, const std::string& fileName, AgoCompiledGraphCacheEntry& entry)
+{
+    // keep the file contents in the context, so that verify of the same graph skips reading the file again
+    if (acontext->compiled_graph_cache_entries.size() >= CONFIG_COMPILED_GRAPH_CACHE_ENTRIES)
+        acontext->compiled_graph_cache_entries.clear();
+    std::swap(acontext->compiled_graph_cache_entries[fileName], entry);
+}
+
+static int agoCacheReadEntry(AgoGraph * agraph, AgoCompiledGraphCache * cache, const std::string& fileName, AgoCompiledGraphCacheEntry& entry)
+{
+    // returns 0 if the file is valid, and 1 if it is missing or invalid
+    FILE * fp = fopen(fileName.c_str(), "rb");
+    if (!fp)
+        return 1;
+    char magic[sizeof(agoCompiledGraphCacheMagic)];
+    vx_uint64 key = 0;
+    vx_uint32 header[5] = { 0 };
+    bool ok = fread(magic, sizeof(magic), 1, fp) == 1 && !memcmp(magic, agoCompiledGraphCacheMagic, sizeof(magic)) &&
+              fread(&key, sizeof(key), 1, fp) == 1 && key == cache->key &&
+              fread(header, sizeof(header), 1, fp) == 1 && header[0] == AGO_COMPILED_GRAPH_CACHE_VERSION &&
+              header[1] == (vx_uint32)cache->dataList.size();
+    for (vx_uint32 i = 0; ok && i < header[2]; i++) {
+        vx_uint32 len = 0;
+        char desc[MAX_DESCRIPTION_DATA_SIZE];
+        ok = fread(&len, sizeof(len), 1, fp) == 1 && len < sizeof(desc) && fread(desc, 1, len, fp) == len;
+        if (ok) {
+            desc[len] = '\0';
+            entry.newDesc.push_back(desc);
+        }
+    }
+    entry.formatRecords.resize(ok ? header[3] : 0);
+    entry.nodeRecords.resize(ok ? header[4] : 0);
+    ok = ok && fread(entry.formatRecords.data(), sizeof(vx_uint32), entry.formatRecords.size(), fp) == entry.formatRecords.size();
+    ok = ok && fread(entry.nodeRecords.data(), sizeof(vx_uint32), entry.nodeRecords.size(), fp) == entry.nodeRecords.size();
+    fclose(fp);
+    if (!ok) {
+        agoAddLogEntry(&agraph->ref, VX_SUCCESS, "WARNING: agoOptimizeDramaCacheLoad: ignored invalid %s\n", fileName.c_str());
+        return 1;
+    }
+    return 0;
+}
+
+static void agoCacheDeleteData(AgoData * data)
+{
+    // release data created from the cache file that never got added to the graph
+    for (vx_uint32 child = 0; child < data->numChildren; child++) {
+        if (data->children[child])
+            agoCacheDeleteData(data->children[child]);
+    }
+    delete[] data->children;
+    delete data;
+}
+
+int agoOptimizeDramaCacheKey(AgoGraph * agraph, AgoCompiledGraphCache * cache)
+{
+    AgoContext * acontext = agraph->ref.context;
+    cache->key = 0;
+    cache->nodeList.clear();
+    cache->dataList.clear();
+    cache->dataIndex.clear();
+
+    // enumerate data in the order of first use by nodes followed by remaining data of the graph
+    auto addData = [&](AgoData * data) {
+        if (data && cache->dataIndex.find(data) == cache->dataIndex.end()) {
+            cache->dataIndex[data] = (vx_uint32)cache->dataList.size();
+            cache->dataList.push_back(data);
+        }
+    };
+    for (AgoNode * node = agraph->nodeList.head; node; node = node->next) {
+        if (node->callback || node->akernel->regen_callback_f) {
+            // node callbacks and regenerated nodes depend on state that can't be saved
+            return -1;
+        }
+        cache->nodeList.push_back(node);
+        for (vx_uint32 i = 0; i < node->paramCount; i++)
+            addData(node->paramList[i]);
+    }
+    for (AgoData * data = agraph->dataList.head; data; data = data->next)
+        addData(data);
+
+    // kernels and merge rules are hashed once per context and again only after they change
+    vx_uint64 signature = 0xcbf29ce484222325ull;
+    vx_uint32 finalizedCount = 0;
+    for (AgoKernel * kernel = acontext->kernelList.head; kernel; kernel = kernel->next)
+        finalizedCount += kernel->finalized ? 1 : 0;
+    agoCacheHash(signature, acontext->kernelList.count);
+    agoCacheHash(signature, acontext->kernelList.generation);
+    agoCacheHash(signature, finalizedCount);
+    agoCacheHash(signature, (vx_uint32)acontext->merge_rules.size());
+    if (!acontext->compiled_graph_cache_kernel_hash || acontext->compiled_graph_cache_kernel_signature != signature) {
+        vx_uint64 kernelHash = 0xcbf29ce484222325ull;
+        for (AgoKernel * kernel = acontext->kernelList.head; kernel; kernel = kernel->next) {
+            agoCacheHash(kernelHash, kernel->name);
+            agoCacheHash(kernelHash, (vx_uint32)kernel->id);
+            agoCacheHash(kernelHash, kernel->flags);
+            agoCacheHash(kernelHash, kernel->argCount);
+            agoCacheHash(kernelHash, kernel->argConfig, sizeof(kernel->argConfig));
+            agoCacheHash(kernelHash, kernel->argType, sizeof(kernel->argType));
+            agoCacheHash(kernelHash, ((vx_uint32)kernel->kernOpType << 8) | kernel->kernOpInfo);
+        }
+        for (auto& rule : acontext->merge_rules)
+            agoCacheHash(kernelHash, &rule, sizeof(rule));
+        acontext->compiled_graph_cache_kernel_hash = kernelHash;
+        acontext->compiled_graph_cache_kernel_signature = signature;
+    }
+
+    // key: library and kernel versions, optimizer configuration, nodes and data of the graph
+    vx_uint64 hash = 0xcbf29ce484222325ull;
+    agoCacheHash(hash, AGO_VERSION);
+    agoCacheHash(hash, AGO_COMPILED_GRAPH_CACHE_VERSION);
+    agoCacheHash(hash, agraph->optimizer_flags);
+    agoCacheHash(hash, &agraph->attr_affinity, sizeof(agraph->attr_affinity));
+    agoCacheHash(hash, &acontext->compiled_graph_cache_kernel_hash, sizeof(acontext->compiled_graph_cache_kernel_hash));
+    for (AgoNode * node : cache->nodeList) {
+        agoCacheHash(hash, node->akernel->name);
+        agoCacheHash(hash, node->paramCount);
+        for (vx_uint32 i = 0; i < node->paramCount; i++)
+            agoCacheHash(hash, node->paramList[i] ? cache->dataIndex[node->paramList[i]] : ~0u);
+        agoCacheHash(hash, (vx_uint32)node->attr_border_mode.mode);
+        if (node->attr_border_mode.mode == VX_BORDER_MODE_CONSTANT)
+            agoCacheHash(hash, node->attr_border_mode.constant_value.U32);
+        agoCacheHash(hash, &node->attr_affinity, sizeof(node->attr_affinity));
+    }
+    for (AgoData * data : cache->dataList) {
+        // descriptions carry type, format, dimensions and scalar values; parameters that
+        // the optimizer may look into are hashed by content
+        char desc[MAX_DESCRIPTION_DATA_SIZE] = "";
+        for (AgoData * d = data; d; d = d->parent) {
+            desc[0] = '\0';
+            agoGetDescriptionFromData(acontext, desc, d);
+            if (!desc[0])
+                return -1;
+            agoCacheHash(hash, desc);
+            agoCacheHash(hash, (vx_uint32)d->siblingIndex);
+        }
+        if ((data->ref.type == VX_TYPE_CONVOLUTION || data->ref.type == VX_TYPE_MATRIX || data->ref.type == VX_TYPE_LUT) && data->buffer)
+            agoCacheHash(hash, data->buffer, data->size);
+    }
+    cache->key = hash;
+    return 0;
+}
+
+int agoOptimizeDramaCacheSave(AgoGraph * agraph, AgoCompiledGraphCache * cache)
+{
+    AgoContext * acontext = agraph->ref.context;
+
+    // data created by the optimizer is recorded by its description
+    std::map<AgoData *, vx_uint32> newIndex;
+    std::vector<std::string> newDesc;
+    std::vector<vx_uint32> nodeRecords, formatRecords;
+    std::vector<AgoData *> graphData;
+    for (AgoData * data = agraph->dataList.head; data; data = data->next)
+        graphData.push_back(data);
+    auto encode = [&](AgoData * data, std::vector<vx_uint32>& out) -> bool {
+        if (!data) {
+            out.push_back(AGO_COMPILED_GRAPH_REF_NULL);
+            return true;
+        }
+        std::vector<vx_uint32> path;
+        for (AgoData * d = data; d; d = d->parent) {
+            auto it = cache->dataIndex.find(d);
+            if (it != cache->dataIndex.end() || newIndex.find(d) != newIndex.end() || (!d->parent && std::find(graphData.begin(), graphData.end(), d) != graphData.end())) {
+                if (it != cache->dataIndex.end()) {
+                    out.push_back(AGO_COMPILED_GRAPH_REF_DATA);
+                    out.push_back(it->second);
+                }
+                else {
+                    if (newIndex.find(d) == newIndex.end()) {
+                        char desc[MAX_DESCRIPTION_DATA_SIZE] = "";
+                        agoGetDescriptionFromData(acontext, desc, d);
+                        if (!desc[0])
+                            return false;
+                        newIndex[d] = (vx_uint32)newDesc.size();
+                        newDesc.push_back(desc);
+                    }
+                    out.push_back(AGO_COMPILED_GRAPH_REF_NEW);
+                    out.push_back(newIndex[d]);
+                }
+                out.push_back((vx_uint32)path.size());
+                out.insert(out.end(), path.rbegin(), path.rend());
+                return true;
+            }
+            if (!d->parent)
+                break;
+            vx_uint32 child = 0;
+            while (child < d->parent->numChildren && d->parent->children[child] != d)
+                child++;
+            if (child == d->parent->numChildren)
+                break;
+            path.push_back(child);
+        }
+        return false;
+    };
+    for (AgoNode * node = agraph->nodeList.head; node; node = node->next) {
+        // retained nodes are recorded by index, so that they keep the state that was set by the application
+        auto it = std::find(cache->nodeList.begin(), cache->nodeList.end(), node);
+        nodeRecords.push_back(it != cache->nodeList.end() ? (vx_uint32)(it - cache->nodeList.begin()) : ~0u);
+        nodeRecords.push_back((vx_uint32)strlen(node->akernel->name));
+        for (const char * s = node->akernel->name; *s; s++)
+            nodeRecords.push_back((vx_uint8)*s);
+        nodeRecords.push_back(node->paramCount);
+        for (vx_uint32 i = 0; i < node->paramCount; i++) {
+            AgoData * data = node->paramList[i];
+            if (!encode(data, nodeRecords))
+                return -1;
+            // image formats can get changed by the optimizer, for example 8-bit to 1-bit
+            if (data && data->ref.type == VX_TYPE_IMAGE) {
+                if (!encode(data, formatRecords))
+                    return -1;
+                formatRecords.push_back(data->u.img.format);
+            }
+        }
+        nodeRecords.push_back(node->attr_border_mode.mode);
+        const vx_uint32 * border = (const vx_uint32 *)&node->attr_border_mode.constant_value;
+        nodeRecords.insert(nodeRecords.end(), border, border + sizeof(node->attr_border_mode.constant_value) / sizeof(vx_uint32));
+        const vx_uint32 * affinity = (const vx_uint32 *)&node->attr_affinity;
+        nodeRecords.insert(nodeRecords.end(), affinity, affinity + sizeof(node->attr_affinity) / sizeof(vx_uint32));
+    }
+
+    // write into a temporary file and rename it, so that concurrent processes never see partial files
+    std::string fileName = agoCacheFileName(agraph, cache->key);
+    char tmpName[1024];
+    snprintf(tmpName, sizeof(tmpName), "%s.%llx.tmp", fileName.c_str(), (unsigned long long)agoGetClockCounter());
+    FILE * fp = fopen(tmpName, "wb");
+    if (!fp) {
+        agoAddLogEntry(&agraph->ref, VX_SUCCESS, "WARNING: agoOptimizeDramaCacheSave: unable to create %s\n", tmpName);
+        return -1;
+    }
+    vx_uint32 header[5] = { AGO_COMPILED_GRAPH_CACHE_VERSION, (vx_uint32)cache->dataList.size(), (vx_uint32)newDesc.size(),
+                            (vx_uint32)formatRecords.size(), (vx_uint32)nodeRecords.size() };
+    bool ok = fwrite(agoCompiledGraphCacheMagic, sizeof(agoCompiledGraphCacheMagic), 1, fp) == 1 &&
+              fwrite(&cache->key, sizeof(cache->key), 1, fp) == 1 &&
+              fwrite(header, sizeof(header), 1, fp) == 1;
+    for (auto& desc : newDesc) {
+        vx_uint32 len = (vx_uint32)desc.length();
+        ok = ok && fwrite(&len, sizeof(len), 1, fp) == 1 && fwrite(desc.c_str(), 1, len, fp) == len;
+    }
+    ok = ok && fwrite(formatRecords.data(), sizeof(vx_uint32), formatRecords.size(), fp) == formatRecords.size();
+    ok = ok && fwrite(nodeRecords.data(), sizeof(vx_uint32), nodeRecords.size(), fp) == nodeRecords.size();
+    ok = (fclose(fp) == 0) && ok;
+    if (!ok || rename(tmpName, fileName.c_str())) {
+        remove(tmpName);
+        agoAddLogEntry(&agraph->ref, VX_SUCCESS, "WARNING: agoOptimizeDramaCacheSave: unable to write %s\n", fileName.c_str());
+        return -1;
+    }
+    AgoCompiledGraphCacheEntry entry = { newDesc, formatRecords, nodeRecords };
+    agoCacheKeepEntry(acontext, fileName, entry);
+    agoAddLogEntry(&agraph->ref, VX_SUCCESS, "DEBUG: agoOptimizeDramaCacheSave: saved %d nodes into %s\n", agraph->nodeList.count, fileName.c_str());
+    return 0;
+}
+
+int agoOptimizeDramaCacheLoad(AgoGraph * agraph, AgoCompiledGraphCache * cache)
+{
+    // returns 0 if the graph got loaded from cache, 1 on a cache miss (the graph is left as it was), and -1 on errors
+    AgoContext * acontext = agraph->ref.context;
+    std::string fileName = agoCacheFileName(agraph, cache->key);
+    auto entryIt = acontext->compiled_graph_cache_entries.find(fileName);
+    if (entryIt == acontext->compiled_graph_cache_entries.end()) {
+        AgoCompiledGraphCacheEntry entry;
+        if (agoCacheReadEntry(agraph, cache, fileName, entry))
+            return 1;
+        agoCacheKeepEntry(acontext, fileName, entry);
+        entryIt = acontext->compiled_graph_cache_entries.find(fileName);
+    }
+    const AgoCompiledGraphCacheEntry& entry = entryIt->second;
+
+    // decode and check all records before making any change to the graph:
+    // the data added by the optimizer is created outside the graph until then
+    std::vector<AgoData *> newData;
+    auto discard = [&]() -> int {
+        for (AgoData * data : newData)
+            agoCacheDeleteData(data);
+        agoAddLogEntry(&agraph->ref, VX_SUCCESS, "WARNING: agoOptimizeDramaCacheLoad: ignored invalid %s\n", fileName.c_str());
+        acontext->compiled_graph_cache_entries.erase(fileName);
+        return 1;
+    };
+    for (auto& desc : entry.newDesc) {
+        AgoData * data = agoCreateDataFromDescription(acontext, agraph, desc.c_str(), false);
+        if (!data)
+            return discard();
+        newData.push_back(data);
+    }
+    size_t pos = 0;
+    auto decode = [&](const std::vector<vx_uint32>& in, AgoData *& data) -> bool {
+        if (pos >= in.size())
+            return false;
+        vx_uint32 kind = in[pos++];
+        data = nullptr;
+        if (kind == AGO_COMPILED_GRAPH_REF_NULL)
+            return true;
+        if (pos + 2 > in.size())
+            return false;
+        vx_uint32 index = in[pos++], depth = in[pos++];
+        if (kind == AGO_COMPILED_GRAPH_REF_DATA && index < cache->dataList.size())
+            data = cache->dataList[index];
+        else if (kind == AGO_COMPILED_GRAPH_REF_NEW && index < newData.size())
+            data = newData[index];
+        else
+            return false;
+        for (vx_uint32 i = 0; i < depth; i++) {
+            if (pos >= in.size() || in[pos] >= data->numChildren || !data->children[in[pos]])
+                return false;
+            data = data->children[in[pos++]];
+        }
+        return true;
+    };
+    struct NodeRecord {
+        AgoNode * node;
+        AgoKernel * kernel;
+        vx_uint32 paramCount;
+        AgoData * paramList[AGO_MAX_PARAMS];
+        vx_border_mode_t border_mode;
+        AgoTargetAffinityInfo_ affinity;
+    };
+    std::vector<NodeRecord> records;
+    const std::vector<vx_uint32>& nodeRecords = entry.nodeRecords;
+    const vx_uint32 borderWords = sizeof(vx_border_mode_t().constant_value) / sizeof(vx_uint32);
+    const vx_uint32 affinityWords = sizeof(AgoTargetAffinityInfo_) / sizeof(vx_uint32);
+    for (pos = 0; pos < nodeRecords.size();) {
+        NodeRecord record = { 0 };
+        vx_uint32 nodeIndex = nodeRecords[pos++];
+        if (nodeIndex != ~0u) {
+            if (nodeIndex >= cache->nodeList.size())
+                return discard();
+            record.node = cache->nodeList[nodeIndex];
+        }
+        char name[VX_MAX_KERNEL_NAME] = "";
+        vx_uint32 len = (pos < nodeRecords.size()) ? nodeRecords[pos++] : ~0u;
+        if (len >= VX_MAX_KERNEL_NAME || pos + len + 1 > nodeRecords.size())
+            return discard();
+        for (vx_uint32 i = 0; i < len; i++)
+            name[i] = (char)nodeRecords[pos++];
+        record.kernel = agoFindKernelByName(acontext, name);
+        record.paramCount = nodeRecords[pos++];
+        if (!record.kernel || record.paramCount != record.kernel->argCount || (record.node && record.node->akernel != record.kernel))
+            return discard();
+        for (vx_uint32 i = 0; i < record.paramCount; i++) {
+            if (!decode(nodeRecords, record.paramList[i]))
+                return discard();
+        }
+        if (pos + 1 + borderWords + affinityWords > nodeRecords.size())
+            return discard();
+        record.border_mode.mode = nodeRecords[pos++];
+        memcpy(&record.border_mode.constant_value, &nodeRecords[pos], borderWords * sizeof(vx_uint32));
+        pos += borderWords;
+        memcpy(&record.affinity, &nodeRecords[pos], affinityWords * sizeof(vx_uint32));
+        pos += affinityWords;
+        records.push_back(record);
+    }
+    std::vector<std::pair<AgoData *, vx_df_image>> formats;
+    for (pos = 0; pos < entry.formatRecords.size();) {
+        AgoData * data = nullptr;
+        if (!decode(entry.formatRecords, data) || !data || data->ref.type != VX_TYPE_IMAGE || pos >= entry.formatRecords.size())
+            return discard();
+        formats.push_back(std::make_pair(data, (vx_df_image)entry.formatRecords[pos++]));
+    }
+
+    // create and validate the new nodes next to the current ones, so that the graph can be restored when that fails
+    std::vector<vx_df_image> oldFormats;
+    for (auto& format : formats) {
+        oldFormats.push_back(format.first->u.img.format);
+        format.first->u.img.format = format.second;
+    }
+    for (AgoData * data : newData) {
+        agoGenerateVirtualDataName(agraph, "cache", data->name);
+        agoAddData(&agraph->dataList, data);
+    }
+    std::vector<AgoNode *> nodes;
+    bool verified = true;
+    for (auto& record : records) {
+        AgoNode * node = record.node;
+        if (!node) {
+            node = agoCreateNode(agraph, record.kernel);
+            for (vx_uint32 i = 0; i < record.paramCount; i++)
+                node->paramList[i] = record.paramList[i];
+            node->attr_border_mode = record.border_mode;
+            node->attr_affinity = record.affinity;
+            if (agoVerifyNode(node))
+                verified = false;
+        }
+        nodes.push_back(node);
+        if (!verified)
+            break;
+    }
+    if (!verified) {
+        for (size_t i = 0; i < nodes.size(); i++) {
+            if (!records[i].node)
+                agoRemoveNode(&agraph->nodeList, nodes[i], true);
+        }
+        for (size_t i = 0; i < formats.size(); i++)
+            formats[i].first->u.img.format = oldFormats[i];
+        for (AgoData * data : newData)
+            agoRemoveDataInGraph(agraph, data);
+        agoAddLogEntry(&agraph->ref, VX_SUCCESS, "WARNING: agoOptimizeDramaCacheLoad: ignored %s that doesn't validate\n", fileName.c_str());
+        acontext->compiled_graph_cache_entries.erase(fileName);
+        return 1;
+    }
+
+    // replace the node list of the graph: nodes that are not part of the cached list go
+    // into trash just like the nodes replaced by the optimizer
+    for (AgoNode * node : cache->nodeList) {
+        if (std::find(nodes.begin(), nodes.end(), node) == nodes.end()) {
+            if (agoRemoveNode(&agraph->nodeList, node, true)) {
+                agoAddLogEntry(&agraph->ref, VX_FAILURE, "ERROR: agoOptimizeDramaCacheLoad: agoRemoveNode(*,%s) failed\n", node->akernel->name);
+                return -1;
+            }
+        }
+    }
+    agraph->nodeList.head = agraph->nodeList.tail = NULL;
+    agraph->nodeList.count = 0;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        AgoNode * node = nodes[i];
+        node->next = NULL;
+        agoAddNode(&agraph->nodeList, node);
+        if (records[i].node) {
+            for (vx_uint32 arg = 0; arg < records[i].paramCount; arg++)
+                node->paramList[arg] = records[i].paramList[arg];
+        }
+    }
+    agoAddLogEntry(&agraph->ref, VX_SUCCESS, "DEBUG: agoOptimizeDramaCacheLoad: loaded %d nodes from %s\n", agraph->nodeList.count, fileName.c_str());
+    return 0;
+}
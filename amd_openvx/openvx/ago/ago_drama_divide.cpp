@@ -1989,6 +1989,119 @@ int agoDramaDivideLaplacianReconstructNode(AgoNodeList * nodeList, AgoNode * ano
 	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
 }
 
+int agoDramaDivideTensorMultiplyNode(AgoNodeList * nodeList, AgoNode * anode)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[2], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[3], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[4], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[5], VX_TYPE_TENSOR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[5];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[1];
+	anode->paramList[3] = paramList[2];
+	anode->paramList[4] = paramList[3];
+	anode->paramList[5] = paramList[4];
+	anode->paramCount = 6;
+	vx_enum new_kernel_id = VX_KERNEL_AMD_TENSOR_MULTIPLY_DATA_DATA_DATA;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
+int agoDramaDivideTensorAddSubtractNode(AgoNodeList * nodeList, AgoNode * anode, vx_enum new_kernel_id)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[2], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[3], VX_TYPE_TENSOR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[3];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[1];
+	anode->paramList[3] = paramList[2];
+	anode->paramCount = 4;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
+int agoDramaDivideTensorTableLookupNode(AgoNodeList * nodeList, AgoNode * anode)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_LUT);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[2], VX_TYPE_TENSOR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[2];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[1];
+	anode->paramCount = 3;
+	vx_enum new_kernel_id = VX_KERNEL_AMD_TENSOR_TABLE_LOOKUP_DATA_DATA_DATA;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
+int agoDramaDivideTensorTransposeNode(AgoNodeList * nodeList, AgoNode * anode)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[2], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[3], VX_TYPE_SCALAR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[1];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[2];
+	anode->paramList[3] = paramList[3];
+	anode->paramCount = 4;
+	vx_enum new_kernel_id = VX_KERNEL_AMD_TENSOR_TRANSPOSE_DATA_DATA;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
+int agoDramaDivideTensorConvertDepthNode(AgoNodeList * nodeList, AgoNode * anode)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[2], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[3], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[4], VX_TYPE_TENSOR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[4];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[1];
+	anode->paramList[3] = paramList[2];
+	anode->paramList[4] = paramList[3];
+	anode->paramCount = 5;
+	vx_enum new_kernel_id = VX_KERNEL_AMD_TENSOR_CONVERT_DEPTH_DATA_DATA;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
+int agoDramaDivideTensorMatrixMultiplyNode(AgoNodeList * nodeList, AgoNode * anode)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE_OPTIONAL(anode->paramList[2], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[3], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[4], VX_TYPE_TENSOR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[4];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[1];
+	anode->paramList[3] = paramList[2];
+	anode->paramList[4] = paramList[3];
+	anode->paramCount = 5;
+	vx_enum new_kernel_id = VX_KERNEL_AMD_TENSOR_MATRIX_MULTIPLY_DATA_DATA_DATA;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
 int agoDramaDivideNode(AgoNodeList * nodeList, AgoNode * anode)
 {
 	// save parameter list
@@ -2139,6 +2252,27 @@ int agoDramaDivideNode(AgoNodeList * nodeList, AgoNode * anode)
 		case VX_KERNEL_LAPLACIAN_RECONSTRUCT:
 			status = agoDramaDivideLaplacianReconstructNode(nodeList, anode);
 			break;
+		case VX_KERNEL_TENSOR_MULTIPLY:
+			status = agoDramaDivideTensorMultiplyNode(nodeList, anode);
+			break;
+		case VX_KERNEL_TENSOR_ADD:
+			status = agoDramaDivideTensorAddSubtractNode(nodeList, anode, VX_KERNEL_AMD_TENSOR_ADD_DATA_DATA_DATA);
+			break;
+		case VX_KERNEL_TENSOR_SUBTRACT:
+			status = agoDramaDivideTensorAddSubtractNode(nodeList, anode, VX_KERNEL_AMD_TENSOR_SUBTRACT_DATA_DATA_DATA);
+			break;
+		case VX_KERNEL_TENSOR_TABLE_LOOKUP:
+			status = agoDramaDivideTensorTableLookupNode(nodeList, anode);
+			break;
+		case VX_KERNEL_TENSOR_TRANSPOSE:
+			status = agoDramaDivideTensorTransposeNode(nodeList, anode);
+			break;
+		case VX_KERNEL_TENSOR_CONVERT_DEPTH:
+			status = agoDramaDivideTensorConvertDepthNode(nodeList, anode);
+			break;
+		case VX_KERNEL_TENSOR_MATRIX_MULTIPLY:
+			status = agoDramaDivideTensorMatrixMultiplyNode(nodeList, anode);
+			break;
 		default:
 			break;
 	}
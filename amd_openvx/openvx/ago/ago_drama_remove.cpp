@@ -1321,6 +1321,21 @@ int agoOptimizeDramaRemoveNodeMerge(AgoGraph * agraph)
 int agoOptimizeDramaRemoveImageU8toU1(AgoGraph * agraph)
 {
 	int status = 0;
+	// index the nodes using each data (with the first argument that uses it) and the image ROIs
+	// of each master image: node list and node parameters don't change below
+	std::unordered_map<AgoData *, std::vector<std::pair<AgoNode *, vx_int32>>> dataUsers;
+	std::unordered_map<AgoData *, std::vector<AgoData *>> roiImages;
+	for (AgoNode * anode = agraph->nodeList.head; anode; anode = anode->next) {
+		for (vx_uint32 i = 0; i < anode->paramCount; i++) {
+			AgoData * data = anode->paramList[i];
+			if (data && std::find(anode->paramList, anode->paramList + i, data) == anode->paramList + i)
+				dataUsers[data].push_back(std::make_pair(anode, (vx_int32)i));
+		}
+	}
+	for (AgoData * data = agraph->dataList.head; data; data = data->next) {
+		if (data->ref.type == VX_TYPE_IMAGE && data->u.img.roiMasterImage)
+			roiImages[data->u.img.roiMasterImage].push_back(data);
+	}
 	// browse through all virtual data in the graph for VX_DF_IMAGE_U8 objects
 	// that can be potentially converted into VX_DF_IMAGE_U1_AMD
 	for (AgoData * adata = agraph->dataList.head; adata; adata = adata->next) {
@@ -1334,44 +1349,37 @@ int agoOptimizeDramaRemoveImageU8toU1(AgoGraph * agraph)
 
 			// loop through all connected images, such as ROI
 			AgoData * pdata = adata->u.img.roiMasterImage ? adata->u.img.roiMasterImage : adata;
-			for (AgoData * data = agraph->dataList.head; data && U8toU1_possible; data = data->next)
-			{
-				if (data->ref.type == VX_TYPE_IMAGE && (data == adata || data->u.img.roiMasterImage == pdata))
-				{
-					// if ROI, make sure start_x and end_x are multiple of 8
-					if (data->u.img.isROI && ((data->u.img.rect_roi.start_x & 7) || (data->u.img.rect_roi.end_x & 7))) {
-						// can not convert it to U1 since ROI accesses on non-byte boundaries
+			std::vector<AgoData *> connectedImages = roiImages[pdata];
+			if (adata->u.img.roiMasterImage != pdata)
+				connectedImages.push_back(adata);
+			for (size_t index = 0; index < connectedImages.size() && U8toU1_possible; index++)
+			{
+				AgoData * data = connectedImages[index];
+				// if ROI, make sure start_x and end_x are multiple of 8
+				if (data->u.img.isROI && ((data->u.img.rect_roi.start_x & 7) || (data->u.img.rect_roi.end_x & 7))) {
+					// can not convert it to U1 since ROI accesses on non-byte boundaries
+					U8toU1_possible = false;
+					break;
+				}
+				// make sure all the nodes that access this data can be converted to use VX_DF_IMAGE_U1_AMD
+				for (auto& user : dataUsers[data]) {
+					AgoNode * anode = user.first;
+					vx_int32 arg_index = user.second;
+					// check if anode is part of U8toU1 conversion rule
+					bool matched = false;
+					for (vx_uint32 rule = 0; rule < s_U8toU1_rule_count; rule++) {
+						if (s_U8toU1_rule[rule].find_kernel_id == anode->akernel->id &&
+							s_U8toU1_rule[rule].arg_index == arg_index)
+						{
+							matched = true;
+							break;
+						}
+					}
+					if (!matched) {
+						// data is used by nodes that are not in U8toU1 conversion rule
 						U8toU1_possible = false;
 						break;
 					}
-					// make sure all the nodes that access this data can be converted to use VX_DF_IMAGE_U1_AMD
-					for (AgoNode * anode = agraph->nodeList.head; anode; anode = anode->next) {
-						vx_int32 arg_index = -1;
-						for (vx_uint32 i = 0; i < anode->paramCount; i++) {
-							if (anode->paramList[i] == data) {
-								arg_index = i;
-								break;
-							}
-						}
-						// check if data is used by anode
-						if (arg_index >= 0) {
-							// check if anode is part of U8toU1 conversion rule
-							bool matched = false;
-							for (vx_uint32 rule = 0; rule < s_U8toU1_rule_count; rule++) {
-								if (s_U8toU1_rule[rule].find_kernel_id == anode->akernel->id &&
-									s_U8toU1_rule[rule].arg_index == arg_index)
-								{
-									matched = true;
-									break;
-								}
-							}
-							if (!matched) {
-								// data is used by nodes that are not in U8toU1 conversion rule
-								U8toU1_possible = false;
-								break;
-							}
-						}
-					}
 				}
 			}
 
@@ -1380,35 +1388,23 @@ int agoOptimizeDramaRemoveImageU8toU1(AgoGraph * agraph)
 			// - change node type to use VX_DF_IMAGE_U1_AMD instead of VX_DF_IMAGE_U8
 			if (U8toU1_possible) {
 				// loop through all connected images, such as ROI
-				AgoData * pdata = adata->u.img.roiMasterImage ? adata->u.img.roiMasterImage : adata;
-				for (AgoData * data = agraph->dataList.head; data && U8toU1_possible; data = data->next)
+				for (AgoData * data : connectedImages)
 				{
-					if (data->ref.type == VX_TYPE_IMAGE && (data == adata || data->u.img.roiMasterImage == pdata))
-					{
-						data->u.img.format = VX_DF_IMAGE_U1_AMD;
-						for (AgoNode * anode = agraph->nodeList.head; anode; anode = anode->next) {
-							vx_int32 arg_index = -1;
-							for (vx_uint32 i = 0; i < anode->paramCount; i++) {
-								if (anode->paramList[i] == data) {
-									arg_index = i;
-									break;
-								}
-							}
-							// check if data is used by anode
-							if (arg_index >= 0) {
-								// check if anode is part of U8toU1 conversion rule
-								for (vx_uint32 rule = 0; rule < s_U8toU1_rule_count; rule++) {
-									if (s_U8toU1_rule[rule].find_kernel_id == anode->akernel->id &&
-										s_U8toU1_rule[rule].arg_index == arg_index)
-									{
-										anode->akernel = agoFindKernelByEnum(agraph->ref.context, s_U8toU1_rule[rule].replace_kernel_id);
-										if (!anode->akernel) {
-											agoAddLogEntry(&anode->ref, VX_FAILURE, "ERROR: agoOptimizeDramaRemoveImageU8toU1: agoFindKernelByEnum(0x%08x) failed for rule:%d\n", s_U8toU1_rule[rule].replace_kernel_id, rule);
-											return -1;
-										}
-										break;
-									}
+					data->u.img.format = VX_DF_IMAGE_U1_AMD;
+					for (auto& user : dataUsers[data]) {
+						AgoNode * anode = user.first;
+						vx_int32 arg_index = user.second;
+						// check if anode is part of U8toU1 conversion rule
+						for (vx_uint32 rule = 0; rule < s_U8toU1_rule_count; rule++) {
+							if (s_U8toU1_rule[rule].find_kernel_id == anode->akernel->id &&
+								s_U8toU1_rule[rule].arg_index == arg_index)
+							{
+								anode->akernel = agoFindKernelByEnum(agraph->ref.context, s_U8toU1_rule[rule].replace_kernel_id);
+								if (!anode->akernel) {
+									agoAddLogEntry(&anode->ref, VX_FAILURE, "ERROR: agoOptimizeDramaRemoveImageU8toU1: agoFindKernelByEnum(0x%08x) failed for rule:%d\n", s_U8toU1_rule[rule].replace_kernel_id, rule);
+									return -1;
 								}
+								break;
 							}
 						}
 					}
@@ -2257,6 +2257,24 @@ int HafCpu_NonMaxSupp_XY_ANY_3x3
 		vx_float32         * pSrcImg,
 		vx_uint32            srcStrideInBytes
 	);
+vx_uint32 HafCpu_NonMaxSuppGridInfo
+	(
+		ago_harris_grid_header_t * gridInfo,
+		vx_uint32                  width,
+		vx_uint32                  height,
+		vx_float32                 min_distance
+	);
+int HafCpu_NonMaxSuppGrid_XY_XYS
+	(
+		vx_uint32                  capacityOfDstCorner,
+		vx_keypoint_t            * dstCorner,
+		vx_uint32                * pDstCornerCount,
+		const ago_keypoint_xys_t * srcList,
+		vx_uint32                  srcListCount,
+		vx_float32                 min_distance,
+		ago_harris_grid_header_t * gridInfo,
+		ago_coord2d_short_t      * gridBuf
+	);
 int HafCpu_HarrisMergeSortAndPick_XY_XYS
 	(
 		vx_uint32                  capacityOfDstCorner,
@@ -2520,7 +2538,9 @@ int HafCpu_WarpAffine_U8_U8_Bilinear
 		vx_uint8            * pSrcImage,
 		vx_uint32             srcImageStrideInBytes,
 		ago_affine_matrix_t * matrix,
-		vx_uint8			* pLocalData
+		vx_uint8			* pLocalData,
+		vx_uint32             dstRowStart,
+		vx_uint32             dstRowEnd
 	);
 int HafCpu_WarpAffine_U8_U8_Bilinear_Constant
 	(
@@ -2625,7 +2645,9 @@ int HafCpu_ScaleImage_U8_U8_Bilinear
 		vx_uint32            srcHeight,
 		vx_uint8           * pSrcImage,
 		vx_uint32            srcImageStrideInBytes,
-		ago_scale_matrix_t * matrix
+		ago_scale_matrix_t * matrix,
+		vx_uint32            dstRowStart,
+		vx_uint32            dstRowEnd
 	);
 int HafCpu_ScaleImage_U8_U8_Bilinear_Replicate
 	(
@@ -2685,14 +2707,18 @@ int HafCpu_OpticalFlowPyrLK_XY_XY_Generic
 
 int HafCpu_HarrisMergeSortAndPick_XY_HVC
 	(
-		vx_uint32         capacityOfDstCorner,
-		vx_keypoint_t     dstCorner[],
-		vx_uint32       * pDstCornerCount,
-		vx_uint32         srcWidth,
-		vx_uint32         srcHeight,
-		vx_float32      * pSrcVc,
-		vx_uint32         srcVcStrideInBytes,
-		vx_float32        min_distance
+		vx_uint32                  capacityOfDstCorner,
+		vx_keypoint_t              dstCorner[],
+		vx_uint32                * pDstCornerCount,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_float32               * pSrcVc,
+		vx_uint32                  srcVcStrideInBytes,
+		vx_float32                 min_distance,
+		vx_uint32                  capacityOfList,
+		ago_keypoint_xys_t       * list,
+		ago_harris_grid_header_t * gridInfo,
+		ago_coord2d_short_t      * gridBuf
 	);
 int HafCpu_FastCornerMerge_XY_XY
 	(
@@ -3117,4 +3143,105 @@ int HafCpu_LaplacianReconstruct_DATA_DATA_DATA
 	vx_image input,
 	vx_image output
 );
+
+int HafCpu_TensorAdd_DATA_DATA_DATA
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_enum          data_type,
+		vx_bool          saturate,
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc1,
+		const vx_size    src1Stride[],
+		const vx_uint8 * pSrc2,
+		const vx_size    src2Stride[]
+	);
+int HafCpu_TensorSubtract_DATA_DATA_DATA
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_enum          data_type,
+		vx_bool          saturate,
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc1,
+		const vx_size    src1Stride[],
+		const vx_uint8 * pSrc2,
+		const vx_size    src2Stride[]
+	);
+int HafCpu_TensorMultiply_DATA_DATA_DATA
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_enum          data_type,
+		vx_uint32        fixed_point_pos,
+		vx_float32       scale,
+		vx_bool          saturate,
+		vx_bool          roundToNearestEven,
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc1,
+		const vx_size    src1Stride[],
+		const vx_uint8 * pSrc2,
+		const vx_size    src2Stride[]
+	);
+int HafCpu_TensorTableLookup_DATA_DATA_DATA
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_enum          data_type,
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc,
+		const vx_size    srcStride[],
+		const vx_uint8 * pLut,
+		vx_uint32        lutCount,
+		vx_uint32        lutOffset
+	);
+int HafCpu_TensorTranspose_DATA_DATA
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_size          elementSize,
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc,
+		const vx_size    srcStride[],
+		vx_size          dimension1,
+		vx_size          dimension2
+	);
+int HafCpu_TensorConvertDepth_DATA_DATA
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		vx_enum          dst_data_type,
+		vx_uint32        dst_fixed_point_pos,
+		const vx_uint8 * pSrc,
+		const vx_size    srcStride[],
+		vx_enum          src_data_type,
+		vx_uint32        src_fixed_point_pos,
+		vx_bool          saturate,
+		vx_float32       norm,
+		vx_float32       offset
+	);
+int HafCpu_TensorMatrixMultiply_DATA_DATA_DATA
+	(
+		vx_enum          data_type,
+		vx_uint32        fixed_point_pos,
+		vx_size          M,
+		vx_size          N,
+		vx_size          K,
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc1,
+		const vx_size    src1Stride[],
+		const vx_uint8 * pSrc2,
+		const vx_size    src2Stride[],
+		const vx_uint8 * pSrc3,
+		const vx_size    src3Stride[],
+		vx_float32     * pScratch
+	);
 #endif // __ago_haf_cpu_h__
@@ -23,7 +23,8 @@ THE SOFTWARE.
 
 #include "ago_internal.h"
 
-int HafCpu_Add_U8_U8U8_Wrap
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Add_U8_U8U8_Wrap_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -35,8 +36,7 @@ int HafCpu_Add_U8_U8U8_Wrap
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc1_ymm, *pLocalSrc2_ymm, *pLocalDst_ymm;
 	vx_uint8 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
@@ -107,7 +107,118 @@ int HafCpu_Add_U8_U8U8_Wrap
 			pDstImage += dstImageStrideInBytes;
 		}
 	}
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+#if USE_AVX512
+static AGO_TARGET_AVX512 int HafCpu_Add_U8_U8U8_Wrap_AVX512
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x3F) == 0) ? true : false;
+
+	__m512i *pLocalSrc1_zmm, *pLocalSrc2_zmm, *pLocalDst_zmm;
+	vx_uint8 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
+	__m512i pixels1, pixels2;
+
+	int alignedWidth = dstWidth & ~63;
+	int postfixWidth = dstWidth - alignedWidth;
+
+	if (useAligned)
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 64)
+			{
+				pixels1 = _mm512_load_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_load_si512(pLocalSrc2_zmm++);
+				pixels1 = _mm512_add_epi8(pixels1, pixels2);
+				_mm512_store_si512(pLocalDst_zmm++, pixels1);
+			}
+
+			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_uint8 *)pLocalDst_zmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				vx_int16 temp = (vx_int16)(*pLocalSrc1++) + (vx_int16)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_uint8)temp;
+			}
+
+			pSrcImage1 += srcImage1StrideInBytes;
+			pSrcImage2 += srcImage2StrideInBytes;
+			pDstImage += dstImageStrideInBytes;
+		}
+	}
+	else
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 64)
+			{
+				pixels1 = _mm512_loadu_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_loadu_si512(pLocalSrc2_zmm++);
+				pixels1 = _mm512_add_epi8(pixels1, pixels2);
+				_mm512_storeu_si512(pLocalDst_zmm++, pixels1);
+			}
+
+			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_uint8 *)pLocalDst_zmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				vx_int16 temp = (vx_int16)(*pLocalSrc1++) + (vx_int16)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_uint8)temp;
+			}
+
+			pSrcImage1 += srcImage1StrideInBytes;
+			pSrcImage2 += srcImage2StrideInBytes;
+			pDstImage += dstImageStrideInBytes;
+		}
+	}
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Add_U8_U8U8_Wrap
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX512
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX512BW)
+		return HafCpu_Add_U8_U8U8_Wrap_AVX512(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Add_U8_U8U8_Wrap_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc1_xmm, *pLocalSrc2_xmm, *pLocalDst_xmm;
@@ -179,11 +290,11 @@ int HafCpu_Add_U8_U8U8_Wrap
 			pDstImage += dstImageStrideInBytes;
 		}
 	}
-#endif
 	return AGO_SUCCESS;
 }
 
-int HafCpu_Add_U8_U8U8_Sat
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Add_U8_U8U8_Sat_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -195,8 +306,7 @@ int HafCpu_Add_U8_U8U8_Sat
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc1_ymm, *pLocalSrc2_ymm, *pLocalDst_ymm;
 	vx_uint8 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
@@ -270,7 +380,121 @@ int HafCpu_Add_U8_U8U8_Sat
 		}
 	}
 
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+#if USE_AVX512
+static AGO_TARGET_AVX512 int HafCpu_Add_U8_U8U8_Sat_AVX512
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x3F) == 0) ? true : false;
+
+	__m512i *pLocalSrc1_zmm, *pLocalSrc2_zmm, *pLocalDst_zmm;
+	vx_uint8 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
+	__m512i pixels1, pixels2;
+
+	int alignedWidth = dstWidth & ~63;
+	int postfixWidth = dstWidth - alignedWidth;
+
+	if (useAligned)
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 64)
+			{
+				pixels1 = _mm512_load_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_load_si512(pLocalSrc2_zmm++);
+				pixels1 = _mm512_adds_epu8(pixels1, pixels2);
+				_mm512_store_si512(pLocalDst_zmm++, pixels1);
+			}
+
+			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_uint8 *)pLocalDst_zmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				int temp = (int)(*pLocalSrc1++) + (int)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_uint8)min(temp, UINT8_MAX);
+			}
+
+			pSrcImage1 += srcImage1StrideInBytes;
+			pSrcImage2 += srcImage2StrideInBytes;
+			pDstImage += dstImageStrideInBytes;
+		}
+	}
+	else
+	{
+		{
+			for (int height = 0; height < (int)dstHeight; height++)
+			{
+				pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+				pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+				pLocalDst_zmm = (__m512i*) pDstImage;
+
+				for (int width = 0; width < alignedWidth; width += 64)
+				{
+					pixels1 = _mm512_loadu_si512(pLocalSrc1_zmm++);
+					pixels2 = _mm512_loadu_si512(pLocalSrc2_zmm++);
+					pixels1 = _mm512_adds_epu8(pixels1, pixels2);
+					_mm512_storeu_si512(pLocalDst_zmm++, pixels1);
+				}
+
+				pLocalSrc1 = (vx_uint8 *)pLocalSrc1_zmm;
+				pLocalSrc2 = (vx_uint8 *)pLocalSrc2_zmm;
+				pLocalDst = (vx_uint8 *)pLocalDst_zmm;
+
+				for (int width = 0; width < postfixWidth; width++)
+				{
+					int temp = (int)(*pLocalSrc1++) + (int)(*pLocalSrc2++);
+					*pLocalDst++ = (vx_uint8)min(temp, UINT8_MAX);
+				}
+
+				pSrcImage1 += srcImage1StrideInBytes;
+				pSrcImage2 += srcImage2StrideInBytes;
+				pDstImage += dstImageStrideInBytes;
+			}
+		}
+	}
+
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Add_U8_U8U8_Sat
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX512
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX512BW)
+		return HafCpu_Add_U8_U8U8_Sat_AVX512(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Add_U8_U8U8_Sat_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc1_xmm, *pLocalSrc2_xmm, *pLocalDst_xmm;
@@ -344,12 +568,11 @@ int HafCpu_Add_U8_U8U8_Sat
 			}
 		}
 	}
-#endif
-	
 	return AGO_SUCCESS;
 }
 
-int HafCpu_Sub_U8_U8U8_Wrap
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Sub_U8_U8U8_Wrap_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -361,8 +584,7 @@ int HafCpu_Sub_U8_U8U8_Wrap
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc1_ymm, *pLocalSrc2_ymm, *pLocalDst_ymm;
 	vx_uint8 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
@@ -433,35 +655,51 @@ int HafCpu_Sub_U8_U8U8_Wrap
 			pDstImage += dstImageStrideInBytes;
 		}
 	}
-#else
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
+	return AGO_SUCCESS;
+}
+#endif
 
-	__m128i *pLocalSrc1_xmm, *pLocalSrc2_xmm, *pLocalDst_xmm;
+#if USE_AVX512
+static AGO_TARGET_AVX512 int HafCpu_Sub_U8_U8U8_Wrap_AVX512
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x3F) == 0) ? true : false;
+
+	__m512i *pLocalSrc1_zmm, *pLocalSrc2_zmm, *pLocalDst_zmm;
 	vx_uint8 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
-	__m128i pixels1, pixels2;
+	__m512i pixels1, pixels2;
 
-	int alignedWidth = dstWidth & ~15;
+	int alignedWidth = dstWidth & ~63;
 	int postfixWidth = dstWidth - alignedWidth;
 
 	if (useAligned)
 	{
 		for (int height = 0; height < (int)dstHeight; height++)
 		{
-			pLocalSrc1_xmm = (__m128i*) pSrcImage1;
-			pLocalSrc2_xmm = (__m128i*) pSrcImage2;
-			pLocalDst_xmm = (__m128i*) pDstImage;
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
 
-			for (int width = 0; width < alignedWidth; width += 16)
+			for (int width = 0; width < alignedWidth; width += 64)
 			{
-				pixels1 = _mm_load_si128(pLocalSrc1_xmm++);
-				pixels2 = _mm_load_si128(pLocalSrc2_xmm++);
-				pixels1 = _mm_sub_epi8(pixels1, pixels2);
-				_mm_store_si128(pLocalDst_xmm++, pixels1);
+				pixels1 = _mm512_load_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_load_si512(pLocalSrc2_zmm++);
+				pixels1 = _mm512_sub_epi8(pixels1, pixels2);
+				_mm512_store_si512(pLocalDst_zmm++, pixels1);
 			}
 
-			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_xmm;
-			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_xmm;
-			pLocalDst = (vx_uint8 *)pLocalDst_xmm;
+			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_uint8 *)pLocalDst_zmm;
 
 			for (int width = 0; width < postfixWidth; width++)
 			{
@@ -478,21 +716,21 @@ int HafCpu_Sub_U8_U8U8_Wrap
 	{
 		for (int height = 0; height < (int)dstHeight; height++)
 		{
-			pLocalSrc1_xmm = (__m128i*) pSrcImage1;
-			pLocalSrc2_xmm = (__m128i*) pSrcImage2;
-			pLocalDst_xmm = (__m128i*) pDstImage;
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
 
-			for (int width = 0; width < alignedWidth; width += 16)
+			for (int width = 0; width < alignedWidth; width += 64)
 			{
-				pixels1 = _mm_loadu_si128(pLocalSrc1_xmm++);
-				pixels2 = _mm_loadu_si128(pLocalSrc2_xmm++);
-				pixels1 = _mm_sub_epi8(pixels1, pixels2);
-				_mm_storeu_si128(pLocalDst_xmm++, pixels1);
+				pixels1 = _mm512_loadu_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_loadu_si512(pLocalSrc2_zmm++);
+				pixels1 = _mm512_sub_epi8(pixels1, pixels2);
+				_mm512_storeu_si512(pLocalDst_zmm++, pixels1);
 			}
 
-			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_xmm;
-			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_xmm;
-			pLocalDst = (vx_uint8 *)pLocalDst_xmm;
+			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_uint8 *)pLocalDst_zmm;
 
 			for (int width = 0; width < postfixWidth; width++)
 			{
@@ -505,11 +743,11 @@ int HafCpu_Sub_U8_U8U8_Wrap
 			pDstImage += dstImageStrideInBytes;
 		}
 	}
-#endif
 	return AGO_SUCCESS;
 }
+#endif
 
-int HafCpu_Sub_U8_U8U8_Sat
+int HafCpu_Sub_U8_U8U8_Wrap
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -521,40 +759,134 @@ int HafCpu_Sub_U8_U8U8_Sat
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
+#if USE_AVX512
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX512BW)
+		return HafCpu_Sub_U8_U8U8_Wrap_AVX512(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 #if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Sub_U8_U8U8_Wrap_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
-	__m256i *pLocalSrc1_ymm, *pLocalSrc2_ymm, *pLocalDst_ymm;
+	__m128i *pLocalSrc1_xmm, *pLocalSrc2_xmm, *pLocalDst_xmm;
 	vx_uint8 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
-	__m256i pixels1, pixels2;
+	__m128i pixels1, pixels2;
 
-	int alignedWidth = dstWidth & ~31;
+	int alignedWidth = dstWidth & ~15;
 	int postfixWidth = dstWidth - alignedWidth;
 
 	if (useAligned)
 	{
 		for (int height = 0; height < (int)dstHeight; height++)
 		{
-			pLocalSrc1_ymm = (__m256i*) pSrcImage1;
-			pLocalSrc2_ymm = (__m256i*) pSrcImage2;
-			pLocalDst_ymm = (__m256i*) pDstImage;
+			pLocalSrc1_xmm = (__m128i*) pSrcImage1;
+			pLocalSrc2_xmm = (__m128i*) pSrcImage2;
+			pLocalDst_xmm = (__m128i*) pDstImage;
 
-			for (int width = 0; width < alignedWidth; width += 32)
+			for (int width = 0; width < alignedWidth; width += 16)
 			{
-				pixels1 = _mm256_load_si256(pLocalSrc1_ymm++);
-				pixels2 = _mm256_load_si256(pLocalSrc2_ymm++);
-				pixels1 = _mm256_subs_epu8(pixels1, pixels2);
-				_mm256_store_si256(pLocalDst_ymm++, pixels1);
+				pixels1 = _mm_load_si128(pLocalSrc1_xmm++);
+				pixels2 = _mm_load_si128(pLocalSrc2_xmm++);
+				pixels1 = _mm_sub_epi8(pixels1, pixels2);
+				_mm_store_si128(pLocalDst_xmm++, pixels1);
 			}
 
-			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_ymm;
-			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_ymm;
-			pLocalDst = (vx_uint8 *)pLocalDst_ymm;
+			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_xmm;
+			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_xmm;
+			pLocalDst = (vx_uint8 *)pLocalDst_xmm;
 
 			for (int width = 0; width < postfixWidth; width++)
 			{
-				int temp = (int)(*pLocalSrc1++) - (int)(*pLocalSrc2++);
-				*pLocalDst++ = (vx_uint8)max(min(temp, UINT8_MAX), 0);
+				vx_int16 temp = (vx_int16)(*pLocalSrc1++) - (vx_int16)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_uint8)temp;
+			}
+
+			pSrcImage1 += srcImage1StrideInBytes;
+			pSrcImage2 += srcImage2StrideInBytes;
+			pDstImage += dstImageStrideInBytes;
+		}
+	}
+	else
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_xmm = (__m128i*) pSrcImage1;
+			pLocalSrc2_xmm = (__m128i*) pSrcImage2;
+			pLocalDst_xmm = (__m128i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 16)
+			{
+				pixels1 = _mm_loadu_si128(pLocalSrc1_xmm++);
+				pixels2 = _mm_loadu_si128(pLocalSrc2_xmm++);
+				pixels1 = _mm_sub_epi8(pixels1, pixels2);
+				_mm_storeu_si128(pLocalDst_xmm++, pixels1);
+			}
+
+			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_xmm;
+			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_xmm;
+			pLocalDst = (vx_uint8 *)pLocalDst_xmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				int temp = (int)(*pLocalSrc1++) - (int)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_uint8)temp;
+			}
+
+			pSrcImage1 += srcImage1StrideInBytes;
+			pSrcImage2 += srcImage2StrideInBytes;
+			pDstImage += dstImageStrideInBytes;
+		}
+	}
+	return AGO_SUCCESS;
+}
+
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Sub_U8_U8U8_Sat_AVX2
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
+
+	__m256i *pLocalSrc1_ymm, *pLocalSrc2_ymm, *pLocalDst_ymm;
+	vx_uint8 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
+	__m256i pixels1, pixels2;
+
+	int alignedWidth = dstWidth & ~31;
+	int postfixWidth = dstWidth - alignedWidth;
+
+	if (useAligned)
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_ymm = (__m256i*) pSrcImage1;
+			pLocalSrc2_ymm = (__m256i*) pSrcImage2;
+			pLocalDst_ymm = (__m256i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 32)
+			{
+				pixels1 = _mm256_load_si256(pLocalSrc1_ymm++);
+				pixels2 = _mm256_load_si256(pLocalSrc2_ymm++);
+				pixels1 = _mm256_subs_epu8(pixels1, pixels2);
+				_mm256_store_si256(pLocalDst_ymm++, pixels1);
+			}
+
+			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_ymm;
+			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_ymm;
+			pLocalDst = (vx_uint8 *)pLocalDst_ymm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				int temp = (int)(*pLocalSrc1++) - (int)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_uint8)max(min(temp, UINT8_MAX), 0);
 			}
 
 			pSrcImage1 += srcImage1StrideInBytes;
@@ -593,7 +925,118 @@ int HafCpu_Sub_U8_U8U8_Sat
 			pDstImage += dstImageStrideInBytes;
 		}
 	}
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+#if USE_AVX512
+static AGO_TARGET_AVX512 int HafCpu_Sub_U8_U8U8_Sat_AVX512
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x3F) == 0) ? true : false;
+
+	__m512i *pLocalSrc1_zmm, *pLocalSrc2_zmm, *pLocalDst_zmm;
+	vx_uint8 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
+	__m512i pixels1, pixels2;
+
+	int alignedWidth = dstWidth & ~63;
+	int postfixWidth = dstWidth - alignedWidth;
+
+	if (useAligned)
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 64)
+			{
+				pixels1 = _mm512_load_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_load_si512(pLocalSrc2_zmm++);
+				pixels1 = _mm512_subs_epu8(pixels1, pixels2);
+				_mm512_store_si512(pLocalDst_zmm++, pixels1);
+			}
+
+			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_uint8 *)pLocalDst_zmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				int temp = (int)(*pLocalSrc1++) - (int)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_uint8)max(min(temp, UINT8_MAX), 0);
+			}
+
+			pSrcImage1 += srcImage1StrideInBytes;
+			pSrcImage2 += srcImage2StrideInBytes;
+			pDstImage += dstImageStrideInBytes;
+		}
+	}
+	else
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 64)
+			{
+				pixels1 = _mm512_loadu_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_loadu_si512(pLocalSrc2_zmm++);
+				pixels1 = _mm512_subs_epu8(pixels1, pixels2);
+				_mm512_storeu_si512(pLocalDst_zmm++, pixels1);
+			}
+
+			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_uint8 *)pLocalDst_zmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				int temp = (int)(*pLocalSrc1++) - (int)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_uint8)max(min(temp, UINT8_MAX), 0);
+			}
+
+			pSrcImage1 += srcImage1StrideInBytes;
+			pSrcImage2 += srcImage2StrideInBytes;
+			pDstImage += dstImageStrideInBytes;
+		}
+	}
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Sub_U8_U8U8_Sat
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX512
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX512BW)
+		return HafCpu_Sub_U8_U8U8_Sat_AVX512(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Sub_U8_U8U8_Sat_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc1_xmm, *pLocalSrc2_xmm, *pLocalDst_xmm;
@@ -665,11 +1108,11 @@ int HafCpu_Sub_U8_U8U8_Sat
 			pDstImage += dstImageStrideInBytes;
 		}
 	}
-#endif	
 	return AGO_SUCCESS;
 }
 
-int HafCpu_Add_S16_U8U8
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Add_S16_U8U8_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -681,8 +1124,7 @@ int HafCpu_Add_S16_U8U8
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc1_ymm, *pLocalSrc2_ymm, *pLocalDst_ymm;
 	vx_uint8 *pLocalSrc1, *pLocalSrc2;
@@ -705,9 +1147,11 @@ int HafCpu_Add_S16_U8U8
 			for (int width = 0; width < alignedWidth; width += 32)
 			{
 				pixels1L = _mm256_load_si256(pLocalSrc1_ymm++);
+				pixels1L = _mm256_permute4x64_epi64(pixels1L, 0xD8);
 				pixels1H = _mm256_unpackhi_epi8(pixels1L, zeromask);
 				pixels1L = _mm256_unpacklo_epi8(pixels1L, zeromask);
 				pixels2L = _mm256_load_si256(pLocalSrc2_ymm++);
+				pixels2L = _mm256_permute4x64_epi64(pixels2L, 0xD8);
 				pixels2H = _mm256_unpackhi_epi8(pixels2L, zeromask);
 				pixels2L = _mm256_unpacklo_epi8(pixels2L, zeromask);
 				pixels1L = _mm256_add_epi16(pixels1L, pixels2L);
@@ -742,9 +1186,11 @@ int HafCpu_Add_S16_U8U8
 				for (int width = 0; width < alignedWidth; width += 32)
 				{
 					pixels1L = _mm256_loadu_si256(pLocalSrc1_ymm++);
+					pixels1L = _mm256_permute4x64_epi64(pixels1L, 0xD8);
 					pixels1H = _mm256_unpackhi_epi8(pixels1L, zeromask);
 					pixels1L = _mm256_unpacklo_epi8(pixels1L, zeromask);
 					pixels2L = _mm256_loadu_si256(pLocalSrc2_ymm++);
+					pixels2L = _mm256_permute4x64_epi64(pixels2L, 0xD8);
 					pixels2H = _mm256_unpackhi_epi8(pixels2L, zeromask);
 					pixels2L = _mm256_unpacklo_epi8(pixels2L, zeromask);
 					pixels1L = _mm256_add_epi16(pixels1L, pixels2L);
@@ -769,7 +1215,26 @@ int HafCpu_Add_S16_U8U8
 		}
 	}
 
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Add_S16_U8U8
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Add_S16_U8U8_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc1_xmm, *pLocalSrc2_xmm, *pLocalDst_xmm;
@@ -856,11 +1321,11 @@ int HafCpu_Add_S16_U8U8
 			}
 		}
 	}
-#endif	
 	return AGO_SUCCESS;
 }
 
-int HafCpu_Sub_S16_U8U8
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Sub_S16_U8U8_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -872,8 +1337,7 @@ int HafCpu_Sub_S16_U8U8
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc1_ymm, *pLocalSrc2_ymm, *pLocalDst_ymm;
 	vx_uint8 *pLocalSrc1, *pLocalSrc2;
@@ -896,9 +1360,11 @@ int HafCpu_Sub_S16_U8U8
 			for (int width = 0; width < alignedWidth; width += 32)
 			{
 				pixels1L = _mm256_load_si256(pLocalSrc1_ymm++);
+				pixels1L = _mm256_permute4x64_epi64(pixels1L, 0xD8);
 				pixels1H = _mm256_unpackhi_epi8(pixels1L, zeromask);
 				pixels1L = _mm256_unpacklo_epi8(pixels1L, zeromask);
 				pixels2L = _mm256_load_si256(pLocalSrc2_ymm++);
+				pixels2L = _mm256_permute4x64_epi64(pixels2L, 0xD8);
 				pixels2H = _mm256_unpackhi_epi8(pixels2L, zeromask);
 				pixels2L = _mm256_unpacklo_epi8(pixels2L, zeromask);
 				pixels1L = _mm256_sub_epi16(pixels1L, pixels2L);
@@ -932,9 +1398,11 @@ int HafCpu_Sub_S16_U8U8
 			for (int width = 0; width < alignedWidth; width += 32)
 			{
 				pixels1L = _mm256_loadu_si256(pLocalSrc1_ymm++);
+				pixels1L = _mm256_permute4x64_epi64(pixels1L, 0xD8);
 				pixels1H = _mm256_unpackhi_epi8(pixels1L, zeromask);
 				pixels1L = _mm256_unpacklo_epi8(pixels1L, zeromask);
 				pixels2L = _mm256_loadu_si256(pLocalSrc2_ymm++);
+				pixels2L = _mm256_permute4x64_epi64(pixels2L, 0xD8);
 				pixels2H = _mm256_unpackhi_epi8(pixels2L, zeromask);
 				pixels2L = _mm256_unpacklo_epi8(pixels2L, zeromask);
 				pixels1L = _mm256_sub_epi16(pixels1L, pixels2L);
@@ -958,7 +1426,26 @@ int HafCpu_Sub_S16_U8U8
 		}
 	}
 
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Sub_S16_U8U8
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Sub_S16_U8U8_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc1_xmm, *pLocalSrc2_xmm, *pLocalDst_xmm;
@@ -1043,11 +1530,11 @@ int HafCpu_Sub_S16_U8U8
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#endif
 	return AGO_SUCCESS;
 }
 
-int HafCpu_Add_S16_S16U8_Wrap
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Add_S16_S16U8_Wrap_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -1059,8 +1546,7 @@ int HafCpu_Add_S16_S16U8_Wrap
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc16_ymm, *pLocalSrc8_ymm, *pLocalDst_ymm;
 	vx_uint8 *pLocalSrc8;
@@ -1072,7 +1558,7 @@ int HafCpu_Add_S16_S16U8_Wrap
 	int alignedWidth = dstWidth & ~31;
 	int postfixWidth = dstWidth - alignedWidth;
 
-	if (alignedWidth)
+	if (useAligned)
 	{
 		for (int height = 0; height < (int)dstHeight; height++)
 		{
@@ -1085,6 +1571,7 @@ int HafCpu_Add_S16_S16U8_Wrap
 				pixels1L = _mm256_load_si256(pLocalSrc16_ymm++);
 				pixels1H = _mm256_load_si256(pLocalSrc16_ymm++);;
 				pixels2L = _mm256_load_si256(pLocalSrc8_ymm++);
+				pixels2L = _mm256_permute4x64_epi64(pixels2L, 0xD8);
 				pixels2H = _mm256_unpackhi_epi8(pixels2L, zeromask);
 				pixels2L = _mm256_unpacklo_epi8(pixels2L, zeromask);
 				pixels1L = _mm256_add_epi16(pixels1L, pixels2L);
@@ -1120,6 +1607,7 @@ int HafCpu_Add_S16_S16U8_Wrap
 				pixels1L = _mm256_loadu_si256(pLocalSrc16_ymm++);
 				pixels1H = _mm256_loadu_si256(pLocalSrc16_ymm++);;
 				pixels2L = _mm256_loadu_si256(pLocalSrc8_ymm++);
+				pixels2L = _mm256_permute4x64_epi64(pixels2L, 0xD8);
 				pixels2H = _mm256_unpackhi_epi8(pixels2L, zeromask);
 				pixels2L = _mm256_unpacklo_epi8(pixels2L, zeromask);
 				pixels1L = _mm256_add_epi16(pixels1L, pixels2L);
@@ -1142,7 +1630,26 @@ int HafCpu_Add_S16_S16U8_Wrap
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#else	
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Add_S16_S16U8_Wrap
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_int16    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Add_S16_S16U8_Wrap_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc16_xmm, *pLocalSrc8_xmm, *pLocalDst_xmm;
@@ -1155,7 +1662,7 @@ int HafCpu_Add_S16_S16U8_Wrap
 	int alignedWidth = dstWidth & ~15;
 	int postfixWidth = dstWidth - alignedWidth;
 
-	if (alignedWidth)
+	if (useAligned)
 	{
 		for (int height = 0; height < (int)dstHeight; height++)
 		{
@@ -1225,11 +1732,11 @@ int HafCpu_Add_S16_S16U8_Wrap
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#endif
 	return AGO_SUCCESS;
 }
 
-int HafCpu_Add_S16_S16U8_Sat
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Add_S16_S16U8_Sat_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -1241,8 +1748,7 @@ int HafCpu_Add_S16_S16U8_Sat
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc16_ymm, *pLocalSrc8_ymm, *pLocalDst_ymm;
 	vx_uint8 *pLocalSrc8;
@@ -1267,6 +1773,7 @@ int HafCpu_Add_S16_S16U8_Sat
 				pixels1L = _mm256_load_si256(pLocalSrc16_ymm++);
 				pixels1H = _mm256_load_si256(pLocalSrc16_ymm++);;
 				pixels2L = _mm256_load_si256(pLocalSrc8_ymm++);
+				pixels2L = _mm256_permute4x64_epi64(pixels2L, 0xD8);
 				pixels2H = _mm256_unpackhi_epi8(pixels2L, zeromask);
 				pixels2L = _mm256_unpacklo_epi8(pixels2L, zeromask);
 				pixels1L = _mm256_adds_epi16(pixels1L, pixels2L);
@@ -1303,6 +1810,7 @@ int HafCpu_Add_S16_S16U8_Sat
 				pixels1L = _mm256_loadu_si256(pLocalSrc16_ymm++);
 				pixels1H = _mm256_loadu_si256(pLocalSrc16_ymm++);;
 				pixels2L = _mm256_loadu_si256(pLocalSrc8_ymm++);
+				pixels2L = _mm256_permute4x64_epi64(pixels2L, 0xD8);
 				pixels2H = _mm256_unpackhi_epi8(pixels2L, zeromask);
 				pixels2L = _mm256_unpacklo_epi8(pixels2L, zeromask);
 				pixels1L = _mm256_adds_epi16(pixels1L, pixels2L);
@@ -1326,7 +1834,26 @@ int HafCpu_Add_S16_S16U8_Sat
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Add_S16_S16U8_Sat
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_int16    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Add_S16_S16U8_Sat_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc16_xmm, *pLocalSrc8_xmm, *pLocalDst_xmm;
@@ -1411,11 +1938,11 @@ int HafCpu_Add_S16_S16U8_Sat
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#endif
 	return AGO_SUCCESS;
 }
 
-int HafCpu_Sub_S16_S16U8_Wrap
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Sub_S16_S16U8_Wrap_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -1427,8 +1954,7 @@ int HafCpu_Sub_S16_S16U8_Wrap
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc16_ymm, *pLocalSrc8_ymm, *pLocalDst_ymm;
 	vx_uint8 *pLocalSrc8;
@@ -1453,6 +1979,7 @@ int HafCpu_Sub_S16_S16U8_Wrap
 				pixels1L = _mm256_load_si256(pLocalSrc16_ymm++);
 				pixels1H = _mm256_load_si256(pLocalSrc16_ymm++);;
 				pixels2L = _mm256_load_si256(pLocalSrc8_ymm++);
+				pixels2L = _mm256_permute4x64_epi64(pixels2L, 0xD8);
 				pixels2H = _mm256_unpackhi_epi8(pixels2L, zeromask);
 				pixels2L = _mm256_unpacklo_epi8(pixels2L, zeromask);
 				pixels1L = _mm256_sub_epi16(pixels1L, pixels2L);
@@ -1489,6 +2016,7 @@ int HafCpu_Sub_S16_S16U8_Wrap
 				pixels1L = _mm256_loadu_si256(pLocalSrc16_ymm++);
 				pixels1H = _mm256_loadu_si256(pLocalSrc16_ymm++);;
 				pixels2L = _mm256_loadu_si256(pLocalSrc8_ymm++);
+				pixels2L = _mm256_permute4x64_epi64(pixels2L, 0xD8);
 				pixels2H = _mm256_unpackhi_epi8(pixels2L, zeromask);
 				pixels2L = _mm256_unpacklo_epi8(pixels2L, zeromask);
 				pixels1L = _mm256_sub_epi16(pixels1L, pixels2L);
@@ -1512,7 +2040,26 @@ int HafCpu_Sub_S16_S16U8_Wrap
 
 		}
 	}
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Sub_S16_S16U8_Wrap
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_int16    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Sub_S16_S16U8_Wrap_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc16_xmm, *pLocalSrc8_xmm, *pLocalDst_xmm;
@@ -1597,11 +2144,11 @@ int HafCpu_Sub_S16_S16U8_Wrap
 
 		}
 	}
-#endif
 	return AGO_SUCCESS;
 }
 
-int HafCpu_Sub_S16_S16U8_Sat
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Sub_S16_S16U8_Sat_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -1613,8 +2160,7 @@ int HafCpu_Sub_S16_S16U8_Sat
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc16_ymm, *pLocalSrc8_ymm, *pLocalDst_ymm;
 	vx_uint8 *pLocalSrc8;
@@ -1639,6 +2185,7 @@ int HafCpu_Sub_S16_S16U8_Sat
 				pixels1L = _mm256_load_si256(pLocalSrc16_ymm++);
 				pixels1H = _mm256_load_si256(pLocalSrc16_ymm++);;
 				pixels2L = _mm256_load_si256(pLocalSrc8_ymm++);
+				pixels2L = _mm256_permute4x64_epi64(pixels2L, 0xD8);
 				pixels2H = _mm256_unpackhi_epi8(pixels2L, zeromask);
 				pixels2L = _mm256_unpacklo_epi8(pixels2L, zeromask);
 				pixels1L = _mm256_subs_epi16(pixels1L, pixels2L);
@@ -1675,6 +2222,7 @@ int HafCpu_Sub_S16_S16U8_Sat
 				pixels1L = _mm256_loadu_si256(pLocalSrc16_ymm++);
 				pixels1H = _mm256_loadu_si256(pLocalSrc16_ymm++);;
 				pixels2L = _mm256_loadu_si256(pLocalSrc8_ymm++);
+				pixels2L = _mm256_permute4x64_epi64(pixels2L, 0xD8);
 				pixels2H = _mm256_unpackhi_epi8(pixels2L, zeromask);
 				pixels2L = _mm256_unpacklo_epi8(pixels2L, zeromask);
 				pixels1L = _mm256_subs_epi16(pixels1L, pixels2L);
@@ -1698,7 +2246,26 @@ int HafCpu_Sub_S16_S16U8_Sat
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Sub_S16_S16U8_Sat
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_int16    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Sub_S16_S16U8_Sat_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc16_xmm, *pLocalSrc8_xmm, *pLocalDst_xmm;
@@ -1783,11 +2350,11 @@ int HafCpu_Sub_S16_S16U8_Sat
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#endif
 	return AGO_SUCCESS;
 }
 
-int HafCpu_Sub_S16_U8S16_Wrap
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Sub_S16_U8S16_Wrap_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -1799,8 +2366,7 @@ int HafCpu_Sub_S16_U8S16_Wrap
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc16_ymm, *pLocalSrc8_ymm, *pLocalDst_ymm;
 	vx_uint8 *pLocalSrc8;
@@ -1823,6 +2389,7 @@ int HafCpu_Sub_S16_U8S16_Wrap
 			for (int width = 0; width < alignedWidth; width += 32)
 			{
 				pixels1L = _mm256_load_si256(pLocalSrc8_ymm++);
+				pixels1L = _mm256_permute4x64_epi64(pixels1L, 0xD8);
 				pixels1H = _mm256_unpackhi_epi8(pixels1L, zeromask);
 				pixels1L = _mm256_unpacklo_epi8(pixels1L, zeromask);
 				pixels2L = _mm256_load_si256(pLocalSrc16_ymm++);
@@ -1858,8 +2425,9 @@ int HafCpu_Sub_S16_U8S16_Wrap
 			for (int width = 0; width < alignedWidth; width += 32)
 			{
 				pixels1L = _mm256_loadu_si256(pLocalSrc8_ymm++);
+				pixels1L = _mm256_permute4x64_epi64(pixels1L, 0xD8);
 				pixels1H = _mm256_unpackhi_epi8(pixels1L, zeromask);
-				pixels1L = _mm256_unpacklo_epi16(pixels1L, zeromask);
+				pixels1L = _mm256_unpacklo_epi8(pixels1L, zeromask);
 				pixels2L = _mm256_loadu_si256(pLocalSrc16_ymm++);
 				pixels2H = _mm256_loadu_si256(pLocalSrc16_ymm++);;
 				pixels1L = _mm256_sub_epi16(pixels1L, pixels2L);
@@ -1882,7 +2450,26 @@ int HafCpu_Sub_S16_U8S16_Wrap
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Sub_S16_U8S16_Wrap
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_int16    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Sub_S16_U8S16_Wrap_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc16_xmm, *pLocalSrc8_xmm, *pLocalDst_xmm;
@@ -1965,11 +2552,11 @@ int HafCpu_Sub_S16_U8S16_Wrap
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#endif
 	return AGO_SUCCESS;
 }
 
-int HafCpu_Sub_S16_U8S16_Sat
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Sub_S16_U8S16_Sat_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -1981,8 +2568,7 @@ int HafCpu_Sub_S16_U8S16_Sat
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc16_ymm, *pLocalSrc8_ymm, *pLocalDst_ymm;
 	vx_uint8 *pLocalSrc8;
@@ -2005,6 +2591,7 @@ int HafCpu_Sub_S16_U8S16_Sat
 			for (int width = 0; width < alignedWidth; width += 32)
 			{
 				pixels1L = _mm256_load_si256(pLocalSrc8_ymm++);
+				pixels1L = _mm256_permute4x64_epi64(pixels1L, 0xD8);
 				pixels1H = _mm256_unpackhi_epi8(pixels1L, zeromask);
 				pixels1L = _mm256_unpacklo_epi8(pixels1L, zeromask);
 				pixels2L = _mm256_load_si256(pLocalSrc16_ymm++);
@@ -2041,6 +2628,7 @@ int HafCpu_Sub_S16_U8S16_Sat
 			for (int width = 0; width < alignedWidth; width += 32)
 			{
 				pixels1L = _mm256_loadu_si256(pLocalSrc8_ymm++);
+				pixels1L = _mm256_permute4x64_epi64(pixels1L, 0xD8);
 				pixels1H = _mm256_unpackhi_epi8(pixels1L, zeromask);
 				pixels1L = _mm256_unpacklo_epi8(pixels1L, zeromask);
 				pixels2L = _mm256_loadu_si256(pLocalSrc16_ymm++);
@@ -2066,7 +2654,26 @@ int HafCpu_Sub_S16_U8S16_Sat
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Sub_S16_U8S16_Sat
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_int16    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Sub_S16_U8S16_Sat_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc16_xmm, *pLocalSrc8_xmm, *pLocalDst_xmm;
@@ -2151,11 +2758,11 @@ int HafCpu_Sub_S16_U8S16_Sat
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#endif
 	return AGO_SUCCESS;
 }
 
-int HafCpu_Add_S16_S16S16_Wrap
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Add_S16_S16S16_Wrap_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -2167,8 +2774,7 @@ int HafCpu_Add_S16_S16S16_Wrap
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc1_ymm, *pLocalSrc2_ymm, *pLocalDst_ymm;
 	vx_int16 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
@@ -2253,7 +2859,132 @@ int HafCpu_Add_S16_S16S16_Wrap
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+#if USE_AVX512
+static AGO_TARGET_AVX512 int HafCpu_Add_S16_S16S16_Wrap_AVX512
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_int16    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_int16    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x3F) == 0) ? true : false;
+
+	__m512i *pLocalSrc1_zmm, *pLocalSrc2_zmm, *pLocalDst_zmm;
+	vx_int16 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
+
+	__m512i pixels1, pixels2, pixels3, pixels4;
+	__m512i zeromask = _mm512_setzero_si512();
+
+	int alignedWidth = dstWidth & ~63;
+	int postfixWidth = dstWidth - alignedWidth;
+
+	if (useAligned)
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 64)
+			{
+				pixels1 = _mm512_load_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_load_si512(pLocalSrc1_zmm++);
+				pixels3 = _mm512_load_si512(pLocalSrc2_zmm++);
+				pixels4 = _mm512_load_si512(pLocalSrc2_zmm++);
+
+				pixels1 = _mm512_add_epi16(pixels1, pixels3);
+				pixels2 = _mm512_add_epi16(pixels2, pixels4);
+
+				_mm512_store_si512(pLocalDst_zmm++, pixels1);
+				_mm512_store_si512(pLocalDst_zmm++, pixels2);
+			}
+
+			pLocalSrc1 = (vx_int16 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_int16 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_int16 *)pLocalDst_zmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				vx_int32 temp = (vx_int32)(*pLocalSrc1++) + (vx_int32)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_int16)temp;
+			}
+
+			pSrcImage1 += (srcImage1StrideInBytes >> 1);
+			pSrcImage2 += (srcImage2StrideInBytes >> 1);
+			pDstImage += (dstImageStrideInBytes >> 1);
+		}
+	}
+	else
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 64)
+			{
+				pixels1 = _mm512_loadu_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_loadu_si512(pLocalSrc1_zmm++);
+				pixels3 = _mm512_loadu_si512(pLocalSrc2_zmm++);
+				pixels4 = _mm512_loadu_si512(pLocalSrc2_zmm++);
+
+				pixels1 = _mm512_add_epi16(pixels1, pixels3);
+				pixels2 = _mm512_add_epi16(pixels2, pixels4);
+
+				_mm512_storeu_si512(pLocalDst_zmm++, pixels1);
+				_mm512_storeu_si512(pLocalDst_zmm++, pixels2);
+			}
+
+			pLocalSrc1 = (vx_int16 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_int16 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_int16 *)pLocalDst_zmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				vx_int32 temp = (vx_int32)(*pLocalSrc1++) + (vx_int32)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_int16)temp;
+			}
+
+			pSrcImage1 += (srcImage1StrideInBytes >> 1);
+			pSrcImage2 += (srcImage2StrideInBytes >> 1);
+			pDstImage += (dstImageStrideInBytes >> 1);
+		}
+	}
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Add_S16_S16S16_Wrap
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_int16    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_int16    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX512
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX512BW)
+		return HafCpu_Add_S16_S16S16_Wrap_AVX512(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Add_S16_S16S16_Wrap_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc1_xmm, *pLocalSrc2_xmm, *pLocalDst_xmm;
@@ -2339,11 +3070,11 @@ int HafCpu_Add_S16_S16S16_Wrap
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#endif
 	return AGO_SUCCESS;
 }
 
-int HafCpu_Add_S16_S16S16_Sat
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Add_S16_S16S16_Sat_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -2355,8 +3086,7 @@ int HafCpu_Add_S16_S16S16_Sat
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc1_ymm, *pLocalSrc2_ymm, *pLocalDst_ymm;
 	vx_int16 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
@@ -2441,7 +3171,132 @@ int HafCpu_Add_S16_S16S16_Sat
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+#if USE_AVX512
+static AGO_TARGET_AVX512 int HafCpu_Add_S16_S16S16_Sat_AVX512
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_int16    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_int16    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x3F) == 0) ? true : false;
+
+	__m512i *pLocalSrc1_zmm, *pLocalSrc2_zmm, *pLocalDst_zmm;
+	vx_int16 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
+
+	__m512i pixels1, pixels2, pixels3, pixels4;
+	__m512i zeromask = _mm512_setzero_si512();
+
+	int alignedWidth = dstWidth & ~63;
+	int postfixWidth = dstWidth - alignedWidth;
+
+	if (useAligned)
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 64)
+			{
+				pixels1 = _mm512_load_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_load_si512(pLocalSrc1_zmm++);
+				pixels3 = _mm512_load_si512(pLocalSrc2_zmm++);
+				pixels4 = _mm512_load_si512(pLocalSrc2_zmm++);
+
+				pixels1 = _mm512_adds_epi16(pixels1, pixels3);
+				pixels2 = _mm512_adds_epi16(pixels2, pixels4);
+
+				_mm512_store_si512(pLocalDst_zmm++, pixels1);
+				_mm512_store_si512(pLocalDst_zmm++, pixels2);
+			}
+
+			pLocalSrc1 = (vx_int16 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_int16 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_int16 *)pLocalDst_zmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				vx_int32 temp = (vx_int32)(*pLocalSrc1++) + (vx_int32)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_int16)max(min(temp, INT16_MAX), INT16_MIN);
+			}
+
+			pSrcImage1 += (srcImage1StrideInBytes >> 1);
+			pSrcImage2 += (srcImage2StrideInBytes >> 1);
+			pDstImage += (dstImageStrideInBytes >> 1);
+		}
+	}
+	else
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 64)
+			{
+				pixels1 = _mm512_loadu_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_loadu_si512(pLocalSrc1_zmm++);
+				pixels3 = _mm512_loadu_si512(pLocalSrc2_zmm++);
+				pixels4 = _mm512_loadu_si512(pLocalSrc2_zmm++);
+
+				pixels1 = _mm512_adds_epi16(pixels1, pixels3);
+				pixels2 = _mm512_adds_epi16(pixels2, pixels4);
+
+				_mm512_storeu_si512(pLocalDst_zmm++, pixels1);
+				_mm512_storeu_si512(pLocalDst_zmm++, pixels2);
+			}
+
+			pLocalSrc1 = (vx_int16 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_int16 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_int16 *)pLocalDst_zmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				vx_int32 temp = (vx_int32)(*pLocalSrc1++) + (vx_int32)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_int16)max(min(temp, INT16_MAX), INT16_MIN);
+			}
+
+			pSrcImage1 += (srcImage1StrideInBytes >> 1);
+			pSrcImage2 += (srcImage2StrideInBytes >> 1);
+			pDstImage += (dstImageStrideInBytes >> 1);
+		}
+	}
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Add_S16_S16S16_Sat
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_int16    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_int16    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX512
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX512BW)
+		return HafCpu_Add_S16_S16S16_Sat_AVX512(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Add_S16_S16S16_Sat_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc1_xmm, *pLocalSrc2_xmm, *pLocalDst_xmm;
@@ -2505,21 +3360,122 @@ int HafCpu_Add_S16_S16S16_Sat
 				pixels3 = _mm_loadu_si128(pLocalSrc2_xmm++);
 				pixels4 = _mm_loadu_si128(pLocalSrc2_xmm++);
 
-				pixels1 = _mm_adds_epi16(pixels1, pixels3);
-				pixels2 = _mm_adds_epi16(pixels2, pixels4);
+				pixels1 = _mm_adds_epi16(pixels1, pixels3);
+				pixels2 = _mm_adds_epi16(pixels2, pixels4);
+
+				_mm_storeu_si128(pLocalDst_xmm++, pixels1);
+				_mm_storeu_si128(pLocalDst_xmm++, pixels2);
+			}
+
+			pLocalSrc1 = (vx_int16 *)pLocalSrc1_xmm;
+			pLocalSrc2 = (vx_int16 *)pLocalSrc2_xmm;
+			pLocalDst = (vx_int16 *)pLocalDst_xmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				vx_int32 temp = (vx_int32)(*pLocalSrc1++) + (vx_int32)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_int16)max(min(temp, INT16_MAX), INT16_MIN);
+			}
+
+			pSrcImage1 += (srcImage1StrideInBytes >> 1);
+			pSrcImage2 += (srcImage2StrideInBytes >> 1);
+			pDstImage += (dstImageStrideInBytes >> 1);
+		}
+	}
+	return AGO_SUCCESS;
+}
+
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Sub_S16_S16S16_Wrap_AVX2
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_int16    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_int16    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
+
+	__m256i *pLocalSrc1_ymm, *pLocalSrc2_ymm, *pLocalDst_ymm;
+	vx_int16 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
+
+	__m256i pixels1, pixels2, pixels3, pixels4;
+	__m256i zeromask = _mm256_setzero_si256();
+
+	int alignedWidth = dstWidth & ~31;
+	int postfixWidth = dstWidth - alignedWidth;
+
+	if (useAligned)
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_ymm = (__m256i*) pSrcImage1;
+			pLocalSrc2_ymm = (__m256i*) pSrcImage2;
+			pLocalDst_ymm = (__m256i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 32)
+			{
+				pixels1 = _mm256_load_si256(pLocalSrc1_ymm++);
+				pixels2 = _mm256_load_si256(pLocalSrc1_ymm++);
+				pixels3 = _mm256_load_si256(pLocalSrc2_ymm++);
+				pixels4 = _mm256_load_si256(pLocalSrc2_ymm++);
+
+				pixels1 = _mm256_sub_epi16(pixels1, pixels3);
+				pixels2 = _mm256_sub_epi16(pixels2, pixels4);
+
+				_mm256_store_si256(pLocalDst_ymm++, pixels1);
+				_mm256_store_si256(pLocalDst_ymm++, pixels2);
+			}
+
+			pLocalSrc1 = (vx_int16 *)pLocalSrc1_ymm;
+			pLocalSrc2 = (vx_int16 *)pLocalSrc2_ymm;
+			pLocalDst = (vx_int16 *)pLocalDst_ymm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				vx_int32 temp = (vx_int32)(*pLocalSrc1++) - (vx_int32)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_int16)temp;
+			}
+
+			pSrcImage1 += (srcImage1StrideInBytes >> 1);
+			pSrcImage2 += (srcImage2StrideInBytes >> 1);
+			pDstImage += (dstImageStrideInBytes >> 1);
+		}
+	}
+	else
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_ymm = (__m256i*) pSrcImage1;
+			pLocalSrc2_ymm = (__m256i*) pSrcImage2;
+			pLocalDst_ymm = (__m256i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 32)
+			{
+				pixels1 = _mm256_loadu_si256(pLocalSrc1_ymm++);
+				pixels2 = _mm256_loadu_si256(pLocalSrc1_ymm++);
+				pixels3 = _mm256_loadu_si256(pLocalSrc2_ymm++);
+				pixels4 = _mm256_loadu_si256(pLocalSrc2_ymm++);
+
+				pixels1 = _mm256_sub_epi16(pixels1, pixels3);
+				pixels2 = _mm256_sub_epi16(pixels2, pixels4);
 
-				_mm_storeu_si128(pLocalDst_xmm++, pixels1);
-				_mm_storeu_si128(pLocalDst_xmm++, pixels2);
+				_mm256_storeu_si256(pLocalDst_ymm++, pixels1);
+				_mm256_storeu_si256(pLocalDst_ymm++, pixels2);
 			}
 
-			pLocalSrc1 = (vx_int16 *)pLocalSrc1_xmm;
-			pLocalSrc2 = (vx_int16 *)pLocalSrc2_xmm;
-			pLocalDst = (vx_int16 *)pLocalDst_xmm;
+			pLocalSrc1 = (vx_int16 *)pLocalSrc1_ymm;
+			pLocalSrc2 = (vx_int16 *)pLocalSrc2_ymm;
+			pLocalDst = (vx_int16 *)pLocalDst_ymm;
 
 			for (int width = 0; width < postfixWidth; width++)
 			{
-				vx_int32 temp = (vx_int32)(*pLocalSrc1++) + (vx_int32)(*pLocalSrc2++);
-				*pLocalDst++ = (vx_int16)max(min(temp, INT16_MAX), INT16_MIN);
+				vx_int32 temp = (vx_int32)(*pLocalSrc1++) - (vx_int32)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_int16)temp;
 			}
 
 			pSrcImage1 += (srcImage1StrideInBytes >> 1);
@@ -2527,11 +3483,12 @@ int HafCpu_Add_S16_S16S16_Sat
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#endif
 	return AGO_SUCCESS;
 }
+#endif
 
-int HafCpu_Sub_S16_S16S16_Wrap
+#if USE_AVX512
+static AGO_TARGET_AVX512 int HafCpu_Sub_S16_S16S16_Wrap_AVX512
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -2543,43 +3500,42 @@ int HafCpu_Sub_S16_S16S16_Wrap
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x3F) == 0) ? true : false;
 
-	__m256i *pLocalSrc1_ymm, *pLocalSrc2_ymm, *pLocalDst_ymm;
+	__m512i *pLocalSrc1_zmm, *pLocalSrc2_zmm, *pLocalDst_zmm;
 	vx_int16 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
 
-	__m256i pixels1, pixels2, pixels3, pixels4;
-	__m256i zeromask = _mm256_setzero_si256();
+	__m512i pixels1, pixels2, pixels3, pixels4;
+	__m512i zeromask = _mm512_setzero_si512();
 
-	int alignedWidth = dstWidth & ~31;
+	int alignedWidth = dstWidth & ~63;
 	int postfixWidth = dstWidth - alignedWidth;
 
 	if (useAligned)
 	{
 		for (int height = 0; height < (int)dstHeight; height++)
 		{
-			pLocalSrc1_ymm = (__m256i*) pSrcImage1;
-			pLocalSrc2_ymm = (__m256i*) pSrcImage2;
-			pLocalDst_ymm = (__m256i*) pDstImage;
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
 
-			for (int width = 0; width < alignedWidth; width += 32)
+			for (int width = 0; width < alignedWidth; width += 64)
 			{
-				pixels1 = _mm256_load_si256(pLocalSrc1_ymm++);
-				pixels2 = _mm256_load_si256(pLocalSrc1_ymm++);
-				pixels3 = _mm256_load_si256(pLocalSrc2_ymm++);
-				pixels4 = _mm256_load_si256(pLocalSrc2_ymm++);
+				pixels1 = _mm512_load_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_load_si512(pLocalSrc1_zmm++);
+				pixels3 = _mm512_load_si512(pLocalSrc2_zmm++);
+				pixels4 = _mm512_load_si512(pLocalSrc2_zmm++);
 
-				pixels1 = _mm256_sub_epi16(pixels1, pixels3);
-				pixels2 = _mm256_sub_epi16(pixels2, pixels4);
+				pixels1 = _mm512_sub_epi16(pixels1, pixels3);
+				pixels2 = _mm512_sub_epi16(pixels2, pixels4);
 
-				_mm256_store_si256(pLocalDst_ymm++, pixels1);
-				_mm256_store_si256(pLocalDst_ymm++, pixels2);
+				_mm512_store_si512(pLocalDst_zmm++, pixels1);
+				_mm512_store_si512(pLocalDst_zmm++, pixels2);
 			}
 
-			pLocalSrc1 = (vx_int16 *)pLocalSrc1_ymm;
-			pLocalSrc2 = (vx_int16 *)pLocalSrc2_ymm;
-			pLocalDst = (vx_int16 *)pLocalDst_ymm;
+			pLocalSrc1 = (vx_int16 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_int16 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_int16 *)pLocalDst_zmm;
 
 			for (int width = 0; width < postfixWidth; width++)
 			{
@@ -2596,27 +3552,27 @@ int HafCpu_Sub_S16_S16S16_Wrap
 	{
 		for (int height = 0; height < (int)dstHeight; height++)
 		{
-			pLocalSrc1_ymm = (__m256i*) pSrcImage1;
-			pLocalSrc2_ymm = (__m256i*) pSrcImage2;
-			pLocalDst_ymm = (__m256i*) pDstImage;
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
 
-			for (int width = 0; width < alignedWidth; width += 16)
+			for (int width = 0; width < alignedWidth; width += 64)
 			{
-				pixels1 = _mm256_loadu_si256(pLocalSrc1_ymm++);
-				pixels2 = _mm256_loadu_si256(pLocalSrc1_ymm++);
-				pixels3 = _mm256_loadu_si256(pLocalSrc2_ymm++);
-				pixels4 = _mm256_loadu_si256(pLocalSrc2_ymm++);
+				pixels1 = _mm512_loadu_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_loadu_si512(pLocalSrc1_zmm++);
+				pixels3 = _mm512_loadu_si512(pLocalSrc2_zmm++);
+				pixels4 = _mm512_loadu_si512(pLocalSrc2_zmm++);
 
-				pixels1 = _mm256_sub_epi16(pixels1, pixels3);
-				pixels2 = _mm256_sub_epi16(pixels2, pixels4);
+				pixels1 = _mm512_sub_epi16(pixels1, pixels3);
+				pixels2 = _mm512_sub_epi16(pixels2, pixels4);
 
-				_mm256_storeu_si256(pLocalDst_ymm++, pixels1);
-				_mm256_storeu_si256(pLocalDst_ymm++, pixels2);
+				_mm512_storeu_si512(pLocalDst_zmm++, pixels1);
+				_mm512_storeu_si512(pLocalDst_zmm++, pixels2);
 			}
 
-			pLocalSrc1 = (vx_int16 *)pLocalSrc1_ymm;
-			pLocalSrc2 = (vx_int16 *)pLocalSrc2_ymm;
-			pLocalDst = (vx_int16 *)pLocalDst_ymm;
+			pLocalSrc1 = (vx_int16 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_int16 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_int16 *)pLocalDst_zmm;
 
 			for (int width = 0; width < postfixWidth; width++)
 			{
@@ -2629,7 +3585,30 @@ int HafCpu_Sub_S16_S16S16_Wrap
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Sub_S16_S16S16_Wrap
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_int16    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_int16    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX512
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX512BW)
+		return HafCpu_Sub_S16_S16S16_Wrap_AVX512(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Sub_S16_S16S16_Wrap_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc1_xmm, *pLocalSrc2_xmm, *pLocalDst_xmm;
@@ -2715,11 +3694,11 @@ int HafCpu_Sub_S16_S16S16_Wrap
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#endif
 	return AGO_SUCCESS;
 }
 
-int HafCpu_Sub_S16_S16S16_Sat
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Sub_S16_S16S16_Sat_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -2731,8 +3710,7 @@ int HafCpu_Sub_S16_S16S16_Sat
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc1_ymm, *pLocalSrc2_ymm, *pLocalDst_ymm;
 	vx_int16 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
@@ -2817,7 +3795,132 @@ int HafCpu_Sub_S16_S16S16_Sat
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+#if USE_AVX512
+static AGO_TARGET_AVX512 int HafCpu_Sub_S16_S16S16_Sat_AVX512
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_int16    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_int16    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x3F) == 0) ? true : false;
+
+	__m512i *pLocalSrc1_zmm, *pLocalSrc2_zmm, *pLocalDst_zmm;
+	vx_int16 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
+
+	__m512i pixels1, pixels2, pixels3, pixels4;
+	__m512i zeromask = _mm512_setzero_si512();
+
+	int alignedWidth = dstWidth & ~63;
+	int postfixWidth = dstWidth - alignedWidth;
+
+	if (useAligned)
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 64)
+			{
+				pixels1 = _mm512_load_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_load_si512(pLocalSrc1_zmm++);
+				pixels3 = _mm512_load_si512(pLocalSrc2_zmm++);
+				pixels4 = _mm512_load_si512(pLocalSrc2_zmm++);
+
+				pixels1 = _mm512_subs_epi16(pixels1, pixels3);
+				pixels2 = _mm512_subs_epi16(pixels2, pixels4);
+
+				_mm512_store_si512(pLocalDst_zmm++, pixels1);
+				_mm512_store_si512(pLocalDst_zmm++, pixels2);
+			}
+
+			pLocalSrc1 = (vx_int16 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_int16 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_int16 *)pLocalDst_zmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				vx_int32 temp = (vx_int32)(*pLocalSrc1++) - (vx_int32)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_int16)max(min(temp, INT16_MAX), INT16_MIN);
+			}
+
+			pSrcImage1 += (srcImage1StrideInBytes >> 1);
+			pSrcImage2 += (srcImage2StrideInBytes >> 1);
+			pDstImage += (dstImageStrideInBytes >> 1);
+		}
+	}
+	else
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 64)
+			{
+				pixels1 = _mm512_loadu_si512(pLocalSrc1_zmm++);
+				pixels2 = _mm512_loadu_si512(pLocalSrc1_zmm++);
+				pixels3 = _mm512_loadu_si512(pLocalSrc2_zmm++);
+				pixels4 = _mm512_loadu_si512(pLocalSrc2_zmm++);
+
+				pixels1 = _mm512_subs_epi16(pixels1, pixels3);
+				pixels2 = _mm512_subs_epi16(pixels2, pixels4);
+
+				_mm512_storeu_si512(pLocalDst_zmm++, pixels1);
+				_mm512_storeu_si512(pLocalDst_zmm++, pixels2);
+			}
+
+			pLocalSrc1 = (vx_int16 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_int16 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_int16 *)pLocalDst_zmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				vx_int32 temp = (vx_int32)(*pLocalSrc1++) - (vx_int32)(*pLocalSrc2++);
+				*pLocalDst++ = (vx_int16)max(min(temp, INT16_MAX), INT16_MIN);
+			}
+
+			pSrcImage1 += (srcImage1StrideInBytes >> 1);
+			pSrcImage2 += (srcImage2StrideInBytes >> 1);
+			pDstImage += (dstImageStrideInBytes >> 1);
+		}
+	}
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Sub_S16_S16S16_Sat
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_int16    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_int16    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX512
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX512BW)
+		return HafCpu_Sub_S16_S16S16_Sat_AVX512(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Sub_S16_S16S16_Sat_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc1_xmm, *pLocalSrc2_xmm, *pLocalDst_xmm;
@@ -2903,11 +4006,11 @@ int HafCpu_Sub_S16_S16S16_Sat
 			pDstImage += (dstImageStrideInBytes >> 1);
 		}
 	}
-#endif
 	return AGO_SUCCESS;
 }
 
-int HafCpu_AbsDiff_U8_U8U8
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_AbsDiff_U8_U8U8_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -2919,8 +4022,7 @@ int HafCpu_AbsDiff_U8_U8U8
 		vx_uint32     srcImage2StrideInBytes
 	)
 {
-#if USE_AVX
-	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0x1F) == 0) ? true : false;
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x1F) == 0) ? true : false;
 
 	__m256i *pLocalSrc1_ymm, *pLocalSrc2_ymm, *pLocalDst_ymm;
 	vx_uint8 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
@@ -3013,7 +4115,140 @@ int HafCpu_AbsDiff_U8_U8U8
 			pDstImage += dstImageStrideInBytes;
 		}
 	}
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+#if USE_AVX512
+static AGO_TARGET_AVX512 int HafCpu_AbsDiff_U8_U8U8_AVX512
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage | srcImage1StrideInBytes | srcImage2StrideInBytes | dstImageStrideInBytes) & 0x3F) == 0) ? true : false;
+
+	__m512i *pLocalSrc1_zmm, *pLocalSrc2_zmm, *pLocalDst_zmm;
+	vx_uint8 *pLocalSrc1, *pLocalSrc2, *pLocalDst;
+
+	__m512i pixels1H, pixels1L, pixels2H, pixels2L;
+	__m512i zeromask = _mm512_setzero_si512();
+
+	int alignedWidth = dstWidth & ~63;
+	int postfixWidth = dstWidth - alignedWidth;
+
+	if (useAligned)
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 64)
+			{
+				pixels1L = _mm512_load_si512(pLocalSrc1_zmm++);
+				pixels2L = _mm512_load_si512(pLocalSrc2_zmm++);
+
+				pixels1H = _mm512_unpackhi_epi8(pixels1L, zeromask);
+				pixels2H = _mm512_unpackhi_epi8(pixels2L, zeromask);
+				pixels1L = _mm512_unpacklo_epi8(pixels1L, zeromask);
+				pixels2L = _mm512_unpacklo_epi8(pixels2L, zeromask);
+
+				pixels1H = _mm512_sub_epi16(pixels1H, pixels2H);
+				pixels1L = _mm512_sub_epi16(pixels1L, pixels2L);
+				pixels1H = _mm512_abs_epi16(pixels1H);
+				pixels1L = _mm512_abs_epi16(pixels1L);
+
+				pixels1L = _mm512_packus_epi16(pixels1L, pixels1H);
+				_mm512_store_si512(pLocalDst_zmm++, pixels1L);
+			}
+
+			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_uint8 *)pLocalDst_zmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				*pLocalDst++ = (vx_uint8)abs((vx_int16)(*pLocalSrc1++) - (vx_int16)(*pLocalSrc2++));
+			}
+
+			pSrcImage1 += srcImage1StrideInBytes;
+			pSrcImage2 += srcImage2StrideInBytes;
+			pDstImage += dstImageStrideInBytes;
+		}
+	}
+	else
+	{
+		for (int height = 0; height < (int)dstHeight; height++)
+		{
+			pLocalSrc1_zmm = (__m512i*) pSrcImage1;
+			pLocalSrc2_zmm = (__m512i*) pSrcImage2;
+			pLocalDst_zmm = (__m512i*) pDstImage;
+
+			for (int width = 0; width < alignedWidth; width += 64)
+			{
+				pixels1L = _mm512_loadu_si512(pLocalSrc1_zmm++);
+				pixels2L = _mm512_loadu_si512(pLocalSrc2_zmm++);
+
+				pixels1H = _mm512_unpackhi_epi8(pixels1L, zeromask);
+				pixels2H = _mm512_unpackhi_epi8(pixels2L, zeromask);
+				pixels1L = _mm512_unpacklo_epi8(pixels1L, zeromask);
+				pixels2L = _mm512_unpacklo_epi8(pixels2L, zeromask);
+
+				pixels1H = _mm512_sub_epi16(pixels1H, pixels2H);
+				pixels1L = _mm512_sub_epi16(pixels1L, pixels2L);
+				pixels1H = _mm512_abs_epi16(pixels1H);
+				pixels1L = _mm512_abs_epi16(pixels1L);
+
+				pixels1L = _mm512_packus_epi16(pixels1L, pixels1H);
+				_mm512_storeu_si512(pLocalDst_zmm++, pixels1L);
+			}
+
+			pLocalSrc1 = (vx_uint8 *)pLocalSrc1_zmm;
+			pLocalSrc2 = (vx_uint8 *)pLocalSrc2_zmm;
+			pLocalDst = (vx_uint8 *)pLocalDst_zmm;
+
+			for (int width = 0; width < postfixWidth; width++)
+			{
+				*pLocalDst++ = (vx_uint8)abs((vx_int16)(*pLocalSrc1++) - (vx_int16)(*pLocalSrc2++));
+			}
+
+			pSrcImage1 += srcImage1StrideInBytes;
+			pSrcImage2 += srcImage2StrideInBytes;
+			pDstImage += dstImageStrideInBytes;
+		}
+	}
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_AbsDiff_U8_U8U8
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage1,
+		vx_uint32     srcImage1StrideInBytes,
+		vx_uint8    * pSrcImage2,
+		vx_uint32     srcImage2StrideInBytes
+	)
+{
+#if USE_AVX512
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX512BW)
+		return HafCpu_AbsDiff_U8_U8U8_AVX512(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_AbsDiff_U8_U8U8_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage1, srcImage1StrideInBytes, pSrcImage2, srcImage2StrideInBytes);
+#endif
 	bool useAligned = ((((intptr_t)pSrcImage1 | (intptr_t)pSrcImage2 | (intptr_t)pDstImage) & 0xF) == 0) ? true : false;
 
 	__m128i *pLocalSrc1_xmm, *pLocalSrc2_xmm, *pLocalDst_xmm;
@@ -3107,7 +4342,6 @@ int HafCpu_AbsDiff_U8_U8U8
 			pDstImage += dstImageStrideInBytes;
 		}
 	}
-#endif
 	return AGO_SUCCESS;
 }
 
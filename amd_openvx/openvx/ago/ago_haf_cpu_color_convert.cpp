@@ -3364,6 +3364,83 @@ int HafCpu_ColorConvert_V_RGB
 	return AGO_SUCCESS;
 }
 
+#if USE_AVX
+// same computation as the SSE code below, on 8 RGBX pixels per 256-bit register
+static AGO_TARGET_AVX2 int HafCpu_ColorConvert_Y_RGBX_AVX2
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstYImage,
+		vx_uint32     dstYImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	)
+{
+	int alignedWidth = dstWidth & ~15;
+	int postfixWidth = (int)dstWidth - alignedWidth;
+
+	__m256i pixels0, pixels1;
+	__m256i mask = _mm256_set1_epi32(0xFF);
+	__m256i gatherMask = _mm256_set_epi32(7, 3, 6, 2, 5, 1, 4, 0);
+	__m256 weights_R = _mm256_set1_ps((float) 0.2126);
+	__m256 weights_G = _mm256_set1_ps((float) 0.7152);
+	__m256 weights_B = _mm256_set1_ps((float) 0.0722);
+	__m256 temp, Y;
+
+	for (int height = 0; height < (int)dstHeight; height++)
+	{
+		vx_uint8 * pLocalSrc = pSrcImage;
+		vx_uint8 * pLocalDst = pDstYImage;
+
+		for (int width = 0; width < (alignedWidth >> 4); width++)
+		{
+			pixels0 = _mm256_loadu_si256((__m256i *)pLocalSrc);
+			pixels1 = _mm256_loadu_si256((__m256i *)(pLocalSrc + 32));
+
+			// For pixels 0..7
+			temp = _mm256_cvtepi32_ps(_mm256_and_si256(pixels0, mask));							// R0..R7
+			Y = _mm256_mul_ps(temp, weights_R);
+			temp = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(pixels0, 8), mask));		// G0..G7
+			Y = _mm256_add_ps(Y, _mm256_mul_ps(temp, weights_G));
+			temp = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(pixels0, 16), mask));	// B0..B7
+			Y = _mm256_add_ps(Y, _mm256_mul_ps(temp, weights_B));
+			pixels0 = _mm256_cvttps_epi32(Y);
+
+			// For pixels 8..15
+			temp = _mm256_cvtepi32_ps(_mm256_and_si256(pixels1, mask));							// R8..R15
+			Y = _mm256_mul_ps(temp, weights_R);
+			temp = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(pixels1, 8), mask));		// G8..G15
+			Y = _mm256_add_ps(Y, _mm256_mul_ps(temp, weights_G));
+			temp = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(pixels1, 16), mask));	// B8..B15
+			Y = _mm256_add_ps(Y, _mm256_mul_ps(temp, weights_B));
+			pixels1 = _mm256_cvttps_epi32(Y);
+
+			pixels0 = _mm256_packus_epi32(pixels0, pixels1);
+			pixels0 = _mm256_packus_epi16(pixels0, pixels0);
+			pixels0 = _mm256_permutevar8x32_epi32(pixels0, gatherMask);	// Gather the packed bytes of both lanes
+			_mm_storeu_si128((__m128i *)pLocalDst, _mm256_castsi256_si128(pixels0));
+
+			pLocalSrc += 64;
+			pLocalDst += 16;
+		}
+
+		for (int width = 0; width < postfixWidth; width++)
+		{
+			float R = (float)*pLocalSrc++;
+			float G = (float)*pLocalSrc++;
+			float B = (float)*pLocalSrc++;
+			pLocalSrc++;
+
+			*pLocalDst++ = (vx_uint8)((R * 0.2126f) + (G * 0.7152f) + (B * 0.0722));
+		}
+
+		pSrcImage += srcImageStrideInBytes;
+		pDstYImage += dstYImageStrideInBytes;
+	}
+	return AGO_SUCCESS;
+}
+#endif
+
 int HafCpu_ColorConvert_Y_RGBX
 	(
 		vx_uint32     dstWidth,
@@ -3374,6 +3451,10 @@ int HafCpu_ColorConvert_Y_RGBX
 		vx_uint32     srcImageStrideInBytes
 	)
 {
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_ColorConvert_Y_RGBX_AVX2(dstWidth, dstHeight, pDstYImage, dstYImageStrideInBytes, pSrcImage, srcImageStrideInBytes);
+#endif
 	int alignedWidth = dstWidth & ~15;
 	int postfixWidth = (int)dstWidth - alignedWidth;
 	
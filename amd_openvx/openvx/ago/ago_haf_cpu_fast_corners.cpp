@@ -799,28 +799,19 @@ int HafCpu_FastCornerMerge_XY_XY
 		vx_uint32       numSrcCorners[]
 	)
 {
-	int dstCount = 0;
-	int srcCount;
-	vx_keypoint_t * srcList;
-
-	for (int i = 0; i < (int)numSrcCornerBuffers; i++)
+	// concatenate the sub-image corner lists: the corner count includes the corners that do not fit
+	vx_uint32 dstCount = 0;
+	for (vx_uint32 i = 0; i < numSrcCornerBuffers; i++)
 	{
-		srcCount = numSrcCorners[i];
-		srcList = pSrcCorners[i];
-
-		while (srcCount)
+		vx_uint32 srcCount = numSrcCorners[i];
+		if (dstCount < capacityOfDstCorner)
 		{
-			*dstCorner++ = *srcList++;
-			dstCount++;
-			srcCount--;
-			if (dstCount >(int) capacityOfDstCorner)
-			{
-				*pDstCornerCount = (vx_uint32)(dstCount - 1);
-				return AGO_SUCCESS;
-			}
+			vx_uint32 copyCount = min(srcCount, capacityOfDstCorner - dstCount);
+			memcpy(&dstCorner[dstCount], pSrcCorners[i], copyCount * sizeof(vx_keypoint_t));
 		}
+		dstCount += srcCount;
 	}
 
-	*pDstCornerCount = (vx_uint32)(dstCount - 1);
+	*pDstCornerCount = dstCount;
 	return AGO_SUCCESS;
 }
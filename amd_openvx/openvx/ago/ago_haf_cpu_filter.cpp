@@ -31,6 +31,139 @@ Separable filter
 	1
 	1
 */
+#if USE_AVX
+// same computation as the SSE code below, on 16 pixels per 256-bit register of 16-bit sums
+static AGO_TARGET_AVX2 int HafCpu_Box_U8_U8_3x3_AVX2
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes,
+		vx_uint8    * pScratch
+	)
+{
+	unsigned char *pLocalSrc = (unsigned char *)pSrcImage;
+	unsigned char *pLocalDst = (unsigned char *)pDstImage;
+
+	int prefixWidth = intptr_t(pDstImage) & 15;
+	prefixWidth = (prefixWidth == 0) ? 0 : (16 - prefixWidth);
+	int postfixWidth = ((int)dstWidth - prefixWidth) & 15;
+	int alignedWidth = (int)dstWidth - prefixWidth - postfixWidth;
+
+	int tmpWidth = (dstWidth + 15) & ~15;
+	vx_uint16 * pPrevRow = (vx_uint16*) pScratch;
+	vx_uint16 * pCurrRow = ((vx_uint16*) pScratch) + tmpWidth;
+	vx_uint16 * pNextRow = ((vx_uint16*)pScratch) + (tmpWidth + tmpWidth);
+
+	__m256i result, sum;
+	__m256i divFactor = _mm256_set1_epi16((short)7282);						// ceil((2^16)/9) = 7282
+
+	vx_uint16 * pLocalPrevRow = pPrevRow;
+	vx_uint16 * pLocalCurrRow = pCurrRow;
+	vx_uint16 * pLocalNextRow = pNextRow;
+	vx_uint16 * pTemp;
+
+	// Process first two rows - Horizontal filtering
+	for (int x = 0; x < prefixWidth; x++, pLocalSrc++)
+	{
+		*pLocalPrevRow++ = (vx_uint16)pLocalSrc[-(int)srcImageStrideInBytes - 1] + (vx_uint16)pLocalSrc[-(int)srcImageStrideInBytes] + (vx_uint16)pLocalSrc[-(int)srcImageStrideInBytes + 1];
+		*pLocalCurrRow++ = (vx_uint16)pLocalSrc[-1] + (vx_uint16)pLocalSrc[0] + (vx_uint16)pLocalSrc[1];
+	}
+
+	for (int x = 0; x < (alignedWidth >> 4); x++)
+	{
+		// row above
+		result = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)(pLocalSrc - srcImageStrideInBytes - 1)));
+		result = _mm256_add_epi16(result, _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)(pLocalSrc - srcImageStrideInBytes))));
+		result = _mm256_add_epi16(result, _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)(pLocalSrc - srcImageStrideInBytes + 1))));
+		_mm256_storeu_si256((__m256i *) pLocalPrevRow, result);
+
+		// current row
+		result = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)(pLocalSrc - 1)));
+		result = _mm256_add_epi16(result, _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *) pLocalSrc)));
+		result = _mm256_add_epi16(result, _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)(pLocalSrc + 1))));
+		_mm256_storeu_si256((__m256i *) pLocalCurrRow, result);
+
+		pLocalSrc += 16;
+		pLocalPrevRow += 16;
+		pLocalCurrRow += 16;
+	}
+
+	for (int x = 0; x < postfixWidth; x++, pLocalSrc++)
+	{
+		*pLocalPrevRow++ = (vx_uint16)pLocalSrc[-(int)srcImageStrideInBytes - 1] + (vx_uint16)pLocalSrc[-(int)srcImageStrideInBytes] + (vx_uint16)pLocalSrc[-(int)srcImageStrideInBytes + 1];
+		*pLocalCurrRow++ = (vx_uint16)pLocalSrc[-1] + (vx_uint16)pLocalSrc[0] + (vx_uint16)pLocalSrc[1];
+	}
+
+	pLocalPrevRow = pPrevRow;
+	pLocalCurrRow = pCurrRow;
+	pLocalNextRow = pNextRow;
+
+	// Process rows 3 till the end
+	int height = (int)dstHeight;
+	while (height)
+	{
+		pLocalSrc = (unsigned char *)(pSrcImage + srcImageStrideInBytes);				// Pointing to the row below
+		pLocalDst = (unsigned char *) pDstImage;
+
+		for (int x = 0; x < prefixWidth; x++, pLocalSrc++)
+		{
+			vx_uint16 temp = (vx_uint16)pLocalSrc[-1] + (vx_uint16)pLocalSrc[0] + (vx_uint16)pLocalSrc[1];
+			*pLocalNextRow++ = temp;										// Save the next row temp pixels
+			*pLocalDst++ = (char)((float)(temp + *pLocalPrevRow++ + *pLocalCurrRow++) / 9.0f);
+		}
+
+		int width = (int)(alignedWidth >> 4);
+		while (width)
+		{
+			// Horizontal Filtering of the next row
+			result = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)(pLocalSrc - 1)));
+			result = _mm256_add_epi16(result, _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *) pLocalSrc)));
+			result = _mm256_add_epi16(result, _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)(pLocalSrc + 1))));
+			_mm256_storeu_si256((__m256i *) pLocalNextRow, result);		// Save the horizontal filtered pixels from the next row
+
+			sum = _mm256_add_epi16(_mm256_loadu_si256((__m256i *) pLocalPrevRow), result);	// Prev row + next row
+			sum = _mm256_add_epi16(sum, _mm256_loadu_si256((__m256i *) pLocalCurrRow));		// Prev row + curr row + next row
+			sum = _mm256_mulhi_epi16(sum, divFactor);
+
+			sum = _mm256_packus_epi16(sum, sum);							// Convert to 8 bit
+			sum = _mm256_permute4x64_epi64(sum, 0xD8);						// Gather the packed bytes of both lanes
+			_mm_store_si128((__m128i*) pLocalDst, _mm256_castsi256_si128(sum));
+
+			pLocalSrc += 16;
+			pLocalDst += 16;
+			pLocalPrevRow += 16;
+			pLocalCurrRow += 16;
+			pLocalNextRow += 16;
+			width--;
+		}
+
+		for (int x = 0; x < postfixWidth; x++, pLocalSrc++)
+		{
+			vx_uint16 temp = (vx_uint16)pLocalSrc[-1] + (vx_uint16)pLocalSrc[0] + (vx_uint16)pLocalSrc[1];
+			*pLocalNextRow++ = temp;										// Save the next row temp pixels
+			*pLocalDst++ = (char)((float)(temp + *pLocalPrevRow++ + *pLocalCurrRow++) / 9.0f);
+		}
+
+		pTemp = pPrevRow;
+		pPrevRow = pCurrRow;
+		pCurrRow = pNextRow;
+		pNextRow = pTemp;
+
+		pLocalPrevRow = pPrevRow;
+		pLocalCurrRow = pCurrRow;
+		pLocalNextRow = pNextRow;
+
+		pSrcImage += srcImageStrideInBytes;
+		pDstImage += dstImageStrideInBytes;
+		height--;
+	}
+	return AGO_SUCCESS;
+}
+#endif
+
 int HafCpu_Box_U8_U8_3x3
 	(
 		vx_uint32     dstWidth,
@@ -42,6 +175,10 @@ int HafCpu_Box_U8_U8_3x3
 		vx_uint8    * pScratch
 	)
 {
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Box_U8_U8_3x3_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage, srcImageStrideInBytes, pScratch);
+#endif
 	unsigned char *pLocalSrc = (unsigned char *)pSrcImage;
 	unsigned char *pLocalDst = (unsigned char *)pDstImage;
 	
@@ -1515,7 +1652,8 @@ int HafCpu_Erode_U8_U1_3x3
 	2
 	1
 */
-int HafCpu_Gaussian_U8_U8_3x3
+#if USE_AVX
+static AGO_TARGET_AVX2 int HafCpu_Gaussian_U8_U8_3x3_AVX2
 	(
 		vx_uint32     dstWidth,
 		vx_uint32     dstHeight,
@@ -1526,7 +1664,6 @@ int HafCpu_Gaussian_U8_U8_3x3
 		vx_uint8	* pScratch
 	)
 {
-#if USE_AVX
 	unsigned char *pLocalSrc = (unsigned char *)pSrcImage;
 	unsigned char *pLocalDst = (unsigned char *)pDstImage;
 
@@ -1647,6 +1784,7 @@ int HafCpu_Gaussian_U8_U8_3x3
 			resultL = _mm256_srli_epi16(resultL, 4);						// Div by 16 (normalization)
 			
 			resultL = _mm256_packus_epi16(resultL, resultL);				// Convert to 8 bit
+			resultL = _mm256_permute4x64_epi64(resultL, 0xD8);				// Gather the packed bytes of both lanes
 			row0 = _mm256_castsi256_si128(resultL);							// Lower 128 bits 
 			_mm_store_si128((__m128i*) pLocalDst, row0);
 
@@ -1678,7 +1816,25 @@ int HafCpu_Gaussian_U8_U8_3x3
 		pDstImage += dstImageStrideInBytes;
 		height--;
 	}
-#else
+	return AGO_SUCCESS;
+}
+#endif
+
+int HafCpu_Gaussian_U8_U8_3x3
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes,
+		vx_uint8	* pScratch
+	)
+{
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2)
+		return HafCpu_Gaussian_U8_U8_3x3_AVX2(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage, srcImageStrideInBytes, pScratch);
+#endif
 	unsigned char *pLocalSrc = (unsigned char *)pSrcImage;
 	unsigned char *pLocalDst = (unsigned char *)pDstImage;
 
@@ -1858,8 +2014,6 @@ int HafCpu_Gaussian_U8_U8_3x3
 		pDstImage += dstImageStrideInBytes;
 		height--;
 	}
-#endif
-	
 	return AGO_SUCCESS;
 }
 
@@ -833,10 +833,13 @@ int HafCpu_WarpAffine_U8_U8_Bilinear
 	vx_uint8            * pSrcImage,
 	vx_uint32             srcImageStrideInBytes,
 	ago_affine_matrix_t * matrix,
-	vx_uint8			* pLocalData
+	vx_uint8			* pLocalData,
+	vx_uint32             dstRowStart,
+	vx_uint32             dstRowEnd
 )
 {
 	// call the HafCpu_WarpAffine_U8_U8_Bilinear_Constant with border value 128
+	// only the rows [dstRowStart, dstRowEnd) of the destination are computed
 	__m128  ymap, xmap, ydest, xdest;
 	__m128i srcb, src_s;
 	const __m128i zeromask = _mm_setzero_si128();
@@ -883,12 +886,13 @@ int HafCpu_WarpAffine_U8_U8_Bilinear
 	y1 = (r10*dstWidth + r11*dstHeight + const2);
 	bBoder |= (x1 < 0) | (y1 < 0) | (x1 >= srcWidth) | (y1 >= srcHeight);
 
-	y = 0;
+	y = dstRowStart;
+	pDstImage += dstRowStart * dstImageStrideInBytes;
 	if (bBoder){
 		__m128i srcb = _mm_set1_epi32((srcHeight-1)*srcImageStrideInBytes - 1);
 		__m128i src_s = _mm_set1_epi32(srcImageStrideInBytes);
 
-		while (y < dstHeight)
+		while (y < dstRowEnd)
 		{
 			// calculate (y*m[0][1] + m[0][2]) for x and y
 			xdest = _mm_set1_ps(y*r01 + const1);
@@ -1001,7 +1005,7 @@ int HafCpu_WarpAffine_U8_U8_Bilinear
 	}
 	else{
 		XMM128 xint = { 0 }, yint = { 0 };
-		while (y < dstHeight)
+		while (y < dstRowEnd)
 		{
 			// calculate (y*m[0][1] + m[0][2]) for x and y
 			xdest = _mm_set1_ps(y*r01 + const1);
@@ -1984,9 +1988,12 @@ vx_uint32            srcWidth,
 vx_uint32            srcHeight,
 vx_uint8           * pSrcImage,
 vx_uint32            srcImageStrideInBytes,
-ago_scale_matrix_t * matrix
+ago_scale_matrix_t * matrix,
+vx_uint32            dstRowStart,
+vx_uint32            dstRowEnd
 )
 {
+	// only the rows [dstRowStart, dstRowEnd) of the destination are computed
 	int xinc, yinc,xoffs, yoffs;
 
 	unsigned char *pdst = pDstImage;
@@ -2020,7 +2027,8 @@ ago_scale_matrix_t * matrix
 	const __m128i round = _mm_set1_epi16((short)0x80);
 	unsigned int newDstWidth = dstWidth & ~7;	// nearest multiple of 8
 
-	for (int y = 0, ypos = yoffs; y < (int)dstHeight; y++, ypos += yinc)
+	pDstImage += dstRowStart * dstImageStrideInBytes;
+	for (int y = (int)dstRowStart, ypos = yoffs + (int)dstRowStart * yinc; y < (int)dstRowEnd; y++, ypos += yinc)
 	{
 		int ym, yf, one_min_yf;
 		__m128i rxmm0, rxmm7;
@@ -29,50 +29,6 @@ typedef struct {
 	vx_float32 GyGy;
 } ago_harris_Gxy_t;
 
-void insertAtLocation(vx_uint32 listCapacity, vx_keypoint_t * pList, vx_uint32 * cornerCount, vx_keypoint_t itemToBeAdded, vx_uint32 loc)
-{
-	vx_keypoint_t incoming_keypt = itemToBeAdded;
-	vx_keypoint_t temp;
-
-	for (int i = (int)loc; i <= (int)*cornerCount; i++)
-	{
-		temp = pList[i];
-		pList[i] = incoming_keypt;
-		incoming_keypt = temp;
-	}
-
-	*cornerCount = *cornerCount + 1;
-}
-
-void AddToTheSortedKeypointList(vx_uint32 listCapacity, vx_keypoint_t * pList, vx_uint32 * cornerCount, vx_keypoint_t itemToBeAdded)
-{
-	if (*cornerCount == 0)									// Add the item to the head
-	{
-		pList[0] = itemToBeAdded;
-		*cornerCount = 1;
-	}
-	else
-	{
-		if (itemToBeAdded.strength <= pList[*cornerCount - 1].strength)
-		{
-			if (*cornerCount == listCapacity)
-				return;
-			else
-			{
-				pList[*cornerCount] = itemToBeAdded;
-				*cornerCount = *cornerCount + 1;
-			}
-		}
-		else
-		{
-			int idx = 0;
-			while (pList[idx].strength > itemToBeAdded.strength)
-				idx++;
-			insertAtLocation(listCapacity, pList, cornerCount, itemToBeAdded, idx);
-		}
-	}
-}
-
 // Using Separable filter:
 // For Gx:
 //	-1	0	1		-1	0	1		1
@@ -803,80 +759,24 @@ int HafCpu_HarrisScore_HVC_HG3_7x7
 
 int HafCpu_HarrisMergeSortAndPick_XY_HVC
 	(
-		vx_uint32         capacityOfDstCorner,
-		vx_keypoint_t     dstCorner[],
-		vx_uint32       * pDstCornerCount,
-		vx_uint32         srcWidth,
-		vx_uint32         srcHeight,
-		vx_float32      * pSrcVc,
-		vx_uint32         srcVcStrideInBytes,
-		vx_float32        min_distance
+		vx_uint32                  capacityOfDstCorner,
+		vx_keypoint_t              dstCorner[],
+		vx_uint32                * pDstCornerCount,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_float32               * pSrcVc,
+		vx_uint32                  srcVcStrideInBytes,
+		vx_float32                 min_distance,
+		vx_uint32                  capacityOfList,
+		ago_keypoint_xys_t       * list,
+		ago_harris_grid_header_t * gridInfo,
+		ago_coord2d_short_t      * gridBuf
 	)
 {
-	vx_float32      * pLocalSrc;
-	vx_float32      * pSrcVc_NMS = pSrcVc;
-	vx_int32 radius = (vx_int32) min_distance;
-
-	// Non max supression
-	for (vx_int32 y = 0; y < (vx_int32)srcHeight; y++)
-	{
-		pLocalSrc = pSrcVc_NMS;
-		for (vx_int32 x = 0; x < (vx_int32)srcWidth; x++)
-		{
-			vx_float32 Vc = *pLocalSrc;
-			if (Vc)
-			{
-				
-				for (vx_int32 i = max(y - radius, 0); i <= min(y + radius, (vx_int32) srcHeight - 1); i++)
-				{
-					for (vx_int32 j = max(x - radius, 0); j <= min(x + radius, (vx_int32) srcWidth - 1); j++)
-					{
-						if ((vx_float32)((y-i)*(y-i)) + (vx_float32)((x-j)*(x-j)) <= radius*radius)
-						{
-							vx_float32 * neighbor = (vx_float32 *)(((char *)pLocalSrc) + (i - y) * (vx_int32)srcVcStrideInBytes + (j - x) * sizeof(vx_float32));
-							if (*neighbor < Vc)
-								*neighbor = 0;
-						}
-					}
-				}
-			}
-			pLocalSrc++;
-		}
-
-		pSrcVc_NMS = (vx_float32 *)((char *)pSrcVc_NMS + srcVcStrideInBytes);
-	}	
-
-	// Populate the sorted list
-	vx_keypoint_t cand;
-	vx_uint32 numCorners = 0;
-	
-	for (vx_uint32 y = 0; y < srcHeight; y++)
-	{
-		pLocalSrc = pSrcVc;
-		for (vx_uint32 x = 0; x < srcWidth; x++)
-		{
-			if (*pLocalSrc)
-			{
-				cand.x = x;
-				cand.y = y;
-				cand.strength = *pLocalSrc;
-				cand.scale = 0;
-				cand.orientation = 0;
-				cand.error = 0;
-				cand.tracking_status = 1;
-				if (numCorners < capacityOfDstCorner)
-					AddToTheSortedKeypointList(capacityOfDstCorner, dstCorner, &numCorners, cand);
-				else
-					numCorners++;
-			}
-			pLocalSrc++;
-		}
-		pSrcVc = (vx_float32 *)((char *)pSrcVc + srcVcStrideInBytes);
-	}
-
-	*pDstCornerCount = numCorners;
-
-	return AGO_SUCCESS;
+	// 3x3 local maxima of Vc followed by the same sort and grid pick as the XYS kernel
+	vx_uint32 listCount = 0;
+	HafCpu_NonMaxSupp_XY_ANY_3x3(capacityOfList, list, &listCount, srcWidth, srcHeight, pSrcVc, srcVcStrideInBytes);
+	return HafCpu_HarrisMergeSortAndPick_XY_XYS(capacityOfDstCorner, dstCorner, pDstCornerCount, list, listCount, min_distance, gridInfo, gridBuf);
 }
 
 int HafCpu_NonMaxSupp_XY_ANY_3x3
@@ -920,6 +820,94 @@ int HafCpu_NonMaxSupp_XY_ANY_3x3
 	return AGO_SUCCESS;
 }
 
+vx_uint32 HafCpu_NonMaxSuppGridInfo
+	(
+		ago_harris_grid_header_t * gridInfo,
+		vx_uint32                  width,
+		vx_uint32                  height,
+		vx_float32                 min_distance
+	)
+{
+	// a cell diagonal shorter than min_distance keeps at most one picked corner per cell
+	vx_uint32 cellSize = max((vx_uint32)floor(min_distance / M_SQRT2), 1u);
+	vx_uint32 gridWidth = (width + cellSize - 1) / cellSize;
+	vx_uint32 gridHeight = (height + cellSize - 1) / cellSize;
+	vx_uint32 gridBufSize = (vx_uint32)((unsigned long)(gridWidth * gridHeight) * sizeof(ago_coord2d_short_t));
+	if (gridInfo) {
+		gridInfo->width = gridWidth;
+		gridInfo->height = gridHeight;
+		gridInfo->cellSize = cellSize;
+		gridInfo->gridBufSize = gridBufSize;
+	}
+	return gridBufSize;
+}
+
+int HafCpu_NonMaxSuppGrid_XY_XYS
+	(
+		vx_uint32                  capacityOfDstCorner,
+		vx_keypoint_t            * dstCorner,
+		vx_uint32                * pDstCornerCount,
+		const ago_keypoint_xys_t * srcList,
+		vx_uint32                  srcListCount,
+		vx_float32                 min_distance,
+		ago_harris_grid_header_t * gridInfo,
+		ago_coord2d_short_t      * gridBuf
+	)
+{
+	// get grid info and initialize grid buffer if (-1,-1) coordinate values indicating no presence of values
+	vx_int32 gridWidth = (vx_int32)gridInfo->width;
+	vx_int32 gridHeight = (vx_int32)gridInfo->height;
+	vx_int32 cellSize = (vx_int32)gridInfo->cellSize;
+	HafCpu_MemSet_U32(gridInfo->gridBufSize >> 2, (vx_uint32 *)gridBuf, (vx_uint32)-1);
+	// only cells within reach can hold a picked corner closer than min_distance
+	vx_int32 reach = (vx_int32)ceilf(min_distance / cellSize);
+	vx_int32 min_dist2 = (vx_int32)ceilf(min_distance * min_distance);
+	// pick corners in the order of srcList (strongest first) that are not too close to an already picked corner
+	vx_uint32 count = 0;
+	vx_keypoint_t * corner = dstCorner;
+	for (vx_uint32 i = 0; i < srcListCount; i++) {
+		vx_int32 x = srcList[i].x, y = srcList[i].y;
+		vx_int32 cx = x / cellSize, cy = y / cellSize;
+		ago_coord2d_short_t * cgrid = gridBuf + cy * gridWidth + cx;
+		if (cgrid->x >= 0)
+			continue;
+		bool found = false;
+		vx_int32 cxmin = max(cx - reach, 0), cxmax = min(cx + reach, gridWidth - 1), cw = cxmax - cxmin + 1;
+		vx_int32 cymin = max(cy - reach, 0), cymax = min(cy + reach, gridHeight - 1), ch = cymax - cymin + 1;
+		const ago_coord2d_short_t * grid = gridBuf + cxmin + cymin * gridWidth;
+		for (vx_int32 icy = 0; icy < ch && !found; icy++, grid += gridWidth) {
+			for (vx_int32 icx = 0; icx < cw; icx++) {
+				vx_int32 ix = grid[icx].x;
+				if (ix >= 0) {
+					vx_int32 iy = grid[icx].y;
+					ix -= x; iy -= y;
+					if (ix*ix + iy*iy < min_dist2) {
+						found = true;
+						break;
+					}
+				}
+			}
+		}
+		if (!found) {
+			if (count < capacityOfDstCorner) {
+				corner->x = x;
+				corner->y = y;
+				corner->strength = srcList[i].s;
+				corner->tracking_status = 1;
+				corner->error = 0;
+				corner->scale = 0.0f;
+				corner->orientation = 0.0f;
+				corner++;
+			}
+			count++;
+			cgrid->x = (vx_int16)x;
+			cgrid->y = (vx_int16)y;
+		}
+	}
+	*pDstCornerCount = count;
+	return AGO_SUCCESS;
+}
+
 int HafCpu_HarrisMergeSortAndPick_XY_XYS
 	(
 		vx_uint32                  capacityOfDstCorner,
@@ -935,70 +923,20 @@ int HafCpu_HarrisMergeSortAndPick_XY_XYS
 	// sort the keypoint XYS list
 	std::sort((vx_int64 *)&srcList[0], (vx_int64 *)&srcList[srcListCount], std::greater<vx_int64>());
 	// extract useful keypoints from XYS list into corners array
-	vx_uint32 count = 0;
 	if (gridInfo) {
-		// get grid info and initialize grid buffer if (-1,-1) coordinate values indicating no presence of values
-		vx_uint32 gridWidth = gridInfo->width;
-		vx_uint32 gridHeight = gridInfo->height;
-		vx_uint32 cellSize = gridInfo->cellSize;
-		HafCpu_MemSet_U32(gridInfo->gridBufSize >> 2, (vx_uint32 *)gridBuf, (vx_uint32)-1);
 		// filter the keypoints with min_distance
-		vx_int32 min_dist2 = (vx_int32)ceilf(min_distance * min_distance);
-		vx_keypoint_t * corner = dstCorner;
-		for (vx_uint32 i = 0; i < srcListCount; i++) {
-			vx_uint32 x = srcList[i].x, y = srcList[i].y;
-			bool found = true;
-			vx_int32 cx = (vx_int32)x / cellSize, cy = (vx_int32)y / cellSize;
-			ago_coord2d_short_t * cgrid = gridBuf + cy * gridWidth + cx;
-			if (cgrid->x < 0) {
-				vx_int32 cxmin = max(cx - 2, 0), cxmax = min(cx + 2, (vx_int32)gridWidth - 1), cw = cxmax - cxmin + 1;
-				vx_int32 cymin = max(cy - 2, 0), cymax = min(cy + 2, (vx_int32)gridHeight - 1), ch = cymax - cymin + 1;
-				ago_coord2d_short_t * grid = gridBuf + cxmin + cymin * gridWidth;
-				for (vx_int32 icy = 0; icy < ch; icy++, grid += gridWidth) {
-					for (vx_int32 icx = 0; icx < cw; icx++) {
-						int ix = grid[icx].x;
-						if (ix >= 0) {
-							int iy = grid[icx].y;
-							ix -= x; iy -= y;
-							int dist2 = ix*ix + iy*iy;
-							if (dist2 < min_dist2) {
-								goto search_done;
-							}
-						}
-					}
-				}
-				found = false;
-			}
-		search_done:
-			if (!found) {
-				if (count < capacityOfDstCorner) {
-					corner->x = x;
-					corner->y = y;
-					corner->strength = srcList[i].s;
-					corner->tracking_status = 1;
-					corner->error = 0;
-					corner->scale = 0.0f;
-					corner->orientation = 0.0f;
-					corner++;
-				}
-				count++;
-				cgrid->x = x;
-				cgrid->y = y;
-			}
-		}
+		return HafCpu_NonMaxSuppGrid_XY_XYS(capacityOfDstCorner, dstCorner, pDstCornerCount, srcList, srcListCount, min_distance, gridInfo, gridBuf);
 	}
-	else {
-		// copy all points into output array
-		count = (srcListCount < capacityOfDstCorner) ? srcListCount : capacityOfDstCorner;
-		for (vx_uint32 i = 0; i < count; i++, dstCorner++, srcList++) {
-			dstCorner->x = srcList->x;
-			dstCorner->y = srcList->y;
-			dstCorner->strength = srcList->s;
-			dstCorner->tracking_status = 1;
-			dstCorner->error = 0;
-			dstCorner->scale = 0.0f;
-			dstCorner->orientation = 0.0f;
-		}
+	// copy all points into output array
+	vx_uint32 count = (srcListCount < capacityOfDstCorner) ? srcListCount : capacityOfDstCorner;
+	for (vx_uint32 i = 0; i < count; i++, dstCorner++, srcList++) {
+		dstCorner->x = srcList->x;
+		dstCorner->y = srcList->y;
+		dstCorner->strength = srcList->s;
+		dstCorner->tracking_status = 1;
+		dstCorner->error = 0;
+		dstCorner->scale = 0.0f;
+		dstCorner->orientation = 0.0f;
 	}
 	*pDstCornerCount = count;
 	return AGO_SUCCESS;
@@ -0,0 +1,754 @@
+/*
+Copyright (c) 2015 - 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "ago_internal.h"
+#include <limits>
+
+// Tensors are walked one row (innermost dimension) at a time: strides are in bytes, and a
+// stride of zero along a dimension broadcasts the source across that dimension of the output.
+// The innermost dimension is always contiguous in the output, so the row functions below use
+// SSE over the row and fall back to scalar code for the tail.
+
+template <typename RowFunc>
+static inline void HafCpu_TensorForEachRow
+	(
+		vx_size         num_dims,
+		const vx_size   dims[],
+		const vx_size   dstStride[],
+		const vx_size   src1Stride[],
+		const vx_size   src2Stride[],
+		RowFunc         rowFunc
+	)
+{
+	vx_size index[AGO_MAX_TENSOR_DIMENSIONS] = { 0 };
+	vx_size dstOffset = 0, src1Offset = 0, src2Offset = 0;
+	for (;;) {
+		rowFunc(dstOffset, src1Offset, src2Offset);
+		vx_size d = 1;
+		for (; d < num_dims; d++) {
+			if (++index[d] < dims[d]) {
+				dstOffset += dstStride[d];
+				src1Offset += src1Stride[d];
+				src2Offset += src2Stride[d];
+				break;
+			}
+			index[d] = 0;
+			dstOffset -= dstStride[d] * (dims[d] - 1);
+			src1Offset -= src1Stride[d] * (dims[d] - 1);
+			src2Offset -= src2Stride[d] * (dims[d] - 1);
+		}
+		if (d >= num_dims)
+			break;
+	}
+}
+
+template <typename T>
+static inline T HafCpu_TensorSaturate(vx_int64 value)
+{
+	const vx_int64 minValue = std::numeric_limits<T>::min();
+	const vx_int64 maxValue = std::numeric_limits<T>::max();
+	return (T)(value < minValue ? minValue : (value > maxValue ? maxValue : value));
+}
+
+template <typename T>
+static inline T HafCpu_TensorConvert(vx_float64 value, bool saturate)
+{
+	if (saturate) {
+		const vx_float64 minValue = (vx_float64)std::numeric_limits<T>::min();
+		const vx_float64 maxValue = (vx_float64)std::numeric_limits<T>::max();
+		return (T)(value < minValue ? minValue : (value > maxValue ? maxValue : value));
+	}
+	return (T)(vx_int64)value;
+}
+
+template <>
+inline vx_float32 HafCpu_TensorConvert<vx_float32>(vx_float64 value, bool saturate)
+{
+	return (vx_float32)value;
+}
+
+template <typename T>
+static inline __m128i HafCpu_TensorSplat(T value)
+{
+	T values[16 / sizeof(T)];
+	for (size_t i = 0; i < 16 / sizeof(T); i++)
+		values[i] = value;
+	return _mm_loadu_si128((const __m128i *)values);
+}
+
+template <typename T, typename VecOp, typename ScalarOp>
+static inline void HafCpu_TensorBinary
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc1,
+		const vx_size    src1Stride[],
+		const vx_uint8 * pSrc2,
+		const vx_size    src2Stride[],
+		VecOp            vecOp,
+		ScalarOp         scalarOp
+	)
+{
+	const vx_size lanes = 16 / sizeof(T);
+	const vx_size width = dims[0];
+	const bool src1Broadcast = (src1Stride[0] == 0);
+	const bool src2Broadcast = (src2Stride[0] == 0);
+	HafCpu_TensorForEachRow(num_dims, dims, dstStride, src1Stride, src2Stride, [&](vx_size dstOffset, vx_size src1Offset, vx_size src2Offset) {
+		T * pLocalDst = (T *)(pDst + dstOffset);
+		const T * pLocalSrc1 = (const T *)(pSrc1 + src1Offset);
+		const T * pLocalSrc2 = (const T *)(pSrc2 + src2Offset);
+		__m128i splat1 = src1Broadcast ? HafCpu_TensorSplat<T>(pLocalSrc1[0]) : _mm_setzero_si128();
+		__m128i splat2 = src2Broadcast ? HafCpu_TensorSplat<T>(pLocalSrc2[0]) : _mm_setzero_si128();
+		vx_size x = 0;
+		for (; x + lanes <= width; x += lanes) {
+			__m128i a = src1Broadcast ? splat1 : _mm_loadu_si128((const __m128i *)(pLocalSrc1 + x));
+			__m128i b = src2Broadcast ? splat2 : _mm_loadu_si128((const __m128i *)(pLocalSrc2 + x));
+			_mm_storeu_si128((__m128i *)(pLocalDst + x), vecOp(a, b));
+		}
+		for (; x < width; x++) {
+			pLocalDst[x] = scalarOp(pLocalSrc1[src1Broadcast ? 0 : x], pLocalSrc2[src2Broadcast ? 0 : x]);
+		}
+	});
+}
+
+template <typename T, typename ScalarOp>
+static inline void HafCpu_TensorBinaryScalar
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc1,
+		const vx_size    src1Stride[],
+		const vx_uint8 * pSrc2,
+		const vx_size    src2Stride[],
+		ScalarOp         scalarOp
+	)
+{
+	const vx_size width = dims[0];
+	const vx_size step1 = src1Stride[0] ? 1 : 0;
+	const vx_size step2 = src2Stride[0] ? 1 : 0;
+	HafCpu_TensorForEachRow(num_dims, dims, dstStride, src1Stride, src2Stride, [&](vx_size dstOffset, vx_size src1Offset, vx_size src2Offset) {
+		T * pLocalDst = (T *)(pDst + dstOffset);
+		const T * pLocalSrc1 = (const T *)(pSrc1 + src1Offset);
+		const T * pLocalSrc2 = (const T *)(pSrc2 + src2Offset);
+		for (vx_size x = 0; x < width; x++) {
+			pLocalDst[x] = scalarOp(pLocalSrc1[x * step1], pLocalSrc2[x * step2]);
+		}
+	});
+}
+
+static inline __m128i HafCpu_TensorAddPS(__m128i a, __m128i b)
+{
+	return _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+}
+
+static inline __m128i HafCpu_TensorSubPS(__m128i a, __m128i b)
+{
+	return _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+}
+
+static int HafCpu_TensorAddSubtract
+	(
+		bool             subtract,
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_enum          data_type,
+		bool             saturate,
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc1,
+		const vx_size    src1Stride[],
+		const vx_uint8 * pSrc2,
+		const vx_size    src2Stride[]
+	)
+{
+	const vx_int32 sign = subtract ? -1 : 1;
+	if (data_type == VX_TYPE_UINT8) {
+		auto scalarOp = [=](vx_uint8 a, vx_uint8 b) { vx_int32 v = (vx_int32)a + sign * (vx_int32)b; return saturate ? HafCpu_TensorSaturate<vx_uint8>(v) : (vx_uint8)v; };
+		if (subtract && saturate)
+			HafCpu_TensorBinary<vx_uint8>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, [](__m128i a, __m128i b) { return _mm_subs_epu8(a, b); }, scalarOp);
+		else if (subtract)
+			HafCpu_TensorBinary<vx_uint8>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, [](__m128i a, __m128i b) { return _mm_sub_epi8(a, b); }, scalarOp);
+		else if (saturate)
+			HafCpu_TensorBinary<vx_uint8>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, [](__m128i a, __m128i b) { return _mm_adds_epu8(a, b); }, scalarOp);
+		else
+			HafCpu_TensorBinary<vx_uint8>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, [](__m128i a, __m128i b) { return _mm_add_epi8(a, b); }, scalarOp);
+	}
+	else if (data_type == VX_TYPE_INT8) {
+		auto scalarOp = [=](vx_int8 a, vx_int8 b) { vx_int32 v = (vx_int32)a + sign * (vx_int32)b; return saturate ? HafCpu_TensorSaturate<vx_int8>(v) : (vx_int8)v; };
+		if (subtract && saturate)
+			HafCpu_TensorBinary<vx_int8>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, [](__m128i a, __m128i b) { return _mm_subs_epi8(a, b); }, scalarOp);
+		else if (subtract)
+			HafCpu_TensorBinary<vx_int8>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, [](__m128i a, __m128i b) { return _mm_sub_epi8(a, b); }, scalarOp);
+		else if (saturate)
+			HafCpu_TensorBinary<vx_int8>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, [](__m128i a, __m128i b) { return _mm_adds_epi8(a, b); }, scalarOp);
+		else
+			HafCpu_TensorBinary<vx_int8>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, [](__m128i a, __m128i b) { return _mm_add_epi8(a, b); }, scalarOp);
+	}
+	else if (data_type == VX_TYPE_INT16) {
+		auto scalarOp = [=](vx_int16 a, vx_int16 b) { vx_int32 v = (vx_int32)a + sign * (vx_int32)b; return saturate ? HafCpu_TensorSaturate<vx_int16>(v) : (vx_int16)v; };
+		if (subtract && saturate)
+			HafCpu_TensorBinary<vx_int16>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, [](__m128i a, __m128i b) { return _mm_subs_epi16(a, b); }, scalarOp);
+		else if (subtract)
+			HafCpu_TensorBinary<vx_int16>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, [](__m128i a, __m128i b) { return _mm_sub_epi16(a, b); }, scalarOp);
+		else if (saturate)
+			HafCpu_TensorBinary<vx_int16>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, [](__m128i a, __m128i b) { return _mm_adds_epi16(a, b); }, scalarOp);
+		else
+			HafCpu_TensorBinary<vx_int16>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, [](__m128i a, __m128i b) { return _mm_add_epi16(a, b); }, scalarOp);
+	}
+	else if (data_type == VX_TYPE_FLOAT32) {
+		if (subtract)
+			HafCpu_TensorBinary<vx_float32>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, HafCpu_TensorSubPS, [](vx_float32 a, vx_float32 b) { return a - b; });
+		else
+			HafCpu_TensorBinary<vx_float32>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, HafCpu_TensorAddPS, [](vx_float32 a, vx_float32 b) { return a + b; });
+	}
+	else {
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_TensorAdd_DATA_DATA_DATA
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_enum          data_type,
+		vx_bool          saturate,
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc1,
+		const vx_size    src1Stride[],
+		const vx_uint8 * pSrc2,
+		const vx_size    src2Stride[]
+	)
+{
+	return HafCpu_TensorAddSubtract(false, num_dims, dims, data_type, saturate ? true : false, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride);
+}
+
+int HafCpu_TensorSubtract_DATA_DATA_DATA
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_enum          data_type,
+		vx_bool          saturate,
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc1,
+		const vx_size    src1Stride[],
+		const vx_uint8 * pSrc2,
+		const vx_size    src2Stride[]
+	)
+{
+	return HafCpu_TensorAddSubtract(true, num_dims, dims, data_type, saturate ? true : false, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride);
+}
+
+int HafCpu_TensorMultiply_DATA_DATA_DATA
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_enum          data_type,
+		vx_uint32        fixed_point_pos,
+		vx_float32       scale,
+		vx_bool          saturate,
+		vx_bool          roundToNearestEven,
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc1,
+		const vx_size    src1Stride[],
+		const vx_uint8 * pSrc2,
+		const vx_size    src2Stride[]
+	)
+{
+	// integer results are computed as round(src1 * src2 * scale) in the fixed-point format of the inputs
+	const vx_float64 factor = (vx_float64)scale / (vx_float64)(1 << fixed_point_pos);
+	const bool sat = saturate ? true : false;
+	auto round = [=](vx_float64 v) { return roundToNearestEven ? nearbyint(v) : trunc(v); };
+	if (data_type == VX_TYPE_UINT8) {
+		HafCpu_TensorBinaryScalar<vx_uint8>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride,
+			[=](vx_uint8 a, vx_uint8 b) { return HafCpu_TensorConvert<vx_uint8>(round((vx_float64)a * b * factor), sat); });
+	}
+	else if (data_type == VX_TYPE_INT8) {
+		HafCpu_TensorBinaryScalar<vx_int8>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride,
+			[=](vx_int8 a, vx_int8 b) { return HafCpu_TensorConvert<vx_int8>(round((vx_float64)a * b * factor), sat); });
+	}
+	else if (data_type == VX_TYPE_INT16) {
+		HafCpu_TensorBinaryScalar<vx_int16>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride,
+			[=](vx_int16 a, vx_int16 b) { return HafCpu_TensorConvert<vx_int16>(round((vx_float64)a * b * factor), sat); });
+	}
+	else if (data_type == VX_TYPE_FLOAT32) {
+		const __m128 scaleX4 = _mm_set1_ps(scale);
+		HafCpu_TensorBinary<vx_float32>(num_dims, dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride,
+			[=](__m128i a, __m128i b) { return _mm_castps_si128(_mm_mul_ps(_mm_mul_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)), scaleX4)); },
+			[=](vx_float32 a, vx_float32 b) { return a * b * scale; });
+	}
+	else {
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_TensorTableLookup_DATA_DATA_DATA
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_enum          data_type,
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc,
+		const vx_size    srcStride[],
+		const vx_uint8 * pLut,
+		vx_uint32        lutCount,
+		vx_uint32        lutOffset
+	)
+{
+	const vx_size width = dims[0];
+	if (data_type == VX_TYPE_UINT8) {
+		HafCpu_TensorForEachRow(num_dims, dims, dstStride, srcStride, srcStride, [&](vx_size dstOffset, vx_size srcOffset, vx_size) {
+			vx_uint8 * pLocalDst = pDst + dstOffset;
+			const vx_uint8 * pLocalSrc = pSrc + srcOffset;
+			for (vx_size x = 0; x < width; x++)
+				pLocalDst[x] = pLut[pLocalSrc[x]];
+		});
+	}
+	else if (data_type == VX_TYPE_INT16) {
+		// indices outside of the table are clamped to its first/last entry
+		const vx_int16 * pLut16 = (const vx_int16 *)pLut;
+		const vx_int32 maxIndex = (vx_int32)lutCount - 1;
+		HafCpu_TensorForEachRow(num_dims, dims, dstStride, srcStride, srcStride, [&](vx_size dstOffset, vx_size srcOffset, vx_size) {
+			vx_int16 * pLocalDst = (vx_int16 *)(pDst + dstOffset);
+			const vx_int16 * pLocalSrc = (const vx_int16 *)(pSrc + srcOffset);
+			for (vx_size x = 0; x < width; x++) {
+				vx_int32 index = (vx_int32)lutOffset + pLocalSrc[x];
+				index = index < 0 ? 0 : (index > maxIndex ? maxIndex : index);
+				pLocalDst[x] = pLut16[index];
+			}
+		});
+	}
+	else {
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	}
+	return AGO_SUCCESS;
+}
+
+template <typename T>
+static void HafCpu_TensorTransposeTyped
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc,
+		const vx_size    srcStride[],
+		vx_size          otherDim
+	)
+{
+	if (otherDim == 0) {
+		// dimension 0 stays in place: copy whole rows
+		const vx_size rowSize = dims[0] * sizeof(T);
+		HafCpu_TensorForEachRow(num_dims, dims, dstStride, srcStride, srcStride, [&](vx_size dstOffset, vx_size srcOffset, vx_size) {
+			memcpy(pDst + dstOffset, pSrc + srcOffset, rowSize);
+		});
+		return;
+	}
+	// dimension 0 is swapped with otherDim: transpose the (0, otherDim) planes in cache sized tiles
+	// and walk the remaining dimensions, with otherDim folded into a single row of the walk
+	const vx_size tile = 32;
+	vx_size outerDims[AGO_MAX_TENSOR_DIMENSIONS], outerDstStride[AGO_MAX_TENSOR_DIMENSIONS], outerSrcStride[AGO_MAX_TENSOR_DIMENSIONS];
+	vx_size outerCount = 1;
+	outerDims[0] = 1; outerDstStride[0] = 0; outerSrcStride[0] = 0;
+	for (vx_size d = 1; d < num_dims; d++) {
+		if (d != otherDim) {
+			outerDims[outerCount] = dims[d];
+			outerDstStride[outerCount] = dstStride[d];
+			outerSrcStride[outerCount] = srcStride[d];
+			outerCount++;
+		}
+	}
+	const vx_size width = dims[0], height = dims[otherDim];
+	const vx_size dstRowStride = dstStride[otherDim], srcColStride = srcStride[0];
+	HafCpu_TensorForEachRow(outerCount, outerDims, outerDstStride, outerSrcStride, outerSrcStride, [&](vx_size dstOffset, vx_size srcOffset, vx_size) {
+		for (vx_size y0 = 0; y0 < height; y0 += tile) {
+			vx_size y1 = std::min(y0 + tile, height);
+			for (vx_size x0 = 0; x0 < width; x0 += tile) {
+				vx_size x1 = std::min(x0 + tile, width);
+				for (vx_size y = y0; y < y1; y++) {
+					T * pLocalDst = (T *)(pDst + dstOffset + y * dstRowStride);
+					const vx_uint8 * pLocalSrc = pSrc + srcOffset + y * sizeof(T);
+					for (vx_size x = x0; x < x1; x++)
+						pLocalDst[x] = *(const T *)(pLocalSrc + x * srcColStride);
+				}
+			}
+		}
+	});
+}
+
+int HafCpu_TensorTranspose_DATA_DATA
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_size          elementSize,
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc,
+		const vx_size    srcStride[],
+		vx_size          dimension1,
+		vx_size          dimension2
+	)
+{
+	// walk the output with the strides of the swapped source dimensions
+	vx_size srcStrideSwapped[AGO_MAX_TENSOR_DIMENSIONS];
+	for (vx_size d = 0; d < num_dims; d++)
+		srcStrideSwapped[d] = srcStride[d];
+	srcStrideSwapped[dimension1] = srcStride[dimension2];
+	srcStrideSwapped[dimension2] = srcStride[dimension1];
+	vx_size otherDim = (dimension1 == dimension2) ? 0 : (dimension1 == 0 ? dimension2 : (dimension2 == 0 ? dimension1 : 0));
+	if (otherDim && srcStrideSwapped[otherDim] != elementSize)
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	switch (elementSize) {
+	case 1: HafCpu_TensorTransposeTyped<vx_uint8>(num_dims, dims, pDst, dstStride, pSrc, srcStrideSwapped, otherDim); break;
+	case 2: HafCpu_TensorTransposeTyped<vx_uint16>(num_dims, dims, pDst, dstStride, pSrc, srcStrideSwapped, otherDim); break;
+	case 4: HafCpu_TensorTransposeTyped<vx_uint32>(num_dims, dims, pDst, dstStride, pSrc, srcStrideSwapped, otherDim); break;
+	case 8: HafCpu_TensorTransposeTyped<vx_uint64>(num_dims, dims, pDst, dstStride, pSrc, srcStrideSwapped, otherDim); break;
+	default: return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	}
+	return AGO_SUCCESS;
+}
+
+template <typename TSrc, typename TDst>
+static void HafCpu_TensorConvertDepthTyped
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		vx_uint32        dst_fixed_point_pos,
+		const vx_uint8 * pSrc,
+		const vx_size    srcStride[],
+		vx_uint32        src_fixed_point_pos,
+		bool             saturate,
+		vx_float32       norm,
+		vx_float32       offset
+	)
+{
+	// output = ((input - offset) / norm) on real values, so fixed-point inputs and outputs are rescaled
+	const vx_float64 srcScale = 1.0 / (vx_float64)(1 << src_fixed_point_pos);
+	const vx_float64 dstScale = (vx_float64)(1 << dst_fixed_point_pos) / (vx_float64)norm;
+	const vx_size width = dims[0];
+	HafCpu_TensorForEachRow(num_dims, dims, dstStride, srcStride, srcStride, [&](vx_size dstOffset, vx_size srcOffset, vx_size) {
+		TDst * pLocalDst = (TDst *)(pDst + dstOffset);
+		const TSrc * pLocalSrc = (const TSrc *)(pSrc + srcOffset);
+		for (vx_size x = 0; x < width; x++)
+			pLocalDst[x] = HafCpu_TensorConvert<TDst>(((vx_float64)pLocalSrc[x] * srcScale - offset) * dstScale, saturate);
+	});
+}
+
+template <typename TSrc>
+static int HafCpu_TensorConvertDepthFrom
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		vx_enum          dst_data_type,
+		vx_uint32        dst_fixed_point_pos,
+		const vx_uint8 * pSrc,
+		const vx_size    srcStride[],
+		vx_uint32        src_fixed_point_pos,
+		bool             saturate,
+		vx_float32       norm,
+		vx_float32       offset
+	)
+{
+	switch (dst_data_type) {
+	case VX_TYPE_UINT8: HafCpu_TensorConvertDepthTyped<TSrc, vx_uint8>(num_dims, dims, pDst, dstStride, dst_fixed_point_pos, pSrc, srcStride, src_fixed_point_pos, saturate, norm, offset); break;
+	case VX_TYPE_INT8: HafCpu_TensorConvertDepthTyped<TSrc, vx_int8>(num_dims, dims, pDst, dstStride, dst_fixed_point_pos, pSrc, srcStride, src_fixed_point_pos, saturate, norm, offset); break;
+	case VX_TYPE_INT16: HafCpu_TensorConvertDepthTyped<TSrc, vx_int16>(num_dims, dims, pDst, dstStride, dst_fixed_point_pos, pSrc, srcStride, src_fixed_point_pos, saturate, norm, offset); break;
+	case VX_TYPE_FLOAT32: HafCpu_TensorConvertDepthTyped<TSrc, vx_float32>(num_dims, dims, pDst, dstStride, dst_fixed_point_pos, pSrc, srcStride, src_fixed_point_pos, saturate, norm, offset); break;
+	default: return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_TensorConvertDepth_DATA_DATA
+	(
+		vx_size          num_dims,
+		const vx_size    dims[],
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		vx_enum          dst_data_type,
+		vx_uint32        dst_fixed_point_pos,
+		const vx_uint8 * pSrc,
+		const vx_size    srcStride[],
+		vx_enum          src_data_type,
+		vx_uint32        src_fixed_point_pos,
+		vx_bool          saturate,
+		vx_float32       norm,
+		vx_float32       offset
+	)
+{
+	const vx_size width = dims[0];
+	const vx_float32 invNorm = 1.0f / norm;
+	if (dst_data_type == VX_TYPE_FLOAT32 && src_data_type == VX_TYPE_FLOAT32) {
+		// fast path for float normalization
+		const __m128 offsetX4 = _mm_set1_ps(offset), invNormX4 = _mm_set1_ps(invNorm);
+		HafCpu_TensorForEachRow(num_dims, dims, dstStride, srcStride, srcStride, [&](vx_size dstOffset, vx_size srcOffset, vx_size) {
+			vx_float32 * pLocalDst = (vx_float32 *)(pDst + dstOffset);
+			const vx_float32 * pLocalSrc = (const vx_float32 *)(pSrc + srcOffset);
+			vx_size x = 0;
+			for (; x + 4 <= width; x += 4)
+				_mm_storeu_ps(pLocalDst + x, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(pLocalSrc + x), offsetX4), invNormX4));
+			for (; x < width; x++)
+				pLocalDst[x] = (pLocalSrc[x] - offset) * invNorm;
+		});
+		return AGO_SUCCESS;
+	}
+	if (dst_data_type == VX_TYPE_FLOAT32 && src_data_type == VX_TYPE_UINT8 && src_fixed_point_pos == 0) {
+		// fast path for 8-bit pixels to normalized float
+		const __m128 offsetX4 = _mm_set1_ps(offset), invNormX4 = _mm_set1_ps(invNorm);
+		HafCpu_TensorForEachRow(num_dims, dims, dstStride, srcStride, srcStride, [&](vx_size dstOffset, vx_size srcOffset, vx_size) {
+			vx_float32 * pLocalDst = (vx_float32 *)(pDst + dstOffset);
+			const vx_uint8 * pLocalSrc = pSrc + srcOffset;
+			vx_size x = 0;
+			for (; x + 16 <= width; x += 16) {
+				__m128i pixels = _mm_loadu_si128((const __m128i *)(pLocalSrc + x));
+				for (int i = 0; i < 4; i++) {
+					__m128 fpixels = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(pixels));
+					_mm_storeu_ps(pLocalDst + x + 4 * i, _mm_mul_ps(_mm_sub_ps(fpixels, offsetX4), invNormX4));
+					pixels = _mm_srli_si128(pixels, 4);
+				}
+			}
+			for (; x < width; x++)
+				pLocalDst[x] = ((vx_float32)pLocalSrc[x] - offset) * invNorm;
+		});
+		return AGO_SUCCESS;
+	}
+	const bool sat = saturate ? true : false;
+	switch (src_data_type) {
+	case VX_TYPE_UINT8: return HafCpu_TensorConvertDepthFrom<vx_uint8>(num_dims, dims, pDst, dstStride, dst_data_type, dst_fixed_point_pos, pSrc, srcStride, src_fixed_point_pos, sat, norm, offset);
+	case VX_TYPE_INT8: return HafCpu_TensorConvertDepthFrom<vx_int8>(num_dims, dims, pDst, dstStride, dst_data_type, dst_fixed_point_pos, pSrc, srcStride, src_fixed_point_pos, sat, norm, offset);
+	case VX_TYPE_INT16: return HafCpu_TensorConvertDepthFrom<vx_int16>(num_dims, dims, pDst, dstStride, dst_data_type, dst_fixed_point_pos, pSrc, srcStride, src_fixed_point_pos, sat, norm, offset);
+	case VX_TYPE_FLOAT32: return HafCpu_TensorConvertDepthFrom<vx_float32>(num_dims, dims, pDst, dstStride, dst_data_type, dst_fixed_point_pos, pSrc, srcStride, src_fixed_point_pos, sat, norm, offset);
+	default: return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	}
+}
+
+// computes R rows of C = A * B for float matrices: A rows are read element by element with
+// stride lda (in elements) along k, B is row-major with ldb floats per row
+#if USE_AVX
+template <int R>
+static AGO_TARGET_AVX2 void HafCpu_TensorMatMulRows_F32_AVX2
+	(
+		vx_size            N,
+		vx_size            K,
+		vx_float32       * pDst[],
+		const vx_float32 * pA[],
+		vx_size            lda,
+		const vx_float32 * pB,
+		vx_size            ldb
+	)
+{
+	vx_size n = 0;
+	for (; n + 16 <= N; n += 16) {
+		__m256 acc0[R], acc1[R];
+		for (int r = 0; r < R; r++) { acc0[r] = _mm256_setzero_ps(); acc1[r] = _mm256_setzero_ps(); }
+		for (vx_size k = 0; k < K; k++) {
+			const vx_float32 * pBk = pB + k * ldb + n;
+			__m256 b0 = _mm256_loadu_ps(pBk), b1 = _mm256_loadu_ps(pBk + 8);
+			for (int r = 0; r < R; r++) {
+				__m256 a = _mm256_set1_ps(pA[r][k * lda]);
+				acc0[r] = _mm256_add_ps(acc0[r], _mm256_mul_ps(a, b0));
+				acc1[r] = _mm256_add_ps(acc1[r], _mm256_mul_ps(a, b1));
+			}
+		}
+		for (int r = 0; r < R; r++) {
+			_mm256_storeu_ps(pDst[r] + n, acc0[r]);
+			_mm256_storeu_ps(pDst[r] + n + 8, acc1[r]);
+		}
+	}
+	for (; n < N; n++) {
+		for (int r = 0; r < R; r++) {
+			vx_float32 sum = 0.0f;
+			for (vx_size k = 0; k < K; k++)
+				sum += pA[r][k * lda] * pB[k * ldb + n];
+			pDst[r][n] = sum;
+		}
+	}
+}
+#endif
+
+template <int R>
+static void HafCpu_TensorMatMulRows_F32
+	(
+		vx_size            N,
+		vx_size            K,
+		vx_float32       * pDst[],
+		const vx_float32 * pA[],
+		vx_size            lda,
+		const vx_float32 * pB,
+		vx_size            ldb
+	)
+{
+#if USE_AVX
+	if (g_agoCpuFeatures & AGO_CPU_FEATURE_AVX2) {
+		HafCpu_TensorMatMulRows_F32_AVX2<R>(N, K, pDst, pA, lda, pB, ldb);
+		return;
+	}
+#endif
+	vx_size n = 0;
+	for (; n + 8 <= N; n += 8) {
+		__m128 acc0[R], acc1[R];
+		for (int r = 0; r < R; r++) { acc0[r] = _mm_setzero_ps(); acc1[r] = _mm_setzero_ps(); }
+		for (vx_size k = 0; k < K; k++) {
+			const vx_float32 * pBk = pB + k * ldb + n;
+			__m128 b0 = _mm_loadu_ps(pBk), b1 = _mm_loadu_ps(pBk + 4);
+			for (int r = 0; r < R; r++) {
+				__m128 a = _mm_set1_ps(pA[r][k * lda]);
+				acc0[r] = _mm_add_ps(acc0[r], _mm_mul_ps(a, b0));
+				acc1[r] = _mm_add_ps(acc1[r], _mm_mul_ps(a, b1));
+			}
+		}
+		for (int r = 0; r < R; r++) {
+			_mm_storeu_ps(pDst[r] + n, acc0[r]);
+			_mm_storeu_ps(pDst[r] + n + 4, acc1[r]);
+		}
+	}
+	for (; n < N; n++) {
+		for (int r = 0; r < R; r++) {
+			vx_float32 sum = 0.0f;
+			for (vx_size k = 0; k < K; k++)
+				sum += pA[r][k * lda] * pB[k * ldb + n];
+			pDst[r][n] = sum;
+		}
+	}
+}
+
+template <typename T>
+static void HafCpu_TensorMatMul_Integer
+	(
+		vx_uint32        fixed_point_pos,
+		vx_size          M,
+		vx_size          N,
+		vx_size          K,
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc1,
+		const vx_size    src1Stride[],
+		const vx_uint8 * pSrc2,
+		const vx_size    src2Stride[],
+		const vx_uint8 * pSrc3,
+		const vx_size    src3Stride[]
+	)
+{
+	for (vx_size m = 0; m < M; m++) {
+		T * pLocalDst = (T *)(pDst + m * dstStride[1]);
+		const vx_uint8 * pA = pSrc1 + m * src1Stride[1];
+		for (vx_size n = 0; n < N; n++) {
+			const vx_uint8 * pB = pSrc2 + n * src2Stride[0];
+			vx_int64 sum = 0;
+			for (vx_size k = 0; k < K; k++)
+				sum += (vx_int64)*(const T *)(pA + k * src1Stride[0]) * *(const T *)(pB + k * src2Stride[1]);
+			sum >>= fixed_point_pos;
+			if (pSrc3)
+				sum += *(const T *)(pSrc3 + m * src3Stride[1] + n * src3Stride[0]);
+			pLocalDst[n] = HafCpu_TensorSaturate<T>(sum);
+		}
+	}
+}
+
+int HafCpu_TensorMatrixMultiply_DATA_DATA_DATA
+	(
+		vx_enum          data_type,
+		vx_uint32        fixed_point_pos,
+		vx_size          M,
+		vx_size          N,
+		vx_size          K,
+		vx_uint8       * pDst,
+		const vx_size    dstStride[],
+		const vx_uint8 * pSrc1,
+		const vx_size    src1Stride[],
+		const vx_uint8 * pSrc2,
+		const vx_size    src2Stride[],
+		const vx_uint8 * pSrc3,
+		const vx_size    src3Stride[],
+		vx_float32     * pScratch
+	)
+{
+	// strides are in bytes: [0] along the columns and [1] along the rows of each (already transposed)
+	// matrix, i.e., input1 is MxK, input2 is KxN, input3 (optional) and output are MxN
+	if (data_type == VX_TYPE_UINT8) {
+		HafCpu_TensorMatMul_Integer<vx_uint8>(fixed_point_pos, M, N, K, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, pSrc3, src3Stride);
+	}
+	else if (data_type == VX_TYPE_INT8) {
+		HafCpu_TensorMatMul_Integer<vx_int8>(fixed_point_pos, M, N, K, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, pSrc3, src3Stride);
+	}
+	else if (data_type == VX_TYPE_INT16) {
+		HafCpu_TensorMatMul_Integer<vx_int16>(fixed_point_pos, M, N, K, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride, pSrc3, src3Stride);
+	}
+	else if (data_type == VX_TYPE_FLOAT32) {
+		// the micro-kernel needs rows of input2 to be contiguous: pack it into the scratch buffer otherwise
+		const vx_float32 * pB = (const vx_float32 *)pSrc2;
+		vx_size ldb = src2Stride[1] / sizeof(vx_float32);
+		if (src2Stride[0] != sizeof(vx_float32) || (src2Stride[1] % sizeof(vx_float32)) != 0) {
+			if (!pScratch)
+				return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+			for (vx_size k = 0; k < K; k++)
+				for (vx_size n = 0; n < N; n++)
+					pScratch[k * N + n] = *(const vx_float32 *)(pSrc2 + k * src2Stride[1] + n * src2Stride[0]);
+			pB = pScratch;
+			ldb = N;
+		}
+		// input1 is read one element at a time, so any layout works as long as it is float aligned
+		if ((src1Stride[0] | src1Stride[1]) % sizeof(vx_float32))
+			return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+		const vx_size lda = src1Stride[0] / sizeof(vx_float32);
+		vx_size m = 0;
+		for (; m + 4 <= M; m += 4) {
+			vx_float32 * pDstRows[4];
+			const vx_float32 * pARows[4];
+			for (int r = 0; r < 4; r++) {
+				pDstRows[r] = (vx_float32 *)(pDst + (m + r) * dstStride[1]);
+				pARows[r] = (const vx_float32 *)(pSrc1 + (m + r) * src1Stride[1]);
+			}
+			HafCpu_TensorMatMulRows_F32<4>(N, K, pDstRows, pARows, lda, pB, ldb);
+		}
+		for (; m < M; m++) {
+			vx_float32 * pDstRows[1] = { (vx_float32 *)(pDst + m * dstStride[1]) };
+			const vx_float32 * pARows[1] = { (const vx_float32 *)(pSrc1 + m * src1Stride[1]) };
+			HafCpu_TensorMatMulRows_F32<1>(N, K, pDstRows, pARows, lda, pB, ldb);
+		}
+		if (pSrc3) {
+			for (m = 0; m < M; m++) {
+				vx_float32 * pLocalDst = (vx_float32 *)(pDst + m * dstStride[1]);
+				for (vx_size n = 0; n < N; n++)
+					pLocalDst[n] += *(const vx_float32 *)(pSrc3 + m * src3Stride[1] + n * src3Stride[0]);
+			}
+		}
+	}
+	else {
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	}
+	return AGO_SUCCESS;
+}
@@ -23,6 +23,40 @@ THE SOFTWARE.
 
 #include "ago_internal.h"
 #include <mutex>
+#include <unordered_set>
+
+static vx_uint64 agoIssueGraphTicket(AgoGraph * graph)
+{
+    std::lock_guard<std::mutex> lock(graph->ticketMutex);
+    return ++graph->ticketScheduleCount;
+}
+
+static bool agoIsGraphTicketComplete(AgoGraph * graph, vx_uint64 ticket)
+{
+    // must be called with graph->ticketMutex held
+    return ticket <= graph->ticketCompleteCount || graph->ticketCompleteSet.count(ticket) > 0;
+}
+
+static void agoCompleteGraphTicket(AgoGraph * graph, vx_uint64 ticket, vx_status status)
+{
+    // invoke the callback before marking the ticket complete so that the graph
+    // can't be released by a waiting application while the callback is running
+    if (graph->completionCallback) {
+        graph->completionCallback(graph, ticket, status, graph->completionCallbackData);
+    }
+    {
+        std::lock_guard<std::mutex> lock(graph->ticketMutex);
+        graph->ticketStatus[(size_t)(ticket % AGO_GRAPH_TICKET_HISTORY)] = status;
+        // executions can finish out of schedule order: advance the count only over contiguous tickets
+        graph->ticketCompleteSet.insert(ticket);
+        auto it = graph->ticketCompleteSet.begin();
+        while (it != graph->ticketCompleteSet.end() && *it == graph->ticketCompleteCount + 1) {
+            graph->ticketCompleteCount++;
+            it = graph->ticketCompleteSet.erase(it);
+        }
+    }
+    graph->ticketCv.notify_all();
+}
 
 #if _WIN32
 static DWORD WINAPI agoGraphThreadFunction(LPVOID graph_)
@@ -31,26 +65,32 @@ static void agoGraphThreadFunction(LPVOID graph_)
 #endif
 {
     AgoGraph * graph = (AgoGraph *)graph_;
+    if (!graph->cpu_affinity.empty()) {
+        agoSetThreadAffinity(nullptr, graph->cpu_affinity);
+    }
     while (WaitForSingleObject(graph->hSemToThread, INFINITE) == WAIT_OBJECT_0) {
-        graph->threadThreadWaitState = 2;
         if (graph->threadThreadTerminationState)
             break;
+        vx_uint64 ticket;
+        {
+            std::lock_guard<std::mutex> lock(graph->ticketMutex);
+            ticket = graph->threadTicketQueue.front();
+            graph->threadTicketQueue.pop_front();
+        }
 
-        // execute graph
+        // execute graph and inform caller
         graph->status = agoProcessGraph(graph);
-
-        // inform caller
-        graph->threadExecuteCount++;
-        ReleaseSemaphore(graph->hSemFromThread, 1, nullptr);
+        agoCompleteGraphTicket(graph, ticket, graph->status);
     }
-    // inform caller about termination
     graph->threadThreadTerminationState = 2;
-    ReleaseSemaphore(graph->hSemFromThread, 1, nullptr);
 #if _WIN32
     return 0;
 #endif
 }
 
+// number of contexts alive in the process, protected by the global context lock
+static vx_uint32 g_agoContextCount = 0;
+
 AgoContext * agoCreateContextFromPlatform(struct _vx_platform * platform)
 {
     CAgoLockGlobalContext lock;
@@ -83,6 +123,12 @@ AgoContext * agoCreateContextFromPlatform(struct _vx_platform * platform)
         if (agoGetEnvironmentVariable("AGO_THREAD_CONFIG", textBuffer, sizeof(textBuffer))) {
             acontext->thread_config = atoi(textBuffer);
         }
+        if (agoGetEnvironmentVariable("AGO_VXU_GRAPH_CACHE_SIZE", textBuffer, sizeof(textBuffer))) {
+            acontext->immediate_graph_cache_size = (vx_uint32)atoi(textBuffer);
+        }
+        // CPU worker threads are created on demand by graphs with cpu_num_threads > 1
+        acontext->cpu_thread_pool = new CAgoThreadPool;
+        g_agoContextCount++;
     }
     return (AgoContext *)acontext;
 }
@@ -105,11 +151,14 @@ int agoReleaseContext(AgoContext * acontext)
         // release all the resources
         LeaveCriticalSection(&acontext->cs);
         delete acontext;
+        // the host memory pool only serves later contexts: don't keep it while none is alive
+        if (--g_agoContextCount == 0)
+            agoTrimMemoryPool();
     }
     return 0;
 }
 
-AgoGraph * agoCreateGraph(AgoContext * acontext)
+AgoGraph * agoCreateGraph(AgoContext * acontext, bool scheduleThread)
 {
     AgoGraph * agraph = new AgoGraph;
     if (!agraph || !acontext) {
@@ -119,12 +168,38 @@ AgoGraph * agoCreateGraph(AgoContext * acontext)
     // initialize
     agoResetReference(&agraph->ref, VX_TYPE_GRAPH, acontext, NULL);
     agraph->attr_affinity = acontext->attr_affinity;
+    agraph->cpu_affinity = acontext->cpu_affinity;
     char textBuffer[256];
     if (agoGetEnvironmentVariable("VX_GRAPH_ATTRIBUTE_AMD_OPTIMIZER_FLAGS", textBuffer, sizeof(textBuffer))) {
         if (sscanf(textBuffer, "%i", &agraph->optimizer_flags) == 1) {
             agoAddLogEntry(&agraph->ref, VX_SUCCESS, "DEBUG: VX_GRAPH_ATTRIBUTE_AMD_OPTIMIZER_FLAGS = 0x%08x\n", agraph->optimizer_flags);
         }
     }
+    if (agoGetEnvironmentVariable("VX_GRAPH_ATTRIBUTE_AMD_CPU_NUM_THREADS", textBuffer, sizeof(textBuffer))) {
+        if (sscanf(textBuffer, "%u", &agraph->cpu_num_threads) == 1) {
+            agoAddLogEntry(&agraph->ref, VX_SUCCESS, "DEBUG: VX_GRAPH_ATTRIBUTE_AMD_CPU_NUM_THREADS = %u\n", agraph->cpu_num_threads);
+        }
+    }
+    if (agoGetEnvironmentVariable("VX_GRAPH_ATTRIBUTE_AMD_PIPELINE_STAGES", textBuffer, sizeof(textBuffer))) {
+        if (sscanf(textBuffer, "%u", &agraph->pipeline_stages) == 1) {
+            agoAddLogEntry(&agraph->ref, VX_SUCCESS, "DEBUG: VX_GRAPH_ATTRIBUTE_AMD_PIPELINE_STAGES = %u\n", agraph->pipeline_stages);
+        }
+    }
+    if (agoGetEnvironmentVariable("VX_GRAPH_ATTRIBUTE_AMD_CPU_TILE_FUSION", textBuffer, sizeof(textBuffer))) {
+        agraph->cpu_tile_fusion = atoi(textBuffer) ? true : false;
+        agoAddLogEntry(&agraph->ref, VX_SUCCESS, "DEBUG: VX_GRAPH_ATTRIBUTE_AMD_CPU_TILE_FUSION = %d\n", agraph->cpu_tile_fusion ? 1 : 0);
+    }
+    if (agoGetEnvironmentVariable("VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_TRACE", textBuffer, sizeof(textBuffer))) {
+        // capture from the start and write the trace into <prefix><graph-number>.json at release
+        static std::atomic<vx_uint32> traceCount{ 0 };
+        agraph->performance_trace = std::string(textBuffer) + std::to_string(traceCount++) + ".json";
+        agoPerfProfileEnable(agraph, true);
+        agoAddLogEntry(&agraph->ref, VX_SUCCESS, "DEBUG: VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_TRACE = %s\n", agraph->performance_trace.c_str());
+    }
+    if (agoGetEnvironmentVariable("VX_GRAPH_ATTRIBUTE_AMD_COMPILED_GRAPH_CACHE", textBuffer, sizeof(textBuffer))) {
+        agraph->compiled_graph_cache = textBuffer;
+        agoAddLogEntry(&agraph->ref, VX_SUCCESS, "DEBUG: VX_GRAPH_ATTRIBUTE_AMD_COMPILED_GRAPH_CACHE = %s\n", textBuffer);
+    }
 
     { // link graph to the context
         CAgoLock lock(acontext->cs);
@@ -132,11 +207,10 @@ AgoGraph * agoCreateGraph(AgoContext * acontext)
         agraph->ref.external_count++;
         acontext->num_active_references++;
     }
-    if (acontext->thread_config & 1) {
+    if ((acontext->thread_config & 1) && scheduleThread) {
         // create semaphore and thread for graph scheduling: limit 1000 pending requests
         agraph->hSemToThread = CreateSemaphore(nullptr, 0, 1000, nullptr);
-        agraph->hSemFromThread = CreateSemaphore(nullptr, 0, 1000, nullptr);
-        if (agraph->hSemToThread == NULL || agraph->hSemFromThread == NULL) {
+        if (agraph->hSemToThread == NULL) {
             agoAddLogEntry(&agraph->ref, VX_FAILURE, "ERROR: CreateSemaphore() failed\n");
             agoReleaseGraph(agraph);
             return nullptr;
@@ -169,22 +243,22 @@ int agoReleaseGraph(AgoGraph * agraph)
         agraph->ref.context->num_active_references--;
     if (agraph->ref.external_count == 0) {
         EnterCriticalSection(&agraph->cs);
+        // stop pipeline stage workers
+        agoResetPipeline(agraph);
+        // write the trace requested with environment variable
+        if (agraph->performance_trace.length() > 0) {
+            agoGraphDumpPerformanceTrace(agraph, agraph->performance_trace.c_str());
+        }
         // stop graph thread
         if (agraph->hThread) {
+            // wake up the graph thread to exit and wait for it
             agraph->threadThreadTerminationState = 1;
             ReleaseSemaphore(agraph->hSemToThread, 1, nullptr);
-            while (agraph->threadThreadTerminationState == 1) {
-                // give a chance for the thread to run in case it is waititng
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
-                ReleaseSemaphore(agraph->hSemToThread, 1, nullptr);
-            }
+            WaitForSingleObject(agraph->hThread, INFINITE);
+            CloseHandle(agraph->hThread);
             if (agraph->hSemToThread) {
                 CloseHandle(agraph->hSemToThread);
             }
-            if (agraph->hSemFromThread) {
-                CloseHandle(agraph->hSemFromThread);
-            }
-            CloseHandle(agraph->hThread);
         }
         // deinitialize the graph
         for (AgoNode * node = agraph->nodeList.head; node; node = node->next)
@@ -1340,6 +1414,14 @@ vx_status agoVerifyNode(AgoNode * node)
                             data->u.img.height = meta->data.u.img.height;
                             updated = true;
                         }
+                        // graph parameters switched to other dimensions resize the virtual images that follow them
+                        if (graph->rebindResize && !data->numChildren && !data->parent && !data->u.img.isROI && !data->u.img.isUniform &&
+                            (data->u.img.width != meta->data.u.img.width || data->u.img.height != meta->data.u.img.height))
+                        {
+                            data->u.img.width = meta->data.u.img.width;
+                            data->u.img.height = meta->data.u.img.height;
+                            updated = true;
+                        }
                     }
                     // make sure that the data come from output validator matches with object
                     if (data->u.img.format != meta->data.u.img.format) {
@@ -1652,6 +1734,298 @@ int agoVerifyGraph(AgoGraph * graph)
     return status;
 }
 
+static vx_status agoVerifyNodeRebind(AgoNode * node)
+{
+    // validate a node of a verified graph again: keep the hierarchy computed at verify
+    vx_uint32 hierarchical_level = node->hierarchical_level;
+    vx_uint32 dataLevel[AGO_MAX_PARAMS] = { 0 };
+    for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
+        if (node->paramList[arg])
+            dataLevel[arg] = node->paramList[arg]->hierarchical_level;
+    }
+    AgoData * dataUserBufferGPU = node->akernel->gpu_buffer_update_callback_f ? node->paramList[node->akernel->gpu_buffer_update_param_index] : nullptr;
+    if (dataUserBufferGPU) {
+        dataUserBufferGPU->ownerOfUserBufferGPU = nullptr;
+        dataUserBufferGPU->u.img.enableUserBufferGPU = vx_false_e;
+    }
+    vx_status status = agoVerifyNode(node);
+    node->hierarchical_level = hierarchical_level;
+    for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
+        if (node->paramList[arg])
+            node->paramList[arg]->hierarchical_level = dataLevel[arg];
+    }
+    return status;
+}
+
+static vx_status agoReinitializeNode(AgoNode * node)
+{
+    // release the node resources that depend on its parameters and initialize the node again
+    AgoKernel * kernel = node->akernel;
+    vx_status status = VX_SUCCESS;
+    if (kernel->func) {
+        status = kernel->func(node, ago_kernel_cmd_shutdown);
+        if (status == VX_SUCCESS) {
+            if (node->localDataPtr_allocated) {
+                agoReleaseMemory(node->localDataPtr_allocated);
+                node->localDataPtr = node->localDataPtr_allocated = nullptr;
+            }
+            node->localDataSize = 0;
+            status = kernel->func(node, ago_kernel_cmd_initialize);
+        }
+        if (status == VX_SUCCESS && node->localDataSize > 0 && !node->localDataPtr) {
+            node->localDataPtr = node->localDataPtr_allocated = (vx_uint8 *)agoAllocMemory(node->localDataSize);
+            if (!node->localDataPtr)
+                return VX_ERROR_NO_MEMORY;
+        }
+    }
+    else {
+        if (kernel->deinitialize_f)
+            status = kernel->deinitialize_f(node, (vx_reference *)node->paramList, node->paramCount);
+        if (status == VX_SUCCESS && kernel->initialize_f)
+            status = kernel->initialize_f(node, (vx_reference *)node->paramList, node->paramCount);
+    }
+    return status;
+}
+
+static std::vector<AgoNode *> agoSwitchGraphData(AgoGraph * graph, AgoNode * pnode, vx_uint32 index, AgoData * dataFind, AgoData * data)
+{
+    // point node and supernode parameters that use dataFind (or its planes/levels) to data and return the nodes affected
+    std::vector<AgoNode *> affectedList;
+    for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+        bool affected = false;
+        for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
+            AgoData * rebind = node->paramList[arg] ? agoGetRebindData(node->paramList[arg], dataFind, data) : nullptr;
+            if (rebind) {
+                rebind->hierarchical_level = node->paramList[arg]->hierarchical_level;
+                node->paramList[arg] = rebind;
+                affected = true;
+            }
+            rebind = node->paramListForAgeDelay[arg] ? agoGetRebindData(node->paramListForAgeDelay[arg], dataFind, data) : nullptr;
+            if (rebind) {
+                node->paramListForAgeDelay[arg] = rebind;
+            }
+        }
+        if (affected) {
+            affectedList.push_back(node);
+        }
+    }
+    if (pnode->paramList[index] == dataFind) {
+        // original node got replaced by the optimizer
+        pnode->paramList[index] = pnode->paramListForAgeDelay[index] = data;
+    }
+    agoReleaseData(dataFind, false);
+    agoRetainData(graph, data, false);
+    for (AgoCpuSuperNode * supernode = graph->cpuSupernodeList; supernode; supernode = supernode->next) {
+        for (auto& item : supernode->dataList) {
+            AgoData * rebind = agoGetRebindData(item, dataFind, data);
+            if (rebind) item = rebind;
+        }
+    }
+#if (ENABLE_OPENCL || ENABLE_HIP)
+    for (AgoSuperNode * supernode = graph->supernodeList; supernode; supernode = supernode->next) {
+        for (size_t i = 0; i < supernode->dataList.size(); i++) {
+            AgoData * rebind = agoGetRebindData(supernode->dataList[i], dataFind, data);
+            if (rebind) supernode->dataList[i] = rebind;
+            rebind = agoGetRebindData(supernode->dataListForAgeDelay[i], dataFind, data);
+            if (rebind) supernode->dataListForAgeDelay[i] = rebind;
+        }
+    }
+#endif
+    return affectedList;
+}
+
+int agoRebindGraphParameter(AgoGraph * graph, AgoNode * pnode, vx_uint32 index, AgoData * data)
+{
+    // replace a parameter of a verified graph with an object of same layout without going through the optimizer:
+    // only the nodes that use the object (or its planes/levels) are validated again. An image of different
+    // dimensions is accepted too: its nodes and the virtual images they write are validated and allocated
+    // again by agoVerifyGraphRebind() once all parameters are switched, i.e., at the next vxVerifyGraph
+    AgoData * dataFind = pnode->paramList[index];
+    if (dataFind == data)
+        return VX_SUCCESS;
+    bool resize = dataFind && !agoIsSameDataLayout(dataFind, data) && agoIsResizableData(dataFind, data) && !graph->pipeline;
+#if (ENABLE_OPENCL || ENABLE_HIP)
+    // GPU supernodes are compiled for the dimensions of their images
+    for (AgoNode * node = graph->nodeList.head; node && resize; node = node->next) {
+        if (node->attr_affinity.device_type == AGO_KERNEL_FLAG_DEVICE_GPU || node->akernel->opencl_buffer_access_enable)
+            resize = false;
+    }
+#endif
+    if (!dataFind || dataFind->ref.type != data->ref.type || data->isVirtual || agoIsPartOfDelay(dataFind) || agoIsPartOfDelay(data) || !(resize || agoIsSameDataLayout(dataFind, data))) {
+        char name[1024];
+        agoGetDataName(name, dataFind);
+        agoAddLogEntry(&graph->ref, VX_ERROR_NOT_SUPPORTED, "ERROR: agoRebindGraphParameter: verified graph needs an object with same layout as %s\n", name[0] ? name : "<?>");
+        return VX_ERROR_NOT_SUPPORTED;
+    }
+    if (agoAllocData(data)) {
+        agoAddLogEntry(&graph->ref, VX_ERROR_NO_MEMORY, "ERROR: agoRebindGraphParameter: agoAllocData failed\n");
+        return VX_ERROR_NO_MEMORY;
+    }
+
+    // point node parameters to the new object
+    std::vector<AgoNode *> affectedList = agoSwitchGraphData(graph, pnode, index, dataFind, data);
+#if (ENABLE_OPENCL || ENABLE_HIP)
+    for (AgoNode * node : affectedList) {
+        if (node->attr_affinity.device_type == AGO_KERNEL_FLAG_DEVICE_GPU || node->akernel->opencl_buffer_access_enable) {
+            for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
+                AgoData * adata = node->paramList[arg];
+#if ENABLE_OPENCL
+                if (adata && !adata->opencl_buffer && !adata->isVirtual && agoGpuOclAllocBuffer(adata) < 0) {
+#else
+                if (adata && !adata->hip_memory && !adata->isVirtual && agoGpuHipAllocBuffer(adata) < 0) {
+#endif
+                    return VX_ERROR_NO_MEMORY;
+                }
+            }
+        }
+    }
+#endif
+
+    if (resize || !graph->rebindNodeList.empty()) {
+        // dimensions change: other parameters may have to be switched before the nodes validate
+        for (AgoNode * node : affectedList) {
+            if (std::find(graph->rebindNodeList.begin(), graph->rebindNodeList.end(), node) == graph->rebindNodeList.end())
+                graph->rebindNodeList.push_back(node);
+        }
+        graph->verified = vx_false_e;
+        graph->isReadyToExecute = vx_false_e;
+        graph->state = VX_GRAPH_STATE_UNVERIFIED;
+        return VX_SUCCESS;
+    }
+
+    // run validators of the affected nodes only: hierarchy and buffers of the graph stay as they are
+    vx_status status = VX_SUCCESS;
+    for (AgoNode * node : affectedList) {
+        status = agoVerifyNodeRebind(node);
+        if (status == VX_SUCCESS && node->akernel->user_kernel) {
+            // user kernels may keep references to their parameters in local data
+            status = agoReinitializeNode(node);
+        }
+        if (status) {
+            break;
+        }
+    }
+    if (status == VX_SUCCESS && agoPrepareImageValidRectangleBuffers(graph) == VX_SUCCESS && agoComputeImageValidRectangleOutputs(graph) == VX_SUCCESS) {
+        return VX_SUCCESS;
+    }
+    // graph needs to go through vxVerifyGraph
+    graph->verified = vx_false_e;
+    graph->isReadyToExecute = vx_false_e;
+    graph->state = VX_GRAPH_STATE_UNVERIFIED;
+    return status ? status : VX_FAILURE;
+}
+
+int agoDetachGraphParameter(AgoGraph * graph, AgoNode * pnode, vx_uint32 index, AgoData * placeholder)
+{
+    // replace a parameter of a verified graph with an object of same layout so that the graph no longer references
+    // the object: the placeholder is neither allocated nor validated, so the parameter has to be switched again with
+    // agoRebindGraphParameter() before the graph executes
+    AgoData * dataFind = pnode->paramList[index];
+    if (dataFind == placeholder)
+        return VX_SUCCESS;
+    if (!dataFind || placeholder->isVirtual || agoIsPartOfDelay(dataFind) || !agoIsSameDataLayout(dataFind, placeholder)) {
+        char name[1024];
+        agoGetDataName(name, dataFind);
+        agoAddLogEntry(&graph->ref, VX_ERROR_NOT_SUPPORTED, "ERROR: agoDetachGraphParameter: verified graph needs an object with same layout as %s\n", name[0] ? name : "<?>");
+        return VX_ERROR_NOT_SUPPORTED;
+    }
+    agoSwitchGraphData(graph, pnode, index, dataFind, placeholder);
+    return VX_SUCCESS;
+}
+
+int agoVerifyGraphRebind(AgoGraph * graph)
+{
+    // graph parameters got switched to images of different dimensions after verify: validate the nodes
+    // that use them and the nodes reading the virtual images they resize, in hierarchical order, and
+    // allocate those virtual images again. Graph hierarchy and the other buffers stay as they are
+    std::vector<AgoNode *> rebindNodeList;
+    rebindNodeList.swap(graph->rebindNodeList);
+    std::unordered_set<AgoNode *> pending(rebindNodeList.begin(), rebindNodeList.end());
+    std::unordered_set<AgoData *> resized;
+    std::vector<AgoNode *> affectedList;
+    vx_status status = VX_SUCCESS;
+    for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+        bool affected = pending.find(node) != pending.end();
+        for (vx_uint32 arg = 0; arg < node->paramCount && !affected; arg++) {
+            if (node->paramList[arg] && resized.find(node->paramList[arg]) != resized.end())
+                affected = true;
+        }
+        if (!affected)
+            continue;
+        affectedList.push_back(node);
+        if (status != VX_SUCCESS) {
+            // consumers of its outputs need to validate again at next verify
+            for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
+                if (node->paramList[arg] && node->parameters[arg].direction != VX_INPUT)
+                    resized.insert(node->paramList[arg]);
+            }
+            continue;
+        }
+        // virtual images written by the node take the dimensions from its output validator
+        vx_uint32 width[AGO_MAX_PARAMS] = { 0 }, height[AGO_MAX_PARAMS] = { 0 };
+        for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
+            AgoData * data = node->paramList[arg];
+            if (data && data->ref.type == VX_TYPE_IMAGE) {
+                width[arg] = data->u.img.width;
+                height[arg] = data->u.img.height;
+            }
+        }
+        graph->rebindResize = true;
+        status = agoVerifyNodeRebind(node);
+        graph->rebindResize = false;
+        for (vx_uint32 arg = 0; arg < node->paramCount && status == VX_SUCCESS; arg++) {
+            AgoData * data = node->paramList[arg];
+            if (data && data->isVirtual && data->ref.type == VX_TYPE_IMAGE && (data->u.img.width != width[arg] || data->u.img.height != height[arg])) {
+                resized.insert(data);
+                if (data->buffer_allocated)
+                    agoReleaseMemory(data->buffer_allocated);
+                data->buffer = data->buffer_allocated = nullptr;
+                if (agoAllocData(data)) {
+                    agoAddLogEntry(&data->ref, VX_ERROR_NO_MEMORY, "ERROR: agoVerifyGraphRebind: agoAllocData failed for %dx%d\n", data->u.img.width, data->u.img.height);
+                    status = VX_ERROR_NO_MEMORY;
+                }
+            }
+        }
+        if (status == VX_SUCCESS)
+            status = agoReinitializeNode(node);
+        if (status != VX_SUCCESS) {
+            for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
+                if (node->paramList[arg] && node->parameters[arg].direction != VX_INPUT)
+                    resized.insert(node->paramList[arg]);
+            }
+        }
+    }
+    // row tiles of CPU supernodes cover the new dimensions
+    for (AgoCpuSuperNode * supernode = graph->cpuSupernodeList; supernode && status == VX_SUCCESS; supernode = supernode->next) {
+        AgoData * img = supernode->dataList.front();
+        vx_size rowSize = 0;
+        for (AgoData * data : supernode->dataList) {
+            if (data->u.img.width != img->u.img.width || data->u.img.height != img->u.img.height) {
+                agoAddLogEntry(&graph->ref, VX_ERROR_INVALID_DIMENSION, "ERROR: agoVerifyGraphRebind: images of a CPU supernode need same dimensions\n");
+                status = VX_ERROR_INVALID_DIMENSION;
+            }
+            rowSize += data->u.img.stride_in_bytes;
+        }
+        supernode->width = img->u.img.width;
+        supernode->height = img->u.img.height;
+        supernode->tile_height = (vx_uint32)max((vx_size)AGO_CPU_TILE_MIN_HEIGHT, AGO_CPU_TILE_WORKING_SET_SIZE / max(rowSize, (vx_size)1));
+    }
+    if (status == VX_SUCCESS) {
+        status = agoPrepareImageValidRectangleBuffers(graph);
+        if (status == VX_SUCCESS)
+            status = agoComputeImageValidRectangleOutputs(graph);
+    }
+    if (status != VX_SUCCESS) {
+        // keep the nodes for the next verify: more parameters may have to be switched
+        graph->rebindNodeList = affectedList;
+        return status;
+    }
+    graph->verified = vx_true_e;
+    graph->isReadyToExecute = vx_true_e;
+    graph->state = VX_GRAPH_STATE_VERIFIED;
+    return VX_SUCCESS;
+}
+
 vx_status agoPrepareImageValidRectangleBuffers(AgoGraph * graph)
 {
     vx_status status = VX_SUCCESS;
@@ -2153,6 +2527,179 @@ int agoUpdateDelaySlots(AgoNode * node)
     return 0;
 }
 
+// outputs are rewritten on every execution: bump their write count so that nodes
+// caching host copies of array/scalar parameters (VX_ARRAY_WRITE_COUNT) refresh them
+static void agoMarkNodeOutputsWritten(AgoNode * node)
+{
+    for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
+        AgoData * data = node->paramList[arg];
+        if (data && node->parameters[arg].direction != VX_INPUT)
+            data->ref.write_count++;
+    }
+}
+
+static int agoExecuteCpuSuperNode(AgoGraph * graph, AgoCpuSuperNode * supernode, vx_int64 frame)
+{
+    // run the nodes one row tile at a time so that intermediate images stay in cache:
+    // a node runs on a tile once the rows it reads from images produced in the group are ready
+    size_t count = supernode->nodeList.size();
+    vx_uint32 height = supernode->height;
+    std::vector<vx_uint32> done(count);
+    std::vector<vx_int64> clocks(count, 0);
+    vx_int64 start = agoGetClockCounter();
+    for (size_t n = 0; n < count; n++) {
+        done[n] = supernode->nodeBorder[n];
+    }
+    for (vx_uint32 tileEnd = supernode->tile_height; ; tileEnd += supernode->tile_height) {
+        tileEnd = min(tileEnd, height);
+        for (size_t n = 0; n < count; n++) {
+            AgoNode * node = supernode->nodeList[n];
+            vx_uint32 border = supernode->nodeBorder[n];
+            vx_uint32 limit = min(tileEnd, height - border);
+            // neighborhood kernels also touch the first pixels of the row after their window
+            vx_uint32 lookahead = border ? border + 1 : 0;
+            for (vx_int32 p : supernode->nodeProducer[n]) {
+                if (p >= 0 && done[p] < height - supernode->nodeBorder[p]) {
+                    limit = min(limit, done[p] > lookahead ? done[p] - lookahead : 0);
+                }
+            }
+            if (limit <= done[n])
+                continue;
+            // point image parameters of the node to rows [done[n]-border, limit+border)
+            vx_uint32 y = done[n] - border, rows = limit - done[n] + 2 * border;
+            AgoData * paramList[AGO_MAX_PARAMS];
+            AgoData * tileData = supernode->tileData + supernode->nodeTileIndex[n];
+            for (vx_uint32 i = 0; i < node->paramCount; i++) {
+                AgoData * data = node->paramList[i];
+                paramList[i] = data;
+                if (data && data->ref.type == VX_TYPE_IMAGE) {
+                    // tile proxies share the identity of the image; access counters stay with the original
+                    tileData[i].ref.platform = data->ref.platform;
+                    tileData[i].ref.magic = data->ref.magic;
+                    tileData[i].ref.type = data->ref.type;
+                    tileData[i].ref.context = data->ref.context;
+                    tileData[i].ref.scope = data->ref.scope;
+                    tileData[i].ref.enable_logging = data->ref.enable_logging;
+                    tileData[i].ref.read_only = data->ref.read_only;
+                    tileData[i].u = data->u;
+                    tileData[i].size = data->size;
+                    tileData[i].buffer = data->buffer + (vx_size)y * data->u.img.stride_in_bytes;
+                    tileData[i].u.img.height = rows;
+                    node->paramList[i] = &tileData[i];
+                }
+            }
+            vx_int64 t0 = agoGetClockCounter();
+            int status = node->akernel->func(node, ago_kernel_cmd_execute);
+            clocks[n] += agoGetClockCounter() - t0;
+            for (vx_uint32 i = 0; i < node->paramCount; i++)
+                node->paramList[i] = paramList[i];
+            if (status) {
+                if (status == AGO_ERROR_KERNEL_NOT_IMPLEMENTED)
+                    status = VX_ERROR_NOT_IMPLEMENTED;
+                agoAddLogEntry((vx_reference)graph, VX_FAILURE, "ERROR: kernel %s exec failed (%d:%s)\n", node->akernel->name, status, agoEnum2Name(status));
+                return status;
+            }
+            done[n] = limit;
+        }
+        if (tileEnd >= height)
+            break;
+    }
+    // the tiles of the nodes interleave: report each node as if its tiles ran back to back
+    vx_int64 now = agoGetClockCounter();
+    for (size_t n = 0; n < count; n++) {
+        AgoNode * node = supernode->nodeList[n];
+        node->perf.beg = now - clocks[n];
+        agoPerfCaptureStop(&node->perf);
+        agoPerfProfileEntry(graph, ago_profile_type_exec_begin, &node->ref, start, frame);
+        start += clocks[n];
+        agoPerfProfileEntry(graph, ago_profile_type_exec_end, &node->ref, start, frame);
+    }
+    return VX_SUCCESS;
+}
+
+static int agoExecuteCpuNode(AgoGraph * graph, AgoNode * node, vx_int64 frame = -1)
+{
+    if (node->cpuSupernode)
+        return agoExecuteCpuSuperNode(graph, node->cpuSupernode, frame);
+    // execute node
+    agoPerfProfileEntry(graph, ago_profile_type_exec_begin, &node->ref, 0, frame);
+    agoPerfCaptureStart(&node->perf);
+    AgoKernel * kernel = node->akernel;
+    int status = VX_SUCCESS;
+    if (kernel->func) {
+        status = kernel->func(node, ago_kernel_cmd_execute);
+        if (status == AGO_ERROR_KERNEL_NOT_IMPLEMENTED)
+            status = VX_ERROR_NOT_IMPLEMENTED;
+    }
+    else if (kernel->kernel_f) {
+        status = kernel->kernel_f(node, (vx_reference *)node->paramList, node->paramCount);
+    }
+    if (status) {
+        if (status == VX_ERROR_GRAPH_ABANDONED)
+            agoAddLogEntry((vx_reference)graph, VX_FAILURE, "INFO: kernel %s exec returned graph_stopped status: (this could mean EOS for amd_media extension (%d))\n", kernel->name, status);
+        else
+            agoAddLogEntry((vx_reference)graph, VX_FAILURE, "ERROR: kernel %s exec failed (%d:%s)\n", kernel->name, status, agoEnum2Name(status));
+        return status;
+    }
+    agoPerfCaptureStop(&node->perf);
+    agoPerfProfileEntry(graph, ago_profile_type_exec_end, &node->ref, 0, frame);
+    return status;
+}
+
+static int agoCompleteCpuSingleNode(AgoGraph * graph, AgoNode * node)
+{
+    // mark that node outputs are dirty
+    for (vx_uint32 i = 0; i < node->paramCount; i++) {
+#if ENABLE_OPENCL
+        AgoData * data = node->paramList[i];
+        if (data && data->opencl_buffer &&
+            (node->parameters[i].direction == VX_OUTPUT || node->parameters[i].direction == VX_BIDIRECTIONAL))
+        {
+            auto dataToSync = (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI) ? data->u.img.roiMasterImage : data;
+            dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
+            dataToSync->buffer_sync_flags |=
+                ((node->akernel->opencl_buffer_access_enable || data->u.img.enableUserBufferGPU)
+                    ? AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL
+                    : AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE);
+        }
+#elif ENABLE_HIP
+        AgoData * data = node->paramList[i];
+        if (data && data->hip_memory &&
+                (node->parameters[i].direction == VX_OUTPUT || node->parameters[i].direction == VX_BIDIRECTIONAL))
+        {
+            auto dataToSync = (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI) ? data->u.img.roiMasterImage : data;
+            dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
+            dataToSync->buffer_sync_flags |=
+                ((node->akernel->opencl_buffer_access_enable || data->u.img.enableUserBufferGPU)
+                    ? AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL
+                    : AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE);
+        }
+#endif
+    }
+    // node callback
+    if (node->callback) {
+        vx_action action = node->callback(node);
+        if (action == VX_ACTION_ABANDON) {
+            graph->state = VX_GRAPH_STATE_ABANDONED;
+            return VX_ERROR_GRAPH_ABANDONED;
+        }
+    }
+    return VX_SUCCESS;
+}
+
+static int agoCompleteCpuNode(AgoGraph * graph, AgoNode * node)
+{
+    if (!node->cpuSupernode)
+        return agoCompleteCpuSingleNode(graph, node);
+    // complete all nodes of the CPU supernode
+    for (AgoNode * anode : node->cpuSupernode->nodeList) {
+        int status = agoCompleteCpuSingleNode(graph, anode);
+        if (status)
+            return status;
+    }
+    return VX_SUCCESS;
+}
+
 int agoExecuteGraph(AgoGraph * graph)
 {
     if (graph->detectedInvalidNode) {
@@ -2171,6 +2718,7 @@ int agoExecuteGraph(AgoGraph * graph)
         status = agoUpdateDelaySlots(node);
         if (status != VX_SUCCESS)
             return status;
+        agoMarkNodeOutputsWritten(node);
     }
 #if (ENABLE_OPENCL||ENABLE_HIP)
     for (AgoSuperNode * supernode = graph->supernodeList; supernode; supernode = supernode->next) {
@@ -2226,6 +2774,14 @@ int agoExecuteGraph(AgoGraph * graph)
     vx_uint32 nodeLaunchHierarchicalLevel = 0;
     memset(&graph->gpu_perf, 0, sizeof(graph->gpu_perf));
 #endif
+    // nodes with no dependencies among each other (i.e., same hierarchical level) can run in parallel
+    // on the context CPU worker pool when the graph is configured with cpu_num_threads > 1
+    CAgoThreadPool * cpuThreadPool = nullptr;
+    std::vector<AgoNode *> cpuNodesParallel;
+    if (graph->cpu_num_threads > 1 && graph->ref.context->cpu_thread_pool) {
+        cpuThreadPool = graph->ref.context->cpu_thread_pool;
+        cpuThreadPool->Reserve(graph->cpu_num_threads);
+    }
     // execute one nodes in one hierarchical level at a time
     bool opencl_buffer_access_enable = false;
     for (auto enode = graph->nodeList.head; enode;) {
@@ -2421,65 +2977,37 @@ int agoExecuteGraph(AgoGraph * graph)
                 }
                 agoPerfProfileEntry(graph, ago_profile_type_copy_end, &node->ref);
 #endif
-                // execute node
-                agoPerfProfileEntry(graph, ago_profile_type_exec_begin, &node->ref);
-                agoPerfCaptureStart(&node->perf);
-                AgoKernel * kernel = node->akernel;
-                status = VX_SUCCESS;
-                if (kernel->func) {
-                    status = kernel->func(node, ago_kernel_cmd_execute);
-                    if (status == AGO_ERROR_KERNEL_NOT_IMPLEMENTED)
-                        status = VX_ERROR_NOT_IMPLEMENTED;
-                }
-                else if (kernel->kernel_f) {
-                    status = kernel->kernel_f(node, (vx_reference *)node->paramList, node->paramCount);
-                }
-                if (status) {
-                    if (status == VX_ERROR_GRAPH_ABANDONED)
-                        agoAddLogEntry((vx_reference)graph, VX_FAILURE, "INFO: kernel %s exec returned graph_stopped status: (this could mean EOS for amd_media extension (%d))\n", kernel->name, status);
-                    else
-                        agoAddLogEntry((vx_reference)graph, VX_FAILURE, "ERROR: kernel %s exec failed (%d:%s)\n", kernel->name, status, agoEnum2Name(status));
-                    return status;
-                }
-                agoPerfCaptureStop(&node->perf);
-                agoPerfProfileEntry(graph, ago_profile_type_exec_end, &node->ref);
-                // mark that node outputs are dirty
-                for (vx_uint32 i = 0; i < node->paramCount; i++) {
-#if ENABLE_OPENCL
-                    AgoData * data = node->paramList[i];
-                    if (data && data->opencl_buffer &&
-                        (node->parameters[i].direction == VX_OUTPUT || node->parameters[i].direction == VX_BIDIRECTIONAL))
-                    {
-                        auto dataToSync = (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI) ? data->u.img.roiMasterImage : data;
-                        dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
-                        dataToSync->buffer_sync_flags |=
-                            ((node->akernel->opencl_buffer_access_enable || data->u.img.enableUserBufferGPU)
-                                ? AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL
-                                : AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE);
-                    }
-#elif ENABLE_HIP
-                    AgoData * data = node->paramList[i];
-                    if (data && data->hip_memory &&
-                            (node->parameters[i].direction == VX_OUTPUT || node->parameters[i].direction == VX_BIDIRECTIONAL))
-                    {
-                        auto dataToSync = (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI) ? data->u.img.roiMasterImage : data;
-                        dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
-                        dataToSync->buffer_sync_flags |=
-                            ((node->akernel->opencl_buffer_access_enable || data->u.img.enableUserBufferGPU)
-                                ? AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL
-                                : AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE);
-                    }
-#endif
+                if (node->cpuSupernode && node != node->cpuSupernode->nodeList.back()) {
+                    // nodes of a CPU supernode run together with its last node
+                    continue;
                 }
-                // node callback
-                if (node->callback) {
-                    vx_action action = node->callback(node);
-                    if (action == VX_ACTION_ABANDON) {
-                        graph->state = VX_GRAPH_STATE_ABANDONED;
-                        return VX_ERROR_GRAPH_ABANDONED;
-                    }
+                if (cpuThreadPool && node->akernel->func && !node->akernel->opencl_buffer_access_enable) {
+                    // defer execution of built-in kernels to run in parallel with other nodes of this level
+                    cpuNodesParallel.push_back(node);
+                    continue;
                 }
+                // execute node
+                status = agoExecuteCpuNode(graph, node);
+                if (status == VX_SUCCESS)
+                    status = agoCompleteCpuNode(graph, node);
+                if (status)
+                    return status;
+            }
+        }
+        if (cpuNodesParallel.size() > 0) {
+            // execute the deferred nodes of current hierarchical level on the CPU worker pool
+            std::vector<int> nodeStatus(cpuNodesParallel.size(), VX_SUCCESS);
+            cpuThreadPool->ParallelFor(cpuNodesParallel.size(), [&](size_t i) {
+                nodeStatus[i] = agoExecuteCpuNode(graph, cpuNodesParallel[i]);
+            });
+            for (size_t i = 0; i < cpuNodesParallel.size(); i++) {
+                status = nodeStatus[i];
+                if (status == VX_SUCCESS)
+                    status = agoCompleteCpuNode(graph, cpuNodesParallel[i]);
+                if (status)
+                    return status;
             }
+            cpuNodesParallel.clear();
         }
     }
 #if (ENABLE_OPENCL||ENABLE_HIP)
@@ -2724,8 +3252,7 @@ vx_status agoDirective(vx_reference reference, vx_enum directive)
             case VX_DIRECTIVE_AMD_ENABLE_PROFILE_CAPTURE:
             case VX_DIRECTIVE_AMD_DISABLE_PROFILE_CAPTURE:
                 if (reference->type == VX_TYPE_GRAPH) {
-                    ((AgoGraph *)reference)->enable_performance_profiling =
-                        (directive == VX_DIRECTIVE_AMD_ENABLE_PROFILE_CAPTURE) ? true : false;
+                    agoPerfProfileEnable((AgoGraph *)reference, (directive == VX_DIRECTIVE_AMD_ENABLE_PROFILE_CAPTURE) ? true : false);
                 }
                 else {
                     status = VX_ERROR_NOT_SUPPORTED;
@@ -2750,6 +3277,13 @@ vx_status agoDirective(vx_reference reference, vx_enum directive)
     return status;
 }
 
+static void agoGetProfileEntryName(char * name, size_t size, const AgoProfileEntry& entry)
+{
+    if (entry.ref->type == VX_TYPE_GRAPH) snprintf(name, size, "GRAPH");
+    else if (entry.ref->type == VX_TYPE_NODE) snprintf(name, size, "%s", ((AgoNode *)entry.ref)->akernel->name);
+    else agoGetDataName(name, (AgoData *)entry.ref);
+}
+
 vx_status agoGraphDumpPerformanceProfile(AgoGraph * graph, const char * fileName)
 {
     bool use_stdout = true;
@@ -2783,23 +3317,23 @@ vx_status agoGraphDumpPerformanceProfile(AgoGraph * graph, const char * fileName
                 node->akernel->name);
         }
     }
-    if (graph->enable_performance_profiling && graph->performance_profile.size() > 0) {
+    // leave the captured entries for agoGraphDumpPerformanceTrace when profiling is disabled
+    std::vector<AgoProfileEntry> entryList;
+    if (graph->enable_performance_profiling)
+        agoPerfProfileRead(graph, entryList);
+    if (entryList.size() > 0) {
         fprintf(fp, "***PROFILER-OUTPUT***\n");
         fprintf(fp, " frame,type,timestamp(ms),object-name\n");
-        int64_t stime = graph->performance_profile[0].time;
-        for (auto entry : graph->performance_profile) {
+        int64_t stime = entryList[0].time;
+        for (auto entry : entryList) {
             char name[1024];
-            if (entry.ref->type == VX_TYPE_GRAPH) strcpy(name, "GRAPH");
-            else if (entry.ref->type == VX_TYPE_NODE) strncpy(name, ((AgoNode *)entry.ref)->akernel->name, sizeof(name) - 1);
-            else agoGetDataName(name, (AgoData *)entry.ref);
+            agoGetProfileEntryName(name, sizeof(name), entry);
             static const char * type_str[] = {
                 "launch(s)", "launch(e)", "wait(s)", "wait(e)", "copy(s)", "copy(e)", "exec(s)", "exec(e)",
                 "8", "9", "10", "11", "12", "13", "14", "15"
             };
             fprintf(fp, "%6d,%-9.9s,%13.3f,%s\n", entry.id, type_str[entry.type], (float)(entry.time - stime) * factor, name);
         }
-        // clear the profiling data
-        graph->performance_profile.clear();
     }
     fflush(fp);
     if (!use_stdout) {
@@ -2808,6 +3342,221 @@ vx_status agoGraphDumpPerformanceProfile(AgoGraph * graph, const char * fileName
     return VX_SUCCESS;
 }
 
+vx_status agoGraphDumpPerformanceTrace(AgoGraph * graph, const char * fileName)
+{
+    // write the entries captured since last dump as Chrome trace event JSON (chrome://tracing, ui.perfetto.dev)
+    FILE * fp = fopen(fileName, "w");
+    if (!fp) {
+        agoAddLogEntry(NULL, VX_FAILURE, "ERROR: unable to create: %s\n", fileName);
+        return VX_FAILURE;
+    }
+    std::vector<AgoProfileEntry> entryList;
+    agoPerfProfileRead(graph, entryList);
+    double factor = 1000000.0 / (double)agoGetClockFrequency(); // to convert clock counter to us
+    fprintf(fp, "{\"traceEvents\":[\n");
+    fprintf(fp, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"%s\"}}", graph->name.length() ? graph->name.c_str() : "GRAPH");
+    for (auto entry : entryList) {
+        static const char * cat_str[] = { "launch", "wait", "copy", "exec" };
+        char name[1024];
+        agoGetProfileEntryName(name, sizeof(name), entry);
+        for (char * s = name; *s; s++) {
+            if (*s == '"' || *s == '\\' || (unsigned char)*s < 0x20)
+                *s = '_';
+        }
+        if (entry.ref == &graph->ref && (entry.type == ago_profile_type_exec_begin || entry.type == ago_profile_type_exec_end)) {
+            // frames of pipelined graphs begin and end on different threads and overlap: use async events keyed by frame
+            fprintf(fp, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%s\",\"id\":%u,\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"args\":{\"frame\":%u}}",
+                name, cat_str[entry.type / 2], (entry.type & 1) ? "e" : "b", entry.id, entry.tid, (double)entry.time * factor, entry.id);
+        }
+        else {
+            fprintf(fp, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%s\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"args\":{\"frame\":%u}}",
+                name, cat_str[entry.type / 2], (entry.type & 1) ? "E" : "B", entry.tid, (double)entry.time * factor, entry.id);
+        }
+    }
+    fprintf(fp, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    fclose(fp);
+    return VX_SUCCESS;
+}
+
+static int agoExecutePipelineStage(AgoGraph * graph, AgoPipelineStage * stage, vx_int64 frame)
+{
+    // point node parameters to the copies of virtual data used by this frame
+    for (auto& param : stage->paramList) {
+        AgoData * data = (*param.copies)[(size_t)(frame % param.copies->size())];
+        param.node->paramList[param.index] = (param.child >= 0) ? data->children[param.child] : data;
+    }
+    for (auto node = stage->snode; node != stage->enode; node = node->next)
+        agoMarkNodeOutputsWritten(node);
+    CAgoThreadPool * cpuThreadPool = nullptr;
+    std::vector<AgoNode *> cpuNodesParallel;
+    if (graph->cpu_num_threads > 1 && graph->ref.context->cpu_thread_pool) {
+        cpuThreadPool = graph->ref.context->cpu_thread_pool;
+        cpuThreadPool->Reserve(graph->cpu_num_threads);
+    }
+    // execute nodes of the stage one hierarchical level at a time
+    int status = VX_SUCCESS;
+    for (auto enode = stage->snode; enode != stage->enode && status == VX_SUCCESS;) {
+        auto hierarchical_level = enode->hierarchical_level;
+        auto snode = enode; enode = enode->next;
+        while (enode != stage->enode && enode->hierarchical_level == hierarchical_level)
+            enode = enode->next;
+        for (auto node = snode; node != enode && status == VX_SUCCESS; node = node->next) {
+            if (node->cpuSupernode && node != node->cpuSupernode->nodeList.back())
+                continue;
+            if (cpuThreadPool && node->akernel->func) {
+                cpuNodesParallel.push_back(node);
+                continue;
+            }
+            status = agoExecuteCpuNode(graph, node, frame);
+            if (status == VX_SUCCESS)
+                status = agoCompleteCpuNode(graph, node);
+        }
+        if (cpuNodesParallel.size() > 0) {
+            std::vector<int> nodeStatus(cpuNodesParallel.size(), VX_SUCCESS);
+            cpuThreadPool->ParallelFor(cpuNodesParallel.size(), [&](size_t i) {
+                nodeStatus[i] = agoExecuteCpuNode(graph, cpuNodesParallel[i], frame);
+            });
+            for (size_t i = 0; i < cpuNodesParallel.size() && status == VX_SUCCESS; i++) {
+                status = nodeStatus[i];
+                if (status == VX_SUCCESS)
+                    status = agoCompleteCpuNode(graph, cpuNodesParallel[i]);
+            }
+            cpuNodesParallel.clear();
+        }
+    }
+    // restore original node parameters
+    for (auto& param : stage->paramList) {
+        AgoData * data = param.copies->front();
+        param.node->paramList[param.index] = (param.child >= 0) ? data->children[param.child] : data;
+    }
+    return status;
+}
+
+static void agoPipelineStageDone(AgoGraph * graph, size_t s, vx_int64 frame, int status)
+{
+    AgoPipeline * pipeline = graph->pipeline;
+    if (s + 1 == pipeline->stageList.size()) {
+        {
+            // agoGetGraphPerf() reads the performance of pipelined graphs under the same lock
+            std::lock_guard<std::mutex> lock(pipeline->mutex);
+            graph->perf.beg = pipeline->frameStartTime[(size_t)(frame % pipeline->frameStartTime.size())];
+            agoPerfCaptureStop(&graph->perf);
+        }
+        agoPerfProfileEntry(graph, ago_profile_type_exec_end, &graph->ref, 0, frame);
+        graph->execFrameCount++;
+        // complete the ticket of this frame: frames skipped after a failure report that failure
+        vx_uint64 ticket = pipeline->frameTicket[(size_t)(frame % pipeline->frameTicket.size())];
+        if (ticket) {
+            vx_status ticketStatus = status;
+            if (ticketStatus == VX_SUCCESS) {
+                std::lock_guard<std::mutex> lock(pipeline->mutex);
+                ticketStatus = pipeline->status;
+            }
+            agoCompleteGraphTicket(graph, ticket, ticketStatus);
+        }
+    }
+    std::unique_lock<std::mutex> lock(pipeline->mutex);
+    if (status != VX_SUCCESS && pipeline->status == VX_SUCCESS)
+        pipeline->status = status;
+    if (s + 1 < pipeline->stageList.size()) {
+        // pass the frame to next stage and wait until it is picked up so that at most one frame
+        // is in flight between two stages: the copies of virtual data rely on this
+        pipeline->stageFrame[s + 1] = frame;
+        pipeline->handoffCount++;
+        pipeline->cv.notify_all();
+        agoPerfProfileEntry(graph, ago_profile_type_wait_begin, &graph->ref, 0, frame);
+        pipeline->cv.wait(lock, [=] { return pipeline->terminate || pipeline->stageFrame[s + 1] < 0; });
+        agoPerfProfileEntry(graph, ago_profile_type_wait_end, &graph->ref, 0, frame);
+        // agoWaitPipeline also waits for this so that the trace has no wait still open
+        pipeline->handoffCount--;
+        pipeline->cv.notify_all();
+    }
+    else {
+        pipeline->completeCount++;
+        pipeline->cv.notify_all();
+    }
+}
+
+static void agoPipelineStageWorker(AgoGraph * graph, size_t s)
+{
+    AgoPipeline * pipeline = graph->pipeline;
+    if (!graph->cpu_affinity.empty()) {
+        agoSetThreadAffinity(nullptr, graph->cpu_affinity);
+    }
+    for (;;) {
+        vx_int64 frame;
+        bool skip;
+        {
+            std::unique_lock<std::mutex> lock(pipeline->mutex);
+            pipeline->cv.wait(lock, [=] { return pipeline->terminate || pipeline->stageFrame[s] >= 0; });
+            if (pipeline->terminate)
+                break;
+            frame = pipeline->stageFrame[s];
+            pipeline->stageFrame[s] = -1;
+            // don't run frames after a failure until it is reported by agoWaitGraph
+            skip = (pipeline->status != VX_SUCCESS);
+        }
+        pipeline->cv.notify_all();
+        int status = skip ? VX_SUCCESS : agoExecutePipelineStage(graph, &pipeline->stageList[s], frame);
+        agoPipelineStageDone(graph, s, frame, status);
+    }
+}
+
+static int agoSchedulePipeline(AgoGraph * graph, vx_uint64 ticket)
+{
+    AgoPipeline * pipeline = graph->pipeline;
+    // stage 0 of one frame at a time: it points node parameters to the copies of its frame
+    std::lock_guard<std::mutex> scheduleLock(pipeline->scheduleMutex);
+    if (pipeline->workerList.empty()) {
+        pipeline->stageFrame.assign(pipeline->stageList.size(), -1);
+        pipeline->frameStartTime.assign(pipeline->stageList.size(), 0);
+        pipeline->frameTicket.assign(pipeline->stageList.size(), 0);
+        for (size_t s = 1; s < pipeline->stageList.size(); s++)
+            pipeline->workerList.emplace_back(agoPipelineStageWorker, graph, s);
+    }
+    vx_int64 frame;
+    bool skip;
+    {
+        std::lock_guard<std::mutex> lock(pipeline->mutex);
+        frame = pipeline->scheduleCount++;
+        skip = (pipeline->status != VX_SUCCESS);
+    }
+    // run first stage in the caller so that graph inputs can be overwritten once it returns
+    graph->state = VX_GRAPH_STATE_RUNNING;
+    agoPerfProfileEntry(graph, ago_profile_type_exec_begin, &graph->ref, 0, frame);
+    pipeline->frameStartTime[(size_t)(frame % pipeline->frameStartTime.size())] = agoGetClockCounter();
+    pipeline->frameTicket[(size_t)(frame % pipeline->frameTicket.size())] = ticket;
+    int status = skip ? VX_SUCCESS : agoExecutePipelineStage(graph, &pipeline->stageList[0], frame);
+    agoPipelineStageDone(graph, 0, frame, status);
+    return status;
+}
+
+static int agoWaitPipeline(AgoGraph * graph)
+{
+    AgoPipeline * pipeline = graph->pipeline;
+    std::unique_lock<std::mutex> lock(pipeline->mutex);
+    pipeline->cv.wait(lock, [=] { return pipeline->completeCount == pipeline->scheduleCount && pipeline->handoffCount == 0; });
+    int status = pipeline->status;
+    pipeline->status = VX_SUCCESS;
+    if (status == VX_SUCCESS)
+        graph->state = VX_GRAPH_STATE_COMPLETED;
+    else if (graph->state != VX_GRAPH_STATE_ABANDONED)
+        graph->state = VX_GRAPH_STATE_RUNNING;
+    return status;
+}
+
+void agoGetGraphPerf(AgoGraph * graph, vx_perf_t * perf)
+{
+    // the last stage worker of a pipelined graph updates its performance
+    if (graph->pipeline) {
+        std::lock_guard<std::mutex> lock(graph->pipeline->mutex);
+        *perf = graph->perf;
+    }
+    else {
+        *perf = graph->perf;
+    }
+}
+
 int agoProcessGraph(AgoGraph * graph)
 {
     vx_status status = VX_ERROR_INVALID_REFERENCE;
@@ -2820,7 +3569,13 @@ int agoProcessGraph(AgoGraph * graph)
         }
         // execute graph if possible
         if (status == VX_SUCCESS) {
-            if (graph->verified && graph->isReadyToExecute) {
+            if (graph->verified && graph->isReadyToExecute && graph->pipeline) {
+                status = agoSchedulePipeline(graph, 0);
+                int statusWait = agoWaitPipeline(graph);
+                if (status == VX_SUCCESS)
+                    status = statusWait;
+            }
+            else if (graph->verified && graph->isReadyToExecute) {
                 status = agoExecuteGraph(graph);
             }
             else {
@@ -2832,28 +3587,51 @@ int agoProcessGraph(AgoGraph * graph)
     return status;
 }
 
-int agoScheduleGraph(AgoGraph * graph)
+int agoScheduleGraph(AgoGraph * graph, vx_uint64 * ticket)
 {
     vx_status status = VX_ERROR_INVALID_REFERENCE;
     if (agoIsValidGraph(graph)) {
         status = VX_SUCCESS;
-        graph->threadScheduleCount++;
-        if (graph->hThread) {
-            if (!graph->verified) {
-                // make sure to verify the graph in master thread
-                CAgoLock lock(graph->cs);
-                status = vxVerifyGraph(graph);
-            }
-            if (status == VX_SUCCESS) {
-                // inform graph thread to execute
-                if (!ReleaseSemaphore(graph->hSemToThread, 1, nullptr)) {
-                    status = VX_ERROR_NO_RESOURCES;
-                }
+        vx_uint64 scheduleTicket = 0;
+        if (graph->pipeline_stages > 1 && !graph->verified) {
+            // verify the graph to split it into pipeline stages
+            CAgoLock lock(graph->cs);
+            status = vxVerifyGraph(graph);
+        }
+        else if (graph->hThread && !graph->verified) {
+            // make sure to verify the graph in master thread
+            CAgoLock lock(graph->cs);
+            status = vxVerifyGraph(graph);
+        }
+        if (status != VX_SUCCESS) {
+            scheduleTicket = agoIssueGraphTicket(graph);
+            agoCompleteGraphTicket(graph, scheduleTicket, status);
+        }
+        else if (graph->pipeline && graph->isReadyToExecute) {
+            // run first stage now and let later stages overlap with next frames: last stage completes the ticket
+            scheduleTicket = agoIssueGraphTicket(graph);
+            status = agoSchedulePipeline(graph, scheduleTicket);
+        }
+        else if (graph->hThread) {
+            // issue the ticket and queue it in one step so that the graph thread runs tickets in order:
+            // the graph thread completes the ticket
+            std::unique_lock<std::mutex> lock(graph->ticketMutex);
+            scheduleTicket = ++graph->ticketScheduleCount;
+            graph->threadTicketQueue.push_back(scheduleTicket);
+            if (!ReleaseSemaphore(graph->hSemToThread, 1, nullptr)) {
+                graph->threadTicketQueue.pop_back();
+                status = VX_ERROR_NO_RESOURCES;
+                lock.unlock();
+                agoCompleteGraphTicket(graph, scheduleTicket, status);
             }
         }
         else {
+            scheduleTicket = agoIssueGraphTicket(graph);
             status = agoProcessGraph(graph);
+            agoCompleteGraphTicket(graph, scheduleTicket, status);
         }
+        if (ticket)
+            *ticket = scheduleTicket;
     }
     return status;
 }
@@ -2864,26 +3642,63 @@ int agoWaitGraph(AgoGraph * graph)
     if (agoIsValidGraph(graph)) {
         status = VX_SUCCESS;
         graph->threadWaitCount++;
-        if (graph->threadScheduleCount <= 0) // the graph was never scheduled so return VX_FAILURE
+        std::unique_lock<std::mutex> lock(graph->ticketMutex);
+        vx_uint64 ticket = graph->ticketScheduleCount;
+        if (ticket == 0) // the graph was never scheduled so return VX_FAILURE
             return VX_FAILURE;
-        if (graph->hThread) {
-            graph->threadThreadWaitState = 1;
-            while (graph->threadThreadWaitState == 1) {
-                // wait for the agoGraphThreadFunction to be done
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
-                // release the semaphore in case the agoScheduleGraph was called before the agoGraphThreadFunction
-                ReleaseSemaphore(graph->hSemToThread, 1, nullptr);
-            }
-            while (graph->threadExecuteCount < graph->threadScheduleCount) {
-                if (WaitForSingleObject(graph->hSemFromThread, INFINITE) != WAIT_OBJECT_0) {
-                    agoAddLogEntry(&graph->ref, VX_FAILURE, "ERROR: agoWaitGraph: WaitForSingleObject failed\n");
-                    status = VX_FAILURE;
-                    break;
-                }
-            }
+        if (graph->pipeline) {
+            lock.unlock();
+            status = agoWaitPipeline(graph);
+        }
+        else if (graph->hThread) {
+            // block until the graph thread completed everything scheduled so far
+            graph->ticketCv.wait(lock, [=] { return graph->ticketCompleteCount >= ticket; });
         }
         if(status == VX_SUCCESS)
             status = graph->status;
     }
     return status;
-}
\ No newline at end of file
+}
+
+int agoWaitGraphTicket(AgoGraph * graph, vx_uint64 ticket, vx_uint32 timeout_msec)
+{
+    vx_status status = VX_ERROR_INVALID_REFERENCE;
+    if (agoIsValidGraph(graph)) {
+        std::unique_lock<std::mutex> lock(graph->ticketMutex);
+        if (ticket == 0)
+            ticket = graph->ticketScheduleCount;
+        if (ticket == 0 || ticket > graph->ticketScheduleCount)
+            return VX_ERROR_INVALID_VALUE;
+        auto completed = [=] { return agoIsGraphTicketComplete(graph, ticket); };
+        if (timeout_msec == VX_GRAPH_WAIT_FOREVER_AMD) {
+            graph->ticketCv.wait(lock, completed);
+        }
+        else if (!graph->ticketCv.wait_for(lock, std::chrono::milliseconds(timeout_msec), completed)) {
+            return VX_ERROR_GRAPH_SCHEDULED;
+        }
+        // status of old tickets has been overwritten by newer ones
+        vx_uint64 ticketCompleteLast = graph->ticketCompleteSet.empty() ? graph->ticketCompleteCount : *graph->ticketCompleteSet.rbegin();
+        if (ticketCompleteLast - ticket >= AGO_GRAPH_TICKET_HISTORY)
+            return VX_ERROR_INVALID_VALUE;
+        status = graph->ticketStatus[(size_t)(ticket % AGO_GRAPH_TICKET_HISTORY)];
+    }
+    return status;
+}
+
+int agoSetGraphCompletionCallback(AgoGraph * graph, vx_graph_completion_callback_f callback, void * user_data)
+{
+    vx_status status = VX_ERROR_INVALID_REFERENCE;
+    if (agoIsValidGraph(graph)) {
+        std::lock_guard<std::mutex> lock(graph->ticketMutex);
+        if (graph->ticketCompleteCount < graph->ticketScheduleCount) {
+            // the callback can't be changed while executions are pending
+            status = VX_ERROR_GRAPH_SCHEDULED;
+        }
+        else {
+            graph->completionCallback = callback;
+            graph->completionCallbackData = user_data;
+            status = VX_SUCCESS;
+        }
+    }
+    return status;
+}
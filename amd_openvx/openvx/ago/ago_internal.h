@@ -49,13 +49,19 @@ THE SOFTWARE.
 // Flag to enable BMI2 instructions in the primitives
 #define USE_BMI2 0
 
-// Flag to enable AVX instructions (256 bit operations) in primitives
-#define USE_AVX 0
+// Flag to build AVX2 variants (256 bit operations) of primitives: selected at runtime using g_agoCpuFeatures
+#define USE_AVX 1
+
+// Flag to build AVX-512 variants (512 bit operations) of primitives: selected at runtime using g_agoCpuFeatures
+#define USE_AVX512 1
 
 // AGO configuration
 #define USE_AGO_CANNY_SOBEL_SUPP_THRESHOLD    0// 0:seperate-sobel-and-nonmaxsupression 1:combine-sobel-and-nonmaxsupression
 #define AGO_MEMORY_ALLOC_EXTRA_PADDING       64 // extra bytes to the left and right of buffer allocations
+#define AGO_MEMORY_POOL_MIN_CLASS_SIZE      256 // smallest size class of the host memory pool
+#define AGO_MEMORY_POOL_HUGE_PAGE_SIZE  (2 << 20) // huge page size used when AGO_MEMORY_POOL_HUGE_PAGES is enabled
 #define AGO_MAX_DEPTH_FROM_DELAY_OBJECT       4 // number of levels from delay object to low-level object
+#define AGO_GRAPH_TICKET_HISTORY           1000 // number of recent vxScheduleGraph tickets whose status can be queried
 
 // AGO internal error codes for debug
 #define AGO_SUCCESS                           0 // operation is successful
@@ -78,6 +84,7 @@ THE SOFTWARE.
 #define AGO_KERNEL_FLAG_GPU_INTEG_R2R    0x0400 // kernel GPU integration: need OpenCL kernel generation (REG2REG)
 #define AGO_KERNEL_FLAG_SUBGRAPH         0x1000 // kernel is a subgraph
 #define AGO_KERNEL_FLAG_VALID_RECT_RESET 0x2000 // kernel valid_rect_reset is true
+#define AGO_KERNEL_FLAG_OVERRIDABLE      0x4000 // built-in kernel can be overridden by a user kernel with same enum and name
 
 // AGO default target priority
 #if (ENABLE_OPENCL||ENABLE_HIP)
@@ -95,6 +102,8 @@ THE SOFTWARE.
 #define AGO_KERNEL_OP_TYPE_UNKNOWN            0 // unknown
 #define AGO_KERNEL_OP_TYPE_ELEMENT_WISE       1 // element wise operation
 #define AGO_KERNEL_OP_TYPE_FIXED_NEIGHBORS    2 // filtering operation with fixed neighborhood
+#define AGO_KERNEL_OP_TYPE_MASK            0x0f // mask for operation type
+#define AGO_KERNEL_OP_FLAG_CPU_TILE        0x10 // CPU execute works on any range of rows (FIXED_NEIGHBORS: skips kernOpInfo/2 border rows)
 
 // AGO magic code
 #define AGO_MAGIC_VALID              0xC001C0DE // magic code: reference is valid
@@ -106,6 +115,10 @@ THE SOFTWARE.
 #define AGO_OPTICALFLOWPYRLK_MAX_DIM         15 // maximum size of opticalflow block size
 #define AGO_MAX_TENSOR_DIMENSIONS             6 // maximum dimensions supported by tensor
 #define AGO_MAX_OBJARR_REF 				   4096 // maximum number of references in a context for object array
+#define AGO_CPU_STRIPE_MIN_HEIGHT            64 // minimum number of rows in a stripe for concurrent execution of a CPU kernel
+#define AGO_CPU_TILE_MIN_HEIGHT               8 // minimum number of rows in a tile of a CPU supernode
+#define AGO_CPU_TILE_WORKING_SET_SIZE  (256*1024) // bytes of image rows of all images of a CPU supernode tile to keep in cache
+#define AGO_PROFILE_RING_SIZE           (1<<16) // number of entries in the profile capture ring of a graph (power of 2)
 
 // AGO remap data precision
 #define AGO_REMAP_FRACTIONAL_BITS             3 // number of fractional bits in re-map locations
@@ -175,6 +188,15 @@ THE SOFTWARE.
 // thread scheduling configuration
 #define CONFIG_THREAD_DEFAULT                 1  // 0:disable 1:enable separate threads for graph scheduling
 
+// host memory pool configuration
+#define CONFIG_MEMORY_POOL_SIZE_MB          256  // MB of released buffers kept for reuse by agoAllocMemory (0:disable)
+
+// immediate mode (vxu) configuration
+#define CONFIG_IMMEDIATE_GRAPH_CACHE_SIZE    32  // number of verified vxu graphs kept per context (0:disable)
+
+// compiled graph cache configuration
+#define CONFIG_COMPILED_GRAPH_CACHE_ENTRIES  64  // number of compiled graph cache files kept in memory per context
+
 // module specific
 #define MAX_MODULE_NAME_SIZE 1024
 #define MAX_MODULE_PATH_SIZE 2048
@@ -252,6 +274,17 @@ struct AgoProfileEntry {
     AgoProfileEntryType type;
     vx_reference        ref;
     int64_t             time;
+    vx_uint32           tid;
+};
+struct AgoProfileRing {
+    // entries are claimed with an atomic increment of head and published by writing seqList[slot] = index + 1,
+    // so that any thread can add entries without a lock; the oldest entries get overwritten when the ring is full
+    AgoProfileEntry entryList[AGO_PROFILE_RING_SIZE];
+    std::atomic<vx_uint64> seqList[AGO_PROFILE_RING_SIZE];
+    std::atomic<vx_uint64> head;
+    vx_uint64 tail;                                     // first entry not yet read
+public:
+    AgoProfileRing();
 };
 struct AgoNode;
 struct AgoContext;
@@ -265,7 +298,7 @@ struct AgoReference {
     vx_uint32    external_count;  // user usage count -- can't be free when > 0, can't be access when == 0
     vx_uint32    internal_count;  // framework usage count -- can't be free when > 0
     vx_uint32    read_count;      // number of times object has been read
-    vx_uint32    write_count;     // number of times object has been written
+    std::atomic<vx_uint32> write_count; // number of times object has been written (bumped by graph/pipeline workers)
     bool         hint_serialize;  // serialize hint
     bool         enable_logging;  // enable logging
     bool         read_only;       // read only
@@ -476,6 +509,8 @@ struct AgoData {
     vx_uint32 device_type_unused;
     AgoData * alias_data;
     vx_size   alias_offset;
+    std::vector<vx_uint8 *> handleRing;   // host buffers registered with vxSetHandleRing: handleRing[slot * planes + plane]
+    vx_uint32 handleRingSlot;             // current slot of handleRing
 public:
     AgoData();
     ~AgoData();
@@ -485,6 +520,15 @@ struct AgoDataList {
     AgoData * head;
     AgoData * tail;
     AgoData * trash;
+    vx_uint32 generation; // incremented when items are unlinked from the list (indexes over the list are rebuilt)
+};
+struct AgoDataNameIndex {
+    // name lookup of the items in a data list: new items at the tail are indexed incrementally;
+    // the index is rebuilt when items got removed from the list or data objects got renamed
+    vx_uint32 generation;
+    vx_uint32 nameGeneration;
+    AgoData * tail;
+    std::unordered_map<std::string, AgoData *> byName;
 };
 struct AgoMetaFormat {
     // TBD: this data struct needs some cleanup -- just keep only required fields
@@ -576,6 +620,75 @@ public:
     AgoSuperNode();
     ~AgoSuperNode();
 };
+struct AgoCpuSuperNode {
+    AgoCpuSuperNode * next;
+    vx_uint32 width;
+    vx_uint32 height;
+    vx_uint32 tile_height;
+    std::vector<AgoNode *> nodeList;                    // nodes in execution order: runs with the last node
+    std::vector<AgoData *> dataList;                    // images accessed by the nodes
+    std::vector<vx_uint32> nodeBorder;                  // rows at top and bottom of the image not written by each node
+    std::vector< std::vector<vx_int32> > nodeProducer;  // index in nodeList of producer of each input image (-1 if outside)
+    std::vector<vx_uint32> nodeTileIndex;               // index of first image tile view of each node in tileData
+    AgoData * tileData;                                 // image views used for node parameters during tile execution
+    vx_uint32 hierarchical_level_start;
+    vx_uint32 hierarchical_level_end;
+public:
+    AgoCpuSuperNode();
+    ~AgoCpuSuperNode();
+};
+struct AgoPipelineParam {
+    AgoNode * node;
+    vx_uint32 index;                                    // index of the parameter in node->paramList
+    vx_int32 child;                                     // index of the plane in the copy (-1 if parameter is the copy)
+    std::vector<AgoData *> * copies;                    // one copy per frame in flight: frame N uses copies[N % count]
+};
+struct AgoPipelineStage {
+    vx_uint32 hierarchical_level_start;
+    vx_uint32 hierarchical_level_end;
+    AgoNode * snode;                                    // first node of the stage
+    AgoNode * enode;                                    // node after the last node of the stage (nullptr for last stage)
+    std::vector<AgoPipelineParam> paramList;            // node parameters to point to the copies of current frame
+};
+struct AgoPipeline {
+    std::vector<AgoPipelineStage> stageList;
+    std::list< std::vector<AgoData *> > copyList;       // copies of virtual data accessed by more than one stage
+    // frames are passed from stage to stage through a single slot per stage: stage 0 runs
+    // in the caller of vxScheduleGraph and the other stages run in their own worker thread
+    std::vector<std::thread> workerList;
+    std::mutex scheduleMutex;                           // serializes stage 0 of concurrent vxScheduleGraph calls
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<vx_int64> stageFrame;                   // frame waiting to run on each stage (-1 if none)
+    std::vector<vx_int64> frameStartTime;
+    std::vector<vx_uint64> frameTicket;                 // schedule ticket of each frame in flight (0 if none)
+    vx_int64 scheduleCount;
+    vx_int64 completeCount;
+    vx_int64 handoffCount;                              // stages waiting for the next stage to pick up their frame
+    vx_status status;
+    bool terminate;
+public:
+    AgoPipeline();
+    ~AgoPipeline();
+};
+struct AgoImmediateGraph {
+    std::vector<vx_uint64> key;                         // kernel, non-object arguments, object layouts, border mode, and target of a vxu call
+    AgoGraph * graph;                                   // verified graph with a single node
+    AgoNode * node;
+    std::vector<vx_int32> paramIndex;                   // node parameter of each object argument (-1 if null or repeated)
+    std::vector<AgoData *> placeholderList;             // objects of same layout bound in place of the arguments between calls
+};
+struct AgoCompiledGraphCache {
+    vx_uint64 key;                                      // hash of kernels, optimizer configuration, nodes and data
+    std::vector<AgoNode *> nodeList;                    // nodes of the graph before optimization
+    std::vector<AgoData *> dataList;                    // data of the graph before optimization
+    std::map<AgoData *, vx_uint32> dataIndex;           // index of data in dataList
+};
+struct AgoCompiledGraphCacheEntry {
+    std::vector<std::string> newDesc;                   // descriptions of data created by the optimizer
+    std::vector<vx_uint32> formatRecords;               // image formats set by the optimizer
+    std::vector<vx_uint32> nodeRecords;                 // nodes of the graph after optimization
+};
 struct AgoNode {
     AgoReference ref;
     AgoNode * next;
@@ -595,6 +708,7 @@ struct AgoNode {
     vx_int32 funcExchange[AGO_MAX_PARAMS];
     vx_nodecomplete_f callback;
     AgoSuperNode * supernode;
+    AgoCpuSuperNode * cpuSupernode;
     AgoNode * newchildnode;
     bool initialized;
     bool drama_divide_invoked;
@@ -646,6 +760,14 @@ struct AgoKernelList {
     vx_uint32 count;
     AgoKernel * head;
     AgoKernel * tail;
+    vx_uint32 generation; // incremented when items are unlinked from the list (indexes over the list are rebuilt)
+};
+struct AgoKernelIndex {
+    // enum and name lookup of the items in a kernel list, maintained the same way as AgoDataNameIndex
+    vx_uint32 generation;
+    AgoKernel * tail;
+    std::unordered_map<vx_enum, AgoKernel *> byEnum;
+    std::unordered_map<std::string, AgoKernel *> byName;
 };
 struct AgoNodeList {
     vx_uint32 count;
@@ -658,16 +780,34 @@ struct AgoGraph {
     std::string name;
     AgoGraph * next;
     CRITICAL_SECTION cs;
-    HANDLE hThread, hSemToThread, hSemFromThread;
-    vx_int32 threadScheduleCount, threadExecuteCount, threadWaitCount, threadThreadTerminationState, threadThreadWaitState;
+    HANDLE hThread, hSemToThread;
+    vx_int32 threadWaitCount, threadThreadTerminationState;
+    // every vxScheduleGraph gets the next ticket; completion of a ticket is recorded (and the completion
+    // callback invoked) by whichever thread finished its execution: graph thread, last pipeline stage, or caller
+    std::mutex ticketMutex;
+    std::condition_variable ticketCv;
+    vx_uint64 ticketScheduleCount;
+    vx_uint64 ticketCompleteCount;                     // all tickets up to this one are complete
+    std::set<vx_uint64> ticketCompleteSet;             // tickets above ticketCompleteCount that completed out of order
+    std::deque<vx_uint64> threadTicketQueue;           // tickets handed to the graph thread in schedule order
+    std::vector<vx_status> ticketStatus;               // status of recent tickets indexed by ticket % AGO_GRAPH_TICKET_HISTORY
+    vx_graph_completion_callback_f completionCallback;
+    void * completionCallbackData;
     AgoDataList dataList;
+    AgoDataNameIndex dataNameIndex;
     AgoNodeList nodeList;
     vx_bool isReadyToExecute;
     bool detectedInvalidNode;
     vx_int32 status;
     vx_perf_t perf;
     vx_uint32 cpu_num_threads;
-    vx_enum state;
+    std::vector<int> cpu_affinity;                      // CPUs of the graph thread and pipeline workers (empty: not bound)
+    bool cpu_tile_fusion;
+    AgoCpuSuperNode * cpuSupernodeList;
+    vx_uint32 pipeline_stages;
+    AgoPipeline * pipeline;
+    std::string compiled_graph_cache;
+    std::atomic<vx_enum> state;                         // also set by pipeline stage workers
     bool reverify;
     struct AgoGraphPerfInternalInfo_ { // shall be identical to AgoGraphPerfInternalInfo in amd_ext_amd.h
         vx_uint64 kernel_enqueue;
@@ -680,6 +820,8 @@ struct AgoGraph {
     vx_uint32 optimizer_flags;
     bool verified;
     std::vector<vx_parameter> parameters;
+    std::vector<AgoNode *> rebindNodeList;              // nodes to validate again after graph parameters changed dimensions
+    bool rebindResize;                                  // agoVerifyNode() resizes virtual images to the output meta data
     std::vector<AgoData *> autoAgeDelayList;
 #if (ENABLE_OPENCL||ENABLE_HIP)
     std::vector<AgoNode *> gpu_nodeListQueued;
@@ -693,9 +835,10 @@ struct AgoGraph {
 #endif
 #endif
     AgoTargetAffinityInfo_ attr_affinity;
-    vx_uint32 execFrameCount;
+    std::atomic<vx_uint32> execFrameCount;              // also incremented by last pipeline stage worker
     bool enable_performance_profiling;
-    std::vector<AgoProfileEntry> performance_profile;
+    AgoProfileRing * performance_profile;
+    std::string performance_trace;
     std::map<std::string,void *> moduleHandle;
 public:
     AgoGraph();
@@ -729,6 +872,10 @@ struct AgoContext {
     AgoKernelList kernelList;
     AgoDataList dataList;
     AgoGraphList graphList;
+    std::mutex index_mutex;            // guards kernelIndex and dataNameIndex
+    AgoKernelIndex kernelIndex;
+    AgoDataNameIndex dataNameIndex;
+    vx_uint32 dataNameGeneration;      // incremented when a data object in a list gets renamed
     std::vector<AgoUserStruct> userStructList;
     vx_uint32 dataGenerationCount;
     vx_enum nextUserStructId;
@@ -778,6 +925,17 @@ struct AgoContext {
     vx_size hip_mem_release_count;
 #endif
     AgoTargetAffinityInfo_ attr_affinity;
+    CAgoThreadPool * cpu_thread_pool; // worker pool shared by all graphs for CPU node execution
+    AgoCpuAffinityInfo attr_cpu_affinity;
+    std::vector<int> cpu_affinity;     // CPUs of the threads created for graphs (empty: not bound)
+    vx_int32 cpu_affinity_numa_node;   // NUMA node of cpu_affinity (-1: unknown or not bound)
+    vx_uint64 memory_owner_id;         // unique id that tags pooled host buffers allocated without zeroing
+    std::mutex immediate_graph_mutex;
+    std::list<AgoImmediateGraph> immediate_graph_cache; // graphs of vxu calls, most recently used first
+    vx_uint32 immediate_graph_cache_size;
+    vx_uint64 compiled_graph_cache_kernel_hash;         // hash of kernels and merge rules used in compiled graph cache keys
+    vx_uint64 compiled_graph_cache_kernel_signature;    // state of kernel list and merge rules when the hash got computed
+    std::map<std::string, AgoCompiledGraphCacheEntry> compiled_graph_cache_entries; // compiled graph cache files read or written
 public:
     AgoContext();
     ~AgoContext();
@@ -787,6 +945,21 @@ struct AgoAllocInfo {
     vx_size requested_size;
     vx_int32 retain_count;
     vx_int32 allocate_id;
+    vx_size class_size;   // size of the block returned to the memory pool on release
+    vx_bool huge_pages;   // block is huge page aligned and advised
+    vx_int32 numa_node;   // NUMA node the block was first touched on (-1: unknown)
+    vx_uint64 owner_id;   // memory_owner_id of the context that may reuse the block without clearing (0: none)
+};
+
+// binds the calling thread to the CPU affinity of a context while buffers are allocated, so that
+// they are first touched on its NUMA node: does nothing for unbound contexts and in nested scopes
+class CAgoAllocAffinityScope {
+public:
+    CAgoAllocAffinityScope(AgoContext * context);
+    ~CAgoAllocAffinityScope();
+private:
+    bool m_bound;
+    std::vector<int> m_savedCpus;
 };
 
 struct _vx_array { AgoData d; };
@@ -803,9 +976,12 @@ struct _vx_threshold { AgoData d; };
 struct _vx_object_array { AgoData d; };
 
 // framework
-void * agoAllocMemory(vx_size size);
+void * agoAllocMemory(vx_size size, bool zeroInit = true, AgoContext * owner = nullptr);
 void agoRetainMemory(void * mem);
 void agoReleaseMemory(void * mem);
+void agoGetMemoryPoolInfo(AgoMemoryPoolInfo * info);
+void agoTrimMemoryPool();
+vx_status agoSetContextCpuAffinity(AgoContext * context, const AgoCpuAffinityInfo * info);
 int agoChannelEnum2Index(vx_enum channel);
 const char * agoEnum2Name(vx_enum e);
 size_t agoType2Size(vx_context context, vx_enum type);
@@ -823,8 +999,13 @@ int agoRemoveData(AgoDataList * list, AgoData * item, AgoData ** trash);
 AgoKernel * agoRemoveKernel(AgoKernelList * list, AgoKernel * item);
 void agoRemoveDataInGraph(AgoGraph * agraph, AgoData * data);
 void agoReplaceDataInGraph(AgoGraph * agraph, AgoData * dataFind, AgoData * dataReplace);
+bool agoIsSameDataLayout(AgoData * data1, AgoData * data2);
+bool agoIsResizableData(AgoData * data1, AgoData * data2);
+AgoData * agoGetRebindData(AgoData * data, AgoData * dataFind, AgoData * dataReplace);
 void agoResetDataList(AgoDataList * dataList);
 void agoResetNodeList(AgoNodeList * nodeList);
+void agoResetCpuSuperNodeList(AgoGraph * graph);
+void agoResetPipeline(AgoGraph * graph);
 void agoResetKernelList(AgoKernelList * kernelList);
 vx_size agoGetUserStructSize(AgoContext * acontext, vx_char * name);
 vx_size agoGetUserStructSize(AgoContext * acontext, vx_enum id);
@@ -832,7 +1013,10 @@ vx_enum agoGetUserStructType(AgoContext * acontext, vx_char * name);
 const char * agoGetUserStructName(AgoContext * acontext, vx_enum id);
 AgoKernel * agoFindKernelByEnum(AgoContext * acontext, vx_enum kernel_id);
 AgoKernel * agoFindKernelByName(AgoContext * acontext, const vx_char * name);
+AgoKernel * agoFindOverridableKernel(AgoContext * acontext, vx_enum kernel_id, const vx_char * name);
+void agoAddKernelOverride(AgoKernelList * kernelList, AgoKernel * kernel, AgoKernel * overridden);
 AgoData * agoFindDataByName(AgoContext * acontext, AgoGraph * agraph, vx_char * name);
+void agoRenameData(AgoData * data, const char * name);
 void agoMarkChildrenAsPartOfDelay(AgoData * adata);
 bool agoIsPartOfDelay(AgoData * adata);
 AgoData * agoGetSiblingTraceToDelayForInit(AgoData * data, int trace[], int& traceCount);
@@ -879,6 +1063,9 @@ int agoOptimizeDramaRemove(AgoGraph * agraph);
 int agoOptimizeDramaAnalyze(AgoGraph * agraph);
 int agoOptimizeDramaMerge(AgoGraph * agraph);
 int agoOptimizeDramaAlloc(AgoGraph * agraph);
+int agoOptimizeDramaCacheKey(AgoGraph * agraph, AgoCompiledGraphCache * cache);
+int agoOptimizeDramaCacheLoad(AgoGraph * agraph, AgoCompiledGraphCache * cache);
+int agoOptimizeDramaCacheSave(AgoGraph * agraph, AgoCompiledGraphCache * cache);
 // import
 void agoImportKernelConfig(AgoKernel * kernel, vx_kernel vxkernel);
 void agoImportNodeConfig(AgoNode * node, vx_node vxnode);
@@ -886,7 +1073,9 @@ void agoImportDataConfig(AgoData * data, vx_reference vxref, AgoGraph * graph);
 // string processing
 void agoEvaluateIntegerExpression(char * expr);
 // performance
-void agoPerfProfileEntry(AgoGraph * graph, AgoProfileEntryType type, vx_reference ref);
+void agoPerfProfileEntry(AgoGraph * graph, AgoProfileEntryType type, vx_reference ref, int64_t time = 0, vx_int64 frame = -1); // time 0: now, frame -1: graph->execFrameCount
+void agoPerfProfileEnable(AgoGraph * graph, bool enable);
+void agoPerfProfileRead(AgoGraph * graph, std::vector<AgoProfileEntry>& entryList);
 void agoPerfCaptureReset(vx_perf_t * perf);
 void agoPerfCaptureStart(vx_perf_t * perf);
 void agoPerfCaptureStop(vx_perf_t * perf);
@@ -938,10 +1127,14 @@ int agoGpuHipSuperNodeWait(AgoGraph * graph, AgoSuperNode * supernode);
 extern "C" typedef void (VX_CALLBACK * ago_data_registry_callback_f) (void * obj, vx_reference ref, const char * name, const char * app_params);
 AgoContext * agoCreateContextFromPlatform(struct _vx_platform * platform);
 AgoContext * agoCreateContext();
-AgoGraph * agoCreateGraph(AgoContext * acontext);
+AgoGraph * agoCreateGraph(AgoContext * acontext, bool scheduleThread = true);
 int agoReleaseGraph(AgoGraph * agraph);
 int agoReleaseContext(AgoContext * acontext);
 int agoVerifyGraph(AgoGraph * agraph);
+int agoRebindGraphParameter(AgoGraph * graph, AgoNode * pnode, vx_uint32 index, AgoData * data);
+int agoDetachGraphParameter(AgoGraph * graph, AgoNode * pnode, vx_uint32 index, AgoData * placeholder);
+void agoGetGraphPerf(AgoGraph * graph, vx_perf_t * perf);
+int agoVerifyGraphRebind(AgoGraph * graph);
 vx_status agoPrepareImageValidRectangleBuffers(AgoGraph * graph);
 vx_status agoComputeImageValidRectangleOutputs(AgoGraph * graph);
 int agoOptimizeGraph(AgoGraph * agraph);
@@ -951,14 +1144,17 @@ int agoExecuteGraph(AgoGraph * agraph);
 int agoAgeDelay(AgoData * delay);
 // scheduling
 int agoProcessGraph(AgoGraph * agraph);
-int agoScheduleGraph(AgoGraph * agraph);
+int agoScheduleGraph(AgoGraph * agraph, vx_uint64 * ticket = nullptr);
 int agoWaitGraph(AgoGraph * agraph);
+int agoWaitGraphTicket(AgoGraph * agraph, vx_uint64 ticket, vx_uint32 timeout_msec);
+int agoSetGraphCompletionCallback(AgoGraph * agraph, vx_graph_completion_callback_f callback, void * user_data);
 int agoWriteGraph(AgoGraph * agraph, AgoReference * * ref, int num_ref, FILE * fp, const char * comment);
 int agoReadGraph(AgoGraph * agraph, AgoReference * * ref, int num_ref, ago_data_registry_callback_f callback_f, void * callback_obj, FILE * fp, vx_int32 dumpToConsole);
 int agoReadGraphFromString(AgoGraph * agraph, AgoReference * * ref, int num_ref, ago_data_registry_callback_f callback_f, void * callback_obj, char * str, vx_int32 dumpToConsole);
 int agoLoadModule(AgoContext * context, const char * module);
 int agoUnloadModule(AgoContext * context, const char * module);
 vx_status agoGraphDumpPerformanceProfile(AgoGraph * graph, const char * fileName);
+vx_status agoGraphDumpPerformanceTrace(AgoGraph * graph, const char * fileName);
 vx_status agoDirective(vx_reference reference, vx_enum directive);
 
 ///////////////////////////////////////////////////////////
@@ -31,6 +31,51 @@ THE SOFTWARE.
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Local Utility Functions
 //
+static vx_uint32 GetCpuStripeCount(AgoNode * node, vx_uint32 height)
+{
+    // number of horizontal stripes that the rows of an output can be split into for
+    // concurrent execution on the context CPU worker pool (1 unless graph cpu_num_threads > 1)
+    // nodes of a CPU supernode are run one row tile at a time, so never split them
+    AgoGraph * graph = (AgoGraph *)node->ref.scope;
+    if (node->cpuSupernode)
+        return 1;
+    vx_uint32 count = (graph && graph->cpu_num_threads > 1) ? graph->cpu_num_threads : 1;
+    count = min(count, height / AGO_CPU_STRIPE_MIN_HEIGHT);
+    return count > 0 ? count : 1;
+}
+static vx_size GetCpuStripeLocalDataSize(AgoNode * node, vx_uint32 height, vx_uint32 halo, vx_size stripeLocalDataSize)
+{
+    // node local data needed by ProcessCpuStripes() when each stripe of the rows [halo, height-halo) owns
+    // stripeLocalDataSize bytes: call this at initialize with the same arguments used at execute
+    return stripeLocalDataSize * GetCpuStripeCount(node, height - 2 * halo);
+}
+static int ProcessCpuStripes(AgoNode * node, vx_uint32 height, vx_uint32 halo, vx_uint32 rowAlign, vx_size stripeLocalDataSize,
+                             const std::function<int(vx_uint8 * localData, vx_uint32 y, vx_uint32 rows)>& func)
+{
+    // split the rows [halo, height-halo) of an output into stripes with heights multiple of rowAlign (except the last one)
+    // and run func() on each stripe with its first row, its row count and its own stripeLocalDataSize bytes of node local data
+    // (the start of node local data when stripeLocalDataSize is 0): returns non-zero if any stripe failed
+    vx_uint32 rows = height - 2 * halo;
+    vx_uint32 numStripes = stripeLocalDataSize ? (vx_uint32)(node->localDataSize / stripeLocalDataSize) : GetCpuStripeCount(node, rows);
+    numStripes = max(numStripes, 1u);
+    vx_uint32 stripeHeight = (rows + numStripes - 1) / numStripes;
+    stripeHeight = ((stripeHeight + rowAlign - 1) / rowAlign) * rowAlign;
+    numStripes = stripeHeight ? (rows + stripeHeight - 1) / stripeHeight : 1;
+    AgoGraph * graph = (AgoGraph *)node->ref.scope;
+    if (numStripes <= 1 || !graph || !graph->ref.context->cpu_thread_pool) {
+        return func(node->localDataPtr, halo, rows);
+    }
+    std::vector<int> stripeStatus(numStripes, 0);
+    graph->ref.context->cpu_thread_pool->ParallelFor(numStripes, [&](size_t stripe) {
+        vx_uint32 y = (vx_uint32)stripe * stripeHeight;
+        stripeStatus[stripe] = func(node->localDataPtr + stripe * stripeLocalDataSize, halo + y, min(stripeHeight, rows - y));
+    });
+    for (int stripeResult : stripeStatus) {
+        if (stripeResult)
+            return stripeResult;
+    }
+    return 0;
+}
 static int ValidateArguments_Img_1IN(AgoNode * node, vx_df_image fmtIn)
 {
     // validate parameters
@@ -316,6 +361,158 @@ static int ValidateArguments_OpticalFlowPyrLK_XY_XY(AgoNode * node)
     return VX_SUCCESS;
 }
 
+static bool IsSupportedTensorType(vx_enum data_type)
+{
+    return data_type == VX_TYPE_UINT8 || data_type == VX_TYPE_INT8 || data_type == VX_TYPE_INT16 || data_type == VX_TYPE_FLOAT32;
+}
+static void SetTensorMeta(vx_meta_format meta, AgoData * tensor)
+{
+    meta->data.u.tensor.num_dims = tensor->u.tensor.num_dims;
+    for (vx_size i = 0; i < AGO_MAX_TENSOR_DIMENSIONS; i++)
+        meta->data.u.tensor.dims[i] = tensor->u.tensor.dims[i];
+    meta->data.u.tensor.data_type = tensor->u.tensor.data_type;
+    meta->data.u.tensor.fixed_point_pos = tensor->u.tensor.fixed_point_pos;
+}
+static int ValidateArguments_Tensor_Elementwise(vx_meta_format meta, AgoData * oTensor, AgoData * iTensor1, AgoData * iTensor2)
+{
+    // inputs must have the output format and dimensions that are either same as output or 1 (broadcast)
+    if (!IsSupportedTensorType(oTensor->u.tensor.data_type))
+        return VX_ERROR_INVALID_FORMAT;
+    AgoData * iTensors[2] = { iTensor1, iTensor2 };
+    for (int j = 0; j < 2; j++) {
+        if (iTensors[j]->u.tensor.data_type != oTensor->u.tensor.data_type || iTensors[j]->u.tensor.fixed_point_pos != oTensor->u.tensor.fixed_point_pos)
+            return VX_ERROR_INVALID_FORMAT;
+        if (iTensors[j]->u.tensor.num_dims > oTensor->u.tensor.num_dims)
+            return VX_ERROR_INVALID_DIMENSION;
+        for (vx_size i = 0; i < iTensors[j]->u.tensor.num_dims; i++) {
+            if (iTensors[j]->u.tensor.dims[i] != oTensor->u.tensor.dims[i] && iTensors[j]->u.tensor.dims[i] != 1)
+                return VX_ERROR_INVALID_DIMENSION;
+        }
+    }
+    SetTensorMeta(meta, oTensor);
+    return VX_SUCCESS;
+}
+static int ValidateArguments_Tensor_AddSubtract(vx_meta_format meta, AgoData * oTensor, AgoData * iTensor1, AgoData * iTensor2, AgoData * policy)
+{
+    if (policy->u.scalar.type != VX_TYPE_ENUM)
+        return VX_ERROR_INVALID_TYPE;
+    else if (policy->u.scalar.u.e != VX_CONVERT_POLICY_WRAP && policy->u.scalar.u.e != VX_CONVERT_POLICY_SATURATE)
+        return VX_ERROR_INVALID_VALUE;
+    return ValidateArguments_Tensor_Elementwise(meta, oTensor, iTensor1, iTensor2);
+}
+static int ValidateArguments_Tensor_Multiply(vx_meta_format meta, AgoData * oTensor, AgoData * iTensor1, AgoData * iTensor2, AgoData * scale, AgoData * overflow, AgoData * rounding)
+{
+    if (scale->u.scalar.type != VX_TYPE_FLOAT32 || overflow->u.scalar.type != VX_TYPE_ENUM || rounding->u.scalar.type != VX_TYPE_ENUM)
+        return VX_ERROR_INVALID_TYPE;
+    else if (overflow->u.scalar.u.e != VX_CONVERT_POLICY_WRAP && overflow->u.scalar.u.e != VX_CONVERT_POLICY_SATURATE)
+        return VX_ERROR_INVALID_VALUE;
+    else if (rounding->u.scalar.u.e != VX_ROUND_POLICY_TO_ZERO && rounding->u.scalar.u.e != VX_ROUND_POLICY_TO_NEAREST_EVEN)
+        return VX_ERROR_INVALID_VALUE;
+    return ValidateArguments_Tensor_Elementwise(meta, oTensor, iTensor1, iTensor2);
+}
+static int ValidateArguments_Tensor_TableLookup(vx_meta_format meta, AgoData * oTensor, AgoData * iTensor, AgoData * iLut)
+{
+    vx_enum data_type = iTensor->u.tensor.data_type;
+    if (!((data_type == VX_TYPE_UINT8 && iLut->u.lut.type == VX_TYPE_UINT8) || (data_type == VX_TYPE_INT16 && iLut->u.lut.type == VX_TYPE_INT16)))
+        return VX_ERROR_INVALID_FORMAT;
+    else if (oTensor->u.tensor.data_type != data_type || oTensor->u.tensor.fixed_point_pos != iTensor->u.tensor.fixed_point_pos)
+        return VX_ERROR_INVALID_FORMAT;
+    else if (oTensor->u.tensor.num_dims != iTensor->u.tensor.num_dims || !iLut->u.lut.count)
+        return VX_ERROR_INVALID_DIMENSION;
+    for (vx_size i = 0; i < iTensor->u.tensor.num_dims; i++) {
+        if (oTensor->u.tensor.dims[i] != iTensor->u.tensor.dims[i])
+            return VX_ERROR_INVALID_DIMENSION;
+    }
+    SetTensorMeta(meta, oTensor);
+    return VX_SUCCESS;
+}
+static int ValidateArguments_Tensor_Transpose(vx_meta_format meta, AgoData * oTensor, AgoData * iTensor, AgoData * dimension1, AgoData * dimension2)
+{
+    if (dimension1->u.scalar.type != VX_TYPE_SIZE || dimension2->u.scalar.type != VX_TYPE_SIZE)
+        return VX_ERROR_INVALID_TYPE;
+    vx_size num_dims = iTensor->u.tensor.num_dims;
+    vx_size dim1 = dimension1->u.scalar.u.s, dim2 = dimension2->u.scalar.u.s;
+    if (oTensor->u.tensor.data_type != iTensor->u.tensor.data_type || oTensor->u.tensor.fixed_point_pos != iTensor->u.tensor.fixed_point_pos)
+        return VX_ERROR_INVALID_FORMAT;
+    else if (dim1 >= num_dims || dim2 >= num_dims)
+        return VX_ERROR_INVALID_VALUE;
+    else if (oTensor->u.tensor.num_dims != num_dims)
+        return VX_ERROR_INVALID_DIMENSION;
+    for (vx_size i = 0; i < num_dims; i++) {
+        vx_size j = (i == dim1) ? dim2 : ((i == dim2) ? dim1 : i);
+        if (oTensor->u.tensor.dims[i] != iTensor->u.tensor.dims[j])
+            return VX_ERROR_INVALID_DIMENSION;
+    }
+    SetTensorMeta(meta, oTensor);
+    return VX_SUCCESS;
+}
+static int ValidateArguments_Tensor_ConvertDepth(vx_meta_format meta, AgoData * oTensor, AgoData * iTensor, AgoData * policy, AgoData * norm, AgoData * offset)
+{
+    if (policy->u.scalar.type != VX_TYPE_ENUM || norm->u.scalar.type != VX_TYPE_FLOAT32 || offset->u.scalar.type != VX_TYPE_FLOAT32)
+        return VX_ERROR_INVALID_TYPE;
+    else if (policy->u.scalar.u.e != VX_CONVERT_POLICY_WRAP && policy->u.scalar.u.e != VX_CONVERT_POLICY_SATURATE)
+        return VX_ERROR_INVALID_VALUE;
+    else if (norm->u.scalar.u.f == 0.0f)
+        return VX_ERROR_INVALID_VALUE;
+    else if (!IsSupportedTensorType(oTensor->u.tensor.data_type) || !IsSupportedTensorType(iTensor->u.tensor.data_type))
+        return VX_ERROR_INVALID_FORMAT;
+    else if (oTensor->u.tensor.num_dims != iTensor->u.tensor.num_dims)
+        return VX_ERROR_INVALID_DIMENSION;
+    for (vx_size i = 0; i < iTensor->u.tensor.num_dims; i++) {
+        if (oTensor->u.tensor.dims[i] != iTensor->u.tensor.dims[i])
+            return VX_ERROR_INVALID_DIMENSION;
+    }
+    SetTensorMeta(meta, oTensor);
+    return VX_SUCCESS;
+}
+static void GetTensorBroadcastStrides(AgoData * oTensor, AgoData * iTensor, vx_size stride[])
+{
+    // dimensions of size 1 in the input are repeated along the output with zero stride
+    for (vx_size i = 0; i < oTensor->u.tensor.num_dims; i++) {
+        bool same = i < iTensor->u.tensor.num_dims && iTensor->u.tensor.dims[i] == oTensor->u.tensor.dims[i];
+        stride[i] = same ? iTensor->u.tensor.stride[i] : 0;
+    }
+}
+static bool GetTensorMatrixSize(AgoData * tensor, vx_bool transpose, vx_size& rows, vx_size& columns)
+{
+    // only 2D tensors are supported as matrices: dims[0] is the number of columns
+    for (vx_size i = 2; i < tensor->u.tensor.num_dims; i++) {
+        if (tensor->u.tensor.dims[i] != 1)
+            return false;
+    }
+    rows = transpose ? tensor->u.tensor.dims[0] : tensor->u.tensor.dims[1];
+    columns = transpose ? tensor->u.tensor.dims[1] : tensor->u.tensor.dims[0];
+    return tensor->u.tensor.num_dims >= 2;
+}
+static int ValidateArguments_Tensor_MatrixMultiply(vx_meta_format meta, AgoData * oTensor, AgoData * iTensor1, AgoData * iTensor2, AgoData * iTensor3, AgoData * params)
+{
+    if (params->u.scalar.type != VX_TYPE_TENSOR_MATRIX_MULTIPLY_PARAMS || !params->buffer)
+        return VX_ERROR_INVALID_TYPE;
+    const vx_tensor_matrix_multiply_params_t * mmParams = (const vx_tensor_matrix_multiply_params_t *)params->buffer;
+    vx_enum data_type = oTensor->u.tensor.data_type;
+    vx_uint32 fixed_point_pos = oTensor->u.tensor.fixed_point_pos;
+    if (!IsSupportedTensorType(data_type))
+        return VX_ERROR_INVALID_FORMAT;
+    AgoData * iTensors[3] = { iTensor1, iTensor2, iTensor3 };
+    for (int j = 0; j < 3; j++) {
+        if (iTensors[j] && (iTensors[j]->u.tensor.data_type != data_type || iTensors[j]->u.tensor.fixed_point_pos != fixed_point_pos))
+            return VX_ERROR_INVALID_FORMAT;
+    }
+    vx_size M, K, K2, N, rows, columns;
+    if (!GetTensorMatrixSize(iTensor1, mmParams->transpose_input1, M, K) ||
+        !GetTensorMatrixSize(iTensor2, mmParams->transpose_input2, K2, N) ||
+        !GetTensorMatrixSize(oTensor, vx_false_e, rows, columns))
+        return VX_ERROR_INVALID_DIMENSION;
+    else if (K != K2 || rows != M || columns != N)
+        return VX_ERROR_INVALID_DIMENSION;
+    if (iTensor3) {
+        if (!GetTensorMatrixSize(iTensor3, mmParams->transpose_input3, rows, columns) || rows != M || columns != N)
+            return VX_ERROR_INVALID_DIMENSION;
+    }
+    SetTensorMeta(meta, oTensor);
+    return VX_SUCCESS;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // OpenVX 1.0 built-in kernels
 //
@@ -2357,6 +2554,167 @@ int ovxKernel_LaplacianReconstruct(AgoNode * node, AgoKernelCommand cmd)
     return status;
 }
 
+int ovxKernel_TensorMultiply(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_MULTIPLY_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        status = ValidateArguments_Tensor_Multiply(&node->metaList[5], node->paramList[5], node->paramList[0], node->paramList[1], node->paramList[2], node->paramList[3], node->paramList[4]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int ovxKernel_TensorAdd(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_ADD_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        status = ValidateArguments_Tensor_AddSubtract(&node->metaList[3], node->paramList[3], node->paramList[0], node->paramList[1], node->paramList[2]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int ovxKernel_TensorSubtract(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_SUBTRACT_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        status = ValidateArguments_Tensor_AddSubtract(&node->metaList[3], node->paramList[3], node->paramList[0], node->paramList[1], node->paramList[2]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int ovxKernel_TensorTableLookup(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_TABLE_LOOKUP_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        status = ValidateArguments_Tensor_TableLookup(&node->metaList[2], node->paramList[2], node->paramList[0], node->paramList[1]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int ovxKernel_TensorTranspose(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_TRANSPOSE_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        status = ValidateArguments_Tensor_Transpose(&node->metaList[1], node->paramList[1], node->paramList[0], node->paramList[2], node->paramList[3]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int ovxKernel_TensorConvertDepth(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_CONVERT_DEPTH_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        status = ValidateArguments_Tensor_ConvertDepth(&node->metaList[4], node->paramList[4], node->paramList[0], node->paramList[1], node->paramList[2], node->paramList[3]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int ovxKernel_TensorMatrixMultiply(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_MATRIX_MULTIPLY_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        status = ValidateArguments_Tensor_MatrixMultiply(&node->metaList[4], node->paramList[4], node->paramList[0], node->paramList[1], node->paramList[2], node->paramList[3]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
 #if ENABLE_OPENCL
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Local OpenCL Codegen Functions
@@ -12533,8 +12891,12 @@ int agoKernel_ColorConvert_RGB_NV12(AgoNode * node, AgoKernelCommand cmd)
         AgoData * oImg = node->paramList[0];
         AgoData * iImg1 = node->paramList[1];
         AgoData * iImg2 = node->paramList[2];
-        if (HafCpu_ColorConvert_RGB_NV12(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
-                                         iImg1->buffer, iImg1->u.img.stride_in_bytes, iImg2->buffer, iImg2->u.img.stride_in_bytes))
+        // stripes start on even rows so that each stripe owns its rows of the 2x2 sub-sampled chroma
+        if (ProcessCpuStripes(node, oImg->u.img.height, 0, 2, 0, [&](vx_uint8 * localData, vx_uint32 y, vx_uint32 rows) {
+                return HafCpu_ColorConvert_RGB_NV12(oImg->u.img.width, rows, oImg->buffer + y * oImg->u.img.stride_in_bytes, oImg->u.img.stride_in_bytes,
+                                                    iImg1->buffer + y * iImg1->u.img.stride_in_bytes, iImg1->u.img.stride_in_bytes,
+                                                    iImg2->buffer + (y >> 1) * iImg2->u.img.stride_in_bytes, iImg2->u.img.stride_in_bytes);
+            }))
         {
             status = VX_FAILURE;
         }
@@ -15278,8 +15640,13 @@ int agoKernel_Gaussian_U8_U8_3x3(AgoNode * node, AgoKernelCommand cmd)
         status = VX_SUCCESS;
         AgoData * oImg = node->paramList[0];
         AgoData * iImg = node->paramList[1];
-        if (HafCpu_Gaussian_U8_U8_3x3(oImg->u.img.width, oImg->u.img.height - 2, oImg->buffer + oImg->u.img.stride_in_bytes, oImg->u.img.stride_in_bytes,
-            iImg->buffer + iImg->u.img.stride_in_bytes, iImg->u.img.stride_in_bytes, node->localDataPtr)) {
+        // stripes cover the rows inside the 3x3 halo and each stripe uses its own scratch rows
+        vx_uint32 alignedWidth = (oImg->u.img.width + 15) & ~15;
+        vx_size stripeLocalDataSize = 3 * alignedWidth * sizeof(vx_uint16);
+        if (ProcessCpuStripes(node, oImg->u.img.height, 1, 1, stripeLocalDataSize, [&](vx_uint8 * localData, vx_uint32 y, vx_uint32 rows) {
+                return HafCpu_Gaussian_U8_U8_3x3(oImg->u.img.width, rows, oImg->buffer + y * oImg->u.img.stride_in_bytes, oImg->u.img.stride_in_bytes,
+                    iImg->buffer + y * iImg->u.img.stride_in_bytes, iImg->u.img.stride_in_bytes, localData);
+            })) {
             status = VX_FAILURE;
         }
     }
@@ -15288,7 +15655,8 @@ int agoKernel_Gaussian_U8_U8_3x3(AgoNode * node, AgoKernelCommand cmd)
     }
     else if (cmd == ago_kernel_cmd_initialize) {
         int alignedWidth = (node->paramList[0]->u.img.width + 15) & ~15;		// Next highest multiple of 16, so that the buffer is aligned for all three lines
-        node->localDataSize = 3 * alignedWidth * sizeof(vx_uint16);				// Three rows (+some extra) worth of scratch memory
+        node->localDataSize = GetCpuStripeLocalDataSize(node, node->paramList[0]->u.img.height, 1,
+                                                        3 * alignedWidth * sizeof(vx_uint16));	// Three rows (+some extra) worth of scratch memory per stripe
         status = VX_SUCCESS;
     }
     else if (cmd == ago_kernel_cmd_shutdown) {
@@ -19140,8 +19508,14 @@ int agoKernel_WarpAffine_U8_U8_Bilinear(AgoNode * node, AgoKernelCommand cmd)
         AgoData * oImg = node->paramList[0];
         AgoData * iImg = node->paramList[1];
         AgoData * iMat = node->paramList[2];
-        if (HafCpu_WarpAffine_U8_U8_Bilinear(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
-            iImg->u.img.width, iImg->u.img.height, iImg->buffer, iImg->u.img.stride_in_bytes, (ago_affine_matrix_t *)iMat->buffer, node->localDataPtr))
+        // each stripe uses its own coordinate tables
+        vx_uint32 alignedWidth = (oImg->u.img.width + 15) & ~15;
+        vx_size stripeLocalDataSize = 2 * alignedWidth * sizeof(float);
+        if (ProcessCpuStripes(node, oImg->u.img.height, 0, 1, stripeLocalDataSize, [&](vx_uint8 * localData, vx_uint32 y, vx_uint32 rows) {
+                return HafCpu_WarpAffine_U8_U8_Bilinear(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+                    iImg->u.img.width, iImg->u.img.height, iImg->buffer, iImg->u.img.stride_in_bytes, (ago_affine_matrix_t *)iMat->buffer,
+                    localData, y, y + rows);
+            }))
         {
             status = VX_FAILURE;
         }
@@ -19162,7 +19536,8 @@ int agoKernel_WarpAffine_U8_U8_Bilinear(AgoNode * node, AgoKernelCommand cmd)
     }
     else if (cmd == ago_kernel_cmd_initialize) {
         int alignedWidth = (node->paramList[0]->u.img.width + 15) & ~15;		// Next highest multiple of 16, so that the buffer is aligned for all three lines
-        node->localDataSize = 2 * alignedWidth*sizeof(float);				// Three rows (+some extra) worth of scratch memory
+        node->localDataSize = GetCpuStripeLocalDataSize(node, node->paramList[0]->u.img.height, 0,
+                                                        2 * alignedWidth * sizeof(float));	// x and y coordinate tables per stripe
         status = VX_SUCCESS;
     }
     else if (cmd == ago_kernel_cmd_shutdown) {
@@ -19872,8 +20247,14 @@ int agoKernel_ScaleImage_U8_U8_Bilinear(AgoNode * node, AgoKernelCommand cmd)
         status = VX_SUCCESS;
         AgoData * oImg = node->paramList[0];
         AgoData * iImg = node->paramList[1];
-        if (HafCpu_ScaleImage_U8_U8_Bilinear(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
-            iImg->u.img.width, iImg->u.img.height, iImg->buffer, iImg->u.img.stride_in_bytes, (AgoConfigScaleMatrix *)node->localDataPtr))
+        // each stripe uses its own copy of the scale matrix followed by the horizontal mapping tables
+        vx_uint32 alignedWidth = (oImg->u.img.width + 15) & ~15;
+        vx_size stripeLocalDataSize = sizeof(AgoConfigScaleMatrix) + (alignedWidth * 6);
+        if (ProcessCpuStripes(node, oImg->u.img.height, 0, 1, stripeLocalDataSize, [&](vx_uint8 * localData, vx_uint32 y, vx_uint32 rows) {
+                return HafCpu_ScaleImage_U8_U8_Bilinear(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+                    iImg->u.img.width, iImg->u.img.height, iImg->buffer, iImg->u.img.stride_in_bytes,
+                    (AgoConfigScaleMatrix *)localData, y, y + rows);
+            }))
         {
             status = VX_FAILURE;
         }
@@ -19892,7 +20273,9 @@ int agoKernel_ScaleImage_U8_U8_Bilinear(AgoNode * node, AgoKernelCommand cmd)
         AgoData * oImg = node->paramList[0];
         AgoData * iImg = node->paramList[1];
         int alignedWidth = (oImg->u.img.width + 15) & ~15;
-        node->localDataSize = sizeof(AgoConfigScaleMatrix) + (alignedWidth * 6);
+        vx_size stripeLocalDataSize = sizeof(AgoConfigScaleMatrix) + (alignedWidth * 6);
+        node->localDataSize = GetCpuStripeLocalDataSize(node, oImg->u.img.height, 0, stripeLocalDataSize);
+        vx_uint32 numStripes = (vx_uint32)(node->localDataSize / stripeLocalDataSize);
         node->localDataPtr = (vx_uint8 *)agoAllocMemory(node->localDataSize);
         if (!node->localDataPtr) return VX_ERROR_NO_MEMORY;
         // compute scale matrix from the input and output image sizes
@@ -19901,6 +20284,9 @@ int agoKernel_ScaleImage_U8_U8_Bilinear(AgoNode * node, AgoKernelCommand cmd)
         scalemat->yscale = (vx_float32)((vx_float64)iImg->u.img.height / (vx_float64)oImg->u.img.height);
         scalemat->xoffset = (vx_float32)((vx_float64)iImg->u.img.width / (vx_float64)oImg->u.img.width * 0.5 - 0.5);
         scalemat->yoffset = (vx_float32)((vx_float64)iImg->u.img.height / (vx_float64)oImg->u.img.height * 0.5 - 0.5);
+        for (vx_uint32 stripe = 1; stripe < numStripes; stripe++) {
+            *(AgoConfigScaleMatrix *)(node->localDataPtr + stripe * stripeLocalDataSize) = *scalemat;
+        }
     }
     else if (cmd == ago_kernel_cmd_shutdown) {
         status = VX_SUCCESS;
@@ -20712,9 +21098,14 @@ int agoKernel_HarrisMergeSortAndPick_XY_HVC(AgoNode * node, AgoKernelCommand cmd
         AgoData * oNum = node->paramList[1];
         AgoData * iImg = node->paramList[2];
         vx_float32 min_distance = node->paramList[3]->u.scalar.u.f;
+        ago_harris_grid_header_t * gridInfo = (ago_harris_grid_header_t *)node->localDataPtr;
+        ago_coord2d_short_t * gridBuf = (ago_coord2d_short_t *)&node->localDataPtr[sizeof(ago_harris_grid_header_t)];
+        ago_keypoint_xys_t * list = (ago_keypoint_xys_t *)&node->localDataPtr[sizeof(ago_harris_grid_header_t) + gridInfo->gridBufSize];
+        vx_uint32 capacityOfList = (vx_uint32)((node->localDataSize - sizeof(ago_harris_grid_header_t) - gridInfo->gridBufSize) / sizeof(ago_keypoint_xys_t));
         vx_uint32 cornerCount = 0;
         if (HafCpu_HarrisMergeSortAndPick_XY_HVC((vx_uint32)oXY->u.arr.capacity, (vx_keypoint_t *)oXY->buffer, &cornerCount,
-            iImg->u.img.width, iImg->u.img.height, (vx_float32 *)iImg->buffer, iImg->u.img.stride_in_bytes, min_distance)) {
+            iImg->u.img.width, iImg->u.img.height, (vx_float32 *)iImg->buffer, iImg->u.img.stride_in_bytes, min_distance,
+            capacityOfList, list, gridInfo->gridBufSize ? gridInfo : nullptr, gridBuf)) {
             status = VX_FAILURE;
         }
         else {
@@ -20740,7 +21131,33 @@ int agoKernel_HarrisMergeSortAndPick_XY_HVC(AgoNode * node, AgoKernelCommand cmd
         meta->data.u.scalar.type = VX_TYPE_SIZE;
         status = VX_SUCCESS;
     }
-    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+    else if (cmd == ago_kernel_cmd_initialize) {
+        // allocate a local buffer for the grid with grid meta data, followed by the list of 3x3 local maxima:
+        // local maxima are never 8-connected, so there is at most one per 2x2 block
+        vx_float32 min_distance = node->paramList[3]->u.scalar.u.f;
+        vx_uint32 width = node->paramList[2]->u.img.width;
+        vx_uint32 height = node->paramList[2]->u.img.height;
+        vx_uint32 gridBufSize = 0;
+        if (min_distance > 2.0f) { // no need to check neighorhood when min_distance <= 2.0f
+            gridBufSize = HafCpu_NonMaxSuppGridInfo(nullptr, width, height, min_distance);
+        }
+        vx_size listSize = (vx_size)((width + 1) / 2) * ((height + 1) / 2) * sizeof(ago_keypoint_xys_t);
+        node->localDataSize = sizeof(ago_harris_grid_header_t) + gridBufSize + listSize;
+        node->localDataPtr = (vx_uint8 *)agoAllocMemory(node->localDataSize); if (!node->localDataPtr) return VX_ERROR_NO_MEMORY;
+        ago_harris_grid_header_t * gridInfo = (ago_harris_grid_header_t *)node->localDataPtr;
+        if (gridBufSize) {
+            HafCpu_NonMaxSuppGridInfo(gridInfo, width, height, min_distance);
+        }
+        else {
+            memset(gridInfo, 0, sizeof(ago_harris_grid_header_t));
+        }
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_shutdown) {
+        if (node->localDataPtr) {
+            agoReleaseMemory(node->localDataPtr);
+            node->localDataPtr = nullptr;
+        }
         status = VX_SUCCESS;
     }
     else if (cmd == ago_kernel_cmd_query_target_support) {
@@ -20801,17 +21218,10 @@ int agoKernel_HarrisMergeSortAndPick_XY_XYS(AgoNode * node, AgoKernelCommand cmd
             // allocate a local buffer for a grid buffer with grid meta data
             vx_uint32 width = node->paramList[4]->u.scalar.u.u;
             vx_uint32 height = node->paramList[5]->u.scalar.u.u;
-            vx_uint32 cellSize = (vx_uint32)floor(min_distance / M_SQRT2);
-            vx_uint32 gridWidth = (width + cellSize - 1) / cellSize;
-            vx_uint32 gridHeight = (height + cellSize - 1) / cellSize;
-            vx_uint32 gridBufSize = (vx_uint32)((unsigned long)(gridWidth * gridHeight) * sizeof(ago_coord2d_short_t));
+            vx_uint32 gridBufSize = HafCpu_NonMaxSuppGridInfo(nullptr, width, height, min_distance);
             node->localDataSize = sizeof(ago_harris_grid_header_t) + gridBufSize;
             node->localDataPtr = (vx_uint8 *)agoAllocMemory(node->localDataSize); if (!node->localDataPtr) return VX_ERROR_NO_MEMORY;
-            ago_harris_grid_header_t * gridInfo = (ago_harris_grid_header_t *)node->localDataPtr;
-            gridInfo->width = gridWidth;
-            gridInfo->height = gridHeight;
-            gridInfo->cellSize = cellSize;
-            gridInfo->gridBufSize = gridBufSize;
+            HafCpu_NonMaxSuppGridInfo((ago_harris_grid_header_t *)node->localDataPtr, width, height, min_distance);
         }
         status = VX_SUCCESS;
     }
@@ -22618,4 +23028,241 @@ int agoKernel_LaplacianReconstruct_DATA_DATA_DATA(AgoNode * node, AgoKernelComma
         status = VX_SUCCESS;
     }
     return status;
-}
\ No newline at end of file
+}
+int agoKernel_TensorMultiply_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor1 = node->paramList[1];
+        AgoData * iTensor2 = node->paramList[2];
+        vx_size stride1[AGO_MAX_TENSOR_DIMENSIONS], stride2[AGO_MAX_TENSOR_DIMENSIONS];
+        GetTensorBroadcastStrides(oTensor, iTensor1, stride1);
+        GetTensorBroadcastStrides(oTensor, iTensor2, stride2);
+        vx_bool saturate = (node->paramList[4]->u.scalar.u.e == VX_CONVERT_POLICY_SATURATE) ? vx_true_e : vx_false_e;
+        vx_bool roundToNearestEven = (node->paramList[5]->u.scalar.u.e == VX_ROUND_POLICY_TO_NEAREST_EVEN) ? vx_true_e : vx_false_e;
+        if (HafCpu_TensorMultiply_DATA_DATA_DATA(oTensor->u.tensor.num_dims, oTensor->u.tensor.dims, oTensor->u.tensor.data_type, oTensor->u.tensor.fixed_point_pos,
+                node->paramList[3]->u.scalar.u.f, saturate, roundToNearestEven, oTensor->buffer, oTensor->u.tensor.stride,
+                iTensor1->buffer, stride1, iTensor2->buffer, stride2)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_Multiply(&node->metaList[0], node->paramList[0], node->paramList[1], node->paramList[2], node->paramList[3], node->paramList[4], node->paramList[5]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorAdd_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor1 = node->paramList[1];
+        AgoData * iTensor2 = node->paramList[2];
+        vx_size stride1[AGO_MAX_TENSOR_DIMENSIONS], stride2[AGO_MAX_TENSOR_DIMENSIONS];
+        GetTensorBroadcastStrides(oTensor, iTensor1, stride1);
+        GetTensorBroadcastStrides(oTensor, iTensor2, stride2);
+        vx_bool saturate = (node->paramList[3]->u.scalar.u.e == VX_CONVERT_POLICY_SATURATE) ? vx_true_e : vx_false_e;
+        if (HafCpu_TensorAdd_DATA_DATA_DATA(oTensor->u.tensor.num_dims, oTensor->u.tensor.dims, oTensor->u.tensor.data_type, saturate,
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor1->buffer, stride1, iTensor2->buffer, stride2)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_AddSubtract(&node->metaList[0], node->paramList[0], node->paramList[1], node->paramList[2], node->paramList[3]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorSubtract_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor1 = node->paramList[1];
+        AgoData * iTensor2 = node->paramList[2];
+        vx_size stride1[AGO_MAX_TENSOR_DIMENSIONS], stride2[AGO_MAX_TENSOR_DIMENSIONS];
+        GetTensorBroadcastStrides(oTensor, iTensor1, stride1);
+        GetTensorBroadcastStrides(oTensor, iTensor2, stride2);
+        vx_bool saturate = (node->paramList[3]->u.scalar.u.e == VX_CONVERT_POLICY_SATURATE) ? vx_true_e : vx_false_e;
+        if (HafCpu_TensorSubtract_DATA_DATA_DATA(oTensor->u.tensor.num_dims, oTensor->u.tensor.dims, oTensor->u.tensor.data_type, saturate,
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor1->buffer, stride1, iTensor2->buffer, stride2)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_AddSubtract(&node->metaList[0], node->paramList[0], node->paramList[1], node->paramList[2], node->paramList[3]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorTableLookup_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor = node->paramList[1];
+        AgoData * iLut = node->paramList[2];
+        if (HafCpu_TensorTableLookup_DATA_DATA_DATA(oTensor->u.tensor.num_dims, oTensor->u.tensor.dims, oTensor->u.tensor.data_type,
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor->buffer, iTensor->u.tensor.stride,
+                iLut->buffer, (vx_uint32)iLut->u.lut.count, iLut->u.lut.offset)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_TableLookup(&node->metaList[0], node->paramList[0], node->paramList[1], node->paramList[2]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorTranspose_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor = node->paramList[1];
+        if (HafCpu_TensorTranspose_DATA_DATA(oTensor->u.tensor.num_dims, oTensor->u.tensor.dims, oTensor->u.tensor.stride[0],
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor->buffer, iTensor->u.tensor.stride,
+                node->paramList[2]->u.scalar.u.s, node->paramList[3]->u.scalar.u.s)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_Transpose(&node->metaList[0], node->paramList[0], node->paramList[1], node->paramList[2], node->paramList[3]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorConvertDepth_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor = node->paramList[1];
+        vx_bool saturate = (node->paramList[2]->u.scalar.u.e == VX_CONVERT_POLICY_SATURATE) ? vx_true_e : vx_false_e;
+        if (HafCpu_TensorConvertDepth_DATA_DATA(oTensor->u.tensor.num_dims, oTensor->u.tensor.dims,
+                oTensor->buffer, oTensor->u.tensor.stride, oTensor->u.tensor.data_type, oTensor->u.tensor.fixed_point_pos,
+                iTensor->buffer, iTensor->u.tensor.stride, iTensor->u.tensor.data_type, iTensor->u.tensor.fixed_point_pos,
+                saturate, node->paramList[3]->u.scalar.u.f, node->paramList[4]->u.scalar.u.f)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_ConvertDepth(&node->metaList[0], node->paramList[0], node->paramList[1], node->paramList[2], node->paramList[3], node->paramList[4]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorMatrixMultiply_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor1 = node->paramList[1];
+        AgoData * iTensor2 = node->paramList[2];
+        AgoData * iTensor3 = node->paramList[3];
+        const vx_tensor_matrix_multiply_params_t * mmParams = (const vx_tensor_matrix_multiply_params_t *)node->paramList[4]->buffer;
+        vx_size M, N, K;
+        GetTensorMatrixSize(iTensor1, mmParams->transpose_input1, M, K);
+        GetTensorMatrixSize(iTensor2, mmParams->transpose_input2, K, N);
+        // strides along the columns and rows of each matrix after the optional transpose
+        const vx_size * s1 = iTensor1->u.tensor.stride, * s2 = iTensor2->u.tensor.stride;
+        vx_size stride1[2] = { mmParams->transpose_input1 ? s1[1] : s1[0], mmParams->transpose_input1 ? s1[0] : s1[1] };
+        vx_size stride2[2] = { mmParams->transpose_input2 ? s2[1] : s2[0], mmParams->transpose_input2 ? s2[0] : s2[1] };
+        vx_size stride3[2] = { 0, 0 };
+        if (iTensor3) {
+            const vx_size * s3 = iTensor3->u.tensor.stride;
+            stride3[0] = mmParams->transpose_input3 ? s3[1] : s3[0];
+            stride3[1] = mmParams->transpose_input3 ? s3[0] : s3[1];
+        }
+        if (HafCpu_TensorMatrixMultiply_DATA_DATA_DATA(oTensor->u.tensor.data_type, oTensor->u.tensor.fixed_point_pos, M, N, K,
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor1->buffer, stride1, iTensor2->buffer, stride2,
+                iTensor3 ? iTensor3->buffer : nullptr, stride3, (vx_float32 *)node->localDataPtr)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_MatrixMultiply(&node->metaList[0], node->paramList[0], node->paramList[1], node->paramList[2], node->paramList[3], node->paramList[4]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize) {
+        // scratch for packing a transposed float input2 into rows of contiguous floats
+        const vx_tensor_matrix_multiply_params_t * mmParams = (const vx_tensor_matrix_multiply_params_t *)node->paramList[4]->buffer;
+        if (node->paramList[0]->u.tensor.data_type == VX_TYPE_FLOAT32 && mmParams->transpose_input2) {
+            AgoData * iTensor2 = node->paramList[2];
+            node->localDataSize = iTensor2->u.tensor.dims[0] * iTensor2->u.tensor.dims[1] * sizeof(vx_float32);
+        }
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
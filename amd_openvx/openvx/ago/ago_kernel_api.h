@@ -78,6 +78,13 @@ int ovxKernel_WeightedAverage(AgoNode * node, AgoKernelCommand cmd);
 int ovxKernel_NonLinearFilter(AgoNode * node, AgoKernelCommand cmd);
 int ovxKernel_LaplacianPyramid(AgoNode * node, AgoKernelCommand cmd);
 int ovxKernel_LaplacianReconstruct(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorMultiply(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorAdd(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorSubtract(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorTableLookup(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorTranspose(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorConvertDepth(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorMatrixMultiply(AgoNode * node, AgoKernelCommand cmd);
 // AMD low-level kernels
 int agoKernel_Set00_U8(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_SetFF_U8(AgoNode * node, AgoKernelCommand cmd);
@@ -368,5 +375,12 @@ int agoKernel_WeightedAverage_U8_U8_U8(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_NonLinearFilter_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_LaplacianPyramid_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_LaplacianReconstruct_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorMultiply_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorAdd_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorSubtract_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorTableLookup_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorTranspose_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorConvertDepth_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorMatrixMultiply_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
 #endif // __ago_kernels_api_h__
 
@@ -35,6 +35,7 @@ THE SOFTWARE.
 #define AINx4_AOUT                             { AIN, AIN, AIN, AIN, AOUT }
 #define AINx5_AOUT                             { AIN, AIN, AIN, AIN, AIN, AOUT }
 #define AINx2_AOPTINx2_AOUT                    { AIN, AIN, AOPTIN, AOPTIN, AOUT }
+#define AINx2_AOPTIN_AIN_AOUT                  { AIN, AIN, AOPTIN, AIN, AOUT }
 #define AIN_AOPTOUTx2                          { AIN, AOPTOUT, AOPTOUT }
 #define AIN_AOUT_AIN                           { AIN, AOUT, AIN }
 #define AIN_AOUTx2                             { AIN, AOUT, AOUT }
@@ -51,6 +52,8 @@ THE SOFTWARE.
 #define AOUT_AINx2_AOPTIN                      { AOUT, AIN, AIN, AOPTIN }
 #define AOUT_AINx3                             { AOUT, AIN, AIN, AIN }
 #define AOUT_AINx4                             { AOUT, AIN, AIN, AIN, AIN }
+#define AOUT_AINx5                             { AOUT, AIN, AIN, AIN, AIN, AIN }
+#define AOUT_AINx2_AOPTIN_AIN                  { AOUT, AIN, AIN, AOPTIN, AIN }
 #define AOUT_AINx8                             { AOUT, AIN, AIN, AIN, AIN, AIN, AIN, AIN, AIN }
 #define AOUT_AINx9                             { AOUT, AIN, AIN, AIN, AIN, AIN, AIN, AIN, AIN, AIN }
 #define AOUTx2_AIN                             { AOUT, AOUT, AIN }
@@ -150,11 +153,23 @@ THE SOFTWARE.
 #define ATYPE_SRRR                             { VX_TYPE_SCALAR, VX_TYPE_REFERENCE, VX_TYPE_REFERENCE, VX_TYPE_REFERENCE }
 #define ATYPE_RSRR                             { VX_TYPE_REFERENCE, VX_TYPE_SCALAR, VX_TYPE_REFERENCE, VX_TYPE_REFERENCE }
 #define ATYPE_IMIS                             { VX_TYPE_IMAGE, VX_TYPE_MATRIX, VX_TYPE_IMAGE, VX_TYPE_SCALAR }
+#define ATYPE_TTL                              { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_LUT }
+#define ATYPE_TLT                              { VX_TYPE_TENSOR, VX_TYPE_LUT, VX_TYPE_TENSOR }
+#define ATYPE_TTSS                             { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_SCALAR }
+#define ATYPE_TTST                             { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_TENSOR }
+#define ATYPE_TTTS                             { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR }
+#define ATYPE_TSSST                            { VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_TENSOR }
+#define ATYPE_TTSSS                            { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_SCALAR }
+#define ATYPE_TTSSST                           { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_TENSOR }
+#define ATYPE_TTTSSS                           { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_SCALAR }
+#define ATYPE_TTTST                            { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_TENSOR }
+#define ATYPE_TTTTS                            { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR }
 
 // for kernOpType & kernOpInfo
 #define KOP_UNKNOWN    AGO_KERNEL_OP_TYPE_UNKNOWN,         0,
-#define KOP_ELEMWISE   AGO_KERNEL_OP_TYPE_ELEMENT_WISE,    0,
+#define KOP_ELEMWISE   AGO_KERNEL_OP_TYPE_ELEMENT_WISE | AGO_KERNEL_OP_FLAG_CPU_TILE, 0,
 #define KOP_FIXED(N)   AGO_KERNEL_OP_TYPE_FIXED_NEIGHBORS, N,
+#define KOP_FIXED_TILE(N) AGO_KERNEL_OP_TYPE_FIXED_NEIGHBORS | AGO_KERNEL_OP_FLAG_CPU_TILE, N,
 
 // list of all built-in kernels
 static struct {
@@ -173,6 +188,12 @@ static struct {
 		AGO_KERNEL_FLAG_GROUP_OVX10 | \
 		(validRectReset ? AGO_KERNEL_FLAG_VALID_RECT_RESET : 0), argCfg, argType \
 	}
+#define OVX_KERNEL_ENTRY_OVERRIDABLE(kernel_id,name,kname,argCfg,argType,validRectReset) \
+	{                                                               \
+		kernel_id, ovxKernel_ ## name, "org.khronos.openvx." kname, \
+		AGO_KERNEL_FLAG_GROUP_OVX10 | AGO_KERNEL_FLAG_OVERRIDABLE | \
+		(validRectReset ? AGO_KERNEL_FLAG_VALID_RECT_RESET : 0), argCfg, argType \
+	}
 #define AGO_KERNEL_ENTRY(kernel_id,cpu_avail,gpu_avail,name,argCfg,argType,kernOp,validRectReset) \
 	{                                                               \
 		kernel_id, agoKernel_ ## name, "com.amd.openvx." #name,     \
@@ -227,6 +248,14 @@ static struct {
 	OVX_KERNEL_ENTRY( VX_KERNEL_NON_LINEAR_FILTER     , NonLinearFilter, "non_linear_filter",      		AINx3_AOUT,	     	  ATYPE_SIMI         , false ),	
 	OVX_KERNEL_ENTRY( VX_KERNEL_LAPLACIAN_PYRAMID     , LaplacianPyramid, "laplacian_pyramid",     		AINx2_AOUT,	     	  ATYPE_IPI        	 , false ),	
 	OVX_KERNEL_ENTRY( VX_KERNEL_LAPLACIAN_RECONSTRUCT , LaplacianReconstruct, "laplacian_reconstruct",  AINx2_AOUT,	     	  ATYPE_PII        	 , false ),	
+	// OpenVX 1.2 tensor kernels (can be overridden by extensions, such as vx_nn)
+	OVX_KERNEL_ENTRY_OVERRIDABLE( VX_KERNEL_TENSOR_MULTIPLY        , TensorMultiply, "tensor_multiply",               AINx5_AOUT,            ATYPE_TTSSST       , false ),
+	OVX_KERNEL_ENTRY_OVERRIDABLE( VX_KERNEL_TENSOR_ADD             , TensorAdd, "tensor_add",                         AINx3_AOUT,            ATYPE_TTST         , false ),
+	OVX_KERNEL_ENTRY_OVERRIDABLE( VX_KERNEL_TENSOR_SUBTRACT        , TensorSubtract, "tensor_subtract",               AINx3_AOUT,            ATYPE_TTST         , false ),
+	OVX_KERNEL_ENTRY_OVERRIDABLE( VX_KERNEL_TENSOR_TABLE_LOOKUP    , TensorTableLookup, "tensor_table_lookup",        AINx2_AOUT,            ATYPE_TLT          , false ),
+	OVX_KERNEL_ENTRY_OVERRIDABLE( VX_KERNEL_TENSOR_TRANSPOSE       , TensorTranspose, "tensor_transpose",             AIN_AOUT_AINx2,        ATYPE_TTSS         , false ),
+	OVX_KERNEL_ENTRY_OVERRIDABLE( VX_KERNEL_TENSOR_CONVERT_DEPTH   , TensorConvertDepth, "tensor_convert_depth",      AINx4_AOUT,            ATYPE_TSSST        , false ),
+	OVX_KERNEL_ENTRY_OVERRIDABLE( VX_KERNEL_TENSOR_MATRIX_MULTIPLY , TensorMatrixMultiply, "tensor_matrix_multiply",  AINx2_AOPTIN_AIN_AOUT, ATYPE_TTTST        , false ),
 	// AMD low-level kernel primitives
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SET_00_U8                                               , 1, 1, Set00_U8, { AOUT },                                           ATYPE_I                 , KOP_ELEMWISE  , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SET_FF_U8                                               , 1, 1, SetFF_U8, { AOUT },                                           ATYPE_I                 , KOP_ELEMWISE  , false ),
@@ -401,11 +430,11 @@ static struct {
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_COLOR_CONVERT_IUV_RGBX                                  , 1, 1, ColorConvert_IUV_RGBX, AOUTx2_AIN,                            ATYPE_III               , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_COLOR_CONVERT_UV12_RGB                                  , 1, 1, ColorConvert_UV12_RGB, AOUT_AIN,                              ATYPE_II                , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_COLOR_CONVERT_UV12_RGBX                                 , 1, 1, ColorConvert_UV12_RGBX, AOUT_AIN,                             ATYPE_II                , KOP_UNKNOWN   , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_BOX_U8_U8_3x3                                           , 1, 1, Box_U8_U8_3x3, AOUT_AIN,                                      ATYPE_II                , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_DILATE_U8_U8_3x3                                        , 1, 1, Dilate_U8_U8_3x3, AOUT_AIN,                                   ATYPE_II                , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_ERODE_U8_U8_3x3                                         , 1, 1, Erode_U8_U8_3x3, AOUT_AIN,                                    ATYPE_II                , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_MEDIAN_U8_U8_3x3                                        , 1, 1, Median_U8_U8_3x3, AOUT_AIN,                                   ATYPE_II                , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_GAUSSIAN_U8_U8_3x3                                      , 1, 1, Gaussian_U8_U8_3x3, AOUT_AIN,                                 ATYPE_II                , KOP_FIXED(3)  , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_BOX_U8_U8_3x3                                           , 1, 1, Box_U8_U8_3x3, AOUT_AIN,                                      ATYPE_II                , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_DILATE_U8_U8_3x3                                        , 1, 1, Dilate_U8_U8_3x3, AOUT_AIN,                                   ATYPE_II                , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_ERODE_U8_U8_3x3                                         , 1, 1, Erode_U8_U8_3x3, AOUT_AIN,                                    ATYPE_II                , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_MEDIAN_U8_U8_3x3                                        , 1, 1, Median_U8_U8_3x3, AOUT_AIN,                                   ATYPE_II                , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_GAUSSIAN_U8_U8_3x3                                      , 1, 1, Gaussian_U8_U8_3x3, AOUT_AIN,                                 ATYPE_II                , KOP_FIXED_TILE(3), false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_GAUSSIAN_HALF_U8_U8_3x3                           , 1, 1, ScaleGaussianHalf_U8_U8_3x3, AOUT_AIN,                        ATYPE_II                , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_GAUSSIAN_HALF_U8_U8_5x5                           , 1, 1, ScaleGaussianHalf_U8_U8_5x5, AOUT_AIN,                        ATYPE_II                , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_GAUSSIAN_ORB_U8_U8_5x5                            , 1, 1, ScaleGaussianOrb_U8_U8_5x5, AOUT_AIN,                         ATYPE_II                , KOP_UNKNOWN   , false ),
@@ -413,18 +442,18 @@ static struct {
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_CONVOLVE_S16_U8                                         , 1, 1, Convolve_S16_U8, AOUT_AINx2,                                  ATYPE_IIC               , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_LINEAR_FILTER_ANY_ANY                                   , 1, 1, LinearFilter_ANY_ANY, AOUT_AINx2,                             ATYPE_IIM               , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_LINEAR_FILTER_ANYx2_ANY                                 , 1, 1, LinearFilter_ANYx2_ANY, AOUTx2_AINx3,                         ATYPE_IIIMM             , KOP_UNKNOWN   , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SOBEL_MAGNITUDE_S16_U8_3x3                              , 1, 1, SobelMagnitude_S16_U8_3x3, AOUT_AIN,                          ATYPE_II                , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SOBEL_PHASE_U8_U8_3x3                                   , 1, 1, SobelPhase_U8_U8_3x3, AOUT_AIN,                               ATYPE_II                , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SOBEL_MAGNITUDE_PHASE_S16U8_U8_3x3                      , 1, 1, SobelMagnitudePhase_S16U8_U8_3x3, AOUTx2_AIN,                 ATYPE_III               , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SOBEL_S16S16_U8_3x3_GXY                                 , 1, 1, Sobel_S16S16_U8_3x3_GXY, AOUTx2_AIN,                          ATYPE_III               , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SOBEL_S16_U8_3x3_GX                                     , 1, 1, Sobel_S16_U8_3x3_GX, AOUT_AIN,                                ATYPE_II                , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SOBEL_S16_U8_3x3_GY                                     , 1, 1, Sobel_S16_U8_3x3_GY, AOUT_AIN,                                ATYPE_II                , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_DILATE_U1_U8_3x3                                        , 1, 1, Dilate_U1_U8_3x3, AOUT_AIN,                                   ATYPE_II                , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_ERODE_U1_U8_3x3                                         , 1, 1, Erode_U1_U8_3x3, AOUT_AIN,                                    ATYPE_II                , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_DILATE_U1_U1_3x3                                        , 1, 1, Dilate_U1_U1_3x3, AOUT_AIN,                                   ATYPE_II                , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_ERODE_U1_U1_3x3                                         , 1, 1, Erode_U1_U1_3x3, AOUT_AIN,                                    ATYPE_II                , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_DILATE_U8_U1_3x3                                        , 1, 1, Dilate_U8_U1_3x3, AOUT_AIN,                                   ATYPE_II                , KOP_FIXED(3)  , false ),
-	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_ERODE_U8_U1_3x3                                         , 1, 1, Erode_U8_U1_3x3, AOUT_AIN,                                    ATYPE_II                , KOP_FIXED(3)  , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SOBEL_MAGNITUDE_S16_U8_3x3                              , 1, 1, SobelMagnitude_S16_U8_3x3, AOUT_AIN,                          ATYPE_II                , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SOBEL_PHASE_U8_U8_3x3                                   , 1, 1, SobelPhase_U8_U8_3x3, AOUT_AIN,                               ATYPE_II                , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SOBEL_MAGNITUDE_PHASE_S16U8_U8_3x3                      , 1, 1, SobelMagnitudePhase_S16U8_U8_3x3, AOUTx2_AIN,                 ATYPE_III               , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SOBEL_S16S16_U8_3x3_GXY                                 , 1, 1, Sobel_S16S16_U8_3x3_GXY, AOUTx2_AIN,                          ATYPE_III               , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SOBEL_S16_U8_3x3_GX                                     , 1, 1, Sobel_S16_U8_3x3_GX, AOUT_AIN,                                ATYPE_II                , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SOBEL_S16_U8_3x3_GY                                     , 1, 1, Sobel_S16_U8_3x3_GY, AOUT_AIN,                                ATYPE_II                , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_DILATE_U1_U8_3x3                                        , 1, 1, Dilate_U1_U8_3x3, AOUT_AIN,                                   ATYPE_II                , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_ERODE_U1_U8_3x3                                         , 1, 1, Erode_U1_U8_3x3, AOUT_AIN,                                    ATYPE_II                , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_DILATE_U1_U1_3x3                                        , 1, 1, Dilate_U1_U1_3x3, AOUT_AIN,                                   ATYPE_II                , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_ERODE_U1_U1_3x3                                         , 1, 1, Erode_U1_U1_3x3, AOUT_AIN,                                    ATYPE_II                , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_DILATE_U8_U1_3x3                                        , 1, 1, Dilate_U8_U1_3x3, AOUT_AIN,                                   ATYPE_II                , KOP_FIXED_TILE(3), false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_ERODE_U8_U1_3x3                                         , 1, 1, Erode_U8_U1_3x3, AOUT_AIN,                                    ATYPE_II                , KOP_FIXED_TILE(3), false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_FAST_CORNERS_XY_U8_SUPRESSION                           , 1, 1, FastCorners_XY_U8_Supression, AOUT_AOPTOUT_AINx2,             ATYPE_ASIS              , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_FAST_CORNERS_XY_U8_NOSUPRESSION                         , 1, 1, FastCorners_XY_U8_NoSupression, AOUT_AOPTOUT_AINx2,           ATYPE_ASIS              , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_HARRIS_SOBEL_HG3_U8_3x3                                 , 1, 1, HarrisSobel_HG3_U8_3x3, AOUT_AIN,                             ATYPE_II                , KOP_FIXED(3)  , false ),
@@ -517,7 +546,15 @@ static struct {
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_NON_LINEAR_FILTER_DATA_DATA_DATA                        , 1, 0, NonLinearFilter_DATA_DATA_DATA, AOUT_AINx3,                   ATYPE_IMIS              , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_LAPLACIAN_PYRAMID_DATA_DATA_DATA                        , 1, 0, LaplacianPyramid_DATA_DATA_DATA, AOUT_AINx2,                  ATYPE_IPI               , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_LAPLACIAN_RECONSTRUCT_DATA_DATA_DATA                    , 1, 0, LaplacianReconstruct_DATA_DATA_DATA, AOUT_AINx2,              ATYPE_IIP               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_MULTIPLY_DATA_DATA_DATA                          , 1, 0, TensorMultiply_DATA_DATA_DATA, AOUT_AINx5,                    ATYPE_TTTSSS            , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_ADD_DATA_DATA_DATA                               , 1, 0, TensorAdd_DATA_DATA_DATA, AOUT_AINx3,                         ATYPE_TTTS              , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_SUBTRACT_DATA_DATA_DATA                          , 1, 0, TensorSubtract_DATA_DATA_DATA, AOUT_AINx3,                    ATYPE_TTTS              , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_TABLE_LOOKUP_DATA_DATA_DATA                      , 1, 0, TensorTableLookup_DATA_DATA_DATA, AOUT_AINx2,                 ATYPE_TTL               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_TRANSPOSE_DATA_DATA                              , 1, 0, TensorTranspose_DATA_DATA, AOUT_AINx3,                        ATYPE_TTSS              , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_CONVERT_DEPTH_DATA_DATA                          , 1, 0, TensorConvertDepth_DATA_DATA, AOUT_AINx4,                     ATYPE_TTSSS             , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_MATRIX_MULTIPLY_DATA_DATA_DATA                   , 1, 0, TensorMatrixMultiply_DATA_DATA_DATA, AOUT_AINx2_AOPTIN_AIN,   ATYPE_TTTTS             , KOP_UNKNOWN   , false ),
 #undef AGO_KERNEL_ENTRY
+#undef OVX_KERNEL_ENTRY_OVERRIDABLE
 #undef OVX_KERNEL_ENTRY
 };
 size_t ago_kernel_count = sizeof(ago_kernel_list) / sizeof(ago_kernel_list[0]);
@@ -453,6 +453,13 @@ enum vx_kernel_amd_e {
 	VX_KERNEL_AMD_NON_LINEAR_FILTER_DATA_DATA_DATA,
 	VX_KERNEL_AMD_LAPLACIAN_PYRAMID_DATA_DATA_DATA,
 	VX_KERNEL_AMD_LAPLACIAN_RECONSTRUCT_DATA_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_MULTIPLY_DATA_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_ADD_DATA_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_SUBTRACT_DATA_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_TABLE_LOOKUP_DATA_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_TRANSPOSE_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_CONVERT_DEPTH_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_MATRIX_MULTIPLY_DATA_DATA_DATA,
 
 	VX_KERNEL_AMD_MAX_1_0, // Used for bounds checking in the internal conformance test
 };
@@ -22,28 +22,72 @@ THE SOFTWARE.
 
 
 #include "ago_platform.h"
+#if __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
-// macro to port VisualStudio __cpuid to g++
+// macro to port VisualStudio __cpuid and __cpuidex to g++
 #if !_WIN32
 #define __cpuid(out, infoType) asm("cpuid": "=a" (out[0]), "=b" (out[1]), "=c" (out[2]), "=d" (out[3]): "a" (infoType));
+#define __cpuidex(out, infoType, subType) asm("cpuid": "=a" (out[0]), "=b" (out[1]), "=c" (out[2]), "=d" (out[3]): "a" (infoType), "c" (subType));
+#endif
+
+static inline uint64_t agoGetExtendedControlRegister(uint32_t index)
+{
+#if _WIN32
+	return _xgetbv(index);
+#else
+	uint32_t eax, edx;
+	asm("xgetbv" : "=a" (eax), "=d" (edx) : "c" (index));
+	return ((uint64_t)edx << 32) | eax;
 #endif
+}
 
 #if _WIN32 && ENABLE_OPENCL
 #pragma comment(lib, "OpenCL.lib")
 #endif
 
-bool agoIsCpuHardwareSupported()
+uint32_t g_agoCpuFeatures = AGO_CPU_FEATURE_SSE4_2;
+
+uint32_t agoGetCpuFeatures()
 {
-	bool isHardwareSupported = false;
+	uint32_t features = 0;
 	int CPUInfo[4] = { -1 };
 	__cpuid(CPUInfo, 0);
-	if (CPUInfo[0] > 1) {
+	int maxInfoType = CPUInfo[0];
+	if (maxInfoType > 1) {
 		__cpuid(CPUInfo, 1);
 		// check for SSE4.2 support
 		if (CPUInfo[2] & 0x100000)
-			isHardwareSupported = true;
+			features |= AGO_CPU_FEATURE_SSE4_2;
+		// check for AVX and OSXSAVE before using XGETBV: XCR0 tells which register states are saved by the OS
+		uint64_t xcr0 = 0;
+		if ((CPUInfo[2] & 0x18000000) == 0x18000000)
+			xcr0 = agoGetExtendedControlRegister(0);
+		if (maxInfoType >= 7) {
+			__cpuidex(CPUInfo, 7, 0);
+			if ((CPUInfo[1] & 0x00000020) && (xcr0 & 0x06) == 0x06)
+				features |= AGO_CPU_FEATURE_AVX2;
+			if (CPUInfo[1] & 0x00000100)
+				features |= AGO_CPU_FEATURE_BMI2;
+			if ((CPUInfo[1] & 0x40010000) == 0x40010000 && (xcr0 & 0xe6) == 0xe6)
+				features |= AGO_CPU_FEATURE_AVX512BW;
+		}
 	}
-	return isHardwareSupported;
+	return features;
+}
+
+bool agoIsCpuHardwareSupported()
+{
+	uint32_t features = agoGetCpuFeatures();
+	// select the primitive variants: AGO_CPU_FEATURE_MASK can be used to disable the use of some features
+	char textBuffer[64];
+	if (agoGetEnvironmentVariable("AGO_CPU_FEATURE_MASK", textBuffer, sizeof(textBuffer))) {
+		features &= (uint32_t)strtoul(textBuffer, NULL, 0) | AGO_CPU_FEATURE_SSE4_2;
+	}
+	g_agoCpuFeatures = features;
+	return (features & AGO_CPU_FEATURE_SSE4_2) ? true : false;
 }
 
 uint32_t agoControlFpSetRoundEven()
@@ -130,6 +174,142 @@ void agoCloseModule(ago_module module)
 #endif
 }
 
+// CPUs that a thread can be bound to: one processor group on Windows, a cpu_set_t on Linux
+#if _WIN32
+static const long s_agoCpuLimit = (long)sizeof(DWORD_PTR) * 8;
+#elif __linux__
+static const long s_agoCpuLimit = CPU_SETSIZE;
+#else
+static const long s_agoCpuLimit = 1024;
+#endif
+
+bool agoParseCpuList(const char * text, std::vector<int>& cpus)
+{
+    // CPUs beyond the limit are rejected before a range gets expanded
+    cpus.clear();
+    for (const char * s = text; *s && *s != '\n';) {
+        char * end;
+        long first = strtol(s, &end, 10);
+        if (end == s || first < 0 || first >= s_agoCpuLimit)
+            return false;
+        long last = first;
+        s = end;
+        if (*s == '-') {
+            last = strtol(s + 1, &end, 10);
+            if (end == s + 1 || last < first || last >= s_agoCpuLimit)
+                return false;
+            s = end;
+        }
+        for (long cpu = first; cpu <= last; cpu++) {
+            cpus.push_back((int)cpu);
+        }
+        if (*s == ',')
+            s++;
+        else if (*s && *s != '\n')
+            return false;
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return !cpus.empty();
+}
+
+bool agoGetNumaNodeCpuList(int node, std::vector<int>& cpus)
+{
+    cpus.clear();
+#if _WIN32
+    ULONGLONG mask = 0;
+    if (node < 0 || node > 255 || !GetNumaNodeProcessorMask((UCHAR)node, &mask))
+        return false;
+    for (int cpu = 0; cpu < 64; cpu++) {
+        if (mask & (1ull << cpu))
+            cpus.push_back(cpu);
+    }
+    return !cpus.empty();
+#elif __linux__
+    if (node < 0)
+        return false;
+    char fileName[128], text[4096];
+    snprintf(fileName, sizeof(fileName), "/sys/devices/system/node/node%d/cpulist", node);
+    FILE * fp = fopen(fileName, "r");
+    if (!fp)
+        return false;
+    size_t size = fread(text, 1, sizeof(text) - 1, fp);
+    fclose(fp);
+    text[size] = '\0';
+    return agoParseCpuList(text, cpus);
+#else
+    return false;
+#endif
+}
+
+bool agoGetThreadAffinity(std::vector<int>& cpus)
+{
+    cpus.clear();
+#if _WIN32
+    DWORD_PTR processMask = 0, systemMask = 0;
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask))
+        return false;
+    // the previous mask is only returned by SetThreadAffinityMask
+    DWORD_PTR mask = SetThreadAffinityMask(GetCurrentThread(), processMask);
+    if (!mask)
+        return false;
+    SetThreadAffinityMask(GetCurrentThread(), mask);
+    for (int cpu = 0; cpu < (int)sizeof(mask) * 8; cpu++) {
+        if (mask & ((DWORD_PTR)1 << cpu))
+            cpus.push_back(cpu);
+    }
+    return true;
+#elif __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        return false;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &set))
+            cpus.push_back(cpu);
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool agoSetThreadAffinity(std::thread * thread, const std::vector<int>& cpus)
+{
+#if _WIN32
+    DWORD_PTR mask = 0, systemMask = 0;
+    if (cpus.empty()) {
+        GetProcessAffinityMask(GetCurrentProcess(), &mask, &systemMask);
+    }
+    for (int cpu : cpus) {
+        if (cpu >= 0 && cpu < (int)sizeof(mask) * 8)
+            mask |= (DWORD_PTR)1 << cpu;
+    }
+    if (!mask)
+        return false;
+    HANDLE handle = thread ? (HANDLE)thread->native_handle() : GetCurrentThread();
+    return SetThreadAffinityMask(handle, mask) != 0;
+#elif __linux__
+    // CPUs outside of the process cpuset are dropped by the kernel
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (cpus.empty()) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            CPU_SET(cpu, &set);
+    }
+    for (int cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &set);
+    }
+    if (CPU_COUNT(&set) == 0)
+        return false;
+    pthread_t handle = thread ? thread->native_handle() : pthread_self();
+    return pthread_setaffinity_np(handle, sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
 int64_t agoGetClockCounter()
 {
 #if _WIN32
@@ -152,6 +332,105 @@ int64_t agoGetClockFrequency()
 #endif
 }
 
+CAgoThreadPool::CAgoThreadPool() : m_terminate{ false }
+{
+}
+
+CAgoThreadPool::~CAgoThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_terminate = true;
+    }
+    m_cvWork.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void CAgoThreadPool::Reserve(size_t numThreads)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // the calling thread of ParallelFor() is counted as one of the threads
+    while (m_workers.size() + 1 < numThreads) {
+        m_workers.push_back(std::thread(&CAgoThreadPool::WorkerLoop, this));
+        if (!m_cpus.empty()) {
+            agoSetThreadAffinity(&m_workers.back(), m_cpus);
+        }
+    }
+}
+
+void CAgoThreadPool::SetAffinity(const std::vector<int>& cpus)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (cpus.empty() && m_cpus.empty())
+        return;
+    m_cpus = cpus;
+    for (auto& worker : m_workers) {
+        agoSetThreadAffinity(&worker, m_cpus);
+    }
+}
+
+size_t CAgoThreadPool::GetNumThreads()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_workers.size() + 1;
+}
+
+bool CAgoThreadPool::RunNextItem(Job * job, std::unique_lock<std::mutex>& lock)
+{
+    // shall be called with lock held: returns false if all the items have already been picked
+    if (job->next >= job->count)
+        return false;
+    size_t index = job->next++;
+    if (job->next >= job->count) {
+        // last item picked: no other thread shall pick this job anymore
+        auto it = std::find(m_jobs.begin(), m_jobs.end(), job);
+        if (it != m_jobs.end())
+            m_jobs.erase(it);
+    }
+    lock.unlock();
+    (*job->func)(index);
+    lock.lock();
+    if (++job->done == job->count)
+        m_cvDone.notify_all();
+    return true;
+}
+
+void CAgoThreadPool::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_cvWork.wait(lock, [this] { return m_terminate || !m_jobs.empty(); });
+        if (m_terminate)
+            break;
+        RunNextItem(m_jobs.front(), lock);
+    }
+}
+
+void CAgoThreadPool::ParallelFor(size_t count, const std::function<void(size_t)>& func)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (count <= 1 || m_workers.empty()) {
+        lock.unlock();
+        for (size_t i = 0; i < count; i++) {
+            func(i);
+        }
+        return;
+    }
+    Job job;
+    job.func = &func;
+    job.count = count;
+    job.next = 0;
+    job.done = 0;
+    m_jobs.push_back(&job);
+    m_cvWork.notify_all();
+    // the caller works on its own job until all the items are picked and then waits for completion
+    while (RunNextItem(&job, lock))
+        ;
+    m_cvDone.wait(lock, [&job] { return job.done == job.count; });
+}
+
 #if !_WIN32
 #include "ago_internal.h"
 
@@ -175,6 +454,9 @@ typedef struct {
     int type;   // should be VX_THREAD
     thread thread_obj;
     void* thread_param;
+    mutex mtx;
+    condition_variable cv;
+    bool done;  // set when the thread routine returns, for timed waits
 } vx_thread;
 
 typedef struct {
@@ -213,11 +495,11 @@ void DeleteCriticalSection(CRITICAL_SECTION* cs)
     delete crit_sec;
 }
 
-HANDLE CreateSemaphore(void *, LONG, LONG, void *)
+HANDLE CreateSemaphore(void *, LONG lInitialCount, LONG, void *)
 {
 	vx_semaphore * sem = new vx_semaphore;
 	sem->type = VX_SEMAPHORE;
-	sem->count = 0;
+	sem->count = lInitialCount;
 	return sem;
 }
 
@@ -225,7 +507,14 @@ HANDLE CreateThread(void *, size_t dwStackSize, LPTHREAD_START_ROUTINE lpStartAd
 {
     vx_thread *thd = new vx_thread;
     thd->type = VX_THREAD;
-    thd->thread_obj = thread(lpStartAddress, lpParameter);
+    thd->thread_param = lpParameter;
+    thd->done = false;
+    thd->thread_obj = thread([thd, lpStartAddress]() {
+        lpStartAddress(thd->thread_param);
+        lock_guard<mutex> lk(thd->mtx);
+        thd->done = true;
+        thd->cv.notify_all();
+    });
     return thd;
 }
 
@@ -240,7 +529,8 @@ void CloseHandle(HANDLE h)
 		else if(*(int*)h == VX_THREAD) {
             vx_thread * th = (vx_thread *)h;
             th->type = 0;
-            th->thread_obj.join();
+            if(th->thread_obj.joinable())
+                th->thread_obj.join();
             delete th;
         }
 	}
@@ -250,14 +540,27 @@ DWORD WaitForSingleObject(HANDLE h, DWORD dwMilliseconds)
 	if(h) {
 		if(*(int*)h == VX_SEMAPHORE) {
 			vx_semaphore * sem = (vx_semaphore *)h;
-			{
-				unique_lock<mutex> lk(sem->mtx);
-				sem->cv.wait(lk); // TBD: implement with timeout
+			// consume one count: a release that happened before the wait is not lost
+			unique_lock<mutex> lk(sem->mtx);
+			auto available = [sem] { return sem->count > 0; };
+			if(dwMilliseconds == INFINITE) {
+				sem->cv.wait(lk, available);
 			}
-			{
-				lock_guard<mutex> lk(sem->mtx);
-				sem->count--;
+			else if(!sem->cv.wait_for(lk, chrono::milliseconds(dwMilliseconds), available)) {
+				return WAIT_TIMEOUT;
+			}
+			sem->count--;
+		}
+		else if(*(int*)h == VX_THREAD) {
+			vx_thread * th = (vx_thread *)h;
+			if(dwMilliseconds != INFINITE) {
+				unique_lock<mutex> lk(th->mtx);
+				if(!th->cv.wait_for(lk, chrono::milliseconds(dwMilliseconds), [th] { return th->done; })) {
+					return WAIT_TIMEOUT;
+				}
 			}
+			if(th->thread_obj.joinable())
+				th->thread_obj.join();
 		}
     } else
     {
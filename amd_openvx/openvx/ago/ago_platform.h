@@ -45,10 +45,16 @@ THE SOFTWARE.
 #include <vector>
 #include <list>
 #include <map>
+#include <set>
+#include <unordered_map>
 #include <algorithm>
 #include <functional>
 #include <chrono>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
 
 #if _WIN32
 #include <Windows.h>
@@ -69,6 +75,21 @@ THE SOFTWARE.
 #endif
 using namespace std;
 
+// CPU features detected by agoIsCpuHardwareSupported() to select primitive variants at runtime
+#define AGO_CPU_FEATURE_SSE4_2         0x00000001 // SSE 4.2 (required)
+#define AGO_CPU_FEATURE_AVX2           0x00000002 // AVX2 with OS support for YMM state
+#define AGO_CPU_FEATURE_BMI2           0x00000004 // BMI2
+#define AGO_CPU_FEATURE_AVX512BW       0x00000008 // AVX-512F and AVX-512BW with OS support for ZMM state
+
+// function attributes to compile a primitive variant for an instruction set above the build baseline
+#if _WIN32
+#define AGO_TARGET_AVX2
+#define AGO_TARGET_AVX512
+#else
+#define AGO_TARGET_AVX2   __attribute__((target("avx2")))
+#define AGO_TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512bw")))
+#endif
+
 #if ENABLE_OPENCL
 #if __APPLE__
 #include <opencl.h>
@@ -125,11 +146,15 @@ typedef union {
 } _m128i_union;
 #endif
 
+// CPU features used by primitives: set by agoIsCpuHardwareSupported() and can be masked with AGO_CPU_FEATURE_MASK environment variable
+extern uint32_t g_agoCpuFeatures;
+
 // platform independent data types
 typedef struct _ago_module    * ago_module;
 
 // platform independent functions
 bool       agoIsCpuHardwareSupported();
+uint32_t   agoGetCpuFeatures();
 uint32_t   agoControlFpSetRoundEven();
 void       agoControlFpReset(uint32_t state);
 int64_t    agoGetClockCounter();
@@ -141,6 +166,41 @@ ago_module agoOpenModule(const char * libFileName);
 void *     agoGetFunctionAddress(ago_module module, const char * functionName);
 void       agoCloseModule(ago_module module);
 
+// CPU affinity: CPU sets are lists of logical CPU indices, an empty set stands for all CPUs
+bool       agoParseCpuList(const char * text, std::vector<int>& cpus); // parse lists like "0-7,16,18" (returns true if success, false for CPUs that threads can't be bound to)
+bool       agoGetNumaNodeCpuList(int node, std::vector<int>& cpus); // returns true if success
+bool       agoGetThreadAffinity(std::vector<int>& cpus); // CPUs of the calling thread (returns true if success)
+bool       agoSetThreadAffinity(std::thread * thread, const std::vector<int>& cpus); // nullptr for the calling thread (returns true if success)
+
+// CPU worker thread pool: ParallelFor() runs func(0..count-1) on the pool
+// workers together with the calling thread and returns when all items are done.
+// The caller always participates, so nested calls from a worker can't deadlock.
+class CAgoThreadPool {
+public:
+    CAgoThreadPool();
+    ~CAgoThreadPool();
+    void Reserve(size_t numThreads); // grow pool so that numThreads can run concurrently (includes caller)
+    size_t GetNumThreads();          // number of concurrent threads including the caller
+    void ParallelFor(size_t count, const std::function<void(size_t)>& func);
+    void SetAffinity(const std::vector<int>& cpus); // bind current and future workers to cpus (empty for all CPUs)
+private:
+    struct Job {
+        const std::function<void(size_t)> * func;
+        size_t count;
+        size_t next;
+        size_t done;
+    };
+    void WorkerLoop();
+    bool RunNextItem(Job * job, std::unique_lock<std::mutex>& lock);
+    std::mutex m_mutex;
+    std::condition_variable m_cvWork;
+    std::condition_variable m_cvDone;
+    std::deque<Job *> m_jobs;
+    std::vector<std::thread> m_workers;
+    std::vector<int> m_cpus;
+    bool m_terminate;
+};
+
 #if !_WIN32
 typedef void * CRITICAL_SECTION;
 typedef void * HANDLE;
@@ -161,6 +221,7 @@ extern BOOL ReleaseSemaphore(HANDLE hSemaphore, LONG lReleaseCount, LPLONG lpPre
 #define WINAPI
 #define INFINITE 0xFFFFFFFF
 #define WAIT_OBJECT_0 0
+#define WAIT_TIMEOUT 0x00000102L
 #endif
 
 #endif
\ No newline at end of file
@@ -23,6 +23,9 @@ THE SOFTWARE.
 #include "ago_internal.h"
 #include <math.h>
 #include <sstream>
+#if __linux__
+#include <sys/mman.h>
+#endif
 
 // global locks
 static vx_bool g_cs_context_initialized = vx_false_e;
@@ -184,20 +187,139 @@ void agoUnlockGlobalContext()
     LeaveCriticalSection(&g_cs_context);
 }
 
-void * agoAllocMemory(vx_size size)
+// host memory pool: released buffers are kept in size classes (four per power of two) and handed
+// out again by agoAllocMemory, so that graphs which are created and released repeatedly reuse the
+// same pages instead of going through calloc/free for every buffer
+struct AgoMemoryPool {
+    std::mutex mutex;
+    vx_size limit;         // bytes of released blocks kept for reuse
+    bool hugePages;        // align blocks of AGO_MEMORY_POOL_HUGE_PAGE_SIZE and above to huge pages
+    vx_int32 allocateIdCount;
+    std::unordered_map<vx_uint64, std::vector<vx_uint8 *>> freeBlocks; // released blocks by class size and NUMA node
+    AgoMemoryPoolInfo info;
+    AgoMemoryPool() : limit((vx_size)CONFIG_MEMORY_POOL_SIZE_MB << 20), hugePages(false), allocateIdCount(0) {
+        memset(&info, 0, sizeof(info));
+        char textBuffer[64];
+        if (agoGetEnvironmentVariable("AGO_MEMORY_POOL_SIZE_MB", textBuffer, sizeof(textBuffer))) {
+            limit = (vx_size)atoi(textBuffer) << 20;
+        }
+        if (agoGetEnvironmentVariable("AGO_MEMORY_POOL_HUGE_PAGES", textBuffer, sizeof(textBuffer))) {
+            hugePages = atoi(textBuffer) ? true : false;
+        }
+    }
+    vx_size getClassSize(vx_size size) {
+        if (!limit && !hugePages)
+            return size;
+        if (size <= AGO_MEMORY_POOL_MIN_CLASS_SIZE)
+            return AGO_MEMORY_POOL_MIN_CLASS_SIZE;
+        vx_size power = AGO_MEMORY_POOL_MIN_CLASS_SIZE;
+        while ((power << 1) < size)
+            power <<= 1;
+        vx_size step = power >> 2;
+        vx_size classSize = (size + step - 1) & ~(step - 1);
+        if (hugePages && classSize >= AGO_MEMORY_POOL_HUGE_PAGE_SIZE)
+            classSize = (classSize + AGO_MEMORY_POOL_HUGE_PAGE_SIZE - 1) & ~(vx_size)(AGO_MEMORY_POOL_HUGE_PAGE_SIZE - 1);
+        return classSize;
+    }
+    static vx_uint64 getKey(vx_size classSize, vx_int32 numaNode) {
+        return ((vx_uint64)classSize << 8) | (vx_uint8)(numaNode + 1);
+    }
+};
+
+// NUMA node of the CPU affinity the calling thread is bound to by CAgoAllocAffinityScope
+static thread_local bool t_agoAllocAffinityBound = false;
+static thread_local vx_int32 t_agoAllocNumaNode = -1;
+
+static AgoMemoryPool * agoGetMemoryPool()
+{
+    // never destroyed: buffers may be released by static destructors of the application
+    static AgoMemoryPool * s_pool = new AgoMemoryPool;
+    return s_pool;
+}
+
+static vx_uint8 * agoAllocMemoryBlock(vx_size classSize, bool hugePages)
+{
+#if __linux__
+    if (hugePages) {
+        void * block = nullptr;
+        if (posix_memalign(&block, AGO_MEMORY_POOL_HUGE_PAGE_SIZE, classSize) != 0)
+            return nullptr;
+        madvise(block, classSize, MADV_HUGEPAGE);
+        return (vx_uint8 *)block;
+    }
+#endif
+    return (vx_uint8 *)calloc(1, classSize);
+}
+
+void * agoAllocMemory(vx_size size, bool zeroInit, AgoContext * owner)
 {
-    // to keep track of allocations
-    static vx_int32 s_ago_alloc_id_count = 0;
+    AgoMemoryPool * pool = agoGetMemoryPool();
     // make the buffer allocation 256-bit aligned and add header for debug
     vx_size size_alloc = ALIGN32(ALIGN32(size) + sizeof(vx_uint32) + sizeof(AgoAllocInfo) + 32 + 2*AGO_MEMORY_ALLOC_EXTRA_PADDING);
-    vx_uint8 * mem = (vx_uint8 *)calloc(1, size_alloc); if (!mem) return nullptr;
+    vx_size class_size = pool->getClassSize(size_alloc);
+    bool huge_pages = pool->hugePages && class_size >= AGO_MEMORY_POOL_HUGE_PAGE_SIZE;
+    vx_int32 numa_node = t_agoAllocNumaNode;
+    vx_uint64 owner_id = owner ? owner->memory_owner_id : 0;
+    vx_uint8 * mem = nullptr;
+    vx_int32 allocate_id;
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        auto it = pool->freeBlocks.find(AgoMemoryPool::getKey(class_size, numa_node));
+        if (it != pool->freeBlocks.end() && !it->second.empty()) {
+            mem = it->second.back();
+            it->second.pop_back();
+            pool->info.bytes_pooled -= class_size;
+            pool->info.pool_hit_count++;
+        }
+        allocate_id = pool->allocateIdCount++;
+    }
+    vx_uint8 * mem_aligned = nullptr;
+    AgoAllocInfo * mem_info = nullptr;
+    // the buffer needs clearing unless it is zeroed already, or the caller overwrites it and the
+    // block held data of the same context only: stale data must never cross between contexts
+    bool clear = zeroInit, mapped = !mem;
+    if (mem) {
+        mem_aligned = (vx_uint8 *)ALIGN32PTR(mem + sizeof(vx_uint32) + sizeof(AgoAllocInfo) + AGO_MEMORY_ALLOC_EXTRA_PADDING);
+        mem_info = &((AgoAllocInfo *)(mem_aligned - AGO_MEMORY_ALLOC_EXTRA_PADDING))[-1];
+        if (!owner_id || mem_info->owner_id != owner_id)
+            clear = true;
+    }
+    else {
+        mem = agoAllocMemoryBlock(class_size, huge_pages);
+        if (!mem) return nullptr;
+        mem_aligned = (vx_uint8 *)ALIGN32PTR(mem + sizeof(vx_uint32) + sizeof(AgoAllocInfo) + AGO_MEMORY_ALLOC_EXTRA_PADDING);
+        mem_info = &((AgoAllocInfo *)(mem_aligned - AGO_MEMORY_ALLOC_EXTRA_PADDING))[-1];
+        // calloc returns zeroed pages; new blocks of a thread bound to CPUs are touched right away
+        // so that their pages get placed on its node
+        clear = huge_pages || t_agoAllocAffinityBound;
+    }
     ((vx_uint32 *)mem)[0] = 0xfadedcab; // marker for debug
-    vx_uint8 * mem_aligned = (vx_uint8 *)ALIGN32PTR(mem + sizeof(vx_uint32) + sizeof(AgoAllocInfo) + AGO_MEMORY_ALLOC_EXTRA_PADDING);
-    AgoAllocInfo * mem_info = &((AgoAllocInfo *)(mem_aligned - AGO_MEMORY_ALLOC_EXTRA_PADDING))[-1];
     mem_info->allocated = mem;
     mem_info->requested_size = size;
     mem_info->retain_count = 1;
-    mem_info->allocate_id = s_ago_alloc_id_count++;
+    mem_info->allocate_id = allocate_id;
+    mem_info->class_size = class_size;
+    mem_info->huge_pages = huge_pages ? vx_true_e : vx_false_e;
+    mem_info->numa_node = numa_node;
+    mem_info->owner_id = owner_id;
+    // padding is always cleared so that over-reads by vector kernels are deterministic
+    if (clear) {
+        memset(mem_aligned - AGO_MEMORY_ALLOC_EXTRA_PADDING, 0, ALIGN32(size) + 2*AGO_MEMORY_ALLOC_EXTRA_PADDING);
+    }
+    else {
+        memset(mem_aligned - AGO_MEMORY_ALLOC_EXTRA_PADDING, 0, AGO_MEMORY_ALLOC_EXTRA_PADDING);
+        memset(mem_aligned + size, 0, ALIGN32(size) - size + AGO_MEMORY_ALLOC_EXTRA_PADDING);
+    }
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->info.alloc_count++;
+        pool->info.bytes_in_use += class_size;
+        if (pool->info.bytes_in_use > pool->info.bytes_in_use_peak)
+            pool->info.bytes_in_use_peak = pool->info.bytes_in_use;
+        // pooled huge page blocks are counted until they get freed
+        if (huge_pages && mapped)
+            pool->info.bytes_huge_pages += class_size;
+    }
     return mem_aligned;
 }
 
@@ -220,11 +342,107 @@ void agoReleaseMemory(void * mem)
         agoAddLogEntry(NULL, VX_SUCCESS, "WARNING: agoReleaseMemory: detected retain_count=%d for allocate_id=%d with size=%d\n", mem_info->retain_count, mem_info->allocate_id, (vx_uint32)mem_info->requested_size);
     }
     else if (mem_info->retain_count == 0) {
-        // free the allocated pointer
-        free(mem_info->allocated);
+        // return the block to the pool, or free it when the pool is full
+        AgoMemoryPool * pool = agoGetMemoryPool();
+        vx_uint8 * block = (vx_uint8 *)mem_info->allocated;
+        vx_size class_size = mem_info->class_size;
+        vx_int32 numa_node = mem_info->numa_node;
+        bool huge_pages = mem_info->huge_pages ? true : false;
+        ((vx_uint32 *)block)[0] = 0; // catch double release of a pooled block
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->info.bytes_in_use -= class_size;
+        if (pool->info.bytes_pooled + class_size <= pool->limit) {
+            pool->freeBlocks[AgoMemoryPool::getKey(class_size, numa_node)].push_back(block);
+            pool->info.bytes_pooled += class_size;
+        }
+        else {
+            if (huge_pages)
+                pool->info.bytes_huge_pages -= class_size;
+            free(block);
+        }
     }
 }
 
+void agoGetMemoryPoolInfo(AgoMemoryPoolInfo * info)
+{
+    AgoMemoryPool * pool = agoGetMemoryPool();
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    *info = pool->info;
+}
+
+void agoTrimMemoryPool()
+{
+    // give the released blocks back to the system
+    AgoMemoryPool * pool = agoGetMemoryPool();
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    for (auto& it : pool->freeBlocks) {
+        vx_size classSize = (vx_size)(it.first >> 8);
+        for (auto block : it.second) {
+            if (pool->hugePages && classSize >= AGO_MEMORY_POOL_HUGE_PAGE_SIZE)
+                pool->info.bytes_huge_pages -= classSize;
+            free(block);
+        }
+    }
+    pool->freeBlocks.clear();
+    pool->info.bytes_pooled = 0;
+}
+
+CAgoAllocAffinityScope::CAgoAllocAffinityScope(AgoContext * context) : m_bound{ false }
+{
+    if (context && !context->cpu_affinity.empty() && !t_agoAllocAffinityBound && agoGetThreadAffinity(m_savedCpus)) {
+        if (agoSetThreadAffinity(nullptr, context->cpu_affinity)) {
+            m_bound = true;
+            t_agoAllocAffinityBound = true;
+            t_agoAllocNumaNode = context->cpu_affinity_numa_node;
+        }
+    }
+}
+
+CAgoAllocAffinityScope::~CAgoAllocAffinityScope()
+{
+    if (m_bound) {
+        agoSetThreadAffinity(nullptr, m_savedCpus);
+        t_agoAllocAffinityBound = false;
+        t_agoAllocNumaNode = -1;
+    }
+}
+
+vx_status agoSetContextCpuAffinity(AgoContext * context, const AgoCpuAffinityInfo * info)
+{
+    std::vector<int> cpus;
+    vx_int32 numaNode = -1;
+    if (info->numa_node >= 0) {
+        if (!agoGetNumaNodeCpuList(info->numa_node, cpus)) {
+            agoAddLogEntry(&context->ref, VX_ERROR_INVALID_VALUE, "ERROR: agoSetContextCpuAffinity: no CPUs found for NUMA node %d\n", info->numa_node);
+            return VX_ERROR_INVALID_VALUE;
+        }
+        numaNode = info->numa_node;
+    }
+    else if (info->cpu_list[0]) {
+        char cpuList[sizeof(info->cpu_list)];
+        strncpy(cpuList, info->cpu_list, sizeof(cpuList) - 1);
+        cpuList[sizeof(cpuList) - 1] = '\0';
+        if (!agoParseCpuList(cpuList, cpus)) {
+            agoAddLogEntry(&context->ref, VX_ERROR_INVALID_VALUE, "ERROR: agoSetContextCpuAffinity: invalid CPU list \"%s\"\n", cpuList);
+            return VX_ERROR_INVALID_VALUE;
+        }
+        // buffers are placed on the node of the first CPU in the list
+        std::vector<int> nodeCpus;
+        for (vx_int32 node = 0; node < 64 && numaNode < 0; node++) {
+            if (agoGetNumaNodeCpuList(node, nodeCpus) && std::find(nodeCpus.begin(), nodeCpus.end(), cpus[0]) != nodeCpus.end())
+                numaNode = node;
+        }
+    }
+    context->attr_cpu_affinity = *info;
+    context->attr_cpu_affinity.cpu_list[sizeof(info->cpu_list) - 1] = '\0';
+    context->cpu_affinity = cpus;
+    context->cpu_affinity_numa_node = numaNode;
+    if (context->cpu_thread_pool) {
+        context->cpu_thread_pool->SetAffinity(cpus);
+    }
+    return VX_SUCCESS;
+}
+
 void agoResetReference(AgoReference * ref, vx_enum type, vx_context context, vx_reference scope)
 {
     ref->platform = context ? context->ref.platform : nullptr;
@@ -301,6 +519,7 @@ AgoGraph * agoRemoveGraph(AgoGraphList * list, AgoGraph * item)
 
 AgoKernel * agoRemoveKernel(AgoKernelList * list, AgoKernel * item)
 {
+    list->generation++;
     if (list->head == item) {
         if (list->tail == item)
             list->head = list->tail = NULL;
@@ -391,6 +610,7 @@ int agoRemoveData(AgoDataList * list, AgoData * item, AgoData ** trash)
     if (!item) {
         return status;
     }
+    list->generation++;
     if (list->head == item) {
         if (list->tail == item)
             list->head = list->tail = NULL;
@@ -486,7 +706,7 @@ void agoRemoveDataInGraph(AgoGraph * agraph, AgoData * adata)
                     if (dataName[0] && !adata->children[i]->name.length()) {
                         char nameChild[2048];
                         snprintf(nameChild, sizeof(nameChild), "%s!%d!", dataName, i);
-                        adata->children[i]->name = nameChild;
+                        agoRenameData(adata->children[i], nameChild);
                     }
                     adata->children[i]->parent = NULL;
                 }
@@ -549,7 +769,7 @@ void agoReplaceDataInGraph(AgoGraph * agraph, AgoData * dataFind, AgoData * data
                 if (dataName[0] && !dataFind->children[i]->name.length()) {
                     char nameChild[2048];
                     snprintf(nameChild, sizeof(nameChild), "%s!%d!", dataName, i);
-                    dataFind->children[i]->name = nameChild;
+                    agoRenameData(dataFind->children[i], nameChild);
                 }
                 dataFind->children[i]->parent = dataReplace;
             }
@@ -581,6 +801,97 @@ void agoReplaceDataInGraph(AgoGraph * agraph, AgoData * dataFind, AgoData * data
     }
 }
 
+bool agoIsSameDataLayout(AgoData * data1, AgoData * data2)
+{
+    // check if data2 can take the place of data1 in a verified graph: same type, dimensions, and memory layout
+    if (data1->ref.type != data2->ref.type || data1->size != data2->size || data1->numChildren != data2->numChildren)
+        return false;
+    bool same = false;
+    switch (data1->ref.type) {
+    case VX_TYPE_IMAGE:
+        same = data1->u.img.format == data2->u.img.format && data1->u.img.width == data2->u.img.width &&
+               data1->u.img.height == data2->u.img.height && data1->u.img.stride_in_bytes == data2->u.img.stride_in_bytes &&
+               data1->u.img.planes == data2->u.img.planes && data1->u.img.isUniform == data2->u.img.isUniform;
+        break;
+    case VX_TYPE_PYRAMID:
+        same = data1->u.pyr.format == data2->u.pyr.format && data1->u.pyr.width == data2->u.pyr.width &&
+               data1->u.pyr.height == data2->u.pyr.height && data1->u.pyr.levels == data2->u.pyr.levels &&
+               data1->u.pyr.scale == data2->u.pyr.scale;
+        break;
+    case VX_TYPE_ARRAY:
+        same = data1->u.arr.itemtype == data2->u.arr.itemtype && data1->u.arr.capacity == data2->u.arr.capacity;
+        break;
+    case VX_TYPE_OBJECT_ARRAY:
+        same = data1->u.objarr.itemtype == data2->u.objarr.itemtype && data1->u.objarr.numitems == data2->u.objarr.numitems;
+        break;
+    case VX_TYPE_SCALAR:
+        same = data1->u.scalar.type == data2->u.scalar.type;
+        break;
+    case VX_TYPE_MATRIX:
+        same = data1->u.mat.type == data2->u.mat.type && data1->u.mat.columns == data2->u.mat.columns && data1->u.mat.rows == data2->u.mat.rows;
+        break;
+    case VX_TYPE_CONVOLUTION:
+        same = data1->u.conv.columns == data2->u.conv.columns && data1->u.conv.rows == data2->u.conv.rows;
+        break;
+    case VX_TYPE_LUT:
+        same = data1->u.lut.type == data2->u.lut.type && data1->u.lut.count == data2->u.lut.count;
+        break;
+    case VX_TYPE_DISTRIBUTION:
+        same = data1->u.dist.numbins == data2->u.dist.numbins && data1->u.dist.offset == data2->u.dist.offset && data1->u.dist.range == data2->u.dist.range;
+        break;
+    case VX_TYPE_THRESHOLD:
+        same = data1->u.thr.thresh_type == data2->u.thr.thresh_type && data1->u.thr.data_type == data2->u.thr.data_type;
+        break;
+    case VX_TYPE_REMAP:
+        same = data1->u.remap.src_width == data2->u.remap.src_width && data1->u.remap.src_height == data2->u.remap.src_height &&
+               data1->u.remap.dst_width == data2->u.remap.dst_width && data1->u.remap.dst_height == data2->u.remap.dst_height;
+        break;
+    case VX_TYPE_TENSOR:
+        same = data1->u.tensor.num_dims == data2->u.tensor.num_dims && data1->u.tensor.data_type == data2->u.tensor.data_type &&
+               data1->u.tensor.fixed_point_pos == data2->u.tensor.fixed_point_pos;
+        for (vx_size i = 0; same && i < data1->u.tensor.num_dims; i++) {
+            same = data1->u.tensor.dims[i] == data2->u.tensor.dims[i] && data1->u.tensor.stride[i] == data2->u.tensor.stride[i];
+        }
+        break;
+    }
+    for (vx_uint32 i = 0; same && i < data1->numChildren; i++) {
+        if (data1->children[i] && data2->children[i])
+            same = agoIsSameDataLayout(data1->children[i], data2->children[i]);
+        else
+            same = !data1->children[i] && !data2->children[i];
+    }
+    return same;
+}
+
+bool agoIsResizableData(AgoData * data1, AgoData * data2)
+{
+    // check if image data2 can take the place of data1 once the nodes using it are validated again:
+    // same format and planes, only dimensions and strides differ
+    if (data1->ref.type != VX_TYPE_IMAGE || data2->ref.type != VX_TYPE_IMAGE || data1->numChildren != data2->numChildren)
+        return false;
+    return data1->u.img.format == data2->u.img.format && data1->u.img.planes == data2->u.img.planes &&
+           !data1->u.img.isUniform && !data2->u.img.isUniform && !data1->u.img.isROI && !data2->u.img.isROI;
+}
+
+AgoData * agoGetRebindData(AgoData * data, AgoData * dataFind, AgoData * dataReplace)
+{
+    // get the object in dataReplace at the same position as data in dataFind (nullptr if data is not inside dataFind)
+    int trace[AGO_MAX_DEPTH_FROM_DELAY_OBJECT], traceCount = 0;
+    for (; data != dataFind; data = data->parent) {
+        if (!data || !data->parent || traceCount >= AGO_MAX_DEPTH_FROM_DELAY_OBJECT)
+            return nullptr;
+        vx_uint32 index = 0;
+        while (index < data->parent->numChildren && data->parent->children[index] != data)
+            index++;
+        trace[traceCount++] = (int)index;
+    }
+    for (data = dataReplace; data && traceCount > 0;) {
+        vx_uint32 index = (vx_uint32)trace[--traceCount];
+        data = (index < data->numChildren) ? data->children[index] : nullptr;
+    }
+    return data;
+}
+
 int agoShutdownNode(AgoNode * node)
 {
     vx_status status = VX_SUCCESS;
@@ -624,7 +935,9 @@ void agoResetDataList(AgoDataList * dataList)
             data = next;
         }
     }
+    vx_uint32 generation = dataList->generation + 1;
     memset(dataList, 0, sizeof(*dataList));
+    dataList->generation = generation;
 }
 
 void agoResetNodeList(AgoNodeList * nodeList)
@@ -652,7 +965,9 @@ void agoResetKernelList(AgoKernelList * kernelList)
         // proceed to next item
         kernel = next;
     }
+    vx_uint32 generation = kernelList->generation + 1;
     memset(kernelList, 0, sizeof(*kernelList));
+    kernelList->generation = generation;
 }
 
 static void agoResetSuperNodeList(AgoSuperNode * supernodeList)
@@ -673,37 +988,128 @@ static void agoResetSuperNodeList(AgoSuperNode * supernodeList)
     }
 }
 
+void agoResetCpuSuperNodeList(AgoGraph * graph)
+{
+    for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+        node->cpuSupernode = nullptr;
+    }
+    for (AgoCpuSuperNode * supernode = graph->cpuSupernodeList; supernode;) {
+        AgoCpuSuperNode * next = supernode->next;
+        delete supernode;
+        supernode = next;
+    }
+    graph->cpuSupernodeList = nullptr;
+}
+
+void agoResetPipeline(AgoGraph * graph)
+{
+    // stop pipeline stage workers: copies of virtual data stay in graph data list until removed as unused
+    if (graph->pipeline) {
+        delete graph->pipeline;
+        graph->pipeline = nullptr;
+    }
+}
+
+static void agoUpdateKernelIndex(AgoKernelIndex * index, AgoKernelList * list)
+{
+    AgoKernel * kernel = nullptr;
+    if (index->generation != list->generation) {
+        index->byEnum.clear();
+        index->byName.clear();
+        index->generation = list->generation;
+        index->tail = nullptr;
+        kernel = list->head;
+    }
+    else {
+        kernel = index->tail ? index->tail->next : list->head;
+    }
+    // first kernel in the list wins, same as a linear search
+    for (; kernel; kernel = kernel->next) {
+        index->byEnum.emplace(kernel->id, kernel);
+        index->byName.emplace(kernel->name, kernel);
+        index->tail = kernel;
+    }
+}
+
 AgoKernel * agoFindKernelByEnum(AgoContext * acontext, vx_enum kernel_id)
 {
     // search context
-    for (AgoKernel * kernel = acontext->kernelList.head; kernel; kernel = kernel->next) {
-        if (kernel->id == kernel_id) return kernel;
-    }
-    return 0;
+    std::lock_guard<std::mutex> lock(acontext->index_mutex);
+    agoUpdateKernelIndex(&acontext->kernelIndex, &acontext->kernelList);
+    auto it = acontext->kernelIndex.byEnum.find(kernel_id);
+    return it != acontext->kernelIndex.byEnum.end() ? it->second : 0;
 }
 
 AgoKernel * agoFindKernelByName(AgoContext * acontext, const vx_char * name)
 {
     // search context
-    for (AgoKernel * kernel = acontext->kernelList.head; kernel; kernel = kernel->next) {
-        if (!strcmp(kernel->name, name)) return kernel;
-    }
+    std::lock_guard<std::mutex> lock(acontext->index_mutex);
+    agoUpdateKernelIndex(&acontext->kernelIndex, &acontext->kernelList);
+    auto it = acontext->kernelIndex.byName.find(name);
+    if (it != acontext->kernelIndex.byName.end()) return it->second;
     if (!strstr(name, ".")) {
         char fullName[VX_MAX_KERNEL_NAME];
         // search for org.khronos.openvx.<name>
         snprintf(fullName, VX_MAX_KERNEL_NAME, "org.khronos.openvx.%s", name);
-        for (AgoKernel * kernel = acontext->kernelList.head; kernel; kernel = kernel->next) {
-            if (!strcmp(kernel->name, fullName)) return kernel;
-        }
+        it = acontext->kernelIndex.byName.find(fullName);
+        if (it != acontext->kernelIndex.byName.end()) return it->second;
         // search for org.amd.openvx.<name>
         snprintf(fullName, VX_MAX_KERNEL_NAME, "com.amd.openvx.%s", name);
-        for (AgoKernel * kernel = acontext->kernelList.head; kernel; kernel = kernel->next) {
-            if (!strcmp(kernel->name, fullName)) return kernel;
-        }
+        it = acontext->kernelIndex.byName.find(fullName);
+        if (it != acontext->kernelIndex.byName.end()) return it->second;
     }
     return 0;
 }
 
+AgoKernel * agoFindOverridableKernel(AgoContext * acontext, vx_enum kernel_id, const vx_char * name)
+{
+    // only a built-in kernel that is still visible under both its enum and name can be overridden
+    AgoKernel * kernel = agoFindKernelByEnum(acontext, kernel_id);
+    if (kernel && (kernel->flags & AGO_KERNEL_FLAG_OVERRIDABLE) && !kernel->external_kernel &&
+        !strcmp(kernel->name, name) && agoFindKernelByName(acontext, name) == kernel)
+        return kernel;
+    return 0;
+}
+
+void agoAddKernelOverride(AgoKernelList * kernelList, AgoKernel * kernel, AgoKernel * overridden)
+{
+    // keep the overridden kernel in the list (it is owned by the context) but move it behind
+    // the new kernel so that lookups by enum and name resolve to the new kernel
+    agoRemoveKernel(kernelList, overridden);
+    agoAddKernel(kernelList, kernel);
+    agoAddKernel(kernelList, overridden);
+}
+
+static AgoData * agoFindDataInIndex(AgoDataNameIndex * index, AgoDataList * list, vx_uint32 nameGeneration, const char * name)
+{
+    AgoData * data = nullptr;
+    if (index->generation != list->generation || index->nameGeneration != nameGeneration) {
+        index->byName.clear();
+        index->generation = list->generation;
+        index->nameGeneration = nameGeneration;
+        index->tail = nullptr;
+        data = list->head;
+    }
+    else {
+        data = index->tail ? index->tail->next : list->head;
+    }
+    // first data in the list wins, same as a linear search
+    for (; data; data = data->next) {
+        index->byName.emplace(data->name, data);
+        index->tail = data;
+    }
+    auto it = index->byName.find(name);
+    return it != index->byName.end() ? it->second : nullptr;
+}
+
+void agoRenameData(AgoData * data, const char * name)
+{
+    data->name = name;
+    // names of data objects in lists are indexed for agoFindDataByName
+    if (data->ref.context)
+        data->ref.context->dataNameGeneration++;
+}
+
 AgoData * agoFindDataByName(AgoContext * acontext, AgoGraph * agraph, vx_char * name)
 {
     // check for <object>[index] syntax
@@ -725,15 +1131,12 @@ AgoData * agoFindDataByName(AgoContext * acontext, AgoGraph * agraph, vx_char *
     // search graph
     AgoData * data = NULL;
     if (agraph) {
-        for (data = agraph->dataList.head; data; data = data->next) {
-            if (!strcmp(data->name.c_str(), actualName)) break;
-        }
+        data = agoFindDataInIndex(&agraph->dataNameIndex, &agraph->dataList, acontext->dataNameGeneration, actualName);
     }
     if (!data) {
         // search context
-        for (data = acontext->dataList.head; data; data = data->next) {
-            if (!strcmp(data->name.c_str(), actualName)) break;
-        }
+        std::lock_guard<std::mutex> lock(acontext->index_mutex);
+        data = agoFindDataInIndex(&acontext->dataNameIndex, &acontext->dataList, acontext->dataNameGeneration, actualName);
     }
     if(data) {
         for (int i = 0; i < 4 && index[i] >= 0; i++) {
@@ -2496,7 +2899,9 @@ int agoAllocData(AgoData * data)
         // already allocated: nothing to do
         return 0;
     }
-    else if (agoDataSanityCheckAndUpdate(data)) {
+    // place the buffers on the NUMA node of the context CPU affinity
+    CAgoAllocAffinityScope affinity(data->ref.context);
+    if (agoDataSanityCheckAndUpdate(data)) {
         // can't proceed further
         return -1;
     }
@@ -2618,8 +3023,9 @@ int agoAllocData(AgoData * data)
                 }
             }
             else {
-                // allocate buffer and get aligned buffer with 16-byte alignment
-                data->buffer = data->buffer_allocated = (vx_uint8 *)agoAllocMemory(data->size);
+                // allocate buffer and get aligned buffer with 16-byte alignment:
+                // virtual images are produced by the graph, so their contents need not be cleared
+                data->buffer = data->buffer_allocated = (vx_uint8 *)agoAllocMemory(data->size, !data->isVirtual, data->ref.context);
                 if (!data->buffer_allocated){
                     data->u.img.mem_handle = vx_true_e;
                     return -1;
@@ -2701,8 +3107,8 @@ int agoAllocData(AgoData * data)
             return -1;
     }
     else if (data->ref.type == AGO_TYPE_CANNY_STACK) {
-        // allocate buffer and get aligned buffer with 16-byte alignment
-        data->buffer = data->buffer_allocated = (vx_uint8 *)agoAllocMemory(data->size);
+        // allocate buffer and get aligned buffer with 16-byte alignment (scratch space, no need to clear)
+        data->buffer = data->buffer_allocated = (vx_uint8 *)agoAllocMemory(data->size, false, data->ref.context);
         if (!data->buffer_allocated)
             return -1;
     }
@@ -2721,8 +3127,8 @@ int agoAllocData(AgoData * data)
             data->buffer = data->u.tensor.roiMaster->buffer + data->u.tensor.offset;
         }
         else {
-            // allocate buffer and get aligned buffer with 16-byte alignment
-            data->buffer = data->buffer_allocated = (vx_uint8 *)agoAllocMemory(data->size);
+            // allocate buffer and get aligned buffer with 16-byte alignment (virtual tensors are not cleared)
+            data->buffer = data->buffer_allocated = (vx_uint8 *)agoAllocMemory(data->size, !data->isVirtual, data->ref.context);
             if (!data->buffer_allocated)
                 return -1;
         }
@@ -2760,6 +3166,7 @@ void agoRetainData(AgoGraph * graph, AgoData * data, bool isForExternalUse)
         }
         if (foundInTrash) {
             // add the data into main part of the list
+            graph->dataList.generation++;
             data->next = graph->dataList.tail;
             graph->dataList.tail = data;
             if (!graph->dataList.head)
@@ -3048,18 +3455,61 @@ void agoImportNodeConfig(AgoNode * childnode, AgoNode * anode)
     }
 }
 
-void agoPerfProfileEntry(AgoGraph * graph, AgoProfileEntryType type, vx_reference ref)
+static vx_uint32 agoGetProfileThreadId()
+{
+    // small thread ids in the order of first use, for readable traces
+    static std::atomic<vx_uint32> count{ 0 };
+    thread_local vx_uint32 tid = ++count;
+    return tid;
+}
+
+void agoPerfProfileEntry(AgoGraph * graph, AgoProfileEntryType type, vx_reference ref, int64_t time, vx_int64 frame)
 {
     if (graph->enable_performance_profiling) {
-        AgoProfileEntry entry;
-        entry.id = graph->execFrameCount;
+        AgoProfileRing * ring = graph->performance_profile;
+        vx_uint64 index = ring->head.fetch_add(1, std::memory_order_relaxed);
+        vx_uint32 slot = (vx_uint32)(index & (AGO_PROFILE_RING_SIZE - 1));
+        ring->seqList[slot].store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        AgoProfileEntry& entry = ring->entryList[slot];
+        // frames of pipelined graphs overlap, so their stages pass the frame they are running
+        entry.id = (frame >= 0) ? (vx_uint32)frame : graph->execFrameCount.load();
         entry.type = type;
         entry.ref = ref;
-        entry.time = agoGetClockCounter();
-        graph->performance_profile.push_back(entry);
+        entry.time = time ? time : agoGetClockCounter();
+        entry.tid = agoGetProfileThreadId();
+        ring->seqList[slot].store(index + 1, std::memory_order_release);
     }
 }
 
+void agoPerfProfileEnable(AgoGraph * graph, bool enable)
+{
+    if (enable && !graph->performance_profile)
+        graph->performance_profile = new AgoProfileRing;
+    graph->enable_performance_profiling = enable;
+}
+
+void agoPerfProfileRead(AgoGraph * graph, std::vector<AgoProfileEntry>& entryList)
+{
+    // read the entries added since last read: entries overwritten or still being written are skipped
+    entryList.clear();
+    AgoProfileRing * ring = graph->performance_profile;
+    if (!ring)
+        return;
+    vx_uint64 head = ring->head.load(std::memory_order_acquire);
+    vx_uint64 index = max(ring->tail, head > AGO_PROFILE_RING_SIZE ? head - AGO_PROFILE_RING_SIZE : (vx_uint64)0);
+    for (; index < head; index++) {
+        vx_uint32 slot = (vx_uint32)(index & (AGO_PROFILE_RING_SIZE - 1));
+        if (ring->seqList[slot].load(std::memory_order_acquire) != index + 1)
+            continue;
+        AgoProfileEntry entry = ring->entryList[slot];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (ring->seqList[slot].load(std::memory_order_relaxed) == index + 1)
+            entryList.push_back(entry);
+    }
+    ring->tail = head;
+}
+
 void agoPerfCaptureReset(vx_perf_t * perf)
 {
     memset(perf, 0, sizeof(*perf));
@@ -3164,7 +3614,8 @@ AgoData::AgoData()
       isVirtual{ vx_false_e }, isDelayed{ vx_false_e }, isNotFullyConfigured{ vx_false_e }, isInitialized{ vx_false_e }, siblingIndex{ 0 },
       numChildren{ 0 }, children{ nullptr }, parent{ nullptr }, inputUsageCount{ 0 }, outputUsageCount{ 0 }, inoutUsageCount{ 0 },
       initialization_flags{ 0 }, device_type_unused{ 0 },
-      nextMapId{ 0 }, hierarchical_level{ 0 }, hierarchical_life_start{ 0 }, hierarchical_life_end{ 0 }, ownerOfUserBufferGPU{ nullptr }
+      nextMapId{ 0 }, hierarchical_level{ 0 }, hierarchical_life_start{ 0 }, hierarchical_life_end{ 0 }, ownerOfUserBufferGPU{ nullptr },
+      handleRingSlot{ 0 }
 {
     memset(&u, 0, sizeof(u));
 }
@@ -3229,10 +3680,43 @@ AgoSuperNode::AgoSuperNode()
 AgoSuperNode::~AgoSuperNode()
 {
 }
+AgoCpuSuperNode::AgoCpuSuperNode()
+    : next{ nullptr }, width{ 0 }, height{ 0 }, tile_height{ 0 }, tileData{ nullptr },
+      hierarchical_level_start{ 0 }, hierarchical_level_end{ 0 }
+{
+}
+AgoCpuSuperNode::~AgoCpuSuperNode()
+{
+    if (tileData) {
+        delete[] tileData;
+        tileData = nullptr;
+    }
+}
+AgoProfileRing::AgoProfileRing()
+    : head{ 0 }, tail{ 0 }
+{
+    for (vx_uint32 i = 0; i < AGO_PROFILE_RING_SIZE; i++)
+        seqList[i].store(0, std::memory_order_relaxed);
+}
+AgoPipeline::AgoPipeline()
+    : scheduleCount{ 0 }, completeCount{ 0 }, handoffCount{ 0 }, status{ VX_SUCCESS }, terminate{ false }
+{
+}
+AgoPipeline::~AgoPipeline()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        terminate = true;
+    }
+    cv.notify_all();
+    for (auto& worker : workerList) {
+        worker.join();
+    }
+}
 AgoNode::AgoNode()
     : next{ nullptr }, akernel{ nullptr }, flags{ 0 }, localDataSize{ 0 }, localDataPtr{ nullptr }, localDataPtr_allocated{ nullptr },
       valid_rect_reset{ vx_true_e }, valid_rect_num_inputs{ 0 }, valid_rect_num_outputs{ 0 }, valid_rect_inputs{ nullptr }, valid_rect_outputs{ nullptr },
-      paramCount{ 0 }, callback{ nullptr }, supernode{ nullptr }, initialized{ false }, target_support_flags{ 0 }, hierarchical_level{ 0 }, status{ VX_SUCCESS }
+      paramCount{ 0 }, callback{ nullptr }, supernode{ nullptr }, cpuSupernode{ nullptr }, initialized{ false }, target_support_flags{ 0 }, hierarchical_level{ 0 }, status{ VX_SUCCESS }
     , drama_divide_invoked{ false }
 #if ENABLE_OPENCL
     , opencl_type{ 0 }, opencl_param_mem2reg_mask{ 0 }, opencl_param_discard_mask{ 0 }, opencl_param_as_value_mask{ 0 },
@@ -3281,10 +3765,11 @@ AgoNode::~AgoNode()
 #endif
 }
 AgoGraph::AgoGraph()
-    : next{ nullptr }, hThread{ nullptr }, hSemToThread{ nullptr }, hSemFromThread{ nullptr },
-      threadScheduleCount{ 0 }, threadExecuteCount{ 0 }, threadWaitCount{ 0 }, threadThreadTerminationState{ 0 },
+    : next{ nullptr }, hThread{ nullptr }, hSemToThread{ nullptr }, threadWaitCount{ 0 }, threadThreadTerminationState{ 0 },
+      ticketScheduleCount{ 0 }, ticketCompleteCount{ 0 }, ticketStatus(AGO_GRAPH_TICKET_HISTORY, VX_SUCCESS),
+      completionCallback{ nullptr }, completionCallbackData{ nullptr }, dataNameIndex{ 0, 0, nullptr, {} },
       isReadyToExecute{ vx_false_e }, detectedInvalidNode{ false }, status{ VX_SUCCESS },
-      virtualDataGenerationCount{ 0 }, optimizer_flags{ AGO_GRAPH_OPTIMIZER_FLAGS_DEFAULT }, verified{ false }, enable_performance_profiling{ false }, execFrameCount{ 0 }
+      cpu_num_threads{ 0 }, cpu_tile_fusion{ false }, cpuSupernodeList{ nullptr }, pipeline_stages{ 0 }, pipeline{ nullptr }, virtualDataGenerationCount{ 0 }, optimizer_flags{ AGO_GRAPH_OPTIMIZER_FLAGS_DEFAULT }, verified{ false }, rebindResize{ false }, enable_performance_profiling{ false }, performance_profile{ nullptr }, execFrameCount{ 0 }
 #if ENABLE_OPENCL
     , supernodeList{ nullptr }, opencl_cmdq{ nullptr }, opencl_device{ nullptr }
     , enable_node_level_gpu_flush{ true }
@@ -3303,6 +3788,8 @@ AgoGraph::AgoGraph()
 }
 AgoGraph::~AgoGraph()
 {
+    agoResetPipeline(this);
+
     // decrement auto age delays
     for (auto it = autoAgeDelayList.begin(); it != autoAgeDelayList.end(); it++) {
         if ((agoIsValidData(*it, VX_TYPE_DELAY) || agoIsValidData(*it, VX_TYPE_OBJECT_ARRAY)) && (*it)->ref.internal_count > 0)
@@ -3317,7 +3804,12 @@ AgoGraph::~AgoGraph()
         agoRemoveData(&dataList, dataList.head, &ref.context->graph_garbage_data);
     }
 
+    agoResetCpuSuperNodeList(this);
     agoResetNodeList(&nodeList);
+    if (performance_profile) {
+        delete performance_profile;
+        performance_profile = nullptr;
+    }
 #if ENABLE_OPENCL
     agoResetSuperNodeList(supernodeList);
     supernodeList = NULL;
@@ -3332,9 +3824,11 @@ AgoGraph::~AgoGraph()
     DeleteCriticalSection(&cs);
 }
 AgoContext::AgoContext()
-    : perfNormFactor{ 0 }, dataGenerationCount{ 0 }, nextUserStructId{ VX_TYPE_USER_STRUCT_START }, nextUserKernelId{ 0 }, nextUserLibraryId{ 1 },
+    : perfNormFactor{ 0 }, kernelIndex{ 0, nullptr, {}, {} }, dataNameIndex{ 0, 0, nullptr, {} }, dataNameGeneration{ 0 }, dataGenerationCount{ 0 }, nextUserStructId{ VX_TYPE_USER_STRUCT_START }, nextUserKernelId{ 0 }, nextUserLibraryId{ 1 },
       num_active_modules{ 0 }, num_active_references{ 0 }, callback_log{ nullptr }, callback_reentrant{ vx_false_e },
-      thread_config{ CONFIG_THREAD_DEFAULT }, importing_module_index_plus1{ 0 }, graph_garbage_data{ nullptr }, graph_garbage_node{ nullptr }, graph_garbage_list{ nullptr }
+      thread_config{ CONFIG_THREAD_DEFAULT }, importing_module_index_plus1{ 0 }, graph_garbage_data{ nullptr }, graph_garbage_node{ nullptr }, graph_garbage_list{ nullptr },
+      cpu_thread_pool{ nullptr }, cpu_affinity_numa_node{ -1 }, memory_owner_id{ 0 }, immediate_graph_cache_size{ CONFIG_IMMEDIATE_GRAPH_CACHE_SIZE },
+      compiled_graph_cache_kernel_hash{ 0 }, compiled_graph_cache_kernel_signature{ 0 }
 #if ENABLE_OPENCL
 #if defined(CL_VERSION_2_0)
       , opencl_svmcaps{ 0 }
@@ -3359,6 +3853,11 @@ AgoContext::AgoContext()
     memset(&opencl_build_options, 0, sizeof(opencl_build_options));
 #endif
     memset(&attr_affinity, 0, sizeof(attr_affinity));
+    memset(&attr_cpu_affinity, 0, sizeof(attr_cpu_affinity));
+    attr_cpu_affinity.numa_node = -1;
+    // never reused, unlike context addresses
+    static std::atomic<vx_uint64> s_memory_owner_id_count{ 0 };
+    memory_owner_id = ++s_memory_owner_id_count;
     // critical section
     InitializeCriticalSection(&cs);
     // initialize constants as enumerations with name "!<name>"
@@ -3382,6 +3881,8 @@ AgoContext::AgoContext()
 
 AgoContext::~AgoContext()
 {
+    // cached vxu graphs are released with the other graphs below
+    immediate_graph_cache.clear();
     for (AgoGraph * agraph = graphList.head; agraph;) {
         AgoGraph * next = agraph->next;
         agraph->ref.external_count = 1;
@@ -3436,6 +3937,12 @@ AgoContext::~AgoContext()
     // remove kernel objects
     agoResetKernelList(&kernelList);
 
+    // stop CPU worker threads
+    if (cpu_thread_pool) {
+        delete cpu_thread_pool;
+        cpu_thread_pool = nullptr;
+    }
+
 #if ENABLE_OPENCL
     if (opencl_mem_alloc_count > 0) {
         agoAddLogEntry(&ref, VX_SUCCESS, "OK: OpenCL buffer usage: " VX_FMT_SIZE ", " VX_FMT_SIZE "/" VX_FMT_SIZE "\n",
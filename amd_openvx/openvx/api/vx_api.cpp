@@ -256,6 +256,18 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryContext(vx_context context, vx_enum at
                     status = VX_SUCCESS;
                 }
                 break;
+            case VX_CONTEXT_ATTRIBUTE_AMD_MEMORY_POOL_INFO:
+                if (size == sizeof(AgoMemoryPoolInfo)) {
+                    agoGetMemoryPoolInfo((AgoMemoryPoolInfo *)ptr);
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_CONTEXT_ATTRIBUTE_AMD_CPU_AFFINITY:
+                if (size == sizeof(AgoCpuAffinityInfo)) {
+                    *(AgoCpuAffinityInfo *)ptr = context->attr_cpu_affinity;
+                    status = VX_SUCCESS;
+                }
+                break;
 #if ENABLE_OPENCL
             case VX_CONTEXT_ATTRIBUTE_AMD_OPENCL_CONTEXT:
                 if (size == sizeof(cl_context)) {
@@ -388,6 +400,12 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetContextAttribute(vx_context context, vx_
                 context->attr_affinity = *(AgoTargetAffinityInfo_ *)ptr;
             }
             break;
+        case VX_CONTEXT_ATTRIBUTE_AMD_CPU_AFFINITY:
+            if(!ptr) return VX_ERROR_INVALID_PARAMETERS;
+            if (size == sizeof(AgoCpuAffinityInfo)) {
+                status = agoSetContextCpuAffinity(context, (AgoCpuAffinityInfo *)ptr);
+            }
+            break;
 #if ENABLE_OPENCL
         case VX_CONTEXT_ATTRIBUTE_AMD_OPENCL_CONTEXT:
             if(!ptr) return VX_ERROR_INVALID_PARAMETERS;
@@ -2534,8 +2552,9 @@ VX_API_ENTRY vx_kernel VX_API_CALL vxAddKernel(vx_context context,
     vx_kernel kernel = NULL;
     if (agoIsValidContext(context) && numParams > 0 && numParams <= AGO_MAX_PARAMS && func_ptr && input && output) {
         CAgoLock lock(context->cs);
-        // make sure there are no kernels with the same name
-        if (!agoFindKernelByEnum(context, enumeration) && !agoFindKernelByName(context, name)) {
+        // make sure there are no kernels with the same name, except a built-in kernel that can be overridden
+        AgoKernel * overridden = agoFindOverridableKernel(context, enumeration, name);
+        if (overridden || (!agoFindKernelByEnum(context, enumeration) && !agoFindKernelByName(context, name))) {
             kernel = new AgoKernel;
             // initialize references
             agoResetReference(&kernel->ref, VX_TYPE_KERNEL, context, NULL);
@@ -2557,7 +2576,10 @@ VX_API_ENTRY vx_kernel VX_API_CALL vxAddKernel(vx_context context,
             kernel->deinitialize_f = deinit;
             kernel->importing_module_index_plus1 = context->importing_module_index_plus1;
             kernel->user_kernel = vx_false_e;
-            agoAddKernel(&context->kernelList, kernel);
+            if (overridden)
+                agoAddKernelOverride(&context->kernelList, kernel, overridden);
+            else
+                agoAddKernel(&context->kernelList, kernel);
         }
     }
     return kernel;
@@ -2593,8 +2615,9 @@ VX_API_ENTRY vx_kernel VX_API_CALL vxAddUserKernel(vx_context context,
     vx_kernel kernel = NULL;
     if (agoIsValidContext(context) && numParams > 0 && numParams <= AGO_MAX_PARAMS && func_ptr && validate) {
         CAgoLock lock(context->cs);
-        // make sure there are no kernels with the same name
-        if (!agoFindKernelByEnum(context, enumeration) && !agoFindKernelByName(context, name)) {
+        // make sure there are no kernels with the same name, except a built-in kernel that can be overridden
+        AgoKernel * overridden = agoFindOverridableKernel(context, enumeration, name);
+        if (overridden || (!agoFindKernelByEnum(context, enumeration) && !agoFindKernelByName(context, name))) {
             kernel = new AgoKernel;
             // initialize references
             agoResetReference(&kernel->ref, VX_TYPE_KERNEL, context, NULL);
@@ -2615,7 +2638,10 @@ VX_API_ENTRY vx_kernel VX_API_CALL vxAddUserKernel(vx_context context,
             kernel->deinitialize_f = deinit;
             kernel->importing_module_index_plus1 = context->importing_module_index_plus1;
             kernel->user_kernel = vx_true_e;
-            agoAddKernel(&context->kernelList, kernel);
+            if (overridden)
+                agoAddKernelOverride(&context->kernelList, kernel, overridden);
+            else
+                agoAddKernel(&context->kernelList, kernel);
         }
     }
     return kernel;
@@ -2937,6 +2963,16 @@ VX_API_ENTRY vx_status VX_API_CALL vxVerifyGraph(vx_graph graph)
     if (agoIsValidGraph(graph)) {
         CAgoLock lock(graph->cs);
         CAgoLock lock2(graph->ref.context->cs);
+        // allocate the graph buffers on the NUMA node of the context CPU affinity
+        CAgoAllocAffinityScope affinity(graph->ref.context);
+
+        if (!graph->rebindNodeList.empty()) {
+            // graph parameters got switched to images of different dimensions:
+            // only the nodes that depend on them are validated and allocated again
+            status = agoVerifyGraphRebind(graph);
+            graph->verified = (status == VX_SUCCESS) ? vx_true_e : vx_false_e;
+            return status;
+        }
 
         // mark that graph is not verified and can't be executed
         //graph->verified = vx_false_e;
@@ -3075,7 +3111,9 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryGraph(vx_graph graph, vx_enum attribut
                 break;
             case VX_GRAPH_ATTRIBUTE_PERFORMANCE:
                 if (size == sizeof(vx_perf_t)) {
-                    agoPerfCopyNormalize(graph->ref.context, (vx_perf_t *)ptr, &graph->perf);
+                    vx_perf_t perf;
+                    agoGetGraphPerf(graph, &perf);
+                    agoPerfCopyNormalize(graph->ref.context, (vx_perf_t *)ptr, &perf);
                     status = VX_SUCCESS;
                 }
                 break;
@@ -3140,6 +3178,12 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryGraph(vx_graph graph, vx_enum attribut
             case VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_INTERNAL_PROFILE:
                 status = agoGraphDumpPerformanceProfile(graph, (const char *)ptr);
                 break;
+            case VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_TRACE:
+                // the file name must be terminated within size bytes
+                if (size > 0 && memchr(ptr, 0, size)) {
+                    status = agoGraphDumpPerformanceTrace(graph, (const char *)ptr);
+                }
+                break;
 #if ENABLE_OPENCL
             case VX_GRAPH_ATTRIBUTE_AMD_OPENCL_COMMAND_QUEUE:
                 if (size == sizeof(cl_command_queue)) {
@@ -3154,6 +3198,24 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryGraph(vx_graph graph, vx_enum attribut
                     status = VX_SUCCESS;
                 }
                 break;
+            case VX_GRAPH_ATTRIBUTE_AMD_CPU_TILE_FUSION:
+                if (size == sizeof(vx_bool)) {
+                    *(vx_bool *)ptr = graph->cpu_tile_fusion ? vx_true_e : vx_false_e;
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_GRAPH_ATTRIBUTE_AMD_PIPELINE_STAGES:
+                if (size == sizeof(vx_uint32)) {
+                    *(vx_uint32 *)ptr = graph->pipeline_stages;
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_GRAPH_ATTRIBUTE_AMD_COMPILED_GRAPH_CACHE:
+                if (size > graph->compiled_graph_cache.length()) {
+                    strcpy((char *)ptr, graph->compiled_graph_cache.c_str());
+                    status = VX_SUCCESS;
+                }
+                break;
             default:
                 status = VX_ERROR_NOT_SUPPORTED;
                 break;
@@ -3227,6 +3289,25 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetGraphAttribute(vx_graph graph, vx_enum a
                     status = VX_SUCCESS;
                 }
                 break;
+            case VX_GRAPH_ATTRIBUTE_AMD_CPU_TILE_FUSION:
+                if (size == sizeof(vx_bool)) {
+                    graph->cpu_tile_fusion = *(vx_bool *)ptr ? true : false;
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_GRAPH_ATTRIBUTE_AMD_PIPELINE_STAGES:
+                if (size == sizeof(vx_uint32)) {
+                    graph->pipeline_stages = *(vx_uint32 *)ptr;
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_GRAPH_ATTRIBUTE_AMD_COMPILED_GRAPH_CACHE:
+                if (size > 0) {
+                    // path is limited to size bytes when it isn't terminated within them
+                    graph->compiled_graph_cache.assign((const char *)ptr, strnlen((const char *)ptr, size));
+                    status = VX_SUCCESS;
+                }
+                break;
             default:
                 status = VX_ERROR_NOT_SUPPORTED;
                 break;
@@ -3261,6 +3342,11 @@ VX_API_ENTRY vx_status VX_API_CALL vxAddParameterToGraph(vx_graph graph, vx_para
 
 /*! \brief Sets a reference to the parameter on the graph. The implementation
 * must set this parameter on the originating node as well.
+* On a verified graph, the value must have the same type, dimensions, and layout as the
+* current one: the graph stays verified and only nodes using it are validated again.
+* An image of same format and different dimensions is accepted on CPU graphs too: the graph
+* becomes unverified and the next <tt>\ref vxVerifyGraph</tt> (or <tt>\ref vxProcessGraph</tt>)
+* validates and allocates again only the nodes and virtual images that depend on it.
 * \param [in] graph The graph reference.
 * \param [in] index The parameter index.
 * \param [in] value The reference to set to the parameter.
@@ -3269,12 +3355,14 @@ VX_API_ENTRY vx_status VX_API_CALL vxAddParameterToGraph(vx_graph graph, vx_para
 * \retval VX_ERROR_INVALID_REFERENCE The value is not a valid <tt>\ref vx_reference</tt>.
 * \retval VX_ERROR_INVALID_PARAMETER The parameter index is out of bounds or the
 * dir parameter is incorrect.
+* \retval VX_ERROR_NOT_SUPPORTED The graph is verified and the value has a different layout
+* that can't be switched without a new graph.
 * \ingroup group_graph_parameters
 */
 VX_API_ENTRY vx_status VX_API_CALL vxSetGraphParameterByIndex(vx_graph graph, vx_uint32 index, vx_reference value)
 {
     vx_status status = VX_ERROR_INVALID_REFERENCE;
-    if (agoIsValidGraph(graph) && !graph->verified) {
+    if (agoIsValidGraph(graph) && !graph->verified && graph->rebindNodeList.empty()) {
         status = VX_ERROR_INVALID_PARAMETERS;
         if ((index < graph->parameters.size()) && graph->parameters[index] && (!value || agoIsValidReference(value))) {
             vx_parameter parameter = graph->parameters[index];
@@ -3288,6 +3376,17 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetGraphParameterByIndex(vx_graph graph, vx
             status = VX_SUCCESS;
         }
     }
+    else if (agoIsValidGraph(graph)) {
+        // verified graph: switch to an object with same layout (or an image of different dimensions)
+        // without re-verifying the whole graph
+        CAgoLock lock(graph->cs);
+        CAgoLock lock2(graph->ref.context->cs);
+        status = VX_ERROR_INVALID_PARAMETERS;
+        if ((index < graph->parameters.size()) && graph->parameters[index] && value && agoIsValidReference(value)) {
+            vx_parameter parameter = graph->parameters[index];
+            status = agoRebindGraphParameter(graph, (vx_node)parameter->scope, parameter->index, (AgoData *)value);
+        }
+    }
     return status;
 }
 
@@ -4144,6 +4243,12 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryScalar(vx_scalar scalar, vx_enum attri
                     status = VX_SUCCESS;
                 }
                 break;
+            case VX_SCALAR_WRITE_COUNT:
+                if (size == sizeof(vx_uint32)) {
+                    *(vx_uint32 *)ptr = data->ref.write_count;
+                    status = VX_SUCCESS;
+                }
+                break;
             default:
                 status = VX_ERROR_NOT_SUPPORTED;
                 break;
@@ -4334,6 +4439,8 @@ VX_API_ENTRY vx_status VX_API_CALL vxWriteScalarValue(vx_scalar ref, const void
                 status = VX_ERROR_NOT_SUPPORTED;
                 break;
             }
+            if (status == VX_SUCCESS)
+                data->ref.write_count++;
         }
     }
     return status;
@@ -4586,7 +4693,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetReferenceName(vx_reference ref, const vx
         //printf("%s %s %lu\n", data->name.c_str(), name, strlen(name));
         //printf("before:::strlen(data name) = %lu\n", data->name.length());
         //data->name.assign(name, strlen(name));
-        data->name = name;
+        agoRenameData(data, name);
         //std::copy(name, name + strlen(name), std::back_inserter(data->name));
         //strncpy((char *)data->name.c_str(), name, strnlen(name, VX_MAX_REFERENCE_NAME));
         //data->name.assign("name", 4);
@@ -8142,6 +8249,12 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryArray(vx_array arr, vx_enum attribute,
                     status = VX_SUCCESS;
                 }
                 break;
+            case VX_ARRAY_WRITE_COUNT:
+                if (size == sizeof(vx_uint32)) {
+                    *(vx_uint32 *)ptr = data->ref.write_count;
+                    status = VX_SUCCESS;
+                }
+                break;
 #if (ENABLE_OPENCL||ENABLE_HIP)
             case VX_ARRAY_OFFSET_GPU:
                 if (size == sizeof(vx_size)) {
@@ -8279,6 +8392,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxAddArrayItems(vx_array arr, vx_size count,
                 // update sync flags
                 data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                 data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                data->ref.write_count++;
             }
             status = VX_SUCCESS;
         }
@@ -8306,6 +8420,8 @@ VX_API_ENTRY vx_status VX_API_CALL vxTruncateArray(vx_array arr, vx_size new_num
     if (agoIsValidData(data, VX_TYPE_ARRAY)) {
         status = VX_ERROR_INVALID_PARAMETERS;
         if (new_num_items <= data->u.arr.numitems) {
+            if (new_num_items != data->u.arr.numitems)
+                data->ref.write_count++;
             data->u.arr.numitems = new_num_items;
             status = VX_SUCCESS;
         }
@@ -8486,6 +8602,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxCommitArrayRange(vx_array arr, vx_size star
                     // update sync flags
                     data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                     data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    data->ref.write_count++;
                 }
             }
         }
@@ -8692,6 +8809,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxUnmapArrayRange(vx_array array, vx_map_id m
                     // update sync flags
                     data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                     data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    data->ref.write_count++;
                 }
                 status = VX_SUCCESS;
                 break;
@@ -9571,6 +9689,36 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetModuleHandle(vx_node node, const vx_char
     return status;
 }
 
+VX_API_ENTRY vx_status VX_API_CALL vxRunNodeTasks(vx_node node, vx_uint32 count, vx_uint32 max_slots, vx_node_task_f task, void * user_data)
+{
+    vx_status status = VX_ERROR_INVALID_REFERENCE;
+    if (agoIsValidNode(node)) {
+        status = VX_ERROR_INVALID_PARAMETERS;
+        if (task) {
+            AgoGraph * graph = (AgoGraph *)node->ref.scope;
+            CAgoThreadPool * pool = graph->ref.context->cpu_thread_pool;
+            vx_uint32 slots = std::min(count, std::max(graph->cpu_num_threads, 1u));
+            if (max_slots > 0)
+                slots = std::min(slots, max_slots);
+            if (slots <= 1 || !pool) {
+                for (vx_uint32 index = 0; index < count; index++)
+                    task(user_data, index, 0);
+            }
+            else {
+                // each slot picks the next task until all of them are taken: a pool item runs a single slot at a time
+                std::atomic<vx_uint32> next(0);
+                pool->Reserve(graph->cpu_num_threads);
+                pool->ParallelFor(slots, [&](size_t slot) {
+                    for (vx_uint32 index = next++; index < count; index = next++)
+                        task(user_data, index, (vx_uint32)slot);
+                });
+            }
+            status = VX_SUCCESS;
+        }
+    }
+    return status;
+}
+
 //! \brief Create context from specified platform -- needed for ICD support
 extern "C" VX_API_ENTRY vx_context VX_API_CALL vxCreateContextFromPlatform(struct _vx_platform * platform);
 VX_API_ENTRY vx_context VX_API_CALL vxCreateContextFromPlatform(struct _vx_platform * platform)
@@ -9774,14 +9922,8 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryTensor(vx_tensor tensor, vx_enum attri
                     status = VX_SUCCESS;
                 }
                 break;
-#if (ENABLE_OPENCL||ENABLE_HIP)
-            case VX_TENSOR_OFFSET_GPU:
-                if (size == sizeof(vx_size)) {
-                    *(vx_size *)ptr = data->u.tensor.offset;
-                    status = VX_SUCCESS;
-                }
-                break;
             case VX_TENSOR_STRIDE_GPU:
+                // strides are shared by the host and device buffers
                 if (size >= sizeof(vx_size)*data->u.tensor.num_dims) {
                     for (vx_size i = 0; i < data->u.tensor.num_dims; i++) {
                         ((vx_size *)ptr)[i] = data->u.tensor.stride[i];
@@ -9789,6 +9931,13 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryTensor(vx_tensor tensor, vx_enum attri
                     status = VX_SUCCESS;
                 }
                 break;
+#if (ENABLE_OPENCL||ENABLE_HIP)
+            case VX_TENSOR_OFFSET_GPU:
+                if (size == sizeof(vx_size)) {
+                    *(vx_size *)ptr = data->u.tensor.offset;
+                    status = VX_SUCCESS;
+                }
+                break;
 #if ENABLE_OPENCL
             case VX_TENSOR_BUFFER_OPENCL:
                 if (size == sizeof(cl_mem)) {
@@ -10321,3 +10470,93 @@ VX_API_ENTRY vx_bool VX_API_CALL vxIsTensorAliased(vx_tensor tensorMaster, vx_si
     }
     return status;
 }
+
+static void agoSetHandleRingSlot(AgoData * data, vx_uint32 slot)
+{
+    vx_uint32 numPlanes = data->numChildren ? data->numChildren : 1;
+    vx_uint8 * const * ptrs = &data->handleRing[slot * numPlanes];
+    for (vx_uint32 plane = 0; plane < numPlanes; plane++) {
+        AgoData * img = data->numChildren ? data->children[plane] : data;
+        img->buffer = ptrs[plane];
+        img->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
+        img->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+        // propagate to ROIs
+        for (auto roi = img->roiDepList.begin(); roi != img->roiDepList.end(); roi++) {
+            if (img->ref.type == VX_TYPE_TENSOR) {
+                (*roi)->buffer = img->buffer + (*roi)->u.tensor.offset;
+            }
+            else {
+                (*roi)->buffer = img->buffer +
+                    (*roi)->u.img.rect_roi.start_y * img->u.img.stride_in_bytes +
+                    ImageWidthInBytesFloor((*roi)->u.img.rect_roi.start_x, img);
+            }
+        }
+    }
+    data->handleRingSlot = slot;
+}
+
+VX_API_ENTRY vx_status VX_API_CALL vxSetHandleRing(vx_reference ref, void * const ptrs[], vx_size num_planes, vx_uint32 num_slots)
+{
+    AgoData * data = (AgoData *)ref;
+    vx_status status = VX_ERROR_INVALID_REFERENCE;
+    if (agoIsValidData(data, VX_TYPE_IMAGE) || agoIsValidData(data, VX_TYPE_TENSOR)) {
+        CAgoLock lock(data->ref.context->cs);
+        status = VX_ERROR_INVALID_PARAMETERS;
+        bool isImage = (data->ref.type == VX_TYPE_IMAGE);
+        vx_size planes = isImage ? data->u.img.planes : 1;
+        bool isROI = isImage ? (data->u.img.roiMasterImage != nullptr) : (data->u.tensor.roiMaster != nullptr);
+        if (data->import_type == VX_MEMORY_TYPE_HOST && !isROI && num_planes == planes && (ptrs || !num_slots)) {
+            status = VX_SUCCESS;
+            for (vx_size i = 0; i < num_slots * num_planes; i++) {
+                if (!ptrs[i])
+                    status = VX_ERROR_INVALID_PARAMETERS;
+            }
+            if (status == VX_SUCCESS) {
+                data->handleRing.assign((vx_uint8 * const *)ptrs, (vx_uint8 * const *)ptrs + num_slots * num_planes);
+                if (num_slots > 0) {
+                    agoSetHandleRingSlot(data, 0);
+                    if (isImage) {
+                        for (vx_uint32 i = 0; i < data->numChildren; i++)
+                            data->children[i]->u.img.mem_handle = vx_false_e;
+                        data->u.img.mem_handle = vx_false_e;
+                    }
+                }
+                data->handleRingSlot = 0;
+            }
+        }
+    }
+    return status;
+}
+
+VX_API_ENTRY vx_status VX_API_CALL vxAdvanceHandleRing(vx_reference ref, vx_uint32 * slot)
+{
+    // no lock and no validation of the object: the ring was validated by vxSetHandleRing
+    AgoData * data = (AgoData *)ref;
+    vx_status status = VX_ERROR_INVALID_REFERENCE;
+    if ((agoIsValidData(data, VX_TYPE_IMAGE) || agoIsValidData(data, VX_TYPE_TENSOR)) && !data->handleRing.empty()) {
+        vx_uint32 numSlots = (vx_uint32)data->handleRing.size() / (data->numChildren ? data->numChildren : 1);
+        vx_uint32 next = data->handleRingSlot + 1;
+        if (next == numSlots)
+            next = 0;
+        agoSetHandleRingSlot(data, next);
+        if (slot)
+            *slot = next;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+VX_API_ENTRY vx_status VX_API_CALL vxScheduleGraphTicket(vx_graph graph, vx_uint64 * ticket)
+{
+    return agoScheduleGraph(graph, ticket);
+}
+
+VX_API_ENTRY vx_status VX_API_CALL vxWaitGraphTicket(vx_graph graph, vx_uint64 ticket, vx_uint32 timeout_msec)
+{
+    return agoWaitGraphTicket(graph, ticket, timeout_msec);
+}
+
+VX_API_ENTRY vx_status VX_API_CALL vxSetGraphCompletionCallback(vx_graph graph, vx_graph_completion_callback_f callback, void * user_data)
+{
+    return agoSetGraphCompletionCallback(graph, callback, user_data);
+}
@@ -788,4 +788,132 @@ VX_API_ENTRY vx_node VX_API_CALL vxLaplacianReconstructNode(vx_graph graph, vx_p
                                            params,
                                            dimof(params));
     return node;
-}
\ No newline at end of file
+}
+VX_API_ENTRY vx_node VX_API_CALL vxTensorMultiplyNode(vx_graph graph, vx_tensor input1, vx_tensor input2, vx_scalar scale, vx_enum overflow_policy,
+        vx_enum rounding_policy, vx_tensor output)
+{
+    vx_context context = vxGetContext((vx_reference)graph);
+    vx_scalar soverflow = vxCreateScalar(context, VX_TYPE_ENUM, &overflow_policy);
+    vx_scalar srounding = vxCreateScalar(context, VX_TYPE_ENUM, &rounding_policy);
+    vx_reference params[] = {
+            (vx_reference)input1,
+            (vx_reference)input2,
+            (vx_reference)scale,
+            (vx_reference)soverflow,
+            (vx_reference)srounding,
+            (vx_reference)output,
+    };
+    vx_node node = vxCreateNodeByStructure(graph,
+                                           VX_KERNEL_TENSOR_MULTIPLY,
+                                           params,
+                                           dimof(params));
+    vxReleaseScalar(&soverflow);
+    vxReleaseScalar(&srounding);
+    return node;
+}
+
+VX_API_ENTRY vx_node VX_API_CALL vxTensorAddNode(vx_graph graph, vx_tensor input1, vx_tensor input2, vx_enum policy, vx_tensor output)
+{
+    vx_scalar spolicy = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_ENUM, &policy);
+    vx_reference params[] = {
+            (vx_reference)input1,
+            (vx_reference)input2,
+            (vx_reference)spolicy,
+            (vx_reference)output,
+    };
+    vx_node node = vxCreateNodeByStructure(graph,
+                                           VX_KERNEL_TENSOR_ADD,
+                                           params,
+                                           dimof(params));
+    vxReleaseScalar(&spolicy);
+    return node;
+}
+
+VX_API_ENTRY vx_node VX_API_CALL vxTensorSubtractNode(vx_graph graph, vx_tensor input1, vx_tensor input2, vx_enum policy, vx_tensor output)
+{
+    vx_scalar spolicy = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_ENUM, &policy);
+    vx_reference params[] = {
+            (vx_reference)input1,
+            (vx_reference)input2,
+            (vx_reference)spolicy,
+            (vx_reference)output,
+    };
+    vx_node node = vxCreateNodeByStructure(graph,
+                                           VX_KERNEL_TENSOR_SUBTRACT,
+                                           params,
+                                           dimof(params));
+    vxReleaseScalar(&spolicy);
+    return node;
+}
+
+VX_API_ENTRY vx_node VX_API_CALL vxTensorTableLookupNode(vx_graph graph, vx_tensor input1, vx_lut lut, vx_tensor output)
+{
+    vx_reference params[] = {
+            (vx_reference)input1,
+            (vx_reference)lut,
+            (vx_reference)output,
+    };
+    vx_node node = vxCreateNodeByStructure(graph,
+                                           VX_KERNEL_TENSOR_TABLE_LOOKUP,
+                                           params,
+                                           dimof(params));
+    return node;
+}
+
+VX_API_ENTRY vx_node VX_API_CALL vxTensorTransposeNode(vx_graph graph, vx_tensor input, vx_tensor output, vx_size dimension1, vx_size dimension2)
+{
+    vx_context context = vxGetContext((vx_reference)graph);
+    vx_scalar sdim1 = vxCreateScalar(context, VX_TYPE_SIZE, &dimension1);
+    vx_scalar sdim2 = vxCreateScalar(context, VX_TYPE_SIZE, &dimension2);
+    vx_reference params[] = {
+            (vx_reference)input,
+            (vx_reference)output,
+            (vx_reference)sdim1,
+            (vx_reference)sdim2,
+    };
+    vx_node node = vxCreateNodeByStructure(graph,
+                                           VX_KERNEL_TENSOR_TRANSPOSE,
+                                           params,
+                                           dimof(params));
+    vxReleaseScalar(&sdim1);
+    vxReleaseScalar(&sdim2);
+    return node;
+}
+
+VX_API_ENTRY vx_node VX_API_CALL vxTensorConvertDepthNode(vx_graph graph, vx_tensor input, vx_enum policy, vx_scalar norm, vx_scalar offset, vx_tensor output)
+{
+    vx_scalar spolicy = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_ENUM, &policy);
+    vx_reference params[] = {
+            (vx_reference)input,
+            (vx_reference)spolicy,
+            (vx_reference)norm,
+            (vx_reference)offset,
+            (vx_reference)output,
+    };
+    vx_node node = vxCreateNodeByStructure(graph,
+                                           VX_KERNEL_TENSOR_CONVERT_DEPTH,
+                                           params,
+                                           dimof(params));
+    vxReleaseScalar(&spolicy);
+    return node;
+}
+
+VX_API_ENTRY vx_node VX_API_CALL vxTensorMatrixMultiplyNode(vx_graph graph, vx_tensor input1, vx_tensor input2, vx_tensor input3,
+    const vx_tensor_matrix_multiply_params_t *matrix_multiply_params, vx_tensor output)
+{
+    vx_scalar sparams = vxCreateScalarWithSize(vxGetContext((vx_reference)graph), VX_TYPE_TENSOR_MATRIX_MULTIPLY_PARAMS,
+                                               matrix_multiply_params, sizeof(*matrix_multiply_params));
+    vx_reference params[] = {
+            (vx_reference)input1,
+            (vx_reference)input2,
+            (vx_reference)input3,
+            (vx_reference)sparams,
+            (vx_reference)output,
+    };
+    vx_node node = vxCreateNodeByStructure(graph,
+                                           VX_KERNEL_TENSOR_MATRIX_MULTIPLY,
+                                           params,
+                                           dimof(params));
+    vxReleaseScalar(&sparams);
+    return node;
+}
@@ -24,8 +24,9 @@
 #include <VX/vx.h>
 #include <VX/vxu.h>
 #include <ago_internal.h>
+#include <functional>
 
-static void vxuSetGraphAffinityDefault(vx_graph graph)
+static vx_uint32 vxuGetDefaultTarget()
 {
     vx_uint32 default_target = AGO_KERNEL_TARGET_DEFAULT;
     char textBuffer[1024];
@@ -36,54 +37,248 @@ static void vxuSetGraphAffinityDefault(vx_graph graph)
             default_target = AGO_KERNEL_FLAG_DEVICE_CPU;
         }
     }
-    graph->attr_affinity.device_type = default_target;
-    graph->attr_affinity.device_info = 0;
+    return default_target;
 }
 
- 
-
-VX_API_ENTRY vx_status VX_API_CALL vxuColorConvert(vx_context context, vx_image src, vx_image dst)
-{
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxColorConvertNode(graph, src, dst);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
+// value of an input scalar that a kernel may use when the node is verified: such values are part of the cache key
+static vx_uint64 vxuScalarValue(vx_scalar scalar)
+{
+    AgoData * data = (AgoData *)scalar;
+    if (!agoIsValidData(data, VX_TYPE_SCALAR))
+        return 0;
+    vx_uint64 value = data->u.scalar.u.u64;
+    if (data->u.scalar.itemsize > 0 && data->u.scalar.itemsize < sizeof(value))
+        value &= (1ull << (data->u.scalar.itemsize * 8)) - 1;
+    return value;
+}
+
+static void vxuAddObjectKey(std::vector<vx_uint64>& key, AgoData * data)
+{
+    // the layout checked by agoRebindGraphParameter plus the properties used by the optimizer to pick kernels
+    key.push_back(data->ref.type);
+    switch (data->ref.type) {
+    case VX_TYPE_IMAGE:
+        key.push_back(data->u.img.format);
+        key.push_back(((vx_uint64)data->u.img.width << 32) | data->u.img.height);
+        key.push_back(((vx_uint64)data->u.img.stride_in_bytes << 1) | (data->u.img.isUniform ? 1 : 0));
+        break;
+    case VX_TYPE_PYRAMID:
+        key.push_back(data->u.pyr.format);
+        key.push_back(((vx_uint64)data->u.pyr.width << 32) | data->u.pyr.height);
+        key.push_back(data->u.pyr.levels);
+        break;
+    case VX_TYPE_SCALAR:
+        key.push_back(data->u.scalar.type);
+        break;
+    case VX_TYPE_THRESHOLD:
+        key.push_back(data->u.thr.thresh_type);
+        key.push_back(((vx_uint64)data->u.thr.input_format << 32) | data->u.thr.output_format);
+        break;
+    default:
+        key.push_back(data->size);
+        break;
+    }
+}
+
+static void vxuDiscardPlaceholder(AgoContext * acontext, AgoData * placeholder)
+{
+    // released graphs stay in the garbage list of the context with their parameters,
+    // so placeholders are deleted with the garbage data when the context is released
+    for (vx_uint32 i = 0; i < placeholder->numChildren; i++) {
+        if (placeholder->children[i])
+            vxuDiscardPlaceholder(acontext, placeholder->children[i]);
+    }
+    CAgoLock lock(acontext->cs);
+    placeholder->next = acontext->graph_garbage_data;
+    acontext->graph_garbage_data = placeholder;
+}
+
+static AgoData * vxuCreatePlaceholder(AgoContext * acontext, AgoData * data)
+{
+    // unallocated object with the layout of data, kept out of the data list of the context as vxVerifyGraph
+    // allocates all of them: ROI images are not supported as their description names the master image
+    if (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI)
+        return nullptr;
+    char desc[MAX_DESCRIPTION_DATA_SIZE];
+    agoGetDescriptionFromData(acontext, desc, data);
+    AgoData * placeholder = agoCreateDataFromDescription(acontext, NULL, desc, false);
+    if (!placeholder)
+        return nullptr;
+    agoGenerateDataName(acontext, "vxu", placeholder->name);
+    if (!agoIsSameDataLayout(data, placeholder)) {
+        vxuDiscardPlaceholder(acontext, placeholder);
+        return nullptr;
+    }
+    return placeholder;
+}
+
+static void vxuReleaseImmediateGraph(AgoImmediateGraph& entry)
+{
+    vx_node node = entry.node;
+    vx_graph graph = entry.graph;
+    if (node)
+        vxReleaseNode(&node);
+    if (graph)
+        vxReleaseGraph(&graph);
+    for (AgoData * placeholder : entry.placeholderList) {
+        if (placeholder)
+            vxuDiscardPlaceholder(placeholder->ref.context, placeholder);
+    }
+}
+
+// Run a single node in immediate mode. The verified graph is kept in an LRU cache of the context
+// (AGO_VXU_GRAPH_CACHE_SIZE, 0 disables) keyed by the kernel, the arguments baked into the node,
+// the layout of the objects, the immediate border mode, and the target. A call that hits the cache
+// switches the objects of the graph with agoRebindGraphParameter instead of creating and verifying a
+// new graph. Between calls the arguments are switched to unallocated placeholders of same layout, so the
+// cache doesn't keep the objects of the caller alive.
+static vx_status vxuProcessNode(vx_context context, vx_enum kernel_id, bool useImmediateBorderMode,
+                                std::initializer_list<vx_reference> refs, std::initializer_list<vx_uint64> args,
+                                const std::function<vx_node(vx_graph)>& createNode)
+{
+    if (!agoIsValidContext(context))
+        return VX_FAILURE;
+    AgoContext * acontext = (AgoContext *)context;
+    vx_uint32 default_target = vxuGetDefaultTarget();
+    vx_border_mode_t border = { 0 };
+    if (useImmediateBorderMode) {
+        vx_status status = vxQueryContext(context, VX_CONTEXT_ATTRIBUTE_IMMEDIATE_BORDER_MODE, &border, sizeof(border));
+        if (status != VX_SUCCESS)
+            return status;
+    }
+
+    // cache key: objects repeated in the argument list are keyed by the position of their first occurrence
+    std::vector<AgoData *> dataList;
+    for (vx_reference ref : refs)
+        dataList.push_back((AgoData *)ref);
+    bool cacheable = acontext->immediate_graph_cache_size > 0;
+    std::vector<vx_uint64> key = { (vx_uint64)kernel_id, default_target, args.size() };
+    key.insert(key.end(), args.begin(), args.end());
+    if (useImmediateBorderMode) {
+        vx_uint64 constant_value[2] = { 0, 0 };
+        memcpy(constant_value, &border.constant_value, std::min(sizeof(constant_value), sizeof(border.constant_value)));
+        key.push_back(border.mode);
+        key.insert(key.end(), constant_value, constant_value + 2);
+    }
+    for (size_t i = 0; cacheable && i < dataList.size(); i++) {
+        size_t first = std::find(dataList.begin(), dataList.end(), dataList[i]) - dataList.begin();
+        key.push_back(dataList[i] ? first : ~0ull);
+        if (dataList[i] && first == i) {
+            if (agoIsValidReference((vx_reference)dataList[i]) && dataList[i]->ref.context == acontext && !dataList[i]->isVirtual)
+                vxuAddObjectKey(key, dataList[i]);
+            else
+                cacheable = false;
+        }
+    }
+
+    // reuse a cached graph after switching its objects
+    AgoImmediateGraph entry = { };
+    bool cached = false;
+    if (cacheable) {
+        std::lock_guard<std::mutex> lock(acontext->immediate_graph_mutex);
+        for (auto it = acontext->immediate_graph_cache.begin(); it != acontext->immediate_graph_cache.end(); it++) {
+            if (it->key == key) {
+                entry = std::move(*it);
+                acontext->immediate_graph_cache.erase(it);
+                cached = true;
+                break;
+            }
+        }
+    }
+    vx_status status = VX_SUCCESS;
+    if (cached) {
+        CAgoLock lock(entry.graph->cs);
+        CAgoLock lock2(acontext->cs);
+        for (size_t i = 0; status == VX_SUCCESS && i < dataList.size(); i++) {
+            if (entry.paramIndex[i] >= 0)
+                status = agoRebindGraphParameter(entry.graph, entry.node, (vx_uint32)entry.paramIndex[i], dataList[i]);
+        }
+    }
+    if (cached && status != VX_SUCCESS) {
+        // objects can't be switched: build a new graph
+        vxuReleaseImmediateGraph(entry);
+        entry = { };
+        cached = false;
+    }
+
+    // create and verify a new graph: the scheduling thread is not needed as vxu calls only use vxProcessGraph
+    if (!cached) {
+        entry.graph = agoCreateGraph(acontext, false);
+        if (!entry.graph)
+            return VX_FAILURE;
+        entry.graph->attr_affinity.device_type = default_target;
+        entry.graph->attr_affinity.device_info = 0;
+        entry.node = createNode(entry.graph);
+        status = VX_FAILURE;
+        if (entry.node) {
+            status = VX_SUCCESS;
+            if (useImmediateBorderMode)
+                status = vxSetNodeAttribute(entry.node, VX_NODE_ATTRIBUTE_BORDER_MODE, &border, sizeof(border));
+            if (status == VX_SUCCESS)
+                status = vxVerifyGraph(entry.graph);
+            for (size_t i = 0; cacheable && i < dataList.size(); i++) {
+                vx_int32 index = -1;
+                if (dataList[i] && std::find(dataList.begin(), dataList.end(), dataList[i]) - dataList.begin() == (ptrdiff_t)i) {
+                    for (vx_uint32 arg = 0; arg < entry.node->paramCount && index < 0; arg++) {
+                        if (entry.node->paramList[arg] == dataList[i])
+                            index = (vx_int32)arg;
+                    }
+                    if (index < 0)
+                        cacheable = false;
+                }
+                AgoData * placeholder = nullptr;
+                if (index >= 0) {
+                    placeholder = vxuCreatePlaceholder(acontext, dataList[i]);
+                    if (!placeholder)
+                        cacheable = false;
+                }
+                entry.paramIndex.push_back(index);
+                entry.placeholderList.push_back(placeholder);
             }
-            vxReleaseNode(&node);
         }
-        vxReleaseGraph(&graph);
     }
+    if (status == VX_SUCCESS)
+        status = vxProcessGraph(entry.graph);
+
+    // keep the graph for the next call with the same key, with placeholders in place of the objects of this call
+    if (status == VX_SUCCESS && cacheable) {
+        CAgoLock lock(entry.graph->cs);
+        CAgoLock lock2(acontext->cs);
+        for (size_t i = 0; cacheable && i < entry.paramIndex.size(); i++) {
+            if (entry.paramIndex[i] >= 0 && agoDetachGraphParameter(entry.graph, entry.node, (vx_uint32)entry.paramIndex[i], entry.placeholderList[i]) != VX_SUCCESS)
+                cacheable = false;
+        }
+    }
+    std::vector<AgoImmediateGraph> releaseList;
+    if (status == VX_SUCCESS && cacheable) {
+        entry.key = std::move(key);
+        std::lock_guard<std::mutex> lock(acontext->immediate_graph_mutex);
+        acontext->immediate_graph_cache.push_front(std::move(entry));
+        while (acontext->immediate_graph_cache.size() > acontext->immediate_graph_cache_size) {
+            releaseList.push_back(std::move(acontext->immediate_graph_cache.back()));
+            acontext->immediate_graph_cache.pop_back();
+        }
+    }
+    else {
+        releaseList.push_back(std::move(entry));
+    }
+    for (auto& item : releaseList)
+        vxuReleaseImmediateGraph(item);
     return status;
 }
 
+VX_API_ENTRY vx_status VX_API_CALL vxuColorConvert(vx_context context, vx_image src, vx_image dst)
+{
+    return vxuProcessNode(context, VX_KERNEL_COLOR_CONVERT, false,
+        { (vx_reference)src, (vx_reference)dst }, { },
+        [&](vx_graph graph) { return vxColorConvertNode(graph, src, dst); });
+}
+
 VX_API_ENTRY vx_status VX_API_CALL vxuChannelExtract(vx_context context, vx_image src, vx_enum channel, vx_image dst)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxChannelExtractNode(graph, src, channel, dst);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_CHANNEL_EXTRACT, false,
+        { (vx_reference)src, (vx_reference)dst }, { (vx_uint64)channel },
+        [&](vx_graph graph) { return vxChannelExtractNode(graph, src, channel, dst); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuChannelCombine(vx_context context,
@@ -93,519 +288,166 @@ VX_API_ENTRY vx_status VX_API_CALL vxuChannelCombine(vx_context context,
                             vx_image plane3,
                             vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxChannelCombineNode(graph, plane0, plane1, plane2, plane3, output);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
-}
-
-static vx_status vx_useImmediateBorderMode(vx_context context, vx_node node)
-{
-    vx_border_mode_t border;
-    vx_status status = vxQueryContext(context, VX_CONTEXT_ATTRIBUTE_IMMEDIATE_BORDER_MODE, &border, sizeof(border));
-    if (status == VX_SUCCESS)
-        status = vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_BORDER_MODE, &border, sizeof(border));
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_CHANNEL_COMBINE, false,
+        { (vx_reference)plane0, (vx_reference)plane1, (vx_reference)plane2, (vx_reference)plane3, (vx_reference)output }, { },
+        [&](vx_graph graph) { return vxChannelCombineNode(graph, plane0, plane1, plane2, plane3, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuSobel3x3(vx_context context, vx_image src, vx_image output_x, vx_image output_y)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxSobel3x3Node(graph, src, output_x, output_y);
-        if (node)
-        {
-            status = vx_useImmediateBorderMode(context, node);
-            if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_SOBEL_3x3, true,
+        { (vx_reference)src, (vx_reference)output_x, (vx_reference)output_y }, { },
+        [&](vx_graph graph) { return vxSobel3x3Node(graph, src, output_x, output_y); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuMagnitude(vx_context context, vx_image grad_x, vx_image grad_y, vx_image dst)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxMagnitudeNode(graph, grad_x, grad_y, dst);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_MAGNITUDE, false,
+        { (vx_reference)grad_x, (vx_reference)grad_y, (vx_reference)dst }, { },
+        [&](vx_graph graph) { return vxMagnitudeNode(graph, grad_x, grad_y, dst); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuPhase(vx_context context, vx_image grad_x, vx_image grad_y, vx_image dst)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxPhaseNode(graph, grad_x, grad_y, dst);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_PHASE, false,
+        { (vx_reference)grad_x, (vx_reference)grad_y, (vx_reference)dst }, { },
+        [&](vx_graph graph) { return vxPhaseNode(graph, grad_x, grad_y, dst); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuScaleImage(vx_context context, vx_image src, vx_image dst, vx_enum type)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxScaleImageNode(graph, src, dst, type);
-        if (node)
-        {
-            status = vx_useImmediateBorderMode(context, node);
-            if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_SCALE_IMAGE, true,
+        { (vx_reference)src, (vx_reference)dst }, { (vx_uint64)type },
+        [&](vx_graph graph) { return vxScaleImageNode(graph, src, dst, type); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuTableLookup(vx_context context, vx_image input, vx_lut lut, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxTableLookupNode(graph, input, lut, output);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_TABLE_LOOKUP, false,
+        { (vx_reference)input, (vx_reference)lut, (vx_reference)output }, { },
+        [&](vx_graph graph) { return vxTableLookupNode(graph, input, lut, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuHistogram(vx_context context, vx_image input, vx_distribution distribution)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxHistogramNode(graph, input, distribution);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_HISTOGRAM, false,
+        { (vx_reference)input, (vx_reference)distribution }, { },
+        [&](vx_graph graph) { return vxHistogramNode(graph, input, distribution); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuEqualizeHist(vx_context context, vx_image input, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxEqualizeHistNode(graph, input, output);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_EQUALIZE_HISTOGRAM, false,
+        { (vx_reference)input, (vx_reference)output }, { },
+        [&](vx_graph graph) { return vxEqualizeHistNode(graph, input, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuAbsDiff(vx_context context, vx_image in1, vx_image in2, vx_image out)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxAbsDiffNode(graph, in1, in2, out);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_ABSDIFF, false,
+        { (vx_reference)in1, (vx_reference)in2, (vx_reference)out }, { },
+        [&](vx_graph graph) { return vxAbsDiffNode(graph, in1, in2, out); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuMeanStdDev(vx_context context, vx_image input, vx_float32 *mean, vx_float32 *stddev)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
+    vx_scalar s_mean = vxCreateScalar(context, VX_TYPE_FLOAT32, NULL);
+    vx_scalar s_stddev = vxCreateScalar(context, VX_TYPE_FLOAT32, NULL);
+    vx_status status = vxuProcessNode(context, VX_KERNEL_MEAN_STDDEV, false,
+        { (vx_reference)input, (vx_reference)s_mean, (vx_reference)s_stddev }, { },
+        [&](vx_graph graph) { return vxMeanStdDevNode(graph, input, s_mean, s_stddev); });
+    if (status == VX_SUCCESS)
     {
-		vxuSetGraphAffinityDefault(graph);
-		vx_scalar s_mean = vxCreateScalar(context, VX_TYPE_FLOAT32, NULL);
-        vx_scalar s_stddev = vxCreateScalar(context, VX_TYPE_FLOAT32, NULL);
-        vx_node node = vxMeanStdDevNode(graph, input, s_mean, s_stddev);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-                if(mean) vxReadScalarValue(s_mean, mean);
-                if(stddev) vxReadScalarValue(s_stddev, stddev);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseScalar(&s_mean);
-        vxReleaseScalar(&s_stddev);
-        vxReleaseGraph(&graph);
+        if(mean) vxReadScalarValue(s_mean, mean);
+        if(stddev) vxReadScalarValue(s_stddev, stddev);
     }
+    vxReleaseScalar(&s_mean);
+    vxReleaseScalar(&s_stddev);
     return status;
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuThreshold(vx_context context, vx_image input, vx_threshold thresh, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxThresholdNode(graph, input, thresh, output);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_THRESHOLD, false,
+        { (vx_reference)input, (vx_reference)thresh, (vx_reference)output }, { },
+        [&](vx_graph graph) { return vxThresholdNode(graph, input, thresh, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuIntegralImage(vx_context context, vx_image input, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxIntegralImageNode(graph, input, output);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_INTEGRAL_IMAGE, false,
+        { (vx_reference)input, (vx_reference)output }, { },
+        [&](vx_graph graph) { return vxIntegralImageNode(graph, input, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuErode3x3(vx_context context, vx_image input, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxErode3x3Node(graph, input, output);
-        if (node)
-        {
-            status = vx_useImmediateBorderMode(context, node);
-            if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_ERODE_3x3, true,
+        { (vx_reference)input, (vx_reference)output }, { },
+        [&](vx_graph graph) { return vxErode3x3Node(graph, input, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuDilate3x3(vx_context context, vx_image input, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxDilate3x3Node(graph, input, output);
-        if (node)
-        {
-            status = vx_useImmediateBorderMode(context, node);
-            if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_DILATE_3x3, true,
+        { (vx_reference)input, (vx_reference)output }, { },
+        [&](vx_graph graph) { return vxDilate3x3Node(graph, input, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuMedian3x3(vx_context context, vx_image input, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxMedian3x3Node(graph, input, output);
-        if (node)
-        {
-            status = vx_useImmediateBorderMode(context, node);
-            if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_MEDIAN_3x3, true,
+        { (vx_reference)input, (vx_reference)output }, { },
+        [&](vx_graph graph) { return vxMedian3x3Node(graph, input, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuBox3x3(vx_context context, vx_image input, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxBox3x3Node(graph, input, output);
-        if (node)
-        {
-            status = vx_useImmediateBorderMode(context, node);
-            if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_BOX_3x3, true,
+        { (vx_reference)input, (vx_reference)output }, { },
+        [&](vx_graph graph) { return vxBox3x3Node(graph, input, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuGaussian3x3(vx_context context, vx_image input, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxGaussian3x3Node(graph, input, output);
-        if (node)
-        {
-            status = vx_useImmediateBorderMode(context, node);
-            if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_GAUSSIAN_3x3, true,
+        { (vx_reference)input, (vx_reference)output }, { },
+        [&](vx_graph graph) { return vxGaussian3x3Node(graph, input, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuConvolve(vx_context context, vx_image input, vx_convolution conv, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxConvolveNode(graph, input, conv, output);
-        if (node)
-        {
-            status = vx_useImmediateBorderMode(context, node);
-            if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_CUSTOM_CONVOLUTION, true,
+        { (vx_reference)input, (vx_reference)conv, (vx_reference)output }, { },
+        [&](vx_graph graph) { return vxConvolveNode(graph, input, conv, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuGaussianPyramid(vx_context context, vx_image input, vx_pyramid gaussian)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxGaussianPyramidNode(graph, input, gaussian);
-        if (node)
-        {
-            status = vx_useImmediateBorderMode(context, node);
-            if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_GAUSSIAN_PYRAMID, true,
+        { (vx_reference)input, (vx_reference)gaussian }, { },
+        [&](vx_graph graph) { return vxGaussianPyramidNode(graph, input, gaussian); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuAccumulateImage(vx_context context, vx_image input, vx_image accum)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxAccumulateImageNode(graph, input, accum);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_ACCUMULATE, false,
+        { (vx_reference)input, (vx_reference)accum }, { },
+        [&](vx_graph graph) { return vxAccumulateImageNode(graph, input, accum); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuAccumulateWeightedImage(vx_context context, vx_image input, vx_scalar scale, vx_image accum)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxAccumulateWeightedImageNode(graph, input, scale, accum);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_ACCUMULATE_WEIGHTED, false,
+        { (vx_reference)input, (vx_reference)scale, (vx_reference)accum }, { vxuScalarValue(scale) },
+        [&](vx_graph graph) { return vxAccumulateWeightedImageNode(graph, input, scale, accum); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuAccumulateSquareImage(vx_context context, vx_image input, vx_scalar scale, vx_image accum)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxAccumulateSquareImageNode(graph, input, scale, accum);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_ACCUMULATE_SQUARE, false,
+        { (vx_reference)input, (vx_reference)scale, (vx_reference)accum }, { vxuScalarValue(scale) },
+        [&](vx_graph graph) { return vxAccumulateSquareImageNode(graph, input, scale, accum); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuMinMaxLoc(vx_context context, vx_image input,
@@ -613,46 +455,18 @@ VX_API_ENTRY vx_status VX_API_CALL vxuMinMaxLoc(vx_context context, vx_image inp
                         vx_array minLoc, vx_array maxLoc,
                         vx_scalar minCount, vx_scalar maxCount)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxMinMaxLocNode(graph, input, minVal, maxVal, minLoc, maxLoc, minCount, maxCount);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_MINMAXLOC, false,
+        { (vx_reference)input, (vx_reference)minVal, (vx_reference)maxVal, (vx_reference)minLoc, (vx_reference)maxLoc, (vx_reference)minCount, (vx_reference)maxCount }, { },
+        [&](vx_graph graph) { return vxMinMaxLocNode(graph, input, minVal, maxVal, minLoc, maxLoc, minCount, maxCount); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuConvertDepth(vx_context context, vx_image input, vx_image output, vx_enum policy, vx_int32 shift)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
+    // the scalar is an object argument of the cached graph so that its value can change from call to call
     vx_scalar sshift = vxCreateScalar(context, VX_TYPE_INT32, &shift);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxConvertDepthNode(graph, input, output, policy, sshift);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
+    vx_status status = vxuProcessNode(context, VX_KERNEL_CONVERTDEPTH, false,
+        { (vx_reference)input, (vx_reference)output, (vx_reference)sshift }, { (vx_uint64)policy },
+        [&](vx_graph graph) { return vxConvertDepthNode(graph, input, output, policy, sshift); });
     vxReleaseScalar(&sshift);
     return status;
 }
@@ -661,252 +475,83 @@ VX_API_ENTRY vx_status VX_API_CALL vxuCannyEdgeDetector(vx_context context, vx_i
                                vx_int32 gradient_size, vx_enum norm_type,
                                vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxCannyEdgeDetectorNode(graph, input, hyst, gradient_size, norm_type, output);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_CANNY_EDGE_DETECTOR, false,
+        { (vx_reference)input, (vx_reference)hyst, (vx_reference)output }, { (vx_uint64)gradient_size, (vx_uint64)norm_type },
+        [&](vx_graph graph) { return vxCannyEdgeDetectorNode(graph, input, hyst, gradient_size, norm_type, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuHalfScaleGaussian(vx_context context, vx_image input, vx_image output, vx_int32 kernel_size)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxHalfScaleGaussianNode(graph, input, output, kernel_size);
-        if (node)
-        {
-            status = vx_useImmediateBorderMode(context, node);
-            if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_HALFSCALE_GAUSSIAN, true,
+        { (vx_reference)input, (vx_reference)output }, { (vx_uint64)kernel_size },
+        [&](vx_graph graph) { return vxHalfScaleGaussianNode(graph, input, output, kernel_size); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuAnd(vx_context context, vx_image in1, vx_image in2, vx_image out)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxAndNode(graph, in1, in2, out);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_AND, false,
+        { (vx_reference)in1, (vx_reference)in2, (vx_reference)out }, { },
+        [&](vx_graph graph) { return vxAndNode(graph, in1, in2, out); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuOr(vx_context context, vx_image in1, vx_image in2, vx_image out)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxOrNode(graph, in1, in2, out);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_OR, false,
+        { (vx_reference)in1, (vx_reference)in2, (vx_reference)out }, { },
+        [&](vx_graph graph) { return vxOrNode(graph, in1, in2, out); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuXor(vx_context context, vx_image in1, vx_image in2, vx_image out)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxXorNode(graph, in1, in2, out);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_XOR, false,
+        { (vx_reference)in1, (vx_reference)in2, (vx_reference)out }, { },
+        [&](vx_graph graph) { return vxXorNode(graph, in1, in2, out); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuNot(vx_context context, vx_image input, vx_image out)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxNotNode(graph, input, out);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_NOT, false,
+        { (vx_reference)input, (vx_reference)out }, { },
+        [&](vx_graph graph) { return vxNotNode(graph, input, out); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuMultiply(vx_context context, vx_image in1, vx_image in2, vx_float32 scale, vx_enum overflow_policy, vx_enum rounding_policy, vx_image out)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
+    // the scalar is an object argument of the cached graph so that its value can change from call to call
     vx_scalar sscale = vxCreateScalar(context, VX_TYPE_FLOAT32, &scale);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxMultiplyNode(graph, in1, in2, sscale, overflow_policy, rounding_policy, out);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
+    vx_status status = vxuProcessNode(context, VX_KERNEL_MULTIPLY, false,
+        { (vx_reference)in1, (vx_reference)in2, (vx_reference)sscale, (vx_reference)out }, { (vx_uint64)overflow_policy, (vx_uint64)rounding_policy },
+        [&](vx_graph graph) { return vxMultiplyNode(graph, in1, in2, sscale, overflow_policy, rounding_policy, out); });
     vxReleaseScalar(&sscale);
     return status;
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuAdd(vx_context context, vx_image in1, vx_image in2, vx_enum policy, vx_image out)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxAddNode(graph, in1, in2, policy, out);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_ADD, false,
+        { (vx_reference)in1, (vx_reference)in2, (vx_reference)out }, { (vx_uint64)policy },
+        [&](vx_graph graph) { return vxAddNode(graph, in1, in2, policy, out); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuSubtract(vx_context context, vx_image in1, vx_image in2, vx_enum policy, vx_image out)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxSubtractNode(graph, in1, in2, policy, out);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_SUBTRACT, false,
+        { (vx_reference)in1, (vx_reference)in2, (vx_reference)out }, { (vx_uint64)policy },
+        [&](vx_graph graph) { return vxSubtractNode(graph, in1, in2, policy, out); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuWarpAffine(vx_context context, vx_image input, vx_matrix matrix, vx_enum type, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxWarpAffineNode(graph, input, matrix, type, output);
-        if (node)
-        {
-            status = vx_useImmediateBorderMode(context, node);
-            if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_WARP_AFFINE, true,
+        { (vx_reference)input, (vx_reference)matrix, (vx_reference)output }, { (vx_uint64)type },
+        [&](vx_graph graph) { return vxWarpAffineNode(graph, input, matrix, type, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuWarpPerspective(vx_context context, vx_image input, vx_matrix matrix, vx_enum type, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxWarpPerspectiveNode(graph, input, matrix, type, output);
-        if (node)
-        {
-            status = vx_useImmediateBorderMode(context, node);
-            if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_WARP_PERSPECTIVE, true,
+        { (vx_reference)input, (vx_reference)matrix, (vx_reference)output }, { (vx_uint64)type },
+        [&](vx_graph graph) { return vxWarpPerspectiveNode(graph, input, matrix, type, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuHarrisCorners(vx_context context, vx_image input,
@@ -918,46 +563,16 @@ VX_API_ENTRY vx_status VX_API_CALL vxuHarrisCorners(vx_context context, vx_image
         vx_array corners,
         vx_scalar num_corners)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxHarrisCornersNode(graph, input, strength_thresh, min_distance, sensitivity, gradient_size, block_size, corners, num_corners);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_HARRIS_CORNERS, false,
+        { (vx_reference)input, (vx_reference)strength_thresh, (vx_reference)min_distance, (vx_reference)sensitivity, (vx_reference)corners, (vx_reference)num_corners }, { (vx_uint64)gradient_size, (vx_uint64)block_size, vxuScalarValue(strength_thresh), vxuScalarValue(min_distance), vxuScalarValue(sensitivity) },
+        [&](vx_graph graph) { return vxHarrisCornersNode(graph, input, strength_thresh, min_distance, sensitivity, gradient_size, block_size, corners, num_corners); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuFastCorners(vx_context context, vx_image input, vx_scalar sens, vx_bool nonmax, vx_array corners, vx_scalar num_corners)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxFastCornersNode(graph, input, sens, nonmax, corners, num_corners);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_FAST_CORNERS, false,
+        { (vx_reference)input, (vx_reference)sens, (vx_reference)corners, (vx_reference)num_corners }, { (vx_uint64)nonmax, vxuScalarValue(sens) },
+        [&](vx_graph graph) { return vxFastCornersNode(graph, input, sens, nonmax, corners, num_corners); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuOpticalFlowPyrLK(vx_context context, vx_pyramid old_images,
@@ -971,135 +586,42 @@ VX_API_ENTRY vx_status VX_API_CALL vxuOpticalFlowPyrLK(vx_context context, vx_py
                               vx_scalar use_initial_estimate,
                               vx_size window_dimension)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxOpticalFlowPyrLKNode(graph, old_images, new_images, old_points, new_points_estimates, new_points,
-                termination,epsilon,num_iterations,use_initial_estimate,window_dimension);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_OPTICAL_FLOW_PYR_LK, false,
+        { (vx_reference)old_images, (vx_reference)new_images, (vx_reference)old_points, (vx_reference)new_points_estimates, (vx_reference)new_points, (vx_reference)epsilon, (vx_reference)num_iterations, (vx_reference)use_initial_estimate }, { (vx_uint64)termination, (vx_uint64)window_dimension, vxuScalarValue(epsilon), vxuScalarValue(num_iterations), vxuScalarValue(use_initial_estimate) },
+        [&](vx_graph graph) { return vxOpticalFlowPyrLKNode(graph, old_images, new_images, old_points, new_points_estimates, new_points, termination, epsilon, num_iterations, use_initial_estimate, window_dimension); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuRemap(vx_context context, vx_image input, vx_remap table, vx_enum policy, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxRemapNode(graph, input, table, policy, output);
-        if (node)
-        {
-            status = vx_useImmediateBorderMode(context, node);
-            if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_REMAP, true,
+        { (vx_reference)input, (vx_reference)table, (vx_reference)output }, { (vx_uint64)policy },
+        [&](vx_graph graph) { return vxRemapNode(graph, input, table, policy, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuWeightedAverage(vx_context context, vx_image img1, vx_scalar alpha, vx_image img2, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxWeightedAverageNode(graph, img1, alpha, img2, output);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_WEIGHTED_AVERAGE, false,
+        { (vx_reference)img1, (vx_reference)alpha, (vx_reference)img2, (vx_reference)output }, { vxuScalarValue(alpha) },
+        [&](vx_graph graph) { return vxWeightedAverageNode(graph, img1, alpha, img2, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuNonLinearFilter(vx_context context, vx_enum function, vx_image input, vx_matrix mask, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxNonLinearFilterNode(graph, function, input, mask, output);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_NON_LINEAR_FILTER, false,
+        { (vx_reference)input, (vx_reference)mask, (vx_reference)output }, { (vx_uint64)function },
+        [&](vx_graph graph) { return vxNonLinearFilterNode(graph, function, input, mask, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuLaplacianPyramid(vx_context context, vx_image input, vx_pyramid laplacian, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxLaplacianPyramidNode(graph, input, laplacian, output);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_LAPLACIAN_PYRAMID, false,
+        { (vx_reference)input, (vx_reference)laplacian, (vx_reference)output }, { },
+        [&](vx_graph graph) { return vxLaplacianPyramidNode(graph, input, laplacian, output); });
 }
 
 VX_API_ENTRY vx_status VX_API_CALL vxuLaplacianReconstruct(vx_context context, vx_pyramid laplacian, vx_image input, vx_image output)
 {
-    vx_status status = VX_FAILURE;
-    vx_graph graph = vxCreateGraph(context);
-    if (graph)
-    {
-		vxuSetGraphAffinityDefault(graph);
-		vx_node node = vxLaplacianReconstructNode(graph, laplacian, input, output);
-        if (node)
-        {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
-            vxReleaseNode(&node);
-        }
-        vxReleaseGraph(&graph);
-    }
-    return status;
+    return vxuProcessNode(context, VX_KERNEL_LAPLACIAN_RECONSTRUCT, false,
+        { (vx_reference)laplacian, (vx_reference)input, (vx_reference)output }, { },
+        [&](vx_graph graph) { return vxLaplacianReconstructNode(graph, laplacian, input, output); });
 }
\ No newline at end of file
@@ -71,6 +71,12 @@ THE SOFTWARE.
  */
 #define VX_MAX_STRING_BUFFER_SIZE_AMD 256
 
+/*! \brief Timeout value of <tt>\ref vxWaitGraphTicket</tt> to wait until the execution completes.
+ * \ingroup group_amd
+ * \ingroup group_graph
+ */
+#define VX_GRAPH_WAIT_FOREVER_AMD 0xFFFFFFFF
+
 /*! \brief The Neural Network activation functions vx_nn_activation_function_e extension.
  * \ingroup group_amd
  * \ingroup group_amd_nn
@@ -139,6 +145,10 @@ enum vx_context_attribute_amd_e
     VX_CONTEXT_CL_QUEUE_PROPERTIES = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_CONTEXT) + 0x06,
     /*! \brief HIP context. Use a <tt>\ref cl_context</tt> parameter.*/
     VX_CONTEXT_ATTRIBUTE_AMD_HIP_DEVICE = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_CONTEXT) + 0x07,
+    /*! \brief Host memory pool statistics (process-wide, read-only). Use a <tt>\ref AgoMemoryPoolInfo</tt> parameter.*/
+    VX_CONTEXT_ATTRIBUTE_AMD_MEMORY_POOL_INFO = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_CONTEXT) + 0x08,
+    /*! \brief CPU affinity of the threads created for graphs of the context. Use a <tt>\ref AgoCpuAffinityInfo</tt> parameter.*/
+    VX_CONTEXT_ATTRIBUTE_AMD_CPU_AFFINITY = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_CONTEXT) + 0x09,
 };
 
 /*! \brief The AMD kernel attributes list.
@@ -181,8 +191,19 @@ enum vx_graph_attribute_amd_e
     VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_INTERNAL_PROFILE = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x07,
     /*! \brief OpenCL command queue. Use a <tt>\ref cl_command_queue</tt> parameter.*/
     VX_GRAPH_ATTRIBUTE_AMD_OPENCL_COMMAND_QUEUE = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x08,
-    /*! \brief CPU num_threads to be used in RPP. Use a <tt>\ref vx_uint32</tt> parameter.*/
-    VX_GRAPH_ATTRIBUTE_AMD_CPU_NUM_THREADS = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x09
+    /*! \brief CPU num_threads to be used in RPP and for concurrent execution of independent CPU nodes (default 0: sequential). Use a <tt>\ref vx_uint32</tt> parameter.*/
+    VX_GRAPH_ATTRIBUTE_AMD_CPU_NUM_THREADS = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x09,
+    /*! \brief Run chains of element-wise and 3x3 CPU nodes one row tile at a time (default vx_false_e). Takes effect at vxVerifyGraph. Use a <tt>\ref vx_bool</tt> parameter.*/
+    VX_GRAPH_ATTRIBUTE_AMD_CPU_TILE_FUSION = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x0A,
+    /*! \brief Number of pipeline stages of CPU graphs (default 0: no pipelining). Consecutive <tt>\ref vxScheduleGraph</tt> calls overlap across stages:
+     * vxScheduleGraph returns once the first stage is done with the graph inputs and <tt>\ref vxWaitGraph</tt> waits for all scheduled frames.
+     * Takes effect at vxVerifyGraph. Use a <tt>\ref vx_uint32</tt> parameter.*/
+    VX_GRAPH_ATTRIBUTE_AMD_PIPELINE_STAGES = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x0B,
+    /*! \brief Directory of compiled graph cache (default empty: no cache). vxVerifyGraph skips the graph optimizer when the directory has
+     * the optimized graph for identical nodes, data and kernels, and saves the optimized graph otherwise. Use a char * path parameter.*/
+    VX_GRAPH_ATTRIBUTE_AMD_COMPILED_GRAPH_CACHE = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x0C,
+    /*! \brief Write captured profile entries as Chrome trace event JSON (needs VX_DIRECTIVE_AMD_ENABLE_PROFILE_CAPTURE). Use a <tt>char *</tt> fileName parameter with a size that includes the terminating NUL.*/
+    VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_TRACE = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x0D
 };
 
 /*! \brief The AMD node attributes list.
@@ -254,7 +275,9 @@ enum vx_array_attribute_amd_e
     /*! \brief TODO:. */
     VX_ARRAY_BUFFER = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_ARRAY) + 0x11,
     /*! \brief TODO:. */
-    VX_ARRAY_OFFSET_GPU = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_ARRAY) + 0x12
+    VX_ARRAY_OFFSET_GPU = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_ARRAY) + 0x12,
+    /*! \brief Number of times the array contents have been modified by the application or by a node. <tt>vx_uint32</tt>. */
+    VX_ARRAY_WRITE_COUNT = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_ARRAY) + 0x13
 };
 
 /*! \brief These enumerations are given to the \c vxDirective API to enable/disable
@@ -329,6 +352,8 @@ enum vx_scalar_attribute_amd_e
 {
     /*! \brief scalar's buffer */
     VX_SCALAR_BUFFER = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_SCALAR) + 0x1,
+    /*! \brief Number of times the scalar value has been modified by the application or by a node. <tt>vx_uint32</tt>. */
+    VX_SCALAR_WRITE_COUNT = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_SCALAR) + 0x2,
 };
 
 /*! \brief The multidimensional data object (Tensor).
@@ -410,6 +435,37 @@ typedef struct
     vx_uint64 buffer_write;
 } AgoGraphPerfInternalInfo;
 
+/*! \brief AMD data structure to get host memory pool statistics.
+ * \ingroup group_amd
+ **    Released host buffers are kept in size classes and reused by later allocations, up to
+ **    AGO_MEMORY_POOL_SIZE_MB megabytes (0 disables the pool). The pool is shared by all contexts of
+ **    the process and is given back to the system when the last context is released.
+ **    AGO_MEMORY_POOL_HUGE_PAGES=1 backs buffers of 2 MB and above with transparent huge pages on Linux.
+ */
+typedef struct
+{
+    vx_uint64 alloc_count;       // number of buffer allocations
+    vx_uint64 pool_hit_count;    // allocations served from released buffers kept in the pool
+    vx_uint64 bytes_in_use;      // bytes of buffers currently allocated
+    vx_uint64 bytes_in_use_peak; // highest value of bytes_in_use
+    vx_uint64 bytes_pooled;      // bytes of released buffers kept for reuse
+    vx_uint64 bytes_huge_pages;  // bytes of allocated and pooled buffers backed by huge pages
+} AgoMemoryPoolInfo;
+
+/*! \brief AMD data structure to specify the CPU affinity of a context.
+ * \ingroup group_amd
+ **    The graph scheduling threads, pipeline stage workers and CPU worker threads of the context are
+ **    bound to the selected CPUs, and host buffers are allocated while the allocating thread is bound
+ **    to them, so that their pages are first touched on the NUMA node of those CPUs. Threads of the
+ **    application that call vxProcessGraph are not moved. Set it before creating graphs; a numa_node
+ **    of -1 with an empty cpu_list removes the binding.
+ */
+typedef struct
+{
+    vx_int32 numa_node;        // NUMA node whose CPUs are used (-1 to use cpu_list)
+    vx_char cpu_list[256];     // CPU list like "0-7,16-23" used when numa_node is -1
+} AgoCpuAffinityInfo;
+
 /*! \brief AMD data structure to specify node merge rule.
  * \ingroup group_amd
  */
@@ -496,6 +552,28 @@ typedef vx_status(VX_CALLBACK *amd_kernel_gpu_buffer_update_callback_f)(
     vx_uint32 num                    // [input] number of parameters
 );
 
+/*! \brief AMD graph completion callback registered with <tt>\ref vxSetGraphCompletionCallback</tt>.
+ *   It is called from the thread that finished the execution, before the ticket is reported as complete,
+ *   so it shall return quickly and shall not wait for the graph.
+ * \ingroup group_amd
+ */
+typedef void(VX_CALLBACK *vx_graph_completion_callback_f)(
+    vx_graph graph,                  // [input] graph
+    vx_uint64 ticket,                // [input] ticket of the completed vxScheduleGraph
+    vx_status status,                // [input] status of the execution
+    void * user_data                 // [input] user_data passed to vxSetGraphCompletionCallback
+);
+
+/*! \brief AMD node task run by <tt>\ref vxRunNodeTasks</tt> for one index.
+ *   Tasks that run at the same time get different slots, e.g., to pick per-thread scratch memory.
+ * \ingroup group_amd
+ */
+typedef void(VX_CALLBACK *vx_node_task_f)(
+    void * user_data,                // [input] user_data passed to vxRunNodeTasks
+    vx_uint32 index,                 // [input] task index in [0, count)
+    vx_uint32 slot                   // [input] slot in [0, max_slots)
+);
+
 /*! \brief AMD data structure for use by VX_KERNEL_ATTRIBUTE_AMD_GPU_BUFFER_UPDATE_CALLBACK.
  * \ingroup group_amd
  */
@@ -600,6 +678,29 @@ extern "C"
      */
     VX_API_ENTRY vx_status VX_API_CALL vxGetModuleHandle(vx_node node, const vx_char *module, void **ptr);
 
+    /*!
+     * \brief Run the tasks of a CPU node on the worker threads of the context.
+     * \ingroup vx_framework_reference
+     * \ingroup group_amd
+     *
+     * This function is used by CPU kernels to run task(user_data, index, slot) for every index in [0, count)
+     * and returns when all of them are done. At most <tt>\ref VX_NODE_ATTRIBUTE_AMD_CPU_NUM_THREADS</tt> tasks run
+     * at the same time, including the calling thread, so kernels share the threads of the graph instead of
+     * creating their own. The tasks run one after another on the calling thread when it is 0 or 1.
+     *
+     * \param [in] node The node.
+     * \param [in] count The number of tasks.
+     * \param [in] max_slots The upper bound of tasks running at the same time, e.g., the number of scratch buffers
+     *   allocated by the kernel (0 for no bound other than the CPU threads of the graph).
+     * \param [in] task The task.
+     * \param [in] user_data Passed to the task.
+     * \return A \ref vx_status_e enumeration.
+     * \retval VX_SUCCESS No errors.
+     * \retval VX_ERROR_INVALID_REFERENCE if node is not valid.
+     * \retval VX_ERROR_INVALID_PARAMETERS if task is NULL.
+     */
+    VX_API_ENTRY vx_status VX_API_CALL vxRunNodeTasks(vx_node node, vx_uint32 count, vx_uint32 max_slots, vx_node_task_f task, void * user_data);
+
     /*!
      * \brief Set custom image format description.
      * \ingroup vx_framework_reference
@@ -651,6 +752,96 @@ extern "C"
      */
     VX_API_ENTRY vx_bool VX_API_CALL vxIsTensorAliased(vx_tensor tensorMaster, vx_size offset, vx_tensor tensor);
 
+    /*!
+     * \brief Register a ring of host buffers of an image or a tensor created from handle.
+     * \ingroup group_amd
+     * \ingroup vx_framework_reference
+     *
+     * The buffers of slot 0 become the current handles of the object, just like <tt>\ref vxSwapImageHandle</tt> or <tt>\ref vxSwapTensorHandle</tt>.
+     * Use <tt>\ref vxAdvanceHandleRing</tt> to switch to the next slot without any validation. The buffers remain owned by the application,
+     * so that a capture thread can fill the other slots while a graph processes the current slot.
+     *
+     * \param [in] ref The image or tensor created from handle with <tt>\ref VX_MEMORY_TYPE_HOST</tt>.
+     * \param [in] ptrs The <tt>num_slots * num_planes</tt> buffers: ptrs[slot * num_planes + plane]. Use NULL with num_slots 0 to unregister.
+     * \param [in] num_planes Number of planes of the image (1 for tensors).
+     * \param [in] num_slots Number of slots in the ring.
+     * \return A \ref vx_status_e enumeration.
+     * \retval VX_SUCCESS No errors.
+     * \retval VX_ERROR_INVALID_REFERENCE if reference is not valid.
+     * \retval VX_ERROR_INVALID_PARAMETERS if the object or the buffers don't match.
+     */
+    VX_API_ENTRY vx_status VX_API_CALL vxSetHandleRing(vx_reference ref, void * const ptrs[], vx_size num_planes, vx_uint32 num_slots);
+
+    /*!
+     * \brief Make the next slot of the ring registered with <tt>\ref vxSetHandleRing</tt> the current handles of an image or a tensor.
+     * \ingroup group_amd
+     * \ingroup vx_framework_reference
+     *
+     * Shall not be called while a graph that uses the object is running: call it before <tt>\ref vxProcessGraph</tt> or after
+     * <tt>\ref vxWaitGraph</tt>. A graph with <tt>\ref VX_GRAPH_ATTRIBUTE_AMD_PIPELINE_STAGES</tt> consumes its inputs in the first
+     * stage, so the ring of an input can also be advanced once <tt>\ref vxScheduleGraph</tt> returns, unless pipelining was disabled
+     * at vxVerifyGraph because the graph has delays or non-CPU nodes.
+     *
+     * \param [in] ref The image or tensor.
+     * \param [out] slot Optional: index of the new current slot.
+     * \return A \ref vx_status_e enumeration.
+     * \retval VX_SUCCESS No errors.
+     * \retval VX_ERROR_INVALID_REFERENCE if reference is not valid or has no ring.
+     */
+    VX_API_ENTRY vx_status VX_API_CALL vxAdvanceHandleRing(vx_reference ref, vx_uint32 * slot);
+
+    /*!
+     * \brief Schedule a graph like <tt>\ref vxScheduleGraph</tt> and return a ticket that identifies this execution.
+     * \ingroup group_amd
+     * \ingroup group_graph
+     *
+     * Tickets are numbered from 1 in schedule order. Several executions can be outstanding and each one can
+     * be waited for with <tt>\ref vxWaitGraphTicket</tt>.
+     *
+     * \param [in] graph The graph.
+     * \param [out] ticket Optional: ticket of the scheduled execution.
+     * \return A \ref vx_status_e enumeration.
+     * \retval VX_SUCCESS No errors.
+     * \retval VX_ERROR_INVALID_REFERENCE if graph is not valid.
+     */
+    VX_API_ENTRY vx_status VX_API_CALL vxScheduleGraphTicket(vx_graph graph, vx_uint64 * ticket);
+
+    /*!
+     * \brief Wait until a scheduled execution of a graph completes, with a bounded wait time.
+     * \ingroup group_amd
+     * \ingroup group_graph
+     *
+     * Unlike <tt>\ref vxWaitGraph</tt>, this doesn't wait for executions scheduled after the ticket and can be called
+     * from any thread. The status of the last AGO_GRAPH_TICKET_HISTORY (1000) completed executions is kept.
+     *
+     * \param [in] graph The graph.
+     * \param [in] ticket The ticket from <tt>\ref vxScheduleGraphTicket</tt> or 0 for the most recent schedule.
+     * \param [in] timeout_msec Maximum wait time in milliseconds: 0 to poll, \ref VX_GRAPH_WAIT_FOREVER_AMD to wait until complete.
+     * \return A \ref vx_status_e enumeration: status of the execution of the ticket.
+     * \retval VX_ERROR_GRAPH_SCHEDULED if the execution didn't complete within the timeout.
+     * \retval VX_ERROR_INVALID_VALUE if the ticket was never issued or its status is no longer available.
+     * \retval VX_ERROR_INVALID_REFERENCE if graph is not valid.
+     */
+    VX_API_ENTRY vx_status VX_API_CALL vxWaitGraphTicket(vx_graph graph, vx_uint64 ticket, vx_uint32 timeout_msec);
+
+    /*!
+     * \brief Register a callback invoked when each scheduled execution of a graph completes.
+     * \ingroup group_amd
+     * \ingroup group_graph
+     *
+     * The callback runs on the graph thread, on the last pipeline stage worker, or in the caller of
+     * <tt>\ref vxScheduleGraph</tt> when the graph executes synchronously.
+     *
+     * \param [in] graph The graph.
+     * \param [in] callback The callback or NULL to remove it.
+     * \param [in] user_data Passed to the callback.
+     * \return A \ref vx_status_e enumeration.
+     * \retval VX_SUCCESS No errors.
+     * \retval VX_ERROR_GRAPH_SCHEDULED if executions of the graph are pending.
+     * \retval VX_ERROR_INVALID_REFERENCE if graph is not valid.
+     */
+    VX_API_ENTRY vx_status VX_API_CALL vxSetGraphCompletionCallback(vx_graph graph, vx_graph_completion_callback_f callback, void * user_data);
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,6 +25,10 @@ THE SOFTWARE.
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <map>
 #include <deque>
 #include <string>
 #include <vector>
@@ -56,7 +60,9 @@ FILE *fpIn;
 #endif
 //#endif
 
-#define DECODE_BUFFER_POOL_SIZE    2  // number of buffers in decoder queue: keep it atleast 2
+#define DECODE_QUEUE_DEPTH_DEFAULT  2  // number of frames each stream can decode ahead: keep it atleast 2
+#define DECODE_QUEUE_DEPTH_MAX      64
+#define CONVERT_BAND_MIN_ROWS       64  // don't split a slice into bands shorter than this
 
 typedef struct {
     vx_uint32 size;
@@ -70,6 +76,184 @@ typedef struct {
     int64_t cpuTimestamp;
 } LoomIoMediaDecoderAuxInfo;
 
+//! \brief Single-producer single-consumer queue of decoded frames.
+//! TryPush() and Pop() don't take a lock while the queue is neither empty nor
+//! full; the mutex only parks a consumer that found it empty until the producer
+//! adds an item or Close() is called.
+template <typename T>
+class CFrameQueue {
+public:
+    CFrameQueue() : head{ 0 }, tail{ 0 }, sleepers{ 0 }, closed{ false } {}
+    void Initialize(size_t capacity) {
+        items.resize(capacity + 1);
+        head = 0;
+        tail = 0;
+        closed = false;
+    }
+    bool TryPush(const T& item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t next = (t + 1) % items.size();
+        if (next == head.load(std::memory_order_acquire))
+            return false;
+        items[t] = item;
+        tail.store(next, std::memory_order_release);
+        Wakeup();
+        return true;
+    }
+    bool TryPop(T& item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire))
+            return false;
+        item = items[h];
+        head.store((h + 1) % items.size(), std::memory_order_release);
+        return true;
+    }
+    // wait for the next item: returns false once the queue is closed
+    bool Pop(T& item) {
+        for (int spin = 0; spin < 64; spin++) {
+            if (closed.load())
+                return false;
+            if (TryPop(item))
+                return true;
+            std::this_thread::yield();
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        sleepers++;
+        bool found = false;
+        while (!closed.load() && !(found = TryPop(item)))
+            cv.wait(lock);
+        sleepers--;
+        return found;
+    }
+    void Close() {
+        std::unique_lock<std::mutex> lock(mutex);
+        closed = true;
+        cv.notify_all();
+    }
+
+private:
+    void Wakeup() {
+        // pairs with sleepers++ in Pop(): either the consumer sees the new tail or we see the sleeper
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepers.load()) {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.notify_all();
+        }
+    }
+
+    std::vector<T> items;
+    std::atomic<size_t> head, tail;
+    std::atomic<int> sleepers;
+    std::atomic<bool> closed;
+    std::mutex mutex;
+    std::condition_variable cv;
+};
+
+//! \brief Fork-join pool for the color conversion stage.
+//! ParallelFor() runs task(index) for every index in [0, count) and returns after
+//! all of them are done; the calling thread takes part in the work. The pool is
+//! shared by decoder nodes (see AcquireConvertPool()), so concurrent callers take
+//! turns instead of each one oversubscribing the cores.
+class CConvertThreadPool {
+public:
+    CConvertThreadPool(int numThreads);
+    ~CConvertThreadPool();
+    int NumThreads() const { return (int)workers.size() + 1; }
+    void ParallelFor(int count, const std::function<void(int)>& task);
+
+private:
+    void WorkerLoop();
+    void RunTasks();
+
+    std::vector<std::thread> workers;
+    std::mutex callMutex;   // one ParallelFor() at a time
+    std::mutex mutex;
+    std::condition_variable startCondition, doneCondition;
+    const std::function<void(int)> * currentTask;
+    int taskCount;
+    std::atomic<int> nextTask;
+    int busyWorkers;
+    unsigned long long generation;
+    bool quit;
+};
+
+CConvertThreadPool::CConvertThreadPool(int numThreads)
+    : currentTask{ nullptr }, taskCount{ 0 }, nextTask{ 0 }, busyWorkers{ 0 }, generation{ 0 }, quit{ false }
+{
+    for (int i = 1; i < numThreads; i++)
+        workers.emplace_back(&CConvertThreadPool::WorkerLoop, this);
+}
+
+CConvertThreadPool::~CConvertThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        quit = true;
+    }
+    startCondition.notify_all();
+    for (auto& worker : workers)
+        worker.join();
+}
+
+void CConvertThreadPool::RunTasks()
+{
+    for (int index = nextTask.fetch_add(1); index < taskCount; index = nextTask.fetch_add(1))
+        (*currentTask)(index);
+}
+
+void CConvertThreadPool::WorkerLoop()
+{
+    unsigned long long seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            startCondition.wait(lock, [&] { return quit || generation != seen; });
+            if (quit) return;
+            seen = generation;
+        }
+        RunTasks();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--busyWorkers == 0) doneCondition.notify_one();
+        }
+    }
+}
+
+void CConvertThreadPool::ParallelFor(int count, const std::function<void(int)>& task)
+{
+    if (workers.empty() || count <= 1) {
+        for (int index = 0; index < count; index++) task(index);
+        return;
+    }
+    std::lock_guard<std::mutex> call(callMutex);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentTask = &task;
+        taskCount = count;
+        nextTask = 0;
+        busyWorkers = (int)workers.size();
+        generation++;
+    }
+    startCondition.notify_all();
+    RunTasks();
+    std::unique_lock<std::mutex> lock(mutex);
+    doneCondition.wait(lock, [&] { return busyWorkers == 0; });
+}
+
+//! \brief Returns the conversion pool shared by all decoder nodes asking for the same number of threads.
+static std::shared_ptr<CConvertThreadPool> AcquireConvertPool(int numThreads)
+{
+    static std::mutex registryMutex;
+    static std::map<int, std::weak_ptr<CConvertThreadPool>> registry;
+    std::lock_guard<std::mutex> lock(registryMutex);
+    std::shared_ptr<CConvertThreadPool> pool = registry[numThreads].lock();
+    if (!pool) {
+        pool = std::make_shared<CConvertThreadPool>(numThreads);
+        registry[numThreads] = pool;
+    }
+    return pool;
+}
+
 class CLoomIoMediaDecoder {
 public:
     CLoomIoMediaDecoder(vx_node node, vx_uint32 mediaCount, const char inputMediaFiles[], vx_uint32 width, vx_uint32 height, vx_df_image format, vx_uint32 stride, vx_uint32 offset);
@@ -79,16 +263,16 @@ public:
     vx_status SetRepeatMode(vx_int32 bRepeat);
     vx_status SetEnableUserBufferGPUMode(vx_bool bEnable);
     vx_status SetDeviceId(vx_int32 device_id);
+    vx_status SetDecodeQueueDepth(vx_int32 depth);
+    vx_status SetConvertThreads(vx_int32 threads);
 
 protected:
-    typedef enum { cmd_abort, cmd_decode } command;
     void DecodeLoop(int mediaIndex);
-    void PushCommand(int mediaIndex, command cmd);
-    void PushAck(int mediaIndex, int ack);
-    command PopCommand(int mediaIndex);
-    int PopAck(int mediaIndex);
-    void PushFrame(int mediaIndex, AVFrame *frame);
-    AVFrame * PopFrame(int mediaIndex);
+    void ConvertLoop();
+    void RecycleFrames(std::vector<AVFrame *>& frames);
+    bool ConvertBand(AVFrame * frame, int mediaIndex, int band, uint8_t * const dst_data[4], const int dst_linesize[4]);
+    vx_status ConvertFrames(const std::vector<AVFrame *>& frames, int bufId);
+    vx_status ConvertSlices(const std::vector<AVFrame *>& frames, uint8_t * const dst_data[], const int dst_linesize[]);
 
 private:
     vx_node node;
@@ -101,7 +285,8 @@ private:
     int gpuStride, gpuOffset;
     int offset;
     AVPixelFormat outputFormat, decoderFormat;
-    vx_uint8 * decodeBuffer[DECODE_BUFFER_POOL_SIZE];
+    int decodeQueueDepth;   // frames each stream can decode ahead of ConvertLoop() and converted buffers
+    std::vector<vx_uint8 *> decodeBuffer;
     vx_bool m_enableUserBufferGPU;
 //#if DECODE_ENABLE_OPENCL
 #if ENABLE_OPENCL
@@ -109,7 +294,7 @@ private:
 #elif ENABLE_HIP
     hipDeviceProp_t hip_dev_prop;
 #endif
-    void* mem[DECODE_BUFFER_POOL_SIZE];
+    std::vector<void *> mem;
 //#endif
     std::vector<std::string> inputMediaFileName;
     std::vector<int> useVaapi;
@@ -118,14 +303,24 @@ private:
     std::vector<AVInputFormat *> inputMediaFormat;
     std::vector<AVCodecContext *> videoCodecContext;
     std::vector<SwsContext *> conversionContext;
-    std::vector<std::deque<AVFrame *>> queueFrames;
+    // conversion stage: slices whose rows map 1:1 are split into bands with one context each
+    int convertThreads;
+    std::shared_ptr<CConvertThreadPool> convertPool;
+    std::vector<std::vector<int>> bandRows;     // first row of each band and the slice height; empty for a single sws_scale call
+    std::vector<std::vector<SwsContext *>> bandContext;
     std::vector<int> videoStreamIndex;
-    std::vector<std::mutex> mutexCmd, mutexAck, mutexFrame;
-    std::vector<std::condition_variable> cvCmd, cvAck, cvFrame;
-    std::vector<std::deque<command>> queueCmd;
-    std::vector<std::deque<int>> queueAck;
+    // per stream: frames handed between DecodeLoop() and ConvertLoop(); nullptr in queueDecoded marks eof
+    std::vector<CFrameQueue<AVFrame *>> queueFree, queueDecoded;
+    std::vector<std::vector<AVFrame *>> framePool;
+    std::vector<AVFrame *> hwFrame;
     std::vector<std::thread *> thread;
-    std::vector<bool> eof;
+    std::vector<std::atomic<bool>> eof;   // set by DecodeLoop() when it stops decoding
+    // converted buffers handed between ConvertLoop() and ProcessFrame(); -1 in queueConverted marks eof
+    std::thread * convertThread;
+    CFrameQueue<int> queueConvertFree, queueConverted;
+    std::vector<uint8_t *> convertBuffer;   // host output planes of each converted buffer when not using GPU buffers
+    int bufferInUse;                        // converted buffer given to the graph by the last ProcessFrame()
+    bool convertEnded;
     std::vector<int> decodeFrameCount;
     int outputFrameCount;
     std::vector<int> LoopDec;
@@ -216,66 +411,16 @@ std::vector<std::string> split(const std::string& s, char delimiter)
    return tokens;
 }
 
-void CLoomIoMediaDecoder::PushCommand(int mediaIndex, CLoomIoMediaDecoder::command cmd)
-{
-    std::unique_lock<std::mutex> lock(mutexCmd[mediaIndex]);
-    queueCmd[mediaIndex].push_front(cmd);
-    cvCmd[mediaIndex].notify_one();
-}
-
-CLoomIoMediaDecoder::command CLoomIoMediaDecoder::PopCommand(int mediaIndex)
-{
-    std::unique_lock<std::mutex> lock(mutexCmd[mediaIndex]);
-    cvCmd[mediaIndex].wait(lock, [=] { return !queueCmd[mediaIndex].empty(); });
-    command cmd = std::move(queueCmd[mediaIndex].back());
-    queueCmd[mediaIndex].pop_back();
-    return cmd;
-}
-
-void CLoomIoMediaDecoder::PushAck(int mediaIndex, int ack)
-{
-    std::unique_lock<std::mutex> lock(mutexAck[mediaIndex]);
-    queueAck[mediaIndex].push_front(ack);
-    cvAck[mediaIndex].notify_one();
-}
-
-int CLoomIoMediaDecoder::PopAck(int mediaIndex)
-{
-    std::unique_lock<std::mutex> lock(mutexAck[mediaIndex]);
-    cvAck[mediaIndex].wait(lock, [=] { return !queueAck[mediaIndex].empty(); });
-    int ack = std::move(queueAck[mediaIndex].back());
-    queueAck[mediaIndex].pop_back();
-    return ack;
-}
-
-void CLoomIoMediaDecoder::PushFrame(int mediaIndex, AVFrame *frame)
-{
-    std::unique_lock<std::mutex> lock(mutexFrame[mediaIndex]);
-    queueFrames[mediaIndex].push_front(frame);
-    cvFrame[mediaIndex].notify_one();
-}
-
-AVFrame * CLoomIoMediaDecoder::PopFrame(int mediaIndex)
-{
-    std::unique_lock<std::mutex> lock(mutexFrame[mediaIndex]);
-    cvFrame[mediaIndex].wait(lock, [=] { return !queueFrames[mediaIndex].empty(); });
-    AVFrame *frame = std::move(queueFrames[mediaIndex].back());
-    queueFrames[mediaIndex].pop_back();
-    return frame;
-}
-
-
 CLoomIoMediaDecoder::CLoomIoMediaDecoder(vx_node node_, vx_uint32 mediaCount_, const char inputMediaFiles_[], vx_uint32 width_, vx_uint32 height_, vx_df_image format_, vx_uint32 stride_, vx_uint32 offset_)
     : node{ node_ }, inputMediaFiles(inputMediaFiles_), mediaCount{ static_cast<int>(mediaCount_) }, width{ static_cast<int>(width_) },
       height{ static_cast<int>(height_) }, format{ format_ }, gpuStride{ static_cast<int>(stride_) }, gpuOffset{ static_cast<int>(offset_) },
       decoderImageHeight{ static_cast<int>(height_ / ((mediaCount_ <= 1) ? 1 : mediaCount_)) }, outputFormat{ AV_PIX_FMT_UYVY422 }, outputFrameCount{ 0 },
       inputMediaFileName(mediaCount_), inputMediaFormatContext(mediaCount_), inputMediaFormat(mediaCount_),
-      videoCodecContext(mediaCount_), conversionContext(mediaCount_), videoStreamIndex(mediaCount_),
-      mutexCmd(mediaCount_), cvCmd(mediaCount_), queueCmd(mediaCount_), mutexAck(mediaCount_), cvAck(mediaCount_), queueAck(mediaCount_),
-      thread(mediaCount_), eof(mediaCount_), decodeFrameCount(mediaCount_), useVaapi(mediaCount_), mutexFrame(mediaCount_), cvFrame(mediaCount_), queueFrames(mediaCount_), 
+      videoCodecContext(mediaCount_), conversionContext(mediaCount_), bandRows(mediaCount_), bandContext(mediaCount_), videoStreamIndex(mediaCount_),
+      queueFree(mediaCount_), queueDecoded(mediaCount_), framePool(mediaCount_), hwFrame(mediaCount_),
+      thread(mediaCount_), eof(mediaCount_), decodeFrameCount(mediaCount_), useVaapi(mediaCount_),
       LoopDec(mediaCount_), hwDeviceID(mediaCount_) {
 
-    memset(decodeBuffer, 0, sizeof(decodeBuffer));
     for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++) {
         inputMediaFormat[mediaIndex] = NULL;
         videoCodecContext[mediaIndex] = NULL;
@@ -284,7 +429,11 @@ CLoomIoMediaDecoder::CLoomIoMediaDecoder(vx_node node_, vx_uint32 mediaCount_, c
         hwDeviceID[mediaIndex] = -1;    //use default device ID
     }
     m_enableUserBufferGPU = false;   // use host buffers by default
-    memset(mem, 0, sizeof(mem));
+    decodeQueueDepth = DECODE_QUEUE_DEPTH_DEFAULT;
+    convertThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    convertThread = nullptr;
+    bufferInUse = -1;
+    convertEnded = false;
 
 #if ENABLE_OPENCL
     cmdq = nullptr;
@@ -303,24 +452,37 @@ CLoomIoMediaDecoder::~CLoomIoMediaDecoder()
     std::cout << "Average Decode Time per frame (ms): " << totalDecodeTime.count() * 1000 / frameno << std::endl;
     std::cout << "Average Transfer Time per frame (ms): " << totalTransferTime.count() * 1000 / frameno << std::endl;
 #endif
-    // terminate the thread
+    // terminate the conversion stage first: it waits on the free buffers or on the decoded frames
+    if (convertThread) {
+        queueConvertFree.Close();
+        for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++)
+            queueDecoded[mediaIndex].Close();
+        convertThread->join();
+        delete convertThread;
+    }
+    // terminate the thread: closing the free queue stops DecodeLoop() at its next frame
     for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++) {
         if (thread[mediaIndex]) {
-            PushCommand(mediaIndex, cmd_abort);
-            while (!eof[mediaIndex]) {
-                if (PopAck(mediaIndex) < 0)
-                    break;
-            }
+            queueFree[mediaIndex].Close();
             thread[mediaIndex]->join();
             delete thread[mediaIndex];
         }
     }
+    for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++) {
+        for (auto& frame : framePool[mediaIndex])
+            av_frame_free(&frame);
+        if (hwFrame[mediaIndex]) av_frame_free(&hwFrame[mediaIndex]);
+        for (auto context : bandContext[mediaIndex])
+            sws_freeContext(context);
+    }
+    for (auto buffer : convertBuffer)
+        aligned_free(buffer);
 
     // release buffers
 #if ENABLE_OPENCL
     if (m_enableUserBufferGPU && cmdq) clReleaseCommandQueue(cmdq);
 
-    for (int i = 0; i < DECODE_BUFFER_POOL_SIZE; i++) {
+    for (size_t i = 0; i < mem.size(); i++) {
         if (m_enableUserBufferGPU && mem[i]) clReleaseMemObject((cl_mem)mem[i]);
         if (decodeBuffer[i]) aligned_free(decodeBuffer[i]);
     }
@@ -328,7 +490,7 @@ CLoomIoMediaDecoder::~CLoomIoMediaDecoder()
 #elif ENABLE_HIP
     if (m_enableUserBufferGPU) {
         hipError_t status;
-        for (int i = 0; i < DECODE_BUFFER_POOL_SIZE; i++) {
+        for (size_t i = 0; i < mem.size(); i++) {
             if (decodeBuffer[i]) {
                 status = hipHostFree(decodeBuffer[i]);
                 if (status != hipSuccess) {
@@ -374,6 +536,24 @@ vx_status CLoomIoMediaDecoder::SetEnableUserBufferGPUMode(vx_bool bEnable) {
     return VX_SUCCESS;
 }
 
+vx_status CLoomIoMediaDecoder::SetDecodeQueueDepth(vx_int32 depth) {
+    if (depth < 2 || depth > DECODE_QUEUE_DEPTH_MAX) {
+        vxAddLogEntry((vx_reference)node, VX_ERROR_INVALID_VALUE, "ERROR: decode queue depth %d is outside [2, %d]", depth, DECODE_QUEUE_DEPTH_MAX);
+        return VX_ERROR_INVALID_VALUE;
+    }
+    decodeQueueDepth = depth;
+    return VX_SUCCESS;
+}
+
+vx_status CLoomIoMediaDecoder::SetConvertThreads(vx_int32 threads) {
+    if (threads < 1) {
+        vxAddLogEntry((vx_reference)node, VX_ERROR_INVALID_VALUE, "ERROR: invalid number of conversion threads %d", threads);
+        return VX_ERROR_INVALID_VALUE;
+    }
+    convertThreads = threads;
+    return VX_SUCCESS;
+}
+
 vx_status CLoomIoMediaDecoder::SetDeviceId(vx_int32 device_id_mask) {
     // use default of device_id_mask is -1
     bool use_default = (device_id_mask == -1);
@@ -557,11 +737,34 @@ vx_status CLoomIoMediaDecoder::Initialize()
             printf("OK created sws context src: <%d %d %d> dst: <%d %d %d>\n", codecContext->width, codecContext->height, decoderFormat, width, decoderImageHeight, outputFormat);
         }
         conversionContext[mediaIndex] = swsContext;
+        // rows map 1:1 when there is no vertical scaling and chroma keeps its vertical subsampling:
+        // then the slice is converted in bands of whole chroma rows that don't depend on each other
+        const AVPixFmtDescriptor * srcDesc = av_pix_fmt_desc_get(decoderFormat);
+        const AVPixFmtDescriptor * dstDesc = av_pix_fmt_desc_get(outputFormat);
+        if (srcDesc && dstDesc && codecContext->height == decoderImageHeight && srcDesc->log2_chroma_h == dstDesc->log2_chroma_h) {
+            int align = 1 << dstDesc->log2_chroma_h;
+            int bands = std::max(1, std::min(convertThreads, decoderImageHeight / CONVERT_BAND_MIN_ROWS));
+            for (int band = 0; band < bands; band++)
+                bandRows[mediaIndex].push_back((decoderImageHeight * band / bands) & ~(align - 1));
+            bandRows[mediaIndex].push_back(decoderImageHeight);
+            for (int band = 0; swsContext && band < bands; band++) {
+                int rows = bandRows[mediaIndex][band + 1] - bandRows[mediaIndex][band];
+                SwsContext * context = sws_getContext(codecContext->width, rows, decoderFormat, width, rows, outputFormat, SWS_BILINEAR, NULL, NULL, NULL);
+                ERROR_CHECK_NULLPTR(context);
+                bandContext[mediaIndex].push_back(context);
+            }
+        }
+        else if (!swsContext) {
+            vxAddLogEntry((vx_reference)node, VX_ERROR_NOT_SUPPORTED, "ERROR: no conversion from format %d for %s", decoderFormat, mediaFileName);
+            return VX_ERROR_NOT_SUPPORTED;
+        }
         // debug log
         vxAddLogEntry((vx_reference)node, VX_SUCCESS, "INFO: reading %dx%d into slice#%d from %s", width, decoderImageHeight, mediaIndex, mediaFileName);
     }
 
     if (m_enableUserBufferGPU) {
+        mem.assign(decodeQueueDepth, nullptr);
+        decodeBuffer.assign(decodeQueueDepth, nullptr);
 #if ENABLE_OPENCL
         // allocate OpenCL decode buffers
         cl_context context = nullptr;
@@ -574,7 +777,7 @@ vx_status CLoomIoMediaDecoder::Initialize()
         cmdq = clCreateCommandQueue(context, device_id, 0, nullptr);
     #endif
         ERROR_CHECK_NULLPTR(cmdq);
-        for (int i = 0; i < DECODE_BUFFER_POOL_SIZE; i++) {
+        for (int i = 0; i < decodeQueueDepth; i++) {
             int buf_height = height;
             if (outputFormat == AV_PIX_FMT_NV12)  buf_height = height + (height>>1);
             mem[i] = clCreateBuffer(context, CL_MEM_READ_WRITE, gpuOffset + gpuStride * buf_height, nullptr, nullptr);
@@ -592,7 +795,7 @@ vx_status CLoomIoMediaDecoder::Initialize()
         vxAddLogEntry(NULL, VX_FAILURE, "ERROR: hipGetDeviceProperties(%d) => %d (failed)\n", hip_device, err);
     }
 
-    for (int i = 0; i < DECODE_BUFFER_POOL_SIZE; i++) {
+    for (int i = 0; i < decodeQueueDepth; i++) {
         int buf_height = height;
         if (outputFormat == AV_PIX_FMT_NV12)  buf_height = height + (height>>1);
         err = hipHostMalloc((void **)&decodeBuffer[i], gpuOffset + gpuStride * buf_height);
@@ -616,40 +819,240 @@ vx_status CLoomIoMediaDecoder::Initialize()
     }
 #endif
     }
+    else {
+        // host buffers the conversion stage fills while the graph processes the previous frame
+        size_t bufferSize = (size_t)stride * ((outputFormat == AV_PIX_FMT_NV12) ? (height + (height >> 1)) : height);
+        convertBuffer.assign(decodeQueueDepth, nullptr);
+        for (int i = 0; i < decodeQueueDepth; i++) {
+            convertBuffer[i] = aligned_alloc(bufferSize);
+            ERROR_CHECK_NULLPTR(convertBuffer[i]);
+        }
+    }
 
-    // start decoder thread and wait until first frame is decoded
+    // conversion threads are shared by all streams and by the decoder nodes using the same thread count
+    convertPool = AcquireConvertPool(convertThreads);
+    ERROR_CHECK_NULLPTR(convertPool);
+    bufferInUse = -1;
+    convertEnded = false;
+    queueConvertFree.Initialize(decodeQueueDepth);
+    queueConverted.Initialize(decodeQueueDepth + 1);  // room for the eof marker
+    for (int i = 0; i < decodeQueueDepth; i++)
+        queueConvertFree.TryPush(i);
+
+    // allocate the frames of each stream once: they cycle between queueFree and queueDecoded
     outputFrameCount = 0;
     for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++) {
         decodeFrameCount[mediaIndex] = 0;
         eof[mediaIndex] = false;
+        queueFree[mediaIndex].Initialize(decodeQueueDepth);
+        queueDecoded[mediaIndex].Initialize(decodeQueueDepth + 1);  // room for the eof marker
+        if (useVaapi[mediaIndex]) {
+            hwFrame[mediaIndex] = av_frame_alloc();
+            ERROR_CHECK_NULLPTR(hwFrame[mediaIndex]);
+        }
+        for (int i = 0; i < decodeQueueDepth; i++) {
+            AVFrame * frame = av_frame_alloc();
+            ERROR_CHECK_NULLPTR(frame);
+            framePool[mediaIndex].push_back(frame);
+            queueFree[mediaIndex].TryPush(frame);
+        }
     }
+    // start decoder threads: each one decodes ahead until its free frames run out
     for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++) {
         thread[mediaIndex] = new std::thread(&CLoomIoMediaDecoder::DecodeLoop, this, mediaIndex);
         ERROR_CHECK_NULLPTR(thread[mediaIndex]);
-        // initial ACK to inform producer for readiness
-        for (int i = 1; i < DECODE_BUFFER_POOL_SIZE; i++)
-            PushCommand(mediaIndex, cmd_decode);
     }
+    // start the conversion stage: it converts ahead until the converted buffers run out
+    convertThread = new std::thread(&CLoomIoMediaDecoder::ConvertLoop, this);
+    ERROR_CHECK_NULLPTR(convertThread);
 
     return VX_SUCCESS;
 }
 
 static int frame_num = 0;
 
-vx_status CLoomIoMediaDecoder::ProcessFrame(vx_image output, vx_array aux_data)
+void CLoomIoMediaDecoder::RecycleFrames(std::vector<AVFrame *>& frames)
+{
+    for (int mediaIndex = 0; mediaIndex < (int)frames.size(); mediaIndex++) {
+        if (frames[mediaIndex]) {
+            av_frame_unref(frames[mediaIndex]);
+            queueFree[mediaIndex].TryPush(frames[mediaIndex]);
+        }
+    }
+    frames.clear();
+}
+
+bool CLoomIoMediaDecoder::ConvertBand(AVFrame * frame, int mediaIndex, int band, uint8_t * const dst_data[4], const int dst_linesize[4])
 {
-    // wait until next frame is available
+    if (bandRows[mediaIndex].empty()) {
+        // vertical scaling or chroma resampling: the whole slice needs one sws_scale call
+        int ret = sws_scale(conversionContext[mediaIndex], frame->data, frame->linesize, 0, frame->height, dst_data, dst_linesize);
+        if (ret < decoderImageHeight) {
+            fprintf(stderr, "Error in output image scaling using sws_scale <%d>\n", ret);
+            return false;
+        }
+        return true;
+    }
+    // rows map 1:1, so the band is converted independently from its neighbors
+    int y0 = bandRows[mediaIndex][band], y1 = bandRows[mediaIndex][band + 1];
+    const AVPixFmtDescriptor * srcDesc = av_pix_fmt_desc_get(decoderFormat);
+    const AVPixFmtDescriptor * dstDesc = av_pix_fmt_desc_get(outputFormat);
+    const uint8_t * src[4] = { 0 };
+    uint8_t * dst[4] = { 0 };
+    for (int plane = 0; plane < 4; plane++) {
+        int srcShift = (plane == 1 || plane == 2) ? srcDesc->log2_chroma_h : 0;
+        int dstShift = (plane == 1 || plane == 2) ? dstDesc->log2_chroma_h : 0;
+        if (frame->data[plane]) src[plane] = frame->data[plane] + (y0 >> srcShift) * frame->linesize[plane];
+        if (dst_data[plane]) dst[plane] = dst_data[plane] + (y0 >> dstShift) * dst_linesize[plane];
+    }
+    if (!conversionContext[mediaIndex]) {
+        // decoder already produces the output format: copy the rows
+        int planes = av_pix_fmt_count_planes(outputFormat);
+        for (int plane = 0; plane < planes; plane++) {
+            int shift = (plane == 1 || plane == 2) ? dstDesc->log2_chroma_h : 0;
+            int bytes = av_image_get_linesize(outputFormat, width, plane);
+            for (int y = y0 >> shift; y < (y1 >> shift); y++)
+                memcpy(dst[plane] + (y - (y0 >> shift)) * dst_linesize[plane], src[plane] + (y - (y0 >> shift)) * frame->linesize[plane], bytes);
+        }
+        return true;
+    }
+    int ret = sws_scale(bandContext[mediaIndex][band], src, frame->linesize, 0, y1 - y0, dst, dst_linesize);
+    if (ret < y1 - y0) {
+        fprintf(stderr, "Error in output image scaling using sws_scale <%d>\n", ret);
+        return false;
+    }
+    return true;
+}
+
+vx_status CLoomIoMediaDecoder::ConvertFrames(const std::vector<AVFrame *>& frames, int bufId)
+{
+    // locate the slices of every stream in converted buffer bufId
+    std::vector<uint8_t *> dst_data(mediaCount * 4, nullptr);
+    std::vector<int> dst_linesize(mediaCount * 4, 0);
+    if (m_enableUserBufferGPU) {
+#if ENABLE_OPENCL || ENABLE_HIP
+        // convert all slices into the host view of the GPU buffer
+        int mapHeight = (outputFormat == AV_PIX_FMT_NV12)? (decoderImageHeight + (decoderImageHeight>>1)) : decoderImageHeight;
+        size_t mapSize = (size_t)mediaCount * mapHeight * gpuStride;
+#if ENABLE_OPENCL
+        cl_int err;
+        uint8_t * base = (uint8_t *)clEnqueueMapBuffer(cmdq, (cl_mem)mem[bufId], CL_TRUE, CL_MAP_WRITE_INVALIDATE_REGION, gpuOffset, mapSize, 0, NULL, NULL, &err);
+        if (err) {
+            vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: clEnqueueMapBuffer(buf[%d]) failed (%d)\n", bufId, err);
+            return VX_FAILURE;
+        }
+#else
+        uint8_t * base = decodeBuffer[bufId] + gpuOffset;
+#endif
+        for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++) {
+            uint8_t * slice = base + (size_t)mediaIndex * mapHeight * gpuStride;
+            dst_data[mediaIndex * 4] = slice;
+            dst_linesize[mediaIndex * 4] = gpuStride;
+            if (outputFormat == AV_PIX_FMT_NV12) {
+                dst_data[mediaIndex * 4 + 1] = slice + decoderImageHeight * gpuStride;
+                dst_linesize[mediaIndex * 4 + 1] = gpuStride;
+            }
+        }
+        vx_status status = ConvertSlices(frames, dst_data.data(), dst_linesize.data());
+#if ENABLE_OPENCL
+        err = clEnqueueUnmapMemObject(cmdq, (cl_mem)mem[bufId], base, 0, NULL, NULL);
+        if (!err) err = clFinish(cmdq);
+        if (err) {
+            vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: clEnqueueUnmapMemObject(buf[%d]) failed (%d)\n", bufId, err);
+            return VX_FAILURE;
+        }
+#else
+        if (!hip_dev_prop.canMapHostMemory) {
+            hipError_t err = hipMemcpyHtoD((void *)((uint8_t *)mem[bufId] + gpuOffset), base, mapSize);
+            if (err != hipSuccess) {
+                vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: hipMemcpyHtoD(buf[%d]) failed (%d)\n", bufId, err);
+                return VX_FAILURE;
+            }
+        }
+#endif
+        return status;
+#else
+        return VX_ERROR_NOT_SUPPORTED;
+#endif
+    }
+    // host buffer holds the output planes one after the other
+    uint8_t * base = convertBuffer[bufId];
     for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++) {
-        int ack = PopAck(mediaIndex);
-        if ((ack < 0) || eof[mediaIndex]) {
-            // nothing to process, so abandon the graph execution
-            return VX_ERROR_GRAPH_ABANDONED;
+        dst_data[mediaIndex * 4] = base + (size_t)mediaIndex * decoderImageHeight * stride;
+        dst_linesize[mediaIndex * 4] = stride;
+        if (outputFormat == AV_PIX_FMT_NV12) {
+            dst_data[mediaIndex * 4 + 1] = base + (size_t)height * stride + (size_t)mediaIndex * (decoderImageHeight >> 1) * stride;
+            dst_linesize[mediaIndex * 4 + 1] = stride;
         }
     }
-    // issue command to decode next frame
+    return ConvertSlices(frames, dst_data.data(), dst_linesize.data());
+}
+
+vx_status CLoomIoMediaDecoder::ConvertSlices(const std::vector<AVFrame *>& frames, uint8_t * const dst_data[], const int dst_linesize[])
+{
+    // one task per band of every slice: all streams are converted together on the conversion threads
+    std::vector<std::pair<int, int>> tasks;
     for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++) {
-        PushCommand(mediaIndex, cmd_decode);
+        int bands = bandRows[mediaIndex].empty() ? 1 : (int)bandRows[mediaIndex].size() - 1;
+        for (int band = 0; band < bands; band++)
+            tasks.push_back(std::make_pair(mediaIndex, band));
+    }
+    std::atomic<bool> failed{ false };
+    convertPool->ParallelFor((int)tasks.size(), [&](int index) {
+        int mediaIndex = tasks[index].first;
+        if (!ConvertBand(frames[mediaIndex], mediaIndex, tasks[index].second, &dst_data[mediaIndex * 4], &dst_linesize[mediaIndex * 4]))
+            failed = true;
+    });
+#if DUMP_DECODED_FRAME
+    if (fpIn) {
+        for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++) {
+            fwrite(dst_data[mediaIndex * 4], 1, decoderImageHeight * dst_linesize[mediaIndex * 4], fpIn);
+            if (outputFormat == AV_PIX_FMT_NV12)
+                fwrite(dst_data[mediaIndex * 4 + 1], 1, (decoderImageHeight >> 1) * dst_linesize[mediaIndex * 4 + 1], fpIn);
+        }
+    }
+#endif
+    return failed ? VX_FAILURE : VX_SUCCESS;
+}
+
+void CLoomIoMediaDecoder::ConvertLoop()
+{
+    // each iteration converts one frame of every stream into a free converted buffer,
+    // so the conversion of the next output overlaps the graph processing the current one
+    std::vector<AVFrame *> frames;
+    for (int bufId = -1; queueConvertFree.Pop(bufId);) {
+        frames.assign(mediaCount, nullptr);
+        bool ended = false;
+        for (int mediaIndex = 0; mediaIndex < mediaCount && !ended; mediaIndex++) {
+            // frames decoded before eof are drained first: the stream ends at the nullptr marker
+            if (!queueDecoded[mediaIndex].Pop(frames[mediaIndex]) || !frames[mediaIndex])
+                ended = true;
+        }
+        vx_status status = ended ? VX_ERROR_GRAPH_ABANDONED : ConvertFrames(frames, bufId);
+        RecycleFrames(frames);
+        if (status != VX_SUCCESS)
+            break;
+        queueConverted.TryPush(bufId);
+    }
+    // mark eof for ProcessFrame()
+    queueConverted.TryPush(-1);
+}
+
+vx_status CLoomIoMediaDecoder::ProcessFrame(vx_image output, vx_array aux_data)
+{
+    // the buffer given to the graph by the previous call goes back to the conversion stage
+    if (bufferInUse >= 0) {
+        queueConvertFree.TryPush(bufferInUse);
+        bufferInUse = -1;
     }
+    // wait until next converted frame is available
+    int bufId = -1;
+    if (convertEnded || !queueConverted.Pop(bufId) || bufId < 0) {
+        // nothing to process, so abandon the graph execution
+        convertEnded = true;
+        return VX_ERROR_GRAPH_ABANDONED;
+    }
+    bufferInUse = bufId;
     // set aux data
     if (aux_data) {
         // construct aux data
@@ -662,64 +1065,31 @@ vx_status CLoomIoMediaDecoder::ProcessFrame(vx_image output, vx_array aux_data)
         ERROR_CHECK_STATUS(vxTruncateArray(aux_data, 0));
         ERROR_CHECK_STATUS(vxAddArrayItems(aux_data, sizeof(haux), &haux, sizeof(uint8_t)));
     }
+    outputFrameCount++;
     if (m_enableUserBufferGPU) {
-        // set the GPU buffer pointer for output buffer
-        int bufId = outputFrameCount % DECODE_BUFFER_POOL_SIZE; outputFrameCount++;
+        // set the GPU buffer pointer for output buffer: the graph uses it until the next call
 #if ENABLE_OPENCL
         ERROR_CHECK_STATUS(vxSetImageAttribute(output, VX_IMAGE_ATTRIBUTE_AMD_OPENCL_BUFFER, &mem[bufId], sizeof(void*)));
 #elif ENABLE_HIP
         ERROR_CHECK_STATUS(vxSetImageAttribute(output, VX_IMAGE_ATTRIBUTE_AMD_HIP_BUFFER, &mem[bufId], sizeof(void*)));
 #endif
-
     } else {
-        for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++) {
-            AVFrame *frame = PopFrame(mediaIndex);       // assuming only one stream to decode
-            if (conversionContext[mediaIndex] != NULL) {
-                vx_rectangle_t rect = { 0, (vx_uint32)(mediaIndex * decoderImageHeight), (vx_uint32)width, (vx_uint32)(mediaIndex * decoderImageHeight + decoderImageHeight) };
-                vx_map_id map_id, map_id1;
-                vx_imagepatch_addressing_t addr = {0};
-                uint8_t * ptr = nullptr;
-
-                uint8_t *dst_data[4] = {0};
-                int dst_linesize[4] = {0};
-                ERROR_CHECK_STATUS(vxMapImagePatch(output, &rect, 0, &map_id, &addr, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
-                dst_data[0] = ptr;
-                dst_linesize[0] = addr.stride_y;
-                if (outputFormat == AV_PIX_FMT_NV12) {
-                    uint8_t *ptr_uv = nullptr;
-                    vx_imagepatch_addressing_t addr1 = {0};
-                    ERROR_CHECK_STATUS(vxMapImagePatch(output, &rect, 1, &map_id1, &addr1, (void **)&ptr_uv, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
-                    dst_data[1] = ptr_uv;
-                    dst_linesize[1]  = addr1.stride_y;
-                }
-                // do sws_scale
-                int ret = sws_scale(conversionContext[mediaIndex], frame->data, frame->linesize, 0, frame->height, dst_data, dst_linesize);
-                if (ret < decoderImageHeight) {
-                    fprintf(stderr, "Error in output image scaling using sws_scale <%d>\n", ret);
-                    return VX_FAILURE;
-                }
-                #if DUMP_DECODED_FRAME
-                if (fpIn){
-                    fwrite(dst_data[0], 1, decoderImageHeight*dst_linesize[0], fpIn);
-                    if (outputFormat == AV_PIX_FMT_NV12)
-                        fwrite(dst_data[1], 1, (decoderImageHeight>>1)*dst_linesize[1], fpIn);
-                }
-                #endif
-                // commit image patch
-                ERROR_CHECK_STATUS(vxUnmapImagePatch(output, map_id));
-                if (outputFormat == AV_PIX_FMT_NV12) ERROR_CHECK_STATUS(vxUnmapImagePatch(output, map_id1));
-            } else {
-                // copy AV frame to output
-                vx_rectangle_t rect = { 0, (vx_uint32)(mediaIndex * decoderImageHeight), (vx_uint32)width, (vx_uint32)decoderImageHeight };
-                vx_rectangle_t rect1 = { 0, (vx_uint32)(mediaIndex * (decoderImageHeight>>1)), (vx_uint32)width, (vx_uint32)(decoderImageHeight) }; // UV
-                vx_imagepatch_addressing_t addr = { 0 };
-                addr.stride_x = stride / width;
-                addr.stride_y = stride;
-                ERROR_CHECK_STATUS(vxCopyImagePatch(output, &rect, 0, &addr, frame->data[0], VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
-                ERROR_CHECK_STATUS(vxCopyImagePatch(output, &rect1, 1, &addr, frame->data[1], VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
-            }
-            av_frame_free(&frame);
+        // copy the converted planes into the output image
+        vx_rectangle_t rect = { 0, 0, (vx_uint32)width, (vx_uint32)height };
+        int planes = (outputFormat == AV_PIX_FMT_NV12) ? 2 : 1;
+        const uint8_t * src = convertBuffer[bufId];
+        for (int plane = 0; plane < planes; plane++) {
+            vx_map_id map_id;
+            vx_imagepatch_addressing_t addr = { 0 };
+            uint8_t * ptr = nullptr;
+            ERROR_CHECK_STATUS(vxMapImagePatch(output, &rect, plane, &map_id, &addr, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+            int rows = plane ? (height >> 1) : height;
+            for (int y = 0; y < rows; y++, src += stride)
+                memcpy(ptr + (size_t)y * addr.stride_y, src, stride);
+            ERROR_CHECK_STATUS(vxUnmapImagePatch(output, map_id));
         }
+        queueConvertFree.TryPush(bufId);
+        bufferInUse = -1;
     }
     frame_num++;
     return VX_SUCCESS;
@@ -731,7 +1101,8 @@ void CLoomIoMediaDecoder::DecodeLoop(int mediaIndex)
     AVPacket avpkt = { 0 };
     int status;
 
-    for (command cmd; !eof[mediaIndex] && ((cmd = PopCommand(mediaIndex)) != cmd_abort);) {
+    // each iteration decodes into a frame recycled by ConvertLoop(), so decoding runs up to decodeQueueDepth frames ahead
+    for (AVFrame *frame = nullptr; !eof[mediaIndex] && queueFree[mediaIndex].Pop(frame);) {
         int gotPicture = 0;
         while (!gotPicture && !eof[mediaIndex]) 
         {
@@ -753,7 +1124,7 @@ void CLoomIoMediaDecoder::DecodeLoop(int mediaIndex)
                         vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: Sending packet to video decoder");
                     }
                     eof[mediaIndex] = true;
-                    PushAck(mediaIndex, -1);
+                    queueDecoded[mediaIndex].TryPush(nullptr);
                     av_packet_unref(&avpkt);
 
                     return;
@@ -766,29 +1137,25 @@ void CLoomIoMediaDecoder::DecodeLoop(int mediaIndex)
                     status = avcodec_send_packet(videoCodecContext[mediaIndex], &avpkt);
                     if (status < 0) {
                         vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: Sending packet to video decoder status:%x", AVERROR(status));
+                        eof[mediaIndex] = true;
+                        queueDecoded[mediaIndex].TryPush(nullptr);
+                        av_packet_unref(&avpkt);
                         return;
                     }
                    break;
                 }
             }
-            AVFrame *frame = NULL, *sw_frame = NULL, *tmp_frame = NULL;
-            if (!(frame = av_frame_alloc()) || !(sw_frame = av_frame_alloc())) {
-                vxAddLogEntry((vx_reference)node, VX_ERROR_NO_MEMORY, "ERROR: Can not alloc frame(%d)");
-                return;
-            }
-            int status = avcodec_receive_frame(videoCodecContext[mediaIndex], frame);
+            // vaapi frames are received into hwFrame and transferred into the recycled frame
+            AVFrame *decodedFrame = useVaapi[mediaIndex] ? hwFrame[mediaIndex] : frame;
+            int status = avcodec_receive_frame(videoCodecContext[mediaIndex], decodedFrame);
 
             if (status == AVERROR(EAGAIN)) {
                 // output not available at this time: continue to send the next frame.
-                av_frame_free(&frame);
-                av_frame_free(&sw_frame);
                 continue;
             } else if (status < 0) {
                 vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: avcodec_receive_frame() failed (%x)\n", AVERROR(status));
                 eof[mediaIndex] = true;
-                PushAck(mediaIndex, -1);
-                av_frame_free(&frame);
-                av_frame_free(&sw_frame);
+                queueDecoded[mediaIndex].TryPush(nullptr);
                 return;
             }
             gotPicture = true;
@@ -802,133 +1169,27 @@ void CLoomIoMediaDecoder::DecodeLoop(int mediaIndex)
 #if ENABLE_PERF_MEASURE
                     startTime = std::chrono::high_resolution_clock::now();
 #endif
-                if ((status = av_hwframe_transfer_data(sw_frame, frame, 0)) < 0) {
+                status = av_hwframe_transfer_data(frame, decodedFrame, 0);
+                av_frame_unref(decodedFrame);
+                if (status < 0) {
                     vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: avcodec_receive_frame() failed (%x)\n", AVERROR(status));
                     eof[mediaIndex] = true;
-                    PushAck(mediaIndex, -1);
-                    av_frame_free(&frame);
-                    av_frame_free(&sw_frame);
+                    queueDecoded[mediaIndex].TryPush(nullptr);
                     return;
                 }
 #if ENABLE_PERF_MEASURE           
                 endTime = std::chrono::high_resolution_clock::now();
                 totalTransferTime += endTime - startTime;
 #endif
-
-                tmp_frame = sw_frame;
-                av_frame_free(&frame);
-            } else {
-                tmp_frame = frame;
-                av_frame_free(&sw_frame);
-            }
-            if (m_enableUserBufferGPU) {
-            // do sw_scale for destination format
-                int bufId = decodeFrameCount[mediaIndex] % DECODE_BUFFER_POOL_SIZE;
-                if (conversionContext[mediaIndex] != NULL) {
-                    uint8_t * ptr = nullptr;
-                    int mapHeight = (outputFormat == AV_PIX_FMT_NV12)? (decoderImageHeight + (decoderImageHeight>>1)) : decoderImageHeight;
-#if ENABLE_OPENCL
-                    void * mapped_ptr = nullptr;
-                    cl_int err;
-                    mapped_ptr = (void *)clEnqueueMapBuffer(cmdq, (cl_mem)mem[bufId], CL_TRUE, CL_MAP_WRITE_INVALIDATE_REGION, gpuOffset + mediaIndex * mapHeight * gpuStride, mapHeight * gpuStride, 0, NULL, NULL, &err);
-                    if(err) {
-                        fprintf(stderr,"map output for sw_scale: clEnqueueMapBuffer failed (%d)", err);
-                        continue;
-                    }
-                    uint8_t *dst_data[4] = {0};
-                    int dst_linesize[4] = {0};
-                    dst_data[0] = (uint8_t *)mapped_ptr;
-                    dst_linesize[0] = gpuStride;
-                    if (outputFormat == AV_PIX_FMT_NV12) {
-                        dst_data[1] = (uint8_t *)mapped_ptr + decoderImageHeight*gpuStride;
-                        dst_linesize[1]  = gpuStride;
-                    }
-                    // do sws_scale
-                    int ret = sws_scale(conversionContext[mediaIndex], tmp_frame->data, tmp_frame->linesize, 0, tmp_frame->height, dst_data, dst_linesize);
-                    if (ret < decoderImageHeight) {
-                        fprintf(stderr, "Error in output image scaling using sws_scale\n");
-                        continue;
-                    }
-                    #if DUMP_DECODED_FRAME
-                    if (fpIn){
-                        fwrite(dst_data[0], 1, decoderImageHeight*dst_linesize[0], fpIn);
-                        if (outputFormat == AV_PIX_FMT_NV12)
-                            fwrite(dst_data[1], 1, (decoderImageHeight>>1)*dst_linesize[1], fpIn);
-                    }
-                    #endif
-                    // commit image patch
-                    err = clEnqueueUnmapMemObject(cmdq, (cl_mem)mem[bufId], mapped_ptr, 0, NULL, NULL);
-                    if(err) {
-                        fprintf(stderr,"map output for sw_scale: clEnqueueMapBuffer failed (%d)", err);
-                        continue;
-                    }
-                    err = clFinish(cmdq);
-                    if(err) {
-                        fprintf(stderr,"map output for sw_scale: clFinish failed (%d)",  err);
-                    }
-#elif ENABLE_HIP
-                    uint8_t *dst_data[4] = {0};
-                    int dst_linesize[4] = {0};
-                    dst_data[0] = decodeBuffer[bufId];
-                    dst_linesize[0] = gpuStride;
-                    if (outputFormat == AV_PIX_FMT_NV12) {
-                        dst_data[1] = decodeBuffer[bufId] + decoderImageHeight * gpuStride;
-                        dst_linesize[1]  = gpuStride;
-                    }
-                    // do sws_scale
-                    int ret = sws_scale(conversionContext[mediaIndex], tmp_frame->data, tmp_frame->linesize, 0, tmp_frame->height, dst_data, dst_linesize);
-                    if (ret < decoderImageHeight) {
-                        fprintf(stderr, "Error in output image scaling using sws_scale\n");
-                        continue;
-                    }
-                    #if DUMP_DECODED_FRAME
-                    if (fpIn) {
-                        fwrite(dst_data[0], 1, decoderImageHeight * dst_linesize[0], fpIn);
-                        if (outputFormat == AV_PIX_FMT_NV12)
-                            fwrite(dst_data[1], 1, (decoderImageHeight >> 1) * dst_linesize[1], fpIn);
-                    }
-                    #endif
-                    if (!hip_dev_prop.canMapHostMemory) {
-                        hipError_t err = hipMemcpyHtoD((void *)((uint8_t *)mem[bufId] + gpuOffset + mediaIndex * mapHeight * gpuStride), decodeBuffer[bufId], mapHeight * gpuStride);
-                        if (err != hipSuccess) {
-                            vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: hipMemcpyHtoD(buf[%d], slice[%d]) failed (%d)\n", bufId, mediaIndex, err);
-                            continue;
-                        }
-                    }
-#endif
-
-                } else {
-                    // copy AV frame to output
-#if ENABLE_OPENCL
-                    cl_int err = clEnqueueWriteBuffer(cmdq, (cl_mem)mem[bufId], CL_TRUE, gpuOffset + mediaIndex * decoderImageHeight * gpuStride, decoderImageHeight * gpuStride, tmp_frame->data, 0, nullptr, nullptr);
-                    if (err < 0) {
-                        vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: clEnqueueWriteBuffer(buf[%d], slice[%d]) failed (%d)\n", bufId, mediaIndex, err);
-                        continue;
-                    }
-                    clFinish(cmdq);
-#elif ENABLE_HIP
-                    if (!hip_dev_prop.canMapHostMemory) {
-                        hipError_t err = hipMemcpyHtoD((void *)((uint8_t *)mem[bufId] + gpuOffset + mediaIndex * decoderImageHeight * gpuStride), tmp_frame->data, decoderImageHeight * gpuStride);
-                        if (err != hipSuccess) {
-                            vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: hipMemcpyHtoD(buf[%d], slice[%d]) failed (%d)\n", bufId, mediaIndex, err);
-                            continue;
-                        }
-                    }
-#endif
-                }
-            } else {
-                PushFrame(mediaIndex, tmp_frame);
             }
-            // update decoded frame count and send ACK
-            decodeFrameCount[mediaIndex]++;
-            PushAck(mediaIndex, 0);
         }
-
+        // update decoded frame count and hand the frame over to ConvertLoop()
+        decodeFrameCount[mediaIndex]++;
+        queueDecoded[mediaIndex].TryPush(frame);
     }
-end:
-    // mark eof and send ACK
+    // mark eof for ConvertLoop()
     eof[mediaIndex] = true;
-    PushAck(mediaIndex, -1);
+    queueDecoded[mediaIndex].TryPush(nullptr);
     av_packet_unref(&avpkt);
 }
 
@@ -991,6 +1252,16 @@ static vx_status VX_CALLBACK amd_media_decode_initialize(vx_node node, const vx_
     if (parameters[5]) {
         ERROR_CHECK_STATUS(decoder->SetDeviceId(device_id));
     }
+    // number of frames decoded ahead per stream (default 2)
+    const char * depth = getenv("AMD_MEDIA_DECODE_QUEUE_DEPTH");
+    if (depth) {
+        ERROR_CHECK_STATUS(decoder->SetDecodeQueueDepth(atoi(depth)));
+    }
+    // number of threads converting decoded frames into the output (default: all cores, shared by the decoder nodes)
+    const char * threads = getenv("AMD_MEDIA_CONVERT_THREADS");
+    if (threads) {
+        ERROR_CHECK_STATUS(decoder->SetConvertThreads(atoi(threads)));
+    }
     ERROR_CHECK_STATUS(decoder->Initialize());
 
     return VX_SUCCESS;
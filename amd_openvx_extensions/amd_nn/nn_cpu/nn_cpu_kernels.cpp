@@ -0,0 +1,462 @@
+/*
+Copyright (c) 2017 - 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "nn_cpu_kernels.h"
+#include <vx_ext_amd.h>
+#include <smmintrin.h>
+#include <immintrin.h>
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+
+// ----------------------------------------------------------------------------
+// Neural Network kernels for cpu backend
+// ----------------------------------------------------------------------------
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define NN_CPU_ENABLE_AVX2 1
+#else
+#define NN_CPU_ENABLE_AVX2 0
+#endif
+
+// SGEMM blocking: B is packed into panels of GEMM_NR columns for GEMM_KC x GEMM_NC blocks
+// (128 KB, sized for L2) and each task computes up to GEMM_MC rows of C against it
+#define GEMM_NR     8
+#define GEMM_KC     256
+#define GEMM_NC     128
+#define GEMM_MC     128
+#define GEMM_MR_MAX 8
+
+NeuralNetworkCpuTasks::NeuralNetworkCpuTasks(vx_node node, int maxThreads)
+    : node(node), threads(1)
+{
+    vx_uint32 numThreads = 0;
+    if (vxQueryNode(node, VX_NODE_ATTRIBUTE_AMD_CPU_NUM_THREADS, &numThreads, sizeof(numThreads)) == VX_SUCCESS && numThreads > 1)
+        threads = (int)numThreads;
+    if (maxThreads > 0)
+        threads = std::min(threads, maxThreads);
+}
+
+struct NeuralNetworkCpuTaskArgs {
+    const std::function<void(int index, int thread)> * task;
+};
+
+static void VX_CALLBACK runCpuTask(void * user_data, vx_uint32 index, vx_uint32 slot)
+{
+    (*((NeuralNetworkCpuTaskArgs *)user_data)->task)((int)index, (int)slot);
+}
+
+void NeuralNetworkCpuTasks::parallelFor(int count, const std::function<void(int index, int thread)>& task) const
+{
+    if (count <= 0) return;
+    if (threads <= 1 || count == 1) {
+        for (int index = 0; index < count; index++) task(index, 0);
+        return;
+    }
+    NeuralNetworkCpuTaskArgs args = { &task };
+    if (vxRunNodeTasks(node, (vx_uint32)count, (vx_uint32)threads, runCpuTask, &args) != VX_SUCCESS) {
+        for (int index = 0; index < count; index++) task(index, 0);
+    }
+}
+
+static inline float applyActivation(float v, nn_cpu_activation_e activation, float alpha)
+{
+    switch (activation) {
+    case NN_CPU_ACTIVATION_RELU:       return v > 0.0f ? v : 0.0f;
+    case NN_CPU_ACTIVATION_LEAKY_RELU: return v > 0.0f ? v : v * alpha;
+    case NN_CPU_ACTIVATION_ABS:        return fabsf(v);
+    case NN_CPU_ACTIVATION_LOGISTIC:   return 1.0f / (1.0f + expf(-v));
+    case NN_CPU_ACTIVATION_TANH:       return tanhf(v);
+    case NN_CPU_ACTIVATION_SOFTRELU:   return v > 20.0f ? v : log1pf(expf(v));
+    default:                           return v;
+    }
+}
+
+// apply activation in place; RELU/LEAKY_RELU/ABS vectorized
+static void activateRow(float * dst, const float * src, vx_size count, nn_cpu_activation_e activation, float alpha)
+{
+    vx_size i = 0;
+    if (activation == NN_CPU_ACTIVATION_NONE || activation == NN_CPU_ACTIVATION_RELU ||
+        activation == NN_CPU_ACTIVATION_LEAKY_RELU || activation == NN_CPU_ACTIVATION_ABS)
+    {
+        const __m128 zero = _mm_setzero_ps(), slope = _mm_set1_ps(alpha);
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+        for (; i + 4 <= count; i += 4) {
+            __m128 v = _mm_loadu_ps(src + i);
+            if (activation == NN_CPU_ACTIVATION_RELU) v = _mm_max_ps(v, zero);
+            else if (activation == NN_CPU_ACTIVATION_LEAKY_RELU) v = _mm_add_ps(_mm_max_ps(v, zero), _mm_mul_ps(_mm_min_ps(v, zero), slope));
+            else if (activation == NN_CPU_ACTIVATION_ABS) v = _mm_and_ps(v, absMask);
+            _mm_storeu_ps(dst + i, v);
+        }
+    }
+    for (; i < count; i++) {
+        dst[i] = applyActivation(src[i], activation, alpha);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// SGEMM micro-kernels: tile[mr][GEMM_NR] = A[mr][kc] * Bp[kc][GEMM_NR]
+// rows past mr re-read the last valid row of A so the inner loop stays branch free
+// ----------------------------------------------------------------------------
+
+static void gemmMicroKernel_SSE(int mr, int kc, const float * A, vx_size lda, const float * Bp, float * tile)
+{
+    const float * a0 = A;
+    const float * a1 = A + lda * std::min(1, mr - 1);
+    const float * a2 = A + lda * std::min(2, mr - 1);
+    const float * a3 = A + lda * std::min(3, mr - 1);
+    __m128 c00 = _mm_setzero_ps(), c01 = _mm_setzero_ps(), c10 = _mm_setzero_ps(), c11 = _mm_setzero_ps();
+    __m128 c20 = _mm_setzero_ps(), c21 = _mm_setzero_ps(), c30 = _mm_setzero_ps(), c31 = _mm_setzero_ps();
+    for (int k = 0; k < kc; k++, Bp += GEMM_NR) {
+        __m128 b0 = _mm_loadu_ps(Bp), b1 = _mm_loadu_ps(Bp + 4), a;
+        a = _mm_set1_ps(a0[k]); c00 = _mm_add_ps(c00, _mm_mul_ps(a, b0)); c01 = _mm_add_ps(c01, _mm_mul_ps(a, b1));
+        a = _mm_set1_ps(a1[k]); c10 = _mm_add_ps(c10, _mm_mul_ps(a, b0)); c11 = _mm_add_ps(c11, _mm_mul_ps(a, b1));
+        a = _mm_set1_ps(a2[k]); c20 = _mm_add_ps(c20, _mm_mul_ps(a, b0)); c21 = _mm_add_ps(c21, _mm_mul_ps(a, b1));
+        a = _mm_set1_ps(a3[k]); c30 = _mm_add_ps(c30, _mm_mul_ps(a, b0)); c31 = _mm_add_ps(c31, _mm_mul_ps(a, b1));
+    }
+    _mm_storeu_ps(tile + 0 * GEMM_NR, c00); _mm_storeu_ps(tile + 0 * GEMM_NR + 4, c01);
+    _mm_storeu_ps(tile + 1 * GEMM_NR, c10); _mm_storeu_ps(tile + 1 * GEMM_NR + 4, c11);
+    _mm_storeu_ps(tile + 2 * GEMM_NR, c20); _mm_storeu_ps(tile + 2 * GEMM_NR + 4, c21);
+    _mm_storeu_ps(tile + 3 * GEMM_NR, c30); _mm_storeu_ps(tile + 3 * GEMM_NR + 4, c31);
+}
+
+#if NN_CPU_ENABLE_AVX2
+__attribute__((target("avx2,fma")))
+static void gemmMicroKernel_AVX2(int mr, int kc, const float * A, vx_size lda, const float * Bp, float * tile)
+{
+    const float * a[8];
+    for (int r = 0; r < 8; r++) a[r] = A + lda * std::min(r, mr - 1);
+    __m256 c0 = _mm256_setzero_ps(), c1 = _mm256_setzero_ps(), c2 = _mm256_setzero_ps(), c3 = _mm256_setzero_ps();
+    __m256 c4 = _mm256_setzero_ps(), c5 = _mm256_setzero_ps(), c6 = _mm256_setzero_ps(), c7 = _mm256_setzero_ps();
+    for (int k = 0; k < kc; k++, Bp += GEMM_NR) {
+        __m256 b = _mm256_loadu_ps(Bp);
+        c0 = _mm256_fmadd_ps(_mm256_broadcast_ss(a[0] + k), b, c0);
+        c1 = _mm256_fmadd_ps(_mm256_broadcast_ss(a[1] + k), b, c1);
+        c2 = _mm256_fmadd_ps(_mm256_broadcast_ss(a[2] + k), b, c2);
+        c3 = _mm256_fmadd_ps(_mm256_broadcast_ss(a[3] + k), b, c3);
+        c4 = _mm256_fmadd_ps(_mm256_broadcast_ss(a[4] + k), b, c4);
+        c5 = _mm256_fmadd_ps(_mm256_broadcast_ss(a[5] + k), b, c5);
+        c6 = _mm256_fmadd_ps(_mm256_broadcast_ss(a[6] + k), b, c6);
+        c7 = _mm256_fmadd_ps(_mm256_broadcast_ss(a[7] + k), b, c7);
+    }
+    _mm256_storeu_ps(tile + 0 * GEMM_NR, c0); _mm256_storeu_ps(tile + 1 * GEMM_NR, c1);
+    _mm256_storeu_ps(tile + 2 * GEMM_NR, c2); _mm256_storeu_ps(tile + 3 * GEMM_NR, c3);
+    _mm256_storeu_ps(tile + 4 * GEMM_NR, c4); _mm256_storeu_ps(tile + 5 * GEMM_NR, c5);
+    _mm256_storeu_ps(tile + 6 * GEMM_NR, c6); _mm256_storeu_ps(tile + 7 * GEMM_NR, c7);
+}
+#endif
+
+typedef void (*gemm_micro_kernel_f)(int mr, int kc, const float * A, vx_size lda, const float * Bp, float * tile);
+
+static gemm_micro_kernel_f getGemmMicroKernel(int& MR)
+{
+#if NN_CPU_ENABLE_AVX2
+    static const bool hasAVX2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    if (hasAVX2) {
+        MR = 8;
+        return gemmMicroKernel_AVX2;
+    }
+#endif
+    MR = 4;
+    return gemmMicroKernel_SSE;
+}
+
+// write a tile back to C: accumulate onto the previous K block and, on the last one, add bias and activate
+static inline void gemmStoreTile(const float * tile, int mr, int nr, float * C, vx_size ldc, bool accumulate, bool last,
+    const float * bias, nn_cpu_activation_e activation, float alpha)
+{
+    for (int r = 0; r < mr; r++, C += ldc, tile += GEMM_NR) {
+        float b = (last && bias) ? bias[r] : 0.0f;
+        for (int c = 0; c < nr; c++) {
+            float v = tile[c] + b;
+            if (accumulate) v += C[c];
+            C[c] = last ? applyActivation(v, activation, alpha) : v;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// convolution: im2col is fused into packing of B so the column matrix is never
+// materialized beyond one GEMM_KC x GEMM_NC block per thread
+// ----------------------------------------------------------------------------
+
+static void packConvolutionPanels(const NeuralNetworkCpuConvDesc& d, const float * input, int k0, int kc, int col0, int nc, float * Bp)
+{
+    const int kernelSize = d.kernel_h * d.kernel_w;
+    const int panels = (nc + GEMM_NR - 1) / GEMM_NR;
+    const bool pointwise = kernelSize == 1 && d.stride_h == 1 && d.stride_w == 1 && d.pad_h == 0 && d.pad_w == 0;
+    for (int kk = 0; kk < kc; kk++) {
+        int k = k0 + kk;
+        int ci = k / kernelSize, ky = (k % kernelSize) / d.kernel_w, kx = k % d.kernel_w;
+        const float * plane = input + (vx_size)ci * d.H * d.W;
+        float * dst = Bp + kk * GEMM_NR;
+        if (pointwise) {
+            const float * src = plane + col0;
+            for (int p = 0; p < panels; p++, dst += kc * GEMM_NR, src += GEMM_NR) {
+                int n = std::min(GEMM_NR, nc - p * GEMM_NR);
+                if (n == GEMM_NR) {
+                    _mm_storeu_ps(dst, _mm_loadu_ps(src));
+                    _mm_storeu_ps(dst + 4, _mm_loadu_ps(src + 4));
+                }
+                else {
+                    for (int j = 0; j < GEMM_NR; j++) dst[j] = j < n ? src[j] : 0.0f;
+                }
+            }
+            continue;
+        }
+        int oy = col0 / d.OW, ox = col0 % d.OW;
+        int yOffset = ky * d.dilation_h - d.pad_h, xOffset = kx * d.dilation_w - d.pad_w;
+        for (int j = 0; j < panels * GEMM_NR; j++) {
+            float v = 0.0f;
+            if (j < nc) {
+                int iy = oy * d.stride_h + yOffset, ix = ox * d.stride_w + xOffset;
+                if (iy >= 0 && iy < d.H && ix >= 0 && ix < d.W) v = plane[iy * d.W + ix];
+                if (++ox == d.OW) { ox = 0; oy++; }
+            }
+            dst[(j / GEMM_NR) * kc * GEMM_NR + (j % GEMM_NR)] = v;
+        }
+    }
+}
+
+vx_size CpuExec_Convolution_scratch_size()
+{
+    return GEMM_KC * GEMM_NC;
+}
+
+int CpuExec_Convolution_layer(const NeuralNetworkCpuTasks& tasks, const NeuralNetworkCpuConvDesc& d,
+    const float * input, const float * weights, const float * bias, float * output, float * scratch,
+    nn_cpu_activation_e activation, float alpha)
+{
+    int MR;
+    gemm_micro_kernel_f microKernel = getGemmMicroKernel(MR);
+    const int Cg = d.C / d.groups, Kg = d.K / d.groups;
+    const int depth = Cg * d.kernel_h * d.kernel_w;
+    const int columns = d.OH * d.OW;
+    const int colBlocks = (columns + GEMM_NC - 1) / GEMM_NC;
+    const int rowBlocks = (Kg + GEMM_MC - 1) / GEMM_MC;
+    const int taskCount = d.N * d.groups * rowBlocks * colBlocks;
+    tasks.parallelFor(taskCount, [&](int index, int thread) {
+        int colBlock = index % colBlocks; index /= colBlocks;
+        int rowBlock = index % rowBlocks; index /= rowBlocks;
+        int g = index % d.groups, n = index / d.groups;
+        int col0 = colBlock * GEMM_NC, nc = std::min(GEMM_NC, columns - col0);
+        int m0 = rowBlock * GEMM_MC, m1 = std::min(Kg, m0 + GEMM_MC);
+        const float * src = input + n * d.input_batch_stride + (vx_size)g * Cg * d.H * d.W;
+        const float * A = weights + (vx_size)g * Kg * depth;
+        const float * biasG = bias ? bias + g * Kg : nullptr;
+        float * C = output + n * d.output_batch_stride + (vx_size)g * Kg * columns + col0;
+        float * Bp = scratch + thread * CpuExec_Convolution_scratch_size();
+        float tile[GEMM_MR_MAX * GEMM_NR];
+        for (int k0 = 0; k0 < depth; k0 += GEMM_KC) {
+            int kc = std::min(GEMM_KC, depth - k0);
+            bool last = (k0 + kc) == depth;
+            packConvolutionPanels(d, src, k0, kc, col0, nc, Bp);
+            for (int m = m0; m < m1; m += MR) {
+                int mr = std::min(MR, m1 - m);
+                for (int c = 0; c < nc; c += GEMM_NR) {
+                    microKernel(mr, kc, A + (vx_size)m * depth + k0, depth, Bp + (c / GEMM_NR) * kc * GEMM_NR, tile);
+                    gemmStoreTile(tile, mr, std::min(GEMM_NR, nc - c), C + (vx_size)m * columns + c, columns,
+                                  k0 > 0, last, biasG ? biasG + m : nullptr, activation, alpha);
+                }
+            }
+        }
+    });
+    return VX_SUCCESS;
+}
+
+// ----------------------------------------------------------------------------
+// pooling: one task per group of N*C planes; average excludes padded elements
+// ----------------------------------------------------------------------------
+
+int CpuExec_Pooling_layer(const NeuralNetworkCpuTasks& tasks, bool max_pool, int N, int C, int H, int W, int OH, int OW,
+    int kernel_h, int kernel_w, int stride_h, int stride_w, int pad_h, int pad_w,
+    const float * input, vx_size input_batch_stride, float * output, vx_size output_batch_stride, nn_cpu_activation_e activation)
+{
+    const int planesPerTask = std::max(1, 4096 / std::max(1, OH * OW));
+    const int planes = N * C;
+    tasks.parallelFor((planes + planesPerTask - 1) / planesPerTask, [&](int index, int thread) {
+        for (int plane = index * planesPerTask; plane < std::min(planes, (index + 1) * planesPerTask); plane++) {
+            int n = plane / C, c = plane % C;
+            const float * src = input + n * input_batch_stride + (vx_size)c * H * W;
+            float * dst = output + n * output_batch_stride + (vx_size)c * OH * OW;
+            for (int oy = 0; oy < OH; oy++) {
+                int y0 = std::max(oy * stride_h - pad_h, 0), y1 = std::min(oy * stride_h - pad_h + kernel_h, H);
+                for (int ox = 0; ox < OW; ox++) {
+                    int x0 = std::max(ox * stride_w - pad_w, 0), x1 = std::min(ox * stride_w - pad_w + kernel_w, W);
+                    float v = 0.0f;
+                    if (y0 < y1 && x0 < x1) {
+                        if (max_pool) {
+                            v = -FLT_MAX;
+                            for (int y = y0; y < y1; y++)
+                                for (int x = x0; x < x1; x++) v = std::max(v, src[y * W + x]);
+                        }
+                        else {
+                            for (int y = y0; y < y1; y++)
+                                for (int x = x0; x < x1; x++) v += src[y * W + x];
+                            v /= (float)((y1 - y0) * (x1 - x0));
+                        }
+                    }
+                    dst[oy * OW + ox] = applyActivation(v, activation, 0.0f);
+                }
+            }
+        }
+    });
+    return VX_SUCCESS;
+}
+
+// ----------------------------------------------------------------------------
+// element-wise activation over each image, split in 16K element chunks
+// ----------------------------------------------------------------------------
+
+int CpuExec_Activation_layer(const NeuralNetworkCpuTasks& tasks, int N, vx_size count, const float * input, vx_size input_batch_stride,
+    float * output, vx_size output_batch_stride, nn_cpu_activation_e activation, float alpha)
+{
+    const vx_size chunk = 16384;
+    const int chunks = (int)((count + chunk - 1) / chunk);
+    tasks.parallelFor(N * chunks, [&](int index, int thread) {
+        int n = index / chunks;
+        vx_size start = (index % chunks) * chunk;
+        activateRow(output + n * output_batch_stride + start, input + n * input_batch_stride + start,
+                    std::min(chunk, count - start), activation, alpha);
+    });
+    return VX_SUCCESS;
+}
+
+// ----------------------------------------------------------------------------
+// softmax: inner positions are processed in blocks so that the channel loop
+// reads contiguous rows of the tensor
+// ----------------------------------------------------------------------------
+
+int CpuExec_Softmax_layer(const NeuralNetworkCpuTasks& tasks, int outer, int channels, int inner,
+    const float * input, vx_size input_outer_stride, float * output, vx_size output_outer_stride)
+{
+    const int block = 64;
+    const int innerBlocks = (inner + block - 1) / block;
+    tasks.parallelFor(outer * innerBlocks, [&](int index, int thread) {
+        int o = index / innerBlocks, j0 = (index % innerBlocks) * block, nj = std::min(block, inner - j0);
+        const float * src = input + o * input_outer_stride + j0;
+        float * dst = output + o * output_outer_stride + j0;
+        float maxValue[block], sum[block];
+        for (int j = 0; j < nj; j++) { maxValue[j] = -FLT_MAX; sum[j] = 0.0f; }
+        for (int c = 0; c < channels; c++) {
+            const float * row = src + (vx_size)c * inner;
+            for (int j = 0; j < nj; j++) maxValue[j] = std::max(maxValue[j], row[j]);
+        }
+        for (int c = 0; c < channels; c++) {
+            const float * row = src + (vx_size)c * inner;
+            float * out = dst + (vx_size)c * inner;
+            for (int j = 0; j < nj; j++) {
+                out[j] = expf(row[j] - maxValue[j]);
+                sum[j] += out[j];
+            }
+        }
+        for (int j = 0; j < nj; j++) sum[j] = 1.0f / sum[j];
+        for (int c = 0; c < channels; c++) {
+            float * out = dst + (vx_size)c * inner;
+            for (int j = 0; j < nj; j++) out[j] *= sum[j];
+        }
+    });
+    return VX_SUCCESS;
+}
+
+// ----------------------------------------------------------------------------
+// fully connected: each weight row is streamed once per four batch items,
+// which keeps the common batch-1 case bandwidth bound instead of GEMM padded
+// ----------------------------------------------------------------------------
+
+static inline float horizontalSum(__m128 v)
+{
+    v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+    return _mm_cvtss_f32(v);
+}
+
+int CpuExec_FullyConnected_layer(const NeuralNetworkCpuTasks& tasks, int N, int K, int M, const float * input, vx_size input_batch_stride,
+    const float * weights, const float * bias, float * output, vx_size output_batch_stride)
+{
+    const int rowsPerTask = 16;
+    tasks.parallelFor((M + rowsPerTask - 1) / rowsPerTask, [&](int index, int thread) {
+        for (int m = index * rowsPerTask; m < std::min(M, (index + 1) * rowsPerTask); m++) {
+            const float * w = weights + (vx_size)m * K;
+            float b = bias ? bias[m] : 0.0f;
+            int n = 0;
+            for (; n + 4 <= N; n += 4) {
+                const float * x0 = input + n * input_batch_stride, * x1 = x0 + input_batch_stride;
+                const float * x2 = x1 + input_batch_stride, * x3 = x2 + input_batch_stride;
+                __m128 s0 = _mm_setzero_ps(), s1 = _mm_setzero_ps(), s2 = _mm_setzero_ps(), s3 = _mm_setzero_ps();
+                int k = 0;
+                for (; k + 4 <= K; k += 4) {
+                    __m128 wv = _mm_loadu_ps(w + k);
+                    s0 = _mm_add_ps(s0, _mm_mul_ps(wv, _mm_loadu_ps(x0 + k)));
+                    s1 = _mm_add_ps(s1, _mm_mul_ps(wv, _mm_loadu_ps(x1 + k)));
+                    s2 = _mm_add_ps(s2, _mm_mul_ps(wv, _mm_loadu_ps(x2 + k)));
+                    s3 = _mm_add_ps(s3, _mm_mul_ps(wv, _mm_loadu_ps(x3 + k)));
+                }
+                float r0 = horizontalSum(s0), r1 = horizontalSum(s1), r2 = horizontalSum(s2), r3 = horizontalSum(s3);
+                for (; k < K; k++) {
+                    r0 += w[k] * x0[k]; r1 += w[k] * x1[k]; r2 += w[k] * x2[k]; r3 += w[k] * x3[k];
+                }
+                output[(n + 0) * output_batch_stride + m] = r0 + b;
+                output[(n + 1) * output_batch_stride + m] = r1 + b;
+                output[(n + 2) * output_batch_stride + m] = r2 + b;
+                output[(n + 3) * output_batch_stride + m] = r3 + b;
+            }
+            for (; n < N; n++) {
+                const float * x = input + n * input_batch_stride;
+                __m128 s0 = _mm_setzero_ps(), s1 = _mm_setzero_ps();
+                int k = 0;
+                for (; k + 8 <= K; k += 8) {
+                    s0 = _mm_add_ps(s0, _mm_mul_ps(_mm_loadu_ps(w + k), _mm_loadu_ps(x + k)));
+                    s1 = _mm_add_ps(s1, _mm_mul_ps(_mm_loadu_ps(w + k + 4), _mm_loadu_ps(x + k + 4)));
+                }
+                float r = horizontalSum(_mm_add_ps(s0, s1));
+                for (; k < K; k++) r += w[k] * x[k];
+                output[n * output_batch_stride + m] = r + b;
+            }
+        }
+    });
+    return VX_SUCCESS;
+}
+
+// ----------------------------------------------------------------------------
+// batch normalization folded into a per-channel multiply-add
+// ----------------------------------------------------------------------------
+
+int CpuExec_BatchNorm_layer(const NeuralNetworkCpuTasks& tasks, int N, int C, int plane, const float * input, vx_size input_batch_stride,
+    const float * mean, const float * variance, const float * scale, const float * bias, float eps,
+    float * output, vx_size output_batch_stride)
+{
+    tasks.parallelFor(N * C, [&](int index, int thread) {
+        int n = index / C, c = index % C;
+        float a = scale[c] / sqrtf(variance[c] + eps);
+        float b = (bias ? bias[c] : 0.0f) - mean[c] * a;
+        const float * src = input + n * input_batch_stride + (vx_size)c * plane;
+        float * dst = output + n * output_batch_stride + (vx_size)c * plane;
+        __m128 av = _mm_set1_ps(a), bv = _mm_set1_ps(b);
+        int i = 0;
+        for (; i + 4 <= plane; i += 4) {
+            _mm_storeu_ps(dst + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i), av), bv));
+        }
+        for (; i < plane; i++) dst[i] = src[i] * a + b;
+    });
+    return VX_SUCCESS;
+}
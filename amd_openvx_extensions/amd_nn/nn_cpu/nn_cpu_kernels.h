@@ -0,0 +1,98 @@
+/*
+Copyright (c) 2017 - 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef NN_CPU_KERNELS_H
+#define NN_CPU_KERNELS_H
+#include <VX/vx.h>
+#include <functional>
+
+//////////////////////////////////////////////////////////////////////
+//! \brief Runs the tasks of a CPU layer on the worker threads of the context with vxRunNodeTasks().
+//! parallelFor() runs task(index, thread) for every index in [0, count) and returns after all of them
+//! are done; thread is below numThreads(): the CPU threads of the graph (VX_NODE_ATTRIBUTE_AMD_CPU_NUM_THREADS,
+//! 1 when not set) capped at maxThreads when it is not 0.
+class NeuralNetworkCpuTasks {
+public:
+    NeuralNetworkCpuTasks(vx_node node, int maxThreads = 0);
+    int numThreads() const { return threads; }
+    void parallelFor(int count, const std::function<void(int index, int thread)>& task) const;
+
+private:
+    vx_node node;
+    int threads;
+};
+
+//////////////////////////////////////////////////////////////////////
+//! \brief Activation fused into the output stage of the CPU layers.
+enum nn_cpu_activation_e {
+    NN_CPU_ACTIVATION_NONE,
+    NN_CPU_ACTIVATION_RELU,
+    NN_CPU_ACTIVATION_LEAKY_RELU,
+    NN_CPU_ACTIVATION_ABS,
+    NN_CPU_ACTIVATION_LOGISTIC,
+    NN_CPU_ACTIVATION_TANH,
+    NN_CPU_ACTIVATION_SOFTRELU,
+};
+
+//////////////////////////////////////////////////////////////////////
+//! \brief 2D convolution geometry; tensors are NCHW with W contiguous.
+struct NeuralNetworkCpuConvDesc {
+    int N, C, H, W;             // input
+    int K, OH, OW;              // output channels and size
+    int kernel_h, kernel_w;
+    int stride_h, stride_w;
+    int pad_h, pad_w;
+    int dilation_h, dilation_w;
+    int groups;
+    vx_size input_batch_stride;     // in floats
+    vx_size output_batch_stride;    // in floats
+};
+
+//! \brief Per-thread scratch (in floats) needed by CpuExec_Convolution_layer.
+vx_size CpuExec_Convolution_scratch_size();
+
+//! \brief im2col + cache-blocked SGEMM convolution with fused bias and activation.
+//! scratch must hold tasks.numThreads() * CpuExec_Convolution_scratch_size() floats.
+int CpuExec_Convolution_layer(const NeuralNetworkCpuTasks& tasks, const NeuralNetworkCpuConvDesc& desc,
+    const float * input, const float * weights, const float * bias, float * output, float * scratch,
+    nn_cpu_activation_e activation, float alpha);
+
+int CpuExec_Pooling_layer(const NeuralNetworkCpuTasks& tasks, bool max_pool, int N, int C, int H, int W, int OH, int OW,
+    int kernel_h, int kernel_w, int stride_h, int stride_w, int pad_h, int pad_w,
+    const float * input, vx_size input_batch_stride, float * output, vx_size output_batch_stride, nn_cpu_activation_e activation);
+
+int CpuExec_Activation_layer(const NeuralNetworkCpuTasks& tasks, int N, vx_size count, const float * input, vx_size input_batch_stride,
+    float * output, vx_size output_batch_stride, nn_cpu_activation_e activation, float alpha);
+
+//! \brief softmax over 'channels' for each of the outer x inner positions.
+int CpuExec_Softmax_layer(const NeuralNetworkCpuTasks& tasks, int outer, int channels, int inner,
+    const float * input, vx_size input_outer_stride, float * output, vx_size output_outer_stride);
+
+int CpuExec_FullyConnected_layer(const NeuralNetworkCpuTasks& tasks, int N, int K, int M, const float * input, vx_size input_batch_stride,
+    const float * weights, const float * bias, float * output, vx_size output_batch_stride);
+
+//! \brief inference batch normalization; bias may be NULL.
+int CpuExec_BatchNorm_layer(const NeuralNetworkCpuTasks& tasks, int N, int C, int plane, const float * input, vx_size input_batch_stride,
+    const float * mean, const float * variance, const float * scale, const float * bias, float eps,
+    float * output, vx_size output_batch_stride);
+
+#endif //NN_CPU_KERNELS_H
@@ -23,6 +23,7 @@ THE SOFTWARE.
 #include "kernels.h"
 struct ActivationLayerLocalData {
     NeuralNetworkCommonHandle * handle;
+#if ENABLE_OPENCL || ENABLE_HIP
     miopenActivationMode_t mode;
     miopenDataType_t data_type;          // data_type for the kernel
     double activAlpha;
@@ -33,6 +34,11 @@ struct ActivationLayerLocalData {
     miopenActivationDescriptor_t activationDesc;
     void* input_mem;
     void* output_mem;
+#else
+    nn_cpu_activation_e mode;
+    float alpha;
+    vx_size count;
+#endif
 };
 
 static vx_status VX_CALLBACK validateActivationLayer(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
@@ -74,6 +80,7 @@ static vx_status VX_CALLBACK validateActivationLayer(vx_node node, const vx_refe
     return VX_SUCCESS;
 }
 
+#if ENABLE_OPENCL || ENABLE_HIP
 static vx_status VX_CALLBACK processActivationLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
 PROFILER_START(VX_NN, Activation_Layer)
@@ -176,6 +183,82 @@ static vx_status VX_CALLBACK uninitializeActivationLayer(vx_node node, const vx_
     }
     return VX_SUCCESS;
 }
+#else
+static vx_status VX_CALLBACK processActivationLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+PROFILER_START(VX_NN, Activation_Layer)
+    ActivationLayerLocalData * data= NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    float * input_mem, * output_mem;
+    vx_size input_dims[4], input_batch_stride, output_batch_stride;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_DIMS, input_dims, sizeof(input_dims)));
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[0], &input_mem, &input_batch_stride));
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[4], &output_mem, &output_batch_stride));
+
+    ERROR_CHECK_STATUS(CpuExec_Activation_layer(NeuralNetworkCpuTasks(node), (int)input_dims[3], data->count, input_mem, input_batch_stride,
+                                                output_mem, output_batch_stride, data->mode, data->alpha));
+
+    /*DUMP LAYER BUFFER*/
+    #if ENABLE_DEBUG_DUMP_NN_LAYER_BUFFERS
+        //dump the output layer
+        nn_layer_test_dumpBuffer("activation_%04d.bin", (vx_tensor)parameters[4]);
+    #endif
+PROFILER_STOP(VX_NN, Activation_Layer)
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK initializeActivationLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    vx_size input_dims[4];
+    vx_enum out_type;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_DIMS, input_dims, sizeof(input_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[4], VX_TENSOR_DATA_TYPE, &out_type, sizeof(out_type)));
+    if (out_type != VX_TYPE_FLOAT32) return ERRMSG(VX_ERROR_NOT_SUPPORTED, "initialize: activation: type=%d (CPU backend supports float32 only)\n", out_type);
+
+    ActivationLayerLocalData * data = new ActivationLayerLocalData;
+    memset(data, 0, sizeof(*data));
+    ERROR_CHECK_STATUS(createGraphHandle(node, &data->handle));
+    data->count = input_dims[0] * input_dims[1] * input_dims[2];
+
+    //activation Function Type
+    vx_int32 activationMode;
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[1], &activationMode, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    data->mode = NN_CPU_ACTIVATION_NONE;
+    if (activationMode == VX_NN_ACTIVATION_RELU) {
+        data->mode = NN_CPU_ACTIVATION_RELU;
+    }
+    else if (activationMode == VX_NN_ACTIVATION_ABS) {
+        data->mode = NN_CPU_ACTIVATION_ABS;
+    }
+    else if (activationMode == VX_NN_ACTIVATION_LOGISTIC) {
+        data->mode = NN_CPU_ACTIVATION_LOGISTIC;
+    }
+    else if (activationMode == VX_NN_ACTIVATION_HYPERBOLIC_TAN) {
+        data->mode = NN_CPU_ACTIVATION_TANH;
+    }
+    else if (activationMode == VX_NN_ACTIVATION_SOFTRELU) {
+        data->mode = NN_CPU_ACTIVATION_SOFTRELU;
+    }
+    else if (activationMode == VX_NN_ACTIVATION_LEAKY_RELU) {
+        data->mode = NN_CPU_ACTIVATION_LEAKY_RELU;
+        ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[2], &data->alpha, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    }
+
+    ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK uninitializeActivationLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    ActivationLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    if (data) {
+        ERROR_CHECK_STATUS(releaseGraphHandle(node, data->handle));
+        delete data;
+    }
+    return VX_SUCCESS;
+}
+#endif
 
 vx_status publishActivationLayer(vx_context context)
 {
@@ -183,9 +266,11 @@ vx_status publishActivationLayer(vx_context context)
     vx_kernel kernel = vxAddUserKernel(context, "org.khronos.nn_extension.activation_layer", VX_KERNEL_ACTIVATION_LAYER, processActivationLayer, 5, validateActivationLayer, initializeActivationLayer, uninitializeActivationLayer);
     ERROR_CHECK_OBJECT(kernel);
 
+#if ENABLE_OPENCL || ENABLE_HIP
     // enable GPU buffer access since the kernel_f callback uses GPU buffers instead of host accessible buffers
     vx_bool enableBufferAccess = vx_true_e;
     ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_GPU_BUFFER_ACCESS_ENABLE, &enableBufferAccess, sizeof(enableBufferAccess)));
+#endif
 
     // set kernel parameters
     ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_TENSOR, VX_PARAMETER_STATE_REQUIRED));
@@ -24,6 +24,7 @@ THE SOFTWARE.
 
 struct BatchNormLayerLocalData {
     NeuralNetworkCommonHandle * handle;
+#if ENABLE_OPENCL || ENABLE_HIP
     miopenTensorDescriptor_t input_desc;
     void *input_mem;
     miopenTensorDescriptor_t output_desc;
@@ -34,6 +35,9 @@ struct BatchNormLayerLocalData {
     float alpha, beta, eps;
     miopenTensorDescriptor_t bnScaleBiasMeanVarDesc;
     void *bnScale, *bnBias, *bnMean, *bnVariance;
+#else
+    float eps;
+#endif
 };
 
 static vx_status VX_CALLBACK validateBatchNormalizationLayer(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
@@ -102,6 +106,7 @@ static vx_status VX_CALLBACK validateBatchNormalizationLayer(vx_node node, const
     return VX_SUCCESS;
 }
 
+#if ENABLE_OPENCL || ENABLE_HIP
 static vx_status VX_CALLBACK processBatchNormalizationLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
 PROFILER_START(VX_NN, Batch_Normalization_Layer)
@@ -248,6 +253,64 @@ static vx_status VX_CALLBACK uninitializeBatchNormalizationLayer(vx_node node, c
     }
     return VX_SUCCESS;
 }
+#else
+static vx_status VX_CALLBACK processBatchNormalizationLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+PROFILER_START(VX_NN, Batch_Normalization_Layer)
+    BatchNormLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    float * input_mem, * output_mem, * bnMean, * bnVariance, * bnScale, * bnBias = nullptr;
+    vx_size input_dims[4], input_batch_stride, output_batch_stride, stride;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_DIMS, input_dims, sizeof(input_dims)));
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[0], &input_mem, &input_batch_stride));
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[1], &bnMean, &stride));
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[2], &bnVariance, &stride));
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[3], &bnScale, &stride));
+    if(parameters[4]) {
+        ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[4], &bnBias, &stride));
+    }
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[6], &output_mem, &output_batch_stride));
+
+    ERROR_CHECK_STATUS(CpuExec_BatchNorm_layer(NeuralNetworkCpuTasks(node), (int)input_dims[3], (int)input_dims[2], (int)(input_dims[1] * input_dims[0]),
+                                               input_mem, input_batch_stride, bnMean, bnVariance, bnScale, bnBias, data->eps, output_mem, output_batch_stride));
+
+    /*DUMP LAYER BUFFER*/
+    #if ENABLE_DEBUG_DUMP_NN_LAYER_BUFFERS
+        //dump the output layer
+        nn_layer_test_dumpBuffer("bn_%04d.bin", (vx_tensor)parameters[6]);
+    #endif
+
+PROFILER_STOP(VX_NN, Batch_Normalization_Layer)
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK initializeBatchNormalizationLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    vx_enum out_type;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[6], VX_TENSOR_DATA_TYPE, &out_type, sizeof(out_type)));
+    if (out_type != VX_TYPE_FLOAT32) return ERRMSG(VX_ERROR_NOT_SUPPORTED, "initialize: batch_norm: type=%d (CPU backend supports float32 only)\n", out_type);
+
+    BatchNormLayerLocalData * data = new BatchNormLayerLocalData;
+    memset(data, 0, sizeof(*data));
+    ERROR_CHECK_STATUS(createGraphHandle(node, &data->handle));
+    data->eps = 0.00001;
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[5], &data->eps, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+
+    ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK uninitializeBatchNormalizationLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    BatchNormLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    if (data) {
+        ERROR_CHECK_STATUS(releaseGraphHandle(node, data->handle));
+        delete data;
+    }
+    return VX_SUCCESS;
+}
+#endif
 
 vx_status publishBatchNormalizationLayer(vx_context context)
 {
@@ -255,9 +318,11 @@ vx_status publishBatchNormalizationLayer(vx_context context)
     vx_kernel kernel = vxAddUserKernel(context, "com.amd.nn_extension.batch_normalization_layer", VX_KERNEL_BATCH_NORMALISATION_LAYER_AMD, processBatchNormalizationLayer, 4, validateBatchNormalizationLayer, initializeBatchNormalizationLayer, uninitializeBatchNormalizationLayer);
     ERROR_CHECK_OBJECT(kernel);
 
+#if ENABLE_OPENCL || ENABLE_HIP
     // enable OpenCL buffer access since the kernel_f callback uses OpenCL buffers instead of host accessible buffers
     vx_bool enableBufferAccess = vx_true_e;
     ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_GPU_BUFFER_ACCESS_ENABLE, &enableBufferAccess, sizeof(enableBufferAccess)));
+#endif
 
     // set kernel parameters
     ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_TENSOR, VX_PARAMETER_STATE_REQUIRED));
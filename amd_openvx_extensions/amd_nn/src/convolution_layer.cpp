@@ -34,6 +34,7 @@ enum {
 
 struct ConvolutionLayerLocalData {
     NeuralNetworkCommonHandle * handle;
+#if ENABLE_OPENCL || ENABLE_HIP
     float conv_alpha;
     float conv_beta;
     float bias_alpha, bias_beta;
@@ -64,6 +65,13 @@ struct ConvolutionLayerLocalData {
     miopenFusionOpDescriptor_t biasOp;
     miopenFusionOpDescriptor_t activOp;
     miopenOperatorArgs_t fusionArgs;
+#else
+    NeuralNetworkCpuConvDesc desc;
+    nn_cpu_activation_e activation_mode;
+    vx_float32 leaky_alpha;
+    float * scratch;                    // per-thread packing buffers for the GEMM
+    int scratch_threads;                // threads that the packing buffers were allocated for
+#endif
 };
 
 static vx_status VX_CALLBACK validateConvolutionLayer(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
@@ -129,6 +137,7 @@ static vx_status VX_CALLBACK validateConvolutionLayer(vx_node node, const vx_ref
     return VX_SUCCESS;
 }
 
+#if ENABLE_OPENCL || ENABLE_HIP
 static vx_status VX_CALLBACK processConvolutionLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
 PROFILER_START(VX_NN, Convolution_Layer)
@@ -468,6 +477,113 @@ static vx_status VX_CALLBACK uninitializeConvolutionLayer(vx_node node, const vx
     }
     return VX_SUCCESS;
 }
+#else
+static vx_status VX_CALLBACK processConvolutionLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+PROFILER_START(VX_NN, Convolution_Layer)
+    ConvolutionLayerLocalData * data= NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    float * input_mem, * output_mem, * weight_mem, * bias_mem = nullptr;
+    vx_size stride;
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[0], &input_mem, &data->desc.input_batch_stride));
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[1], &weight_mem, &stride));
+    if(parameters[2]) {
+        ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[2], &bias_mem, &stride));
+    }
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[4], &output_mem, &data->desc.output_batch_stride));
+
+    ERROR_CHECK_STATUS(CpuExec_Convolution_layer(NeuralNetworkCpuTasks(node, data->scratch_threads), data->desc, input_mem, weight_mem, bias_mem, output_mem,
+                                                 data->scratch, data->activation_mode, data->leaky_alpha));
+
+    /*DUMP LAYER BUFFER*/
+    #if ENABLE_DEBUG_DUMP_NN_LAYER_BUFFERS
+        //dump the output layer
+        nn_layer_test_dumpBuffer("conv_%04d.bin", (vx_tensor)parameters[4]);
+    #endif
+PROFILER_STOP(VX_NN, Convolution_Layer)
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK initializeConvolutionLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    vx_size input_dims[4], weights_dims[4], output_dims[4];
+    vx_enum out_type;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_DIMS, input_dims, sizeof(input_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[1], VX_TENSOR_DIMS, weights_dims, sizeof(weights_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[4], VX_TENSOR_DIMS, output_dims, sizeof(output_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[4], VX_TENSOR_DATA_TYPE, &out_type, sizeof(out_type)));
+    if (out_type != VX_TYPE_FLOAT32) return ERRMSG(VX_ERROR_NOT_SUPPORTED, "initialize: conv: type=%d (CPU backend supports float32 only)\n", out_type);
+
+    //convolution params.
+    vx_nn_convolution_params_t params;
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[3], &params, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    vx_size pad_h = params.padding_y, pad_w = params.padding_x;
+    vx_size dilation_h = params.dilation_y + 1, dilation_w = params.dilation_x + 1;
+    vx_int32 groupCount = 1;
+    if(parameters[6]) {
+        ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[6], &groupCount, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    }
+    if(groupCount < 1) groupCount = 1;
+    if(input_dims[2] != (weights_dims[2] * groupCount) || (weights_dims[3] % groupCount) != 0)
+        return ERRMSG(VX_ERROR_INVALID_DIMENSION, "initialize: conv: input[%ldx%ldx%ldx%ld] weights[%ldx%ldx%ldx%ld] output[%ldx%ldx%ldx%ld]\n",
+            input_dims[3], input_dims[2], input_dims[1], input_dims[0],
+            weights_dims[3], weights_dims[2], weights_dims[1], weights_dims[0],
+            output_dims[3], output_dims[2], output_dims[1], output_dims[0]);
+
+    vx_size kernel_h = weights_dims[1], kernel_w = weights_dims[0];
+    vx_size stride_w = (output_dims[0] > 1) ? ((input_dims[0] + 2 * pad_w - kernel_w - (kernel_w - 1) * (dilation_w - 1) + ((output_dims[0] - 1) / 2)) / (output_dims[0] - 1)) : 1;
+    vx_size stride_h = (output_dims[1] > 1) ? ((input_dims[1] + 2 * pad_h - kernel_h - (kernel_h - 1) * (dilation_h - 1) + ((output_dims[1] - 1) / 2)) / (output_dims[1] - 1)) : 1;
+
+    ConvolutionLayerLocalData * data = new ConvolutionLayerLocalData;
+    memset(data, 0, sizeof(*data));
+    ERROR_CHECK_STATUS(createGraphHandle(node, &data->handle));
+    NeuralNetworkCpuConvDesc& desc = data->desc;
+    desc.N = (int)input_dims[3]; desc.C = (int)input_dims[2]; desc.H = (int)input_dims[1]; desc.W = (int)input_dims[0];
+    desc.K = (int)output_dims[2]; desc.OH = (int)output_dims[1]; desc.OW = (int)output_dims[0];
+    desc.kernel_h = (int)kernel_h; desc.kernel_w = (int)kernel_w;
+    desc.stride_h = (int)stride_h; desc.stride_w = (int)stride_w;
+    desc.pad_h = (int)pad_h; desc.pad_w = (int)pad_w;
+    desc.dilation_h = (int)dilation_h; desc.dilation_w = (int)dilation_w;
+    desc.groups = groupCount;
+
+    // fused activation: relu when leaky_alpha is 0, leaky relu for (0,1]
+    data->activation_mode = NN_CPU_ACTIVATION_NONE;
+    if (parameters[5]) {
+        ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[5], &data->leaky_alpha, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+        if (data->leaky_alpha >= 0 && data->leaky_alpha <= 1) {
+            data->activation_mode = data->leaky_alpha ? NN_CPU_ACTIVATION_LEAKY_RELU : NN_CPU_ACTIVATION_RELU;
+        }
+    }
+
+    // the CPU threads of the graph may change after vxVerifyGraph: execution is capped at the threads allocated for
+    data->scratch_threads = NeuralNetworkCpuTasks(node).numThreads();
+    data->scratch = new float[data->scratch_threads * CpuExec_Convolution_scratch_size()];
+
+#if ENABLE_DEBUG_PRINT_DIMS
+    std::cout << "conv input " << input_dims[0] << " " << input_dims[1] << " " << input_dims[2] << " " << input_dims[3] << " ";
+    std::cout << "Leaky_alpha : " << data->leaky_alpha << " " << "groups : " << groupCount << " ";
+    std::cout << "weights " << weights_dims[0] << " " << weights_dims[1] << " "<< weights_dims[2] <<" " <<  weights_dims[3] << " ";
+    std::cout << "stride " << stride_h << " " << stride_w << " " << "pad " << pad_h << " " << pad_w;
+    std::cout << " output " << output_dims[0] << " " << output_dims[1] << " " << output_dims[2] << " " << output_dims[3] << std::endl;
+#endif
+
+    ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK uninitializeConvolutionLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    ConvolutionLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    if (data) {
+        delete[] data->scratch;
+        ERROR_CHECK_STATUS(releaseGraphHandle(node, data->handle));
+        delete data;
+    }
+    return VX_SUCCESS;
+}
+#endif
 
 vx_status publishConvolutionLayer(vx_context context)
 {
@@ -475,9 +591,11 @@ vx_status publishConvolutionLayer(vx_context context)
     vx_kernel kernel = vxAddUserKernel(context, "org.khronos.nn_extension.convolution_layer", VX_KERNEL_CONVOLUTION_LAYER, processConvolutionLayer, 7, validateConvolutionLayer, initializeConvolutionLayer, uninitializeConvolutionLayer);
     ERROR_CHECK_OBJECT(kernel);
 
+#if ENABLE_OPENCL || ENABLE_HIP
     // enable OpenCL buffer access since the kernel_f callback uses OpenCL buffers instead of host accessible buffers
     vx_bool enableBufferAccess = vx_true_e;
     ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_GPU_BUFFER_ACCESS_ENABLE, &enableBufferAccess, sizeof(enableBufferAccess)));
+#endif
 
     // set kernel parameters
     ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_TENSOR, VX_PARAMETER_STATE_REQUIRED));
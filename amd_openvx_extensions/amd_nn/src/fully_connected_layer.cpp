@@ -24,6 +24,7 @@ THE SOFTWARE.
 
 struct FullyConnectedLayerLocalData {
     NeuralNetworkCommonHandle * handle;
+#if ENABLE_OPENCL || ENABLE_HIP
     miopenConvolutionDescriptor_t convdesc;
     miopenTensorDescriptor_t input_desc;
     miopenTensorDescriptor_t output_desc;
@@ -39,7 +40,11 @@ struct FullyConnectedLayerLocalData {
     float alpha;
     float beta;
     void *workspace;
-
+#else
+    int batch;
+    int inputs;             // K: weights_dims[0] * weights_dims[1] * weights_dims[2]
+    int outputs;            // M: weights_dims[3]
+#endif
 };
 
 static vx_status VX_CALLBACK validateFullyConnectedLayer(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
@@ -92,6 +97,7 @@ static vx_status VX_CALLBACK validateFullyConnectedLayer(vx_node node, const vx_
     return VX_SUCCESS;
 }
 
+#if ENABLE_OPENCL || ENABLE_HIP
 static vx_status VX_CALLBACK processFullyConnectedLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
 PROFILER_START(VX_NN, Fully_Connected_Layer)
@@ -268,6 +274,73 @@ static vx_status VX_CALLBACK uninitializeFullyConnectedLayer(vx_node node, const
     }
     return VX_SUCCESS;
 }
+#else
+static vx_status VX_CALLBACK processFullyConnectedLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+PROFILER_START(VX_NN, Fully_Connected_Layer)
+    FullyConnectedLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    float * input_mem, * output_mem, * weight_mem, * bias_mem = nullptr;
+    vx_size input_batch_stride, output_batch_stride, stride;
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[0], &input_mem, &input_batch_stride));
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[1], &weight_mem, &stride));
+    if(parameters[2]) {
+        ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[2], &bias_mem, &stride));
+    }
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[5], &output_mem, &output_batch_stride));
+
+    ERROR_CHECK_STATUS(CpuExec_FullyConnected_layer(NeuralNetworkCpuTasks(node), data->batch, data->inputs, data->outputs, input_mem, input_batch_stride,
+                                                    weight_mem, bias_mem, output_mem, output_batch_stride));
+
+    /*DUMP LAYER BUFFER*/
+    #if ENABLE_DEBUG_DUMP_NN_LAYER_BUFFERS
+        //dump the output layer
+        nn_layer_test_dumpBuffer("conv_%04d.bin", (vx_tensor)parameters[5]);
+    #endif
+
+PROFILER_STOP(VX_NN, Fully_Connected_Layer)
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK initializeFullyConnectedLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    vx_size num_dims;
+    vx_enum out_type;
+    vx_size input_dims[4], weights_dims[4] = { 1, 1, 0, 0 };
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_DIMS, input_dims, sizeof(input_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[1], VX_TENSOR_NUMBER_OF_DIMS, &num_dims, sizeof(vx_size)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[1], VX_TENSOR_DIMS, &weights_dims[4 - num_dims], num_dims * sizeof(vx_size)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[5], VX_TENSOR_DATA_TYPE, &out_type, sizeof(out_type)));
+    if (out_type != VX_TYPE_FLOAT32) return ERRMSG(VX_ERROR_NOT_SUPPORTED, "initialize: FC: type=%d (CPU backend supports float32 only)\n", out_type);
+
+    FullyConnectedLayerLocalData * data = new FullyConnectedLayerLocalData;
+    memset(data, 0, sizeof(*data));
+    ERROR_CHECK_STATUS(createGraphHandle(node, &data->handle));
+    data->batch = (int)input_dims[3];
+    data->inputs = (int)(weights_dims[2] * weights_dims[1] * weights_dims[0]);
+    data->outputs = (int)weights_dims[3];
+
+#if ENABLE_DEBUG_PRINT_DIMS
+    std::cout << "fullyconnected input " << input_dims[3] << " " << input_dims[2] << " " << input_dims[1] << " " << input_dims[0] << " ";
+    std::cout << "weights " << weights_dims[3] << weights_dims[2] << weights_dims[1] << weights_dims[0] << std::endl;
+#endif
+
+    //add to node attribute.
+    ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK uninitializeFullyConnectedLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    FullyConnectedLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    if (data) {
+        ERROR_CHECK_STATUS(releaseGraphHandle(node, data->handle));
+        delete data;
+    }
+    return VX_SUCCESS;
+}
+#endif
 
 vx_status publishFullyConnectedLayer(vx_context context)
 {
@@ -275,9 +348,11 @@ vx_status publishFullyConnectedLayer(vx_context context)
     vx_kernel kernel = vxAddUserKernel(context, "org.khronos.nn_extension.fully_connected_layer", VX_KERNEL_FULLY_CONNECTED_LAYER, processFullyConnectedLayer, 6, validateFullyConnectedLayer, initializeFullyConnectedLayer, uninitializeFullyConnectedLayer);
     ERROR_CHECK_OBJECT(kernel);
 
+#if ENABLE_OPENCL || ENABLE_HIP
     // enable OpenCL buffer access since the kernel_f callback uses OpenCL buffers instead of host accessible buffers
     vx_bool enableBufferAccess = vx_true_e;
     ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_GPU_BUFFER_ACCESS_ENABLE, &enableBufferAccess, sizeof(enableBufferAccess)));
+#endif
 
     // set kernel parameters
     ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_TENSOR, VX_PARAMETER_STATE_REQUIRED));
@@ -123,8 +123,10 @@ vx_status createGraphHandle(vx_node node, NeuralNetworkCommonHandle ** pHandle)
         ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_ATTRIBUTE_AMD_HIP_STREAM, &handle->cmdq, sizeof(handle->cmdq)));
 #endif
 
+#if ENABLE_OPENCL || ENABLE_HIP
         //create miopen_handle from cmdq
         ERROR_CHECK_MIOPEN_STATUS(miopenCreateWithStream(&handle->miopen_handle, handle->cmdq));
+#endif
 
         ERROR_CHECK_STATUS(vxSetModuleHandle(node, OPENVX_KHR_NN, handle));
     }
@@ -143,6 +145,18 @@ vx_status releaseGraphHandle(vx_node node, NeuralNetworkCommonHandle * handle)
     return VX_SUCCESS;
 }
 
+#if !ENABLE_OPENCL && !ENABLE_HIP
+vx_status getCpuTensorBuffer(vx_tensor tensor, float ** ptr, vx_size * batch_stride)
+{
+    vx_size num_dims, stride[4];
+    ERROR_CHECK_STATUS(vxQueryTensor(tensor, VX_TENSOR_NUMBER_OF_DIMS, &num_dims, sizeof(num_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor(tensor, VX_TENSOR_STRIDE_GPU, stride, sizeof(stride)));
+    ERROR_CHECK_STATUS(vxQueryTensor(tensor, VX_TENSOR_BUFFER_HOST, ptr, sizeof(*ptr)));
+    if (!*ptr) return VX_ERROR_NOT_ALLOCATED;
+    *batch_stride = stride[num_dims - 1] / sizeof(float);
+    return VX_SUCCESS;
+}
+#endif
 
 void nn_layer_test_dumpBuffer(const char * fileNameFormat, vx_tensor tensor)
 {
@@ -229,12 +243,18 @@ SHARED_PUBLIC vx_status VX_API_CALL vxPublishKernels(vx_context context)
     ERROR_CHECK_STATUS(publishFullyConnectedLayer(context));
     ERROR_CHECK_STATUS(publishPoolingLayer(context));
     ERROR_CHECK_STATUS(publishSoftmaxLayer(context));
+    ERROR_CHECK_STATUS(publishActivationLayer(context));
+    ERROR_CHECK_STATUS(publishBatchNormalizationLayer(context));
+    ERROR_CHECK_STATUS(publishDetectionOutputLayer(context));
+    ERROR_CHECK_STATUS(publishNMSLayer(context));
+    ERROR_CHECK_STATUS(publishTopKLayer(context));
+    ERROR_CHECK_STATUS(publishReduceMinLayer(context));
+#if ENABLE_OPENCL || ENABLE_HIP
+    // layers without a CPU implementation
     ERROR_CHECK_STATUS(publishNormalizationLayer(context));
     ERROR_CHECK_STATUS(publishLocalResponseNormalizationLayer(context));
-    ERROR_CHECK_STATUS(publishActivationLayer(context));
     ERROR_CHECK_STATUS(publishROIPoolingLayer(context));
     ERROR_CHECK_STATUS(publishDeconvolutionLayer(context));
-    ERROR_CHECK_STATUS(publishBatchNormalizationLayer(context));
     ERROR_CHECK_STATUS(publishArgmaxLayer(context));
     ERROR_CHECK_STATUS(publishConcatLayer(context));
     ERROR_CHECK_STATUS(publishSliceLayer(context));
@@ -255,13 +275,9 @@ SHARED_PUBLIC vx_status VX_API_CALL vxPublishKernels(vx_context context)
     ERROR_CHECK_STATUS(publishTensorMin(context));
     ERROR_CHECK_STATUS(publishTensorMax(context));
     ERROR_CHECK_STATUS(publishCastLayer(context));
-    ERROR_CHECK_STATUS(publishDetectionOutputLayer(context));
     ERROR_CHECK_STATUS(publishTensorExp(context));
     ERROR_CHECK_STATUS(publishTensorLog(context));
-    ERROR_CHECK_STATUS(publishNMSLayer(context));
     ERROR_CHECK_STATUS(publishGatherLayer(context));
-    ERROR_CHECK_STATUS(publishTopKLayer(context));
-    ERROR_CHECK_STATUS(publishReduceMinLayer(context));
     ERROR_CHECK_STATUS(publishTileLayer(context));
     ERROR_CHECK_STATUS(publishTensorCompare(context));
 
@@ -276,6 +292,7 @@ SHARED_PUBLIC vx_status VX_API_CALL vxPublishKernels(vx_context context)
         }
     };
     ERROR_CHECK_STATUS(vxSetContextAttribute(context, VX_CONTEXT_ATTRIBUTE_AMD_SET_MERGE_RULE, &softmax_rule, sizeof(softmax_rule)));
+#endif
 
     return VX_SUCCESS;
 }
@@ -38,7 +38,9 @@ THE SOFTWARE.
 #include <VX/vx_khr_nn.h>
 #include <VX/vx_compatibility.h>
 #include <vx_ext_amd.h>
+#if ENABLE_OPENCL || ENABLE_HIP
 #include <miopen/miopen.h>
+#endif
 #include <iostream>
 #include <string.h>
 #include <vector>
@@ -54,6 +56,9 @@ THE SOFTWARE.
 #include "../nn_hip/nn_hip_host_decls.h"
 #endif
 #endif
+#if !ENABLE_OPENCL && !ENABLE_HIP
+#include "../nn_cpu/nn_cpu_kernels.h"
+#endif
 #if _WIN32
 #include <windows.h>
 #else
@@ -128,7 +133,9 @@ enum user_kernel_e
 //! \brief Common data shared across all nodes in a graph
 struct NeuralNetworkCommonHandle {
     int count;
+#if ENABLE_OPENCL || ENABLE_HIP
     miopenHandle_t  miopen_handle;
+#endif
 #if ENABLE_OPENCL
     cl_command_queue cmdq;
 #elif ENABLE_HIP
@@ -145,6 +152,10 @@ vx_status createGraphHandle(vx_node node, NeuralNetworkCommonHandle ** pHandle);
 vx_status releaseGraphHandle(vx_node node, NeuralNetworkCommonHandle * handle);
 int getEnvironmentVariable(const char* name, char * value, size_t valueSize);
 void nn_layer_test_dumpBuffer(const char * fileNameFormat, vx_tensor tensor);
+#if !ENABLE_OPENCL && !ENABLE_HIP
+//! \brief host buffer of a float tensor and its outermost (batch) stride in elements
+vx_status getCpuTensorBuffer(vx_tensor tensor, float ** ptr, vx_size * batch_stride);
+#endif
 
 //////////////////////////////////////////////////////////////////////
 //! \brief The kernel publish functions
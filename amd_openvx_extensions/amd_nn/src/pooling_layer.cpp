@@ -24,6 +24,7 @@ THE SOFTWARE.
 
 struct PoolingLayerLocalData {
     NeuralNetworkCommonHandle * handle;
+#if ENABLE_OPENCL || ENABLE_HIP
     miopenPoolingDescriptor_t pool_desc;
     float alpha;
     float beta;
@@ -41,6 +42,13 @@ struct PoolingLayerLocalData {
     double activation_beta;
     double activation_power;
     miopenActivationDescriptor_t activation_desc;
+#else
+    bool max_pool;
+    int kernel_w, kernel_h;
+    int stride_w, stride_h;
+    int pad_w, pad_h;
+    nn_cpu_activation_e activation_mode;
+#endif
 };
 
 static vx_status VX_CALLBACK validatePoolingLayer(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
@@ -104,6 +112,7 @@ static vx_status VX_CALLBACK validatePoolingLayer(vx_node node, const vx_referen
     return VX_SUCCESS;
 }
 
+#if ENABLE_OPENCL || ENABLE_HIP
 static vx_status VX_CALLBACK processPoolingLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
 PROFILER_START(VX_NN, Pooling_Layer)
@@ -246,6 +255,90 @@ static vx_status VX_CALLBACK uninitializePoolingLayer(vx_node node, const vx_ref
     }
     return VX_SUCCESS;
 }
+#else
+static vx_status VX_CALLBACK processPoolingLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+PROFILER_START(VX_NN, Pooling_Layer)
+    PoolingLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    float * input_mem, * output_mem;
+    vx_size input_dims[4], output_dims[4], input_batch_stride, output_batch_stride;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_DIMS, input_dims, sizeof(input_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[7], VX_TENSOR_DIMS, output_dims, sizeof(output_dims)));
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[0], &input_mem, &input_batch_stride));
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[7], &output_mem, &output_batch_stride));
+
+    ERROR_CHECK_STATUS(CpuExec_Pooling_layer(NeuralNetworkCpuTasks(node), data->max_pool, (int)input_dims[3], (int)input_dims[2], (int)input_dims[1], (int)input_dims[0],
+                                             (int)output_dims[1], (int)output_dims[0], data->kernel_h, data->kernel_w, data->stride_h, data->stride_w,
+                                             data->pad_h, data->pad_w, input_mem, input_batch_stride, output_mem, output_batch_stride, data->activation_mode));
+
+    /*DUMP LAYER BUFFER*/
+    #if ENABLE_DEBUG_DUMP_NN_LAYER_BUFFERS
+        //dump the output layer
+        nn_layer_test_dumpBuffer("pooling_%04d.bin", (vx_tensor)parameters[7]);
+    #endif
+
+PROFILER_STOP(VX_NN, Pooling_Layer)
+
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK initializePoolingLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    vx_size kernel_w, kernel_h, pad_w, pad_h;
+    vx_size input_dims[4], output_dims[4];
+    vx_enum out_type;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_DIMS, input_dims, sizeof(input_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[7], VX_TENSOR_DIMS, output_dims, sizeof(output_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[7], VX_TENSOR_DATA_TYPE, &out_type, sizeof(out_type)));
+    if (out_type != VX_TYPE_FLOAT32) return ERRMSG(VX_ERROR_NOT_SUPPORTED, "initialize: POOL: type=%d (CPU backend supports float32 only)\n", out_type);
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[2], &kernel_w, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[3], &kernel_h, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[4], &pad_w, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[5], &pad_h, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+
+    PoolingLayerLocalData * data = new PoolingLayerLocalData;
+    memset(data, 0, sizeof(*data));
+    ERROR_CHECK_STATUS(createGraphHandle(node, &data->handle));
+
+    vx_nn_pooling_type_e modeType;
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[1], &modeType, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    data->max_pool = (modeType == VX_NN_POOLING_MAX);
+    data->kernel_w = (int)kernel_w;
+    data->kernel_h = (int)kernel_h;
+    data->pad_w = (int)pad_w;
+    data->pad_h = (int)pad_h;
+    data->stride_w = (output_dims[0] > 1) ? (int)((input_dims[0] + 2 * pad_w - kernel_w + ((output_dims[0] - 1) / 2)) / (output_dims[0] - 1)) : 1;
+    data->stride_h = (output_dims[1] > 1) ? (int)((input_dims[1] + 2 * pad_h - kernel_h + ((output_dims[1] - 1) / 2)) / (output_dims[1] - 1)) : 1;
+
+    vx_int32 activation_mode = 0;
+    if(parameters[9]) {
+        ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[9], &activation_mode, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    }
+    data->activation_mode = (activation_mode == 1) ? NN_CPU_ACTIVATION_RELU : NN_CPU_ACTIVATION_NONE;
+
+#if ENABLE_DEBUG_PRINT_DIMS
+    std::cout << "pooling input " << input_dims[3] << " " << input_dims[2] << " " << input_dims[1] << " " << input_dims[0] << " ";
+    std::cout << "kernel " << kernel_h << " " << kernel_w << " ";
+    std::cout << "stride " << data->stride_h << " " << data->stride_w << " " << "pad " << pad_h << " " << pad_w;
+    std::cout << " output " << output_dims[3] << " " << output_dims[2] << " " << output_dims[1] << " " << output_dims[0] << std::endl;
+#endif
+
+    ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK uninitializePoolingLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    PoolingLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    if (data) {
+        ERROR_CHECK_STATUS(releaseGraphHandle(node, data->handle));
+        delete data;
+    }
+    return VX_SUCCESS;
+}
+#endif
 
 vx_status publishPoolingLayer(vx_context context)
 {
@@ -253,9 +346,11 @@ vx_status publishPoolingLayer(vx_context context)
     vx_kernel kernel = vxAddUserKernel(context, "org.khronos.nn_extension.pooling_layer", VX_KERNEL_POOLING_LAYER, processPoolingLayer, 10, validatePoolingLayer, initializePoolingLayer, uninitializePoolingLayer);
     ERROR_CHECK_OBJECT(kernel);
 
+#if ENABLE_OPENCL || ENABLE_HIP
     // enable OpenCL buffer access since the kernel_f callback uses OpenCL buffers instead of host accessible buffers
     vx_bool enableBufferAccess = vx_true_e;
     ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_GPU_BUFFER_ACCESS_ENABLE, &enableBufferAccess, sizeof(enableBufferAccess)));
+#endif
 
     // set kernel parameters
     ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_TENSOR, VX_PARAMETER_STATE_REQUIRED));
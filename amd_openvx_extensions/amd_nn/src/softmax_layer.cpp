@@ -24,6 +24,7 @@ THE SOFTWARE.
 
 struct SoftmaxLayerLocalData {
     NeuralNetworkCommonHandle * handle;
+#if ENABLE_OPENCL || ENABLE_HIP
     float alpha;
     float beta;
     miopenDataType_t data_type;          // data_type for the kernel
@@ -33,6 +34,10 @@ struct SoftmaxLayerLocalData {
     void *output_mem;
     int dim_in;
     int dim_out;
+#else
+    int batch;
+    int outer, channels, inner;         // softmax over channels for each outer x inner position of an image
+#endif
     vx_int32 axis;
 };
 
@@ -74,6 +79,7 @@ static vx_status VX_CALLBACK validateSoftmaxLayer(vx_node node, const vx_referen
     return VX_SUCCESS;
 }
 
+#if ENABLE_OPENCL || ENABLE_HIP
 static vx_status VX_CALLBACK processSoftmaxLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
 PROFILER_START(VX_NN, Softmax_Layer)
@@ -171,6 +177,85 @@ static vx_status VX_CALLBACK uninitializeSoftmaxLayer(vx_node node, const vx_ref
     }
     return VX_SUCCESS;
 }
+#else
+static vx_status VX_CALLBACK processSoftmaxLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+PROFILER_START(VX_NN, Softmax_Layer)
+    SoftmaxLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    float * input_mem, * output_mem;
+    vx_size input_batch_stride, output_batch_stride;
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[0], &input_mem, &input_batch_stride));
+    ERROR_CHECK_STATUS(getCpuTensorBuffer((vx_tensor)parameters[1], &output_mem, &output_batch_stride));
+
+    vx_size outer_stride = (vx_size)data->channels * data->inner;
+    for (int n = 0; n < data->batch; n++) {
+        ERROR_CHECK_STATUS(CpuExec_Softmax_layer(NeuralNetworkCpuTasks(node), data->outer, data->channels, data->inner,
+                                                 input_mem + n * input_batch_stride, outer_stride, output_mem + n * output_batch_stride, outer_stride));
+    }
+
+    /*DUMP LAYER BUFFER*/
+    #if ENABLE_DEBUG_DUMP_NN_LAYER_BUFFERS
+        //dump the output layer
+        nn_layer_test_dumpBuffer("softmax_%04d.bin", (vx_tensor)parameters[1]);
+    #endif
+
+PROFILER_STOP(VX_NN, Softmax_Layer)
+
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK initializeSoftmaxLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    vx_enum out_type;
+    vx_size num_dims, input_dims[4] = { 1, 1, 1, 1 };
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_NUMBER_OF_DIMS, &num_dims, sizeof(num_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_DIMS, &input_dims[4-num_dims], num_dims * sizeof(vx_size)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[1], VX_TENSOR_DATA_TYPE, &out_type, sizeof(out_type)));
+    if (out_type != VX_TYPE_FLOAT32) return ERRMSG(VX_ERROR_NOT_SUPPORTED, "initialize: softmax: type=%d (CPU backend supports float32 only)\n", out_type);
+
+    SoftmaxLayerLocalData * data = new SoftmaxLayerLocalData;
+    memset(data, 0, sizeof(*data));
+    ERROR_CHECK_STATUS(createGraphHandle(node, &data->handle));
+
+    data->axis = 1;
+    if(parameters[2])
+    {
+        ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[2], &data->axis, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    }
+    data->batch = (int)input_dims[3];
+    if(data->axis == 2)
+    {
+        data->outer = (int)input_dims[2];
+        data->channels = (int)input_dims[1];
+        data->inner = (int)input_dims[0];
+    }
+    else
+    {
+        data->outer = 1;
+        data->channels = (int)input_dims[2];
+        data->inner = (int)(input_dims[1] * input_dims[0]);
+    }
+
+#if ENABLE_DEBUG_PRINT_DIMS
+    std::cout << "softmax input " << input_dims[3] << " " << input_dims[2] << " " << input_dims[1] << " " << input_dims[0] << " axis " << data->axis << std::endl;
+#endif
+
+    ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK uninitializeSoftmaxLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    SoftmaxLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    if (data) {
+        ERROR_CHECK_STATUS(releaseGraphHandle(node, data->handle));
+        delete data;
+    }
+    return VX_SUCCESS;
+}
+#endif
 
 vx_status publishSoftmaxLayer(vx_context context)
 {
@@ -178,9 +263,11 @@ vx_status publishSoftmaxLayer(vx_context context)
     vx_kernel kernel = vxAddUserKernel(context, "org.khronos.nn_extension.softmax_layer", VX_KERNEL_SOFTMAX_LAYER, processSoftmaxLayer, 3, validateSoftmaxLayer, initializeSoftmaxLayer, uninitializeSoftmaxLayer);
     ERROR_CHECK_OBJECT(kernel);
 
+#if ENABLE_OPENCL || ENABLE_HIP
     // enable OpenCL buffer access since the kernel_f callback uses OpenCL buffers instead of host accessible buffers
     vx_bool enableBufferAccess = vx_true_e;
     ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_GPU_BUFFER_ACCESS_ENABLE, &enableBufferAccess, sizeof(enableBufferAccess)));
+#endif
 
     // set kernel parameters
     ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_TENSOR, VX_PARAMETER_STATE_REQUIRED));
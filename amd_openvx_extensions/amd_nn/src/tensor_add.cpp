@@ -204,25 +204,3 @@ vx_status publishTensorAdd(vx_context context)
 
     return VX_SUCCESS;
 }
-
-VX_API_ENTRY vx_node VX_API_CALL vxTensorAddNode(vx_graph graph, vx_tensor input1, vx_tensor input2, vx_enum policy, vx_tensor output)
-{
-    vx_node node = NULL;
-    vx_context context = vxGetContext((vx_reference)graph);
-    if (vxGetStatus((vx_reference)context) == VX_SUCCESS) {
-        vx_scalar s_policy = vxCreateScalarWithSize(context, VX_TYPE_ENUM, &policy, sizeof(policy));
-        if (vxGetStatus((vx_reference)s_policy) == VX_SUCCESS)
-        {
-            vx_reference params[] = {
-                (vx_reference)input1,
-                (vx_reference)input2,
-                (vx_reference)s_policy,
-                (vx_reference)output
-            };
-            node = createNode(graph, VX_KERNEL_TENSOR_ADD, params, sizeof(params) / sizeof(params[0]));
-            vxReleaseScalar(&s_policy);
-        }
-    }
-    return node;
-}
-
@@ -654,24 +654,3 @@ vx_status publishTensorMatrixMultiply(vx_context context)
 
     return VX_SUCCESS;
 }
-
-VX_API_ENTRY vx_node VX_API_CALL vxTensorMatrixMultiplyNode(vx_graph graph, vx_tensor input1, vx_tensor input2, vx_tensor input3, const vx_tensor_matrix_multiply_params_t * params, vx_tensor output)
-{
-    vx_node node = nullptr;
-    vx_context context = vxGetContext((vx_reference)graph);
-    if (vxGetStatus((vx_reference)context) == VX_SUCCESS) {
-        vx_scalar s_params = vxCreateScalarWithSize(context, VX_TYPE_TENSOR_MATRIX_MULTIPLY_PARAMS, params, sizeof(*params));
-        if (vxGetStatus((vx_reference)s_params) == VX_SUCCESS) {
-            vx_reference params[] = {
-                (vx_reference)input1,
-                (vx_reference)input2,
-                (vx_reference)input3,
-                (vx_reference)s_params,
-                (vx_reference)output
-            };
-            node = createNode(graph, VX_KERNEL_TENSOR_MATRIX_MULTIPLY, params, sizeof(params) / sizeof(params[0]));
-            vxReleaseScalar(&s_params);
-        }
-    }
-    return node;
-}
@@ -202,29 +202,3 @@ vx_status publishTensorMultiply(vx_context context)
 
     return VX_SUCCESS;
 }
-
-VX_API_ENTRY vx_node VX_API_CALL vxTensorMultiplyNode(vx_graph graph, vx_tensor input1, vx_tensor input2, vx_scalar scale, vx_enum overflow_policy, vx_enum rounding_policy,  vx_tensor output)
-{
-    vx_node node = NULL;
-    vx_context context = vxGetContext((vx_reference)graph);
-    if (vxGetStatus((vx_reference)context) == VX_SUCCESS) {
-        vx_scalar s_overflowpolicy = vxCreateScalarWithSize(context, VX_TYPE_ENUM, &overflow_policy, sizeof(overflow_policy));
-        vx_scalar s_roundingpolicy = vxCreateScalarWithSize(context, VX_TYPE_ENUM, &rounding_policy, sizeof(rounding_policy));
-        if (vxGetStatus((vx_reference)s_overflowpolicy) == VX_SUCCESS && (vxGetStatus((vx_reference) s_roundingpolicy) == VX_SUCCESS))
-        {
-            vx_reference params[] = {
-                (vx_reference)input1,
-                (vx_reference)input2,
-                (vx_reference)scale,
-                (vx_reference)s_overflowpolicy,
-                (vx_reference)s_roundingpolicy,
-                (vx_reference)output
-            };
-            node = createNode(graph, VX_KERNEL_TENSOR_MULTIPLY, params, sizeof(params) / sizeof(params[0]));
-            vxReleaseScalar(&s_overflowpolicy);
-            vxReleaseScalar(&s_roundingpolicy);
-        }
-    }
-    return node;
-}
-
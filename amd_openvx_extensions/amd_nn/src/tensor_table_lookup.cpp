@@ -308,15 +308,3 @@ vx_status publishTensorTableLookup(vx_context context) {
 
     return VX_SUCCESS;
 }
-
-VX_API_ENTRY vx_node VX_API_CALL vxTensorTableLookupNode(vx_graph graph, vx_tensor input1, vx_lut lut, vx_tensor output)
-{
-    vx_node node = NULL;
-    vx_reference params[] = {
-        (vx_reference) input1,
-        (vx_reference) lut,
-        (vx_reference) output
-    };
-    node = createNode(graph, VX_KERNEL_TENSOR_TABLE_LOOKUP, params, sizeof(params) / sizeof(params[0]));
-    return node;
-}
@@ -50,7 +50,7 @@ using namespace std;
 #define PARAM_ERROR_CHECK(call){vx_status status = call; if(status!= VX_SUCCESS) goto exit;}
 #define MAX_KERNELS 100
 
-int VX_to_CV_Image(Mat**, vx_image);
+int VX_to_CV_Image(Mat&, vx_image, vx_enum usage = VX_READ_ONLY);
 int VX_to_CV_MATRIX(Mat**, vx_matrix);
 
 int CV_to_VX_Pyramid(vx_pyramid, vector<Mat>);
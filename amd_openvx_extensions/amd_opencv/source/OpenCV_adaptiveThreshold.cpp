@@ -184,7 +184,7 @@ vx_status VX_CALLBACK CV_adaptiveThreshold_Kernel(vx_node node, const vx_referen
     vx_scalar BLOCKSIZE = (vx_scalar)parameters[5];
     vx_scalar C = (vx_scalar)parameters[6];
 
-    Mat *mat, bl;
+    Mat mat, bl;
 
     int adaptiveMethod, thresholdType, blockSize;
     float maxValue, c;
@@ -205,10 +205,11 @@ vx_status VX_CALLBACK CV_adaptiveThreshold_Kernel(vx_node node, const vx_referen
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::adaptiveThreshold(*mat, bl, maxValue, adaptiveMethod, thresholdType, blockSize, c);
+    cv::adaptiveThreshold(mat, bl, maxValue, adaptiveMethod, thresholdType, blockSize, c);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
@@ -117,17 +117,18 @@ vx_status VX_CALLBACK CV_add_Kernel(vx_node node, const vx_reference *parameters
     vx_image image_2 = (vx_image) parameters[1];
     vx_image image_out = (vx_image) parameters[2];
 
-    Mat *mat_1, *mat_2, bl;
+    Mat mat_1, mat_2, bl;
     vx_int32 value = 0;
 
     //Converting VX Image to OpenCV Mat 1
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_1, image_2));
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_1, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat_1, image_1));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat_2, image_2));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat_1, image_1));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat_2, image_2));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::add(*mat_1, *mat_2, bl);
+    cv::add(mat_1, mat_2, bl);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
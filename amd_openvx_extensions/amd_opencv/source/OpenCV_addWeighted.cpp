@@ -182,7 +182,7 @@ vx_status VX_CALLBACK CV_AddWeighted_Kernel(vx_node node, const vx_reference *pa
     vx_image image_out = (vx_image) parameters[5];
     vx_scalar Dtype = (vx_scalar) parameters[6];
 
-    Mat *mat_1, *mat_2, bl;
+    Mat mat_1, mat_2, bl;
     double aplha, beta, gamma;
     int dtype;
     vx_float32 value = 0;
@@ -201,11 +201,12 @@ vx_status VX_CALLBACK CV_AddWeighted_Kernel(vx_node node, const vx_reference *pa
     //Converting VX Image_1 to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in_1, image_in_2));
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in_1, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat_1, image_in_1));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat_2, image_in_2));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat_1, image_in_1));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat_2, image_in_2));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::addWeighted(*mat_1, aplha, *mat_2, beta, gamma, bl, dtype);
+    cv::addWeighted(mat_1, aplha, mat_2, beta, gamma, bl, dtype);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
@@ -168,7 +168,7 @@ vx_status VX_CALLBACK CV_bilateralFilter_Kernel(vx_node node, const vx_reference
     vx_scalar SIGMA_S = (vx_scalar) parameters[4];
     vx_scalar BORDER = (vx_scalar) parameters[5];
 
-    Mat *mat, bl;
+    Mat mat, bl;
     int  d, Border;
     float Sigma_Color, Sigma_Space;
 
@@ -187,10 +187,11 @@ vx_status VX_CALLBACK CV_bilateralFilter_Kernel(vx_node node, const vx_reference
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::bilateralFilter(*mat, bl, d, Sigma_Color, Sigma_Space, Border);
+    cv::bilateralFilter(mat, bl, d, Sigma_Color, Sigma_Space, Border);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
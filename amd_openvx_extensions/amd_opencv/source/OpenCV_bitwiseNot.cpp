@@ -104,14 +104,15 @@ vx_status VX_CALLBACK CV_bitwise_not_Kernel(vx_node node, const vx_reference *pa
     vx_image image_in = (vx_image) parameters[0];
     vx_image image_out = (vx_image) parameters[1];
 
-    Mat *mat, bl;
+    Mat mat, bl;
 
     //Converting VX Image to OpenCV Mat 1
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::bitwise_not(*mat, bl);
+    cv::bitwise_not(mat, bl);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
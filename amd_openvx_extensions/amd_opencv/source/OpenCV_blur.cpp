@@ -203,7 +203,7 @@ static vx_status VX_CALLBACK CV_Blur_Kernel(vx_node node, const vx_reference *pa
     vx_scalar A_Y = (vx_scalar) parameters[5];
     vx_scalar BORDER = (vx_scalar) parameters[6];
 
-    Mat *mat, bl;
+    Mat mat, bl;
     int W, H, a_x, a_y, border;
     vx_int32 value = 0;
 
@@ -221,13 +221,14 @@ static vx_status VX_CALLBACK CV_Blur_Kernel(vx_node node, const vx_reference *pa
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
     Point point;
     point.x = a_x;
     point.y = a_y;
-    cv::blur(*mat, bl, Size(W, H), point, border);
+    cv::blur(mat, bl, Size(W, H), point, border);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
@@ -217,7 +217,7 @@ static vx_status VX_CALLBACK CV_Boxfilter_Kernel(vx_node node, const vx_referenc
     vx_scalar NORM = (vx_scalar) parameters[7];
     vx_scalar BORDER = (vx_scalar) parameters[8];
 
-    Mat *mat, bl;
+    Mat mat, bl;
     int ddepth, W, H, a_x = -1, a_y = -1, border = 4;
 
     vx_int32 value = 0;
@@ -241,7 +241,8 @@ static vx_status VX_CALLBACK CV_Boxfilter_Kernel(vx_node node, const vx_referenc
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
     Point point;
@@ -254,7 +255,7 @@ static vx_status VX_CALLBACK CV_Boxfilter_Kernel(vx_node node, const vx_referenc
     }
     point.x = a_x;
     point.y = a_y;
-    cv::boxFilter(*mat, bl, ddepth, Size(W, H), point, Normalized, border);
+    cv::boxFilter(mat, bl, ddepth, Size(W, H), point, Normalized, border);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
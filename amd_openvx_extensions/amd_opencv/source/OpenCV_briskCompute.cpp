@@ -168,7 +168,7 @@ static vx_status VX_CALLBACK CV_brisk_compute_Kernel(vx_node node, const vx_refe
     vx_scalar OCTAVES = (vx_scalar) parameters[5];
     vx_scalar SCALE = (vx_scalar) parameters[6];
 
-    Mat *mat, *mask_mat, Img;
+    Mat mat, mask_mat, Img;
     int thresh, octaves;
     float patternscale;
     vx_float32 FloatValue = 0;
@@ -183,14 +183,14 @@ static vx_status VX_CALLBACK CV_brisk_compute_Kernel(vx_node node, const vx_refe
     octaves = value;
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mask_mat, mask));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mask_mat, mask));
 
     //Compute using OpenCV
     vector<KeyPoint> key_points;
     Mat desp;
     Ptr<Feature2D> brisk = BRISK::create(thresh, octaves, patternscale);
-    brisk->detectAndCompute(*mat, *mask_mat, key_points, desp);
+    brisk->detectAndCompute(mat, mask_mat, key_points, desp);
 
     //Converting OpenCV Keypoints/Descriptors to OpenVX Keypoints/Descriptors
     STATUS_ERROR_CHECK(CV_to_VX_keypoints(key_points, array));
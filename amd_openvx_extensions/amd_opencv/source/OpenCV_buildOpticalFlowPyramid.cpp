@@ -239,7 +239,7 @@ static vx_status VX_CALLBACK CV_buildOpticalFlowPyramid_Kernel(vx_node node, con
     vx_scalar D_Border = (vx_scalar) parameters[7];
     vx_scalar TRY_Reuse = (vx_scalar) parameters[8];
 
-    Mat *mat, bl;
+    Mat mat, bl;
     int W, H, WinSize, Pry_Border, derviBorder;
     vx_bool WithDervi, try_reuse;
     vx_int32 value = 0;
@@ -262,7 +262,7 @@ static vx_status VX_CALLBACK CV_buildOpticalFlowPyramid_Kernel(vx_node node, con
     try_reuse = value_b;
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
 
     //Compute using OpenCV
     vector<Mat> pyramid_cv;
@@ -279,7 +279,7 @@ static vx_status VX_CALLBACK CV_buildOpticalFlowPyramid_Kernel(vx_node node, con
     else {
         try_reuse_b = false;
     }
-    cv::buildOpticalFlowPyramid(*mat, pyramid_cv, Size(W, H), WinSize, WithDervi_b, Pry_Border, derviBorder, try_reuse_b);
+    cv::buildOpticalFlowPyramid(mat, pyramid_cv, Size(W, H), WinSize, WithDervi_b, Pry_Border, derviBorder, try_reuse_b);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Pyramid(pyramid_vx, pyramid_cv));
@@ -134,7 +134,7 @@ static vx_status VX_CALLBACK CV_compare_Kernel(vx_node node, const vx_reference
     vx_image image_out = (vx_image) parameters[2];
     vx_scalar CMPOP = (vx_scalar) parameters[3];
 
-    Mat *mat_1, *mat_2, bl;
+    Mat mat_1, mat_2, bl;
     vx_int32 value = 0;
     int cmpop;
 
@@ -145,11 +145,12 @@ static vx_status VX_CALLBACK CV_compare_Kernel(vx_node node, const vx_reference
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_1, image_2));
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_1, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat_1, image_1));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat_2, image_2));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat_1, image_1));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat_2, image_2));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::compare(*mat_1, *mat_2, bl, cmpop);
+    cv::compare(mat_1, mat_2, bl, cmpop);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
@@ -136,7 +136,7 @@ static vx_status VX_CALLBACK CV_convertScaleAbs_Kernel(vx_node node, const vx_re
     vx_image image_out = (vx_image)parameters[1];
     vx_scalar ALPHA = (vx_scalar)parameters[2];
     vx_scalar BETA = (vx_scalar)parameters[3];
-    Mat *mat, bl;
+    Mat mat, bl;
     double alpha, beta;
     vx_float32 value = 0;
 
@@ -148,10 +148,11 @@ static vx_status VX_CALLBACK CV_convertScaleAbs_Kernel(vx_node node, const vx_re
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    convertScaleAbs(*mat, bl, alpha, beta);
+    convertScaleAbs(mat, bl, alpha, beta);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
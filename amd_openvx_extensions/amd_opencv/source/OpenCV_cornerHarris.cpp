@@ -169,7 +169,7 @@ static vx_status VX_CALLBACK CV_cornerHarris_Kernel(vx_node node, const vx_refer
     vx_scalar KSIZE = (vx_scalar) parameters[3];
     vx_scalar K = (vx_scalar) parameters[4];
     vx_scalar BORDER = (vx_scalar) parameters[5];
-    Mat *mat, bl;
+    Mat mat, bl;
     int blocksize, ksize, border;
     float  k;
     vx_int32 value = 0;
@@ -187,10 +187,11 @@ static vx_status VX_CALLBACK CV_cornerHarris_Kernel(vx_node node, const vx_refer
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::cornerHarris(*mat, bl, blocksize, ksize, k, border);
+    cv::cornerHarris(mat, bl, blocksize, ksize, k, border);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
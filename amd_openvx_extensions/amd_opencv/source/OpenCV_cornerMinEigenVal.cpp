@@ -152,7 +152,7 @@ static vx_status VX_CALLBACK CV_cornerMinEigenVal_Kernel(vx_node node, const vx_
     vx_scalar KSIZE = (vx_scalar) parameters[3];
     vx_scalar BORDER = (vx_scalar) parameters[4];
 
-    Mat *mat, bl;
+    Mat mat, bl;
     int blockSize, ksize, border;
     vx_int32 value = 0;
 
@@ -166,10 +166,11 @@ static vx_status VX_CALLBACK CV_cornerMinEigenVal_Kernel(vx_node node, const vx_
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::cornerMinEigenVal(*mat, bl, blockSize, ksize, border);
+    cv::cornerMinEigenVal(mat, bl, blockSize, ksize, border);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
@@ -95,14 +95,14 @@ static vx_status VX_CALLBACK CV_countNonZero_Kernel(vx_node node, const vx_refer
     vx_status status = VX_SUCCESS;
     vx_image image_in = (vx_image) parameters[0];
     vx_scalar scalar = (vx_scalar) parameters[1];
-    Mat *mat;
+    Mat mat;
     int NonZero;
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
 
     //Compute using OpenCV
-    NonZero = cv::countNonZero(*mat);
+    NonZero = cv::countNonZero(mat);
 
     //Converting int to Scalar
     STATUS_ERROR_CHECK(vxWriteScalarValue(scalar, &NonZero));
@@ -118,7 +118,7 @@ static vx_status VX_CALLBACK CV_cvtColor_Kernel(vx_node node, const vx_reference
     vx_image image_in = (vx_image) parameters[0];
     vx_image image_out = (vx_image) parameters[1];
     vx_scalar scalar = (vx_scalar) parameters[2];
-    Mat *mat, bl;
+    Mat mat, bl;
     int CODE;
     vx_int32 value = 0;
 
@@ -128,10 +128,11 @@ static vx_status VX_CALLBACK CV_cvtColor_Kernel(vx_node node, const vx_reference
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::cvtColor(*mat, bl, CODE);// CODE have to be checked with OpenCV, the frame work will not check for invalid code
+    cv::cvtColor(mat, bl, CODE);// CODE have to be checked with OpenCV, the frame work will not check for invalid code
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
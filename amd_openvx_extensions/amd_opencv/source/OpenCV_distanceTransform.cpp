@@ -104,14 +104,15 @@ static vx_status VX_CALLBACK CV_distanceTransform_Kernel(vx_node node, const vx_
 
     vx_image image_in = (vx_image) parameters[0];
     vx_image image_out = (vx_image) parameters[1];
-    Mat *mat, bl;
+    Mat mat, bl;
 
     //Converting VX Image to OpenCV Mat 1
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::distanceTransform(*mat, bl, CV_DIST_L1, 3, CV_8U); //only CV_DIST_L1 & CV_8U supported in this release
+    cv::distanceTransform(mat, bl, CV_DIST_L1, 3, CV_8U); //only CV_DIST_L1 & CV_8U supported in this release
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
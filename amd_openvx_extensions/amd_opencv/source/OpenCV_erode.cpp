@@ -177,7 +177,7 @@ static vx_status VX_CALLBACK CV_erode_Kernel(vx_node node, const vx_reference *p
     vx_scalar A_Y = (vx_scalar) parameters[4];
     vx_scalar ITERATION = (vx_scalar) parameters[5];
     vx_scalar BORDER = (vx_scalar) parameters[6];
-    Mat *mat, bl;
+    Mat mat, bl;
     int iteration;
     int a_x = -1, a_y = -1, border = 4;
 
@@ -195,12 +195,13 @@ static vx_status VX_CALLBACK CV_erode_Kernel(vx_node node, const vx_reference *p
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
     Mat *kernel;
     STATUS_ERROR_CHECK(VX_to_CV_MATRIX(&kernel, KERNEL));
-    cv::erode(*mat, bl, *kernel, Point(a_x, a_y), iteration, border);
+    cv::erode(mat, bl, *kernel, Point(a_x, a_y), iteration, border);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
@@ -126,7 +126,7 @@ static vx_status VX_CALLBACK CV_FAST_detector_Kernel(vx_node node, const vx_refe
     vx_array array = (vx_array) parameters[1];
     vx_scalar Threshold = (vx_scalar) parameters[2];
     vx_scalar NonMAXSuppression = (vx_scalar) parameters[3];
-    Mat *mat, Img;
+    Mat mat, Img;
     vx_int32 value = 0;
     vx_bool value_b, nonmax;
     int threshold = 0;
@@ -138,7 +138,7 @@ static vx_status VX_CALLBACK CV_FAST_detector_Kernel(vx_node node, const vx_refe
     nonmax = value_b;
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
 
     //Compute using OpenCV
     vector<KeyPoint> key_points;
@@ -149,7 +149,7 @@ static vx_status VX_CALLBACK CV_FAST_detector_Kernel(vx_node node, const vx_refe
     else {
         nonmax_bool = false;
     }
-    cv::FAST(*mat, key_points, threshold, nonmax_bool);
+    cv::FAST(mat, key_points, threshold, nonmax_bool);
 
     //Converting OpenCV Keypoints to OpenVX Keypoints
     STATUS_ERROR_CHECK(CV_to_VX_keypoints(key_points, array));
@@ -153,7 +153,7 @@ static vx_status VX_CALLBACK CV_fastNlMeansDenoising_Kernel(vx_node node, const
     vx_scalar Template_WS = (vx_scalar) parameters[3];
     vx_scalar Search_WS = (vx_scalar) parameters[4];
 
-    Mat *mat, bl;
+    Mat mat, bl;
     int search_ws, template_ws;
     float h;
     vx_float32 value_f = 0;
@@ -169,10 +169,11 @@ static vx_status VX_CALLBACK CV_fastNlMeansDenoising_Kernel(vx_node node, const
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::fastNlMeansDenoising(*mat, bl, h, template_ws, search_ws);
+    cv::fastNlMeansDenoising(mat, bl, h, template_ws, search_ws);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
@@ -168,7 +168,7 @@ static vx_status VX_CALLBACK CV_fastNlMeansDenoisingColored_Kernel(vx_node node,
     vx_scalar H_COLOR = (vx_scalar) parameters[3];
     vx_scalar Template_WS = (vx_scalar) parameters[4];
     vx_scalar Search_WS = (vx_scalar) parameters[5];
-    Mat *mat, bl;
+    Mat mat, bl;
     int search_ws, template_ws;
     float h, h_color;
     vx_float32 value_f = 0;
@@ -186,10 +186,11 @@ static vx_status VX_CALLBACK CV_fastNlMeansDenoisingColored_Kernel(vx_node node,
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::fastNlMeansDenoisingColored(*mat, bl, h, h_color, template_ws, search_ws);
+    cv::fastNlMeansDenoisingColored(mat, bl, h, h_color, template_ws, search_ws);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
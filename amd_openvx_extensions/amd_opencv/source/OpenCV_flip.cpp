@@ -121,7 +121,7 @@ static vx_status VX_CALLBACK CV_flip_Kernel(vx_node node, const vx_reference *pa
     vx_image image_in = (vx_image)parameters[0];
     vx_image image_out = (vx_image)parameters[1];
     vx_scalar scalar = (vx_scalar)parameters[2];
-    Mat *mat, bl;
+    Mat mat, bl;
     int FlipCode;
 
     vx_int32 value = 0;
@@ -131,10 +131,11 @@ static vx_status VX_CALLBACK CV_flip_Kernel(vx_node node, const vx_reference *pa
     FlipCode = value;
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::flip(*mat, bl, FlipCode); //output image size should correspond to the right flip code
+    cv::flip(mat, bl, FlipCode); //output image size should correspond to the right flip code
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
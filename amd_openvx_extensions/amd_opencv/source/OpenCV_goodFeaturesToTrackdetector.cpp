@@ -207,7 +207,7 @@ static vx_status VX_CALLBACK CV_good_feature_detector_Kernel(vx_node node, const
     vx_scalar USEHARRISDETECTOR = (vx_scalar) parameters[7];
     vx_scalar K = (vx_scalar) parameters[8];
 
-    Mat *mat, *mask_mat, Img;
+    Mat mat, mask_mat, Img;
     int maxCorners, blockSize;
     float qualityLevel, minDistance, k;
     vx_float32 FloatValue = 0;
@@ -229,8 +229,8 @@ static vx_status VX_CALLBACK CV_good_feature_detector_Kernel(vx_node node, const
     useHarris = value_b;
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mask_mat, mask));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mask_mat, mask));
 
     //Compute using OpenCV
     vector<Point2f> Points2;
@@ -241,7 +241,7 @@ static vx_status VX_CALLBACK CV_good_feature_detector_Kernel(vx_node node, const
     else {
         useHarrisDetector = false;
     }
-    cv::goodFeaturesToTrack(*mat, Points2, maxCorners, qualityLevel, minDistance, *mask_mat, blockSize, useHarrisDetector, k); ////Compute using OpenCV
+    cv::goodFeaturesToTrack(mat, Points2, maxCorners, qualityLevel, minDistance, mask_mat, blockSize, useHarrisDetector, k); ////Compute using OpenCV
 
     //Converting OpenCV Keypoints to OpenVX Keypoints
     STATUS_ERROR_CHECK(CVPoints2f_to_VX_keypoints(Points2, array));
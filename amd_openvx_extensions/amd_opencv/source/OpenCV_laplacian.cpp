@@ -186,7 +186,7 @@ static vx_status VX_CALLBACK CV_Laplacian_Kernel(vx_node node, const vx_referenc
     vx_scalar DELTA = (vx_scalar) parameters[5];
     vx_scalar BORDER = (vx_scalar) parameters[6];
 
-    Mat *mat, bl;
+    Mat mat, bl;
     int ddepth, ksize, Border;
     float scale, delta;
     vx_int32 value = 0;
@@ -206,10 +206,11 @@ static vx_status VX_CALLBACK CV_Laplacian_Kernel(vx_node node, const vx_referenc
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::Laplacian(*mat, bl, ddepth, ksize, scale, delta, Border);
+    cv::Laplacian(mat, bl, ddepth, ksize, scale, delta, Border);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
@@ -250,7 +250,7 @@ static vx_status VX_CALLBACK CV_MSER_feature_detector_Kernel(vx_node node, const
     vx_scalar MINMAR = (vx_scalar) parameters[10];
     vx_scalar EDGEBLUR = (vx_scalar) parameters[11];
 
-    Mat *mat, *mask_mat, Img;
+    Mat mat, mask_mat, Img;
     vector<KeyPoint> key_points;
     int delta, min_area, max_area, max_evolution, edge_blur_size;
     float max_variation, min_diversity, area_threshold, min_margin;
@@ -278,12 +278,12 @@ static vx_status VX_CALLBACK CV_MSER_feature_detector_Kernel(vx_node node, const
     edge_blur_size = value;
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mask_mat, mask));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mask_mat, mask));
 
     //Compute using OpenCV
     Ptr<Feature2D> mser = MSER::create(delta, min_area, max_area, max_variation, min_diversity, max_evolution, area_threshold, min_margin, edge_blur_size);
-    mser->detect(*mat, key_points, *mask_mat);
+    mser->detect(mat, key_points, mask_mat);
 
     //OpenCV 2.4.11 Call
     //MSER MSER(delta, min_area, max_area, max_variation, min_diversity, max_evolution, area_threshold, min_margin, edge_blur_size);
@@ -151,7 +151,7 @@ static vx_status VX_CALLBACK CV_multiply_Kernel(vx_node node, const vx_reference
     vx_scalar SCALE = (vx_scalar) parameters[3];
     vx_scalar DTYPE = (vx_scalar) parameters[4];
 
-    Mat *mat_1, *mat_2, bl;
+    Mat mat_1, mat_2, bl;
     vx_int32 value = 0;
     int dtype;
     vx_float32 value_f = 0;
@@ -166,11 +166,12 @@ static vx_status VX_CALLBACK CV_multiply_Kernel(vx_node node, const vx_reference
     //Converting VX Image to OpenCV Mat 1
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_1, image_2));
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_1, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat_1, image_1));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat_2, image_2));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat_1, image_1));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat_2, image_2));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::multiply(*mat_1, *mat_2, bl, scale, dtype);
+    cv::multiply(mat_1, mat_2, bl, scale, dtype);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
@@ -113,7 +113,7 @@ static vx_status VX_CALLBACK CV_norm_Kernel(vx_node node, const vx_reference *pa
     vx_scalar scalar = (vx_scalar) parameters[1];
     vx_scalar scalar1 = (vx_scalar) parameters[2];
 
-    Mat *mat;
+    Mat mat;
     int Type;
     vx_int32 value = 0;
 
@@ -122,11 +122,11 @@ static vx_status VX_CALLBACK CV_norm_Kernel(vx_node node, const vx_reference *pa
     Type = value;
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
 
     //Compute using OpenCV
     float NORM_Val = 0;
-    NORM_Val = (float) norm(*mat, Type);
+    NORM_Val = (float) norm(mat, Type);
 
     //Converting int to Scalar
     STATUS_ERROR_CHECK(vxWriteScalarValue(scalar, &NORM_Val));
@@ -248,7 +248,7 @@ static vx_status VX_CALLBACK CV_orb_compute_Kernel(vx_node node, const vx_refere
     vx_scalar SCORETYPE = (vx_scalar) parameters[10];
     vx_scalar PATCHSIZE = (vx_scalar) parameters[11];
 
-    Mat *mat, *mask_mat, Img;
+    Mat mat, mask_mat, Img;
     int nFeatures, nLevels, edgeThreshold, firstLevel, WTA_K, scoreType, patchSize;
     float  ScaleFactor;
     vector<KeyPoint> key_points;
@@ -275,18 +275,18 @@ static vx_status VX_CALLBACK CV_orb_compute_Kernel(vx_node node, const vx_refere
     patchSize = value;
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mask_mat, mask));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mask_mat, mask));
 
 #if USE_OPENCV_4
     ORB::ScoreType scoreTypeORB = (scoreType == 0 ? ORB::HARRIS_SCORE : ORB::FAST_SCORE);
     //Compute using OpenCV
     Ptr<Feature2D> orb = ORB::create(nFeatures, ScaleFactor, nLevels, edgeThreshold, firstLevel, WTA_K, scoreTypeORB, patchSize);
-    orb->detectAndCompute(*mat, *mask_mat, key_points, Desp);
+    orb->detectAndCompute(mat, mask_mat, key_points, Desp);
 #else
     //Compute using OpenCV
     Ptr<Feature2D> orb = ORB::create(nFeatures, ScaleFactor, nLevels, edgeThreshold, firstLevel, WTA_K, scoreType, patchSize);
-    orb->detectAndCompute(*mat, *mask_mat, key_points, Desp);
+    orb->detectAndCompute(mat, mask_mat, key_points, Desp);
 #endif
 
     //Converting OpenCV Keypoints to OpenVX Keypoints
@@ -153,7 +153,7 @@ static vx_status VX_CALLBACK CV_pyrup_Kernel(vx_node node, const vx_reference *p
     vx_scalar S_height = (vx_scalar) parameters[3];
     vx_scalar BORDER = (vx_scalar) parameters[4];
 
-    Mat *mat;
+    Mat mat;
     int W, H, border;
     vx_int32 value = 0;
 
@@ -166,11 +166,12 @@ static vx_status VX_CALLBACK CV_pyrup_Kernel(vx_node node, const vx_reference *p
     border = value;
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
 
     //Compute using OpenCV
-    Mat bl(Size(W, H), CV_8U);//Only CV_8U supported in this release
-    cv::pyrUp(*mat, bl, Size(W, H), border);
+    Mat bl;
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
+    cv::pyrUp(mat, bl, Size(W, H), border);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
@@ -185,7 +185,7 @@ static vx_status VX_CALLBACK CV_resize_Kernel(vx_node node, const vx_reference *
     vx_scalar FY = (vx_scalar) parameters[5];
     vx_scalar INTER = (vx_scalar) parameters[6];
 
-    Mat *mat, bl;
+    Mat mat, bl;
     int interpolation;
     int a_x = -1, a_y = -1;
     float fx = 0, fy = 0;
@@ -215,10 +215,11 @@ static vx_status VX_CALLBACK CV_resize_Kernel(vx_node node, const vx_reference *
     }
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::resize(*mat, bl, Size(a_x, a_y), fx, fy, interpolation);
+    cv::resize(mat, bl, Size(a_x, a_y), fx, fy, interpolation);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
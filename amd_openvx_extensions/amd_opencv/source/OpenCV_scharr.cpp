@@ -201,7 +201,7 @@ static vx_status VX_CALLBACK CV_Scharr_Kernel(vx_node node, const vx_reference *
     vx_scalar Delta = (vx_scalar) parameters[6];
     vx_scalar Bordertype = (vx_scalar) parameters[7];
 
-    Mat *mat, bl;
+    Mat mat, bl;
     int ddepth, dx, dy, bordertype;
     double scale, delta;
     vx_int32 value = 0;
@@ -223,10 +223,11 @@ static vx_status VX_CALLBACK CV_Scharr_Kernel(vx_node node, const vx_reference *
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::Scharr(*mat, bl, ddepth, dx, dy, scale, delta, bordertype);
+    cv::Scharr(mat, bl, ddepth, dx, dy, scale, delta, bordertype);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
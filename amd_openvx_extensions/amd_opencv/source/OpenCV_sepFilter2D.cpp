@@ -202,7 +202,7 @@ static vx_status VX_CALLBACK CV_sepFilter2D_Kernel(vx_node node, const vx_refere
     vx_scalar DELTA = (vx_scalar) parameters[7];
     vx_scalar BORDER = (vx_scalar) parameters[8];
 
-    Mat *mat, bl;
+    Mat mat, bl;
     int ddepth, a_x = -1, a_y = -1, border = 4;
     float delta = 0;
     vx_int32 value = 0;
@@ -222,7 +222,8 @@ static vx_status VX_CALLBACK CV_sepFilter2D_Kernel(vx_node node, const vx_refere
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
     Point point;
@@ -231,7 +232,7 @@ static vx_status VX_CALLBACK CV_sepFilter2D_Kernel(vx_node node, const vx_refere
     Mat *kernelX, *kernelY;
     STATUS_ERROR_CHECK(VX_to_CV_MATRIX(&kernelX, KERNELX));
     STATUS_ERROR_CHECK(VX_to_CV_MATRIX(&kernelY, KERNELY));
-    cv::sepFilter2D(*mat, bl, ddepth, *kernelX, *kernelY, point, delta, border);
+    cv::sepFilter2D(mat, bl, ddepth, *kernelX, *kernelY, point, delta, border);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
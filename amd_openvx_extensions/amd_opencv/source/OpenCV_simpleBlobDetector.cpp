@@ -109,15 +109,15 @@ static vx_status VX_CALLBACK CV_simple_blob_detector_Kernel(vx_node node, const
     vx_array array = (vx_array) parameters[1];
     vx_image mask = (vx_image) parameters[2];
     vector<KeyPoint> key_points;
-    Mat *mat, *mask_mat, Img;
+    Mat mat, mask_mat, Img;
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mask_mat, mask));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mask_mat, mask));
 
     //OpenCV Calls to Simple Blob Detector
     Ptr<Feature2D> simple = SimpleBlobDetector::create();
-    simple->detect(*mat, key_points, *mask_mat);
+    simple->detect(mat, key_points, mask_mat);
 
     //Converting OpenCV Keypoints to OpenVX Keypoints
     STATUS_ERROR_CHECK(CV_to_VX_keypoints(key_points, array));
@@ -504,7 +504,7 @@ static vx_status VX_CALLBACK CV_simple_blob_detector_INITIALIZE_Kernel(vx_node n
     vx_image mask = (vx_image) parameters[2];
 
     vector<KeyPoint> key_points;
-    Mat *mat, *mask_mat, Img;
+    Mat mat, mask_mat, Img;
 
     vx_scalar THRESHOLDSTEP = (vx_scalar) parameters[3];
     vx_scalar MINTHRESHOLD = (vx_scalar) parameters[4];
@@ -574,8 +574,8 @@ static vx_status VX_CALLBACK CV_simple_blob_detector_INITIALIZE_Kernel(vx_node n
     STATUS_ERROR_CHECK(vxReadScalarValue(BLOBCOLOR, &blobColor));
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mask_mat, mask));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mask_mat, mask));
 
     //OpenCV Calls to Simple Blob Detector
     bool filterByColor_bool, filterByArea_bool, filterByCircularity_bool, filterByConvexity_bool, filterByInertia_bool;
@@ -631,7 +631,7 @@ static vx_status VX_CALLBACK CV_simple_blob_detector_INITIALIZE_Kernel(vx_node n
     params.minConvexity = minConvexity;
 
     Ptr<Feature2D> simple = SimpleBlobDetector::create(params);
-    simple->detect(*mat, key_points, *mask_mat);
+    simple->detect(mat, key_points, mask_mat);
 
     //Converting OpenCV Keypoints to OpenVX Keypoints
     STATUS_ERROR_CHECK(CV_to_VX_keypoints(key_points, array));
@@ -217,7 +217,7 @@ static vx_status VX_CALLBACK CV_Sobel_Kernel(vx_node node, const vx_reference *p
     vx_scalar Delta = (vx_scalar) parameters[7];
     vx_scalar Bordertype = (vx_scalar) parameters[8];
 
-    Mat *mat, bl;
+    Mat mat, bl;
     int ddepth, dx, dy, ksize, bordertype;
     double scale, delta;
     vx_int32 value = 0;
@@ -241,10 +241,11 @@ static vx_status VX_CALLBACK CV_Sobel_Kernel(vx_node node, const vx_reference *p
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::Sobel(*mat, bl, ddepth, dx, dy, ksize, scale, delta, bordertype);
+    cv::Sobel(mat, bl, ddepth, dx, dy, ksize, scale, delta, bordertype);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
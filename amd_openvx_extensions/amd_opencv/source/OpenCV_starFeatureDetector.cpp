@@ -188,7 +188,7 @@ static vx_status VX_CALLBACK CV_star_feature_detector_Kernel(vx_node node, const
     vx_scalar lineThresholdB = (vx_scalar) parameters[6];
     vx_scalar suppressN = (vx_scalar) parameters[7];
 
-    Mat *mat, *mask_mat, Img;
+    Mat mat, mask_mat, Img;
     vx_uint32 width = 0;
     vx_uint32 height = 0;
     vector<KeyPoint> key_points;
@@ -208,12 +208,12 @@ static vx_status VX_CALLBACK CV_star_feature_detector_Kernel(vx_node node, const
     suppressNonmaxSize = value;
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mask_mat, mask));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mask_mat, mask));
 
     //Compute using OpenCV
     Ptr<Feature2D> star = xfeatures2d::StarDetector::create(maxSize, responseThreshold, lineThresholdProjected, lineThresholdBinarized, suppressNonmaxSize);
-    star->detect(*mat, key_points, *mask_mat);
+    star->detect(mat, key_points, mask_mat);
 
     //Converting OpenCV Keypoints to OpenVX Keypoints
     STATUS_ERROR_CHECK(CV_to_VX_keypoints(key_points, array));
@@ -118,16 +118,17 @@ static vx_status VX_CALLBACK CV_subtract_Kernel(vx_node node, const vx_reference
     vx_image image_1 = (vx_image) parameters[0];
     vx_image image_2 = (vx_image) parameters[1];
     vx_image image_out = (vx_image) parameters[2];
-    Mat *mat_1, *mat_2, bl;
+    Mat mat_1, mat_2, bl;
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_1, image_2));
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_1, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat_1, image_1));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat_2, image_2));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat_1, image_1));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat_2, image_2));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    subtract(*mat_1, *mat_2, bl);
+    subtract(mat_1, mat_2, bl);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
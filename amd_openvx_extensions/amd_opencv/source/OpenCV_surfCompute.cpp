@@ -199,7 +199,7 @@ static vx_status VX_CALLBACK CV_SURF_Compute_Kernel(vx_node node, const vx_refer
     vx_scalar EXTENDED = (vx_scalar) parameters[7];
     vx_scalar UPRIGHT = (vx_scalar) parameters[8];
 
-    Mat *mat, *mask_mat, Img;
+    Mat mat, mask_mat, Img;
     vx_float32 FloatValue = 0;
     vx_int32 value = 0;
     vx_bool extend, upright, value_b;
@@ -219,8 +219,8 @@ static vx_status VX_CALLBACK CV_SURF_Compute_Kernel(vx_node node, const vx_refer
     upright = value_b;
 
     //Converting VX Image to OpenCV Mat
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mask_mat, mask));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mask_mat, mask));
 
     //Compute using OpenCV
     bool extended_B, upright_b;
@@ -239,7 +239,7 @@ static vx_status VX_CALLBACK CV_SURF_Compute_Kernel(vx_node node, const vx_refer
     vector<KeyPoint> key_points;
     Mat Desp;
     Ptr<Feature2D> surf = xfeatures2d::SURF::create(HessianThreshold, NOctaves, NOctaveLayers);
-    surf->detectAndCompute(*mat, *mask_mat, key_points, Desp);
+    surf->detectAndCompute(mat, mask_mat, key_points, Desp);
 
     //Converting OpenCV Keypoints to OpenVX Keypoints
     STATUS_ERROR_CHECK(CV_to_VX_keypoints(key_points, array));
@@ -153,7 +153,7 @@ static vx_status VX_CALLBACK CV_threshold_Kernel(vx_node node, const vx_referenc
     vx_scalar MAXVAL = (vx_scalar) parameters[3];
     vx_scalar TYPE = (vx_scalar) parameters[4];
 
-    Mat *mat, bl;
+    Mat mat, bl;
     int type;
     float thresh, maxVal;
     vx_float32 value_f = 0;
@@ -169,10 +169,11 @@ static vx_status VX_CALLBACK CV_threshold_Kernel(vx_node node, const vx_referenc
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
-    cv::threshold(*mat, bl, thresh, maxVal, type);
+    cv::threshold(mat, bl, thresh, maxVal, type);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
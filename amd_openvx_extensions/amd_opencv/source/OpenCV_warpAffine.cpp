@@ -177,7 +177,7 @@ static vx_status VX_CALLBACK CV_warpAffine_Kernel(vx_node node, const vx_referen
     vx_scalar FLAGS = (vx_scalar) parameters[5];
     vx_scalar BORDER = (vx_scalar) parameters[6];
 
-    Mat *mat, bl;
+    Mat mat, bl;
     int flags;
     int a_x = -1, a_y = -1, border = 4;
     vx_int32 value = 0;
@@ -194,12 +194,13 @@ static vx_status VX_CALLBACK CV_warpAffine_Kernel(vx_node node, const vx_referen
 
     //Converting VX Image to OpenCV Mat
     STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
-    STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(mat, image_in));
+    STATUS_ERROR_CHECK(VX_to_CV_Image(bl, image_out, VX_WRITE_ONLY));
 
     //Compute using OpenCV
     Mat *M;
     STATUS_ERROR_CHECK(VX_to_CV_MATRIX(&M, KERNEL));
-    cv::warpAffine(*mat, bl, *M, Size(a_x, a_y), flags, border);
+    cv::warpAffine(mat, bl, *M, Size(a_x, a_y), flags, border);
 
     //Converting OpenCV Mat into VX Image
     STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
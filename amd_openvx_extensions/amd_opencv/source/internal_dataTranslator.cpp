@@ -99,20 +99,21 @@ int VX_to_CV_MATRIX(Mat** mat, vx_matrix matrix_vx)
 
 /************************************************************************************************************
 Converting VX Image into an OpenCV Mat
+The Mat is a header on the OpenVX host buffer (AGO keeps the buffer in place after unmap), so no memory is
+allocated or copied. Use VX_WRITE_ONLY for output images: an OpenCV function that writes a Mat of same size
+and type then writes directly into the OpenVX image.
 *************************************************************************************************************/
-int VX_to_CV_Image(Mat** mat, vx_image image)
+int VX_to_CV_Image(Mat& mat, vx_image image, vx_enum usage)
 {
     vx_status status = VX_SUCCESS;
     vx_uint32 width = 0;
     vx_uint32 height = 0;
     vx_df_image format = VX_DF_IMAGE_VIRT;
     int CV_format = 0;
-    vx_size planes = 0;
 
     STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
     STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
     STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &format, sizeof(format)));
-    STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_PLANES, &planes, sizeof(planes)));
 
     if (format == VX_DF_IMAGE_U8) {
         CV_format = CV_8U;
@@ -126,48 +127,49 @@ int VX_to_CV_Image(Mat** mat, vx_image image)
 
     if (format != VX_DF_IMAGE_U8 && format != VX_DF_IMAGE_S16 && format != VX_DF_IMAGE_RGB)
     {
+        if (usage == VX_WRITE_ONLY) {
+            // let OpenCV allocate the output: CV_to_VX_Image will copy it
+            mat.release();
+            return status;
+        }
         vxAddLogEntry((vx_reference)image, VX_ERROR_INVALID_FORMAT, "VX_to_CV_Image ERROR: Image type not Supported in this RELEASE\n");
         return VX_ERROR_INVALID_FORMAT;
     }
 
-    Mat * m_cv;
-    m_cv = new Mat(height, width, CV_format);
-    Mat *pMat = (Mat *)m_cv;
     vx_rectangle_t rect;
     rect.start_x = 0;
     rect.start_y = 0;
     rect.end_x = width;
     rect.end_y = height;
 
-    vx_uint8 *src[4] = { NULL, NULL, NULL, NULL };
-    vx_uint32 p;
-    void *ptr = NULL;
-    vx_imagepatch_addressing_t addr[4] = { 0, 0, 0, 0 };
-    vx_uint32 y = 0u;
-
-    for (p = 0u; (p < (int)planes); p++)
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    vx_uint8 *src = NULL;
+    STATUS_ERROR_CHECK(vxMapImagePatch(image, &rect, 0, &map_id, &addr, (void **)&src, usage, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    size_t elemSize = CV_ELEM_SIZE(CV_format);
+    if (addr.stride_x == (vx_int32)elemSize)
     {
-        STATUS_ERROR_CHECK(vxAccessImagePatch(image, &rect, p, &addr[p], (void **)&src[p], VX_READ_ONLY));
-        size_t len = addr[p].stride_x * (addr[p].dim_x * addr[p].scale_x) / VX_SCALE_UNITY;
-        for (y = 0; y < height; y += addr[p].step_y)
-        {
-            ptr = vxFormatImagePatchAddress2d(src[p], 0, y - rect.start_y, &addr[p]);
-            memcpy(pMat->data + y * pMat->step, ptr, len);
-        }
+        mat = Mat(height, width, CV_format, src, addr.stride_y);
     }
-
-    for (p = 0u; p < (int)planes; p++)
+    else
     {
-        STATUS_ERROR_CHECK(vxCommitImagePatch(image, &rect, p, &addr[p], src[p]));
+        // pixels are not contiguous in a row: copy
+        mat.create(height, width, CV_format);
+        if (usage != VX_WRITE_ONLY)
+        {
+            for (vx_uint32 y = 0; y < height; y++)
+                for (vx_uint32 x = 0; x < width; x++)
+                    memcpy(mat.ptr(y) + x * elemSize, vxFormatImagePatchAddress2d(src, x, y, &addr), elemSize);
+        }
     }
-
-    *mat = pMat;
+    STATUS_ERROR_CHECK(vxUnmapImagePatch(image, map_id));
 
     return status;
 }
 
 /************************************************************************************************************
 Converting CV Image into an OpenVX Image
+Nothing is copied when the Mat is a header on the OpenVX image from VX_to_CV_Image.
 *************************************************************************************************************/
 int CV_to_VX_Image(vx_image image, Mat* mat)
 {
@@ -187,26 +189,26 @@ int CV_to_VX_Image(vx_image image, Mat* mat)
     rect.end_x = width;
     rect.end_y = height;
 
-    vx_uint8 *src[4] = { NULL, NULL, NULL, NULL };
     vx_uint32 p;
     void *ptr = NULL;
-    vx_imagepatch_addressing_t addr[4] = { 0, 0, 0, 0 };
     vx_uint32 y = 0u;
 
-    for (p = 0u; (p <(int)planes); p++)
+    for (p = 0u; (p < (int)planes); p++)
     {
-        STATUS_ERROR_CHECK(vxAccessImagePatch(image, &rect, p, &addr[p], (void **)&src[p], VX_READ_ONLY));
-        size_t len = addr[p].stride_x * (addr[p].dim_x * addr[p].scale_x) / VX_SCALE_UNITY;
-        for (y = 0; y < height; y += addr[p].step_y)
+        vx_map_id map_id;
+        vx_imagepatch_addressing_t addr;
+        vx_uint8 *dst = NULL;
+        STATUS_ERROR_CHECK(vxMapImagePatch(image, &rect, p, &map_id, &addr, (void **)&dst, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+        if (dst != pMat->data || (size_t)addr.stride_y != pMat->step)
         {
-            ptr = vxFormatImagePatchAddress2d(src[p], 0, y - rect.start_y, &addr[p]);
-            memcpy(ptr, pMat->data + y * pMat->step, len);
+            size_t len = addr.stride_x * (addr.dim_x * addr.scale_x) / VX_SCALE_UNITY;
+            for (y = 0; y < height; y += addr.step_y)
+            {
+                ptr = vxFormatImagePatchAddress2d(dst, 0, y - rect.start_y, &addr);
+                memcpy(ptr, pMat->data + y * pMat->step, len);
+            }
         }
-    }
-
-    for (p = 0u; p < (int)planes; p++)
-    {
-        STATUS_ERROR_CHECK(vxCommitImagePatch(image, &rect, p, &addr[p], src[p]));
+        STATUS_ERROR_CHECK(vxUnmapImagePatch(image, map_id));
     }
 
     return status;
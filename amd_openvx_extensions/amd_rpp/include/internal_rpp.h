@@ -65,6 +65,17 @@ struct vxRppHandle {
     int count;
 };
 
+//! Brief Array and scalar parameters seen by the previous refresh of a node.
+//! Nodes keep it in their local data so the per-sample parameter arrays are only copied
+//! again after a graph parameter was replaced or its contents were written.
+#define RPP_MAX_TRACKED_PARAMS 32
+struct vxRppParamTracker {
+    vx_uint32 num;
+    vx_reference ref[RPP_MAX_TRACKED_PARAMS];
+    vx_enum type[RPP_MAX_TRACKED_PARAMS];
+    vx_uint32 write_count[RPP_MAX_TRACKED_PARAMS];
+};
+
 enum vxTensorLayout {
     VX_NHWC = 0,
     VX_NCHW = 1,
@@ -91,6 +102,7 @@ const std::map<vxTensorLayout, RpptLayout> tensorLayoutMapping = {
 vx_node createNode(vx_graph graph, vx_enum kernelEnum, vx_reference params[], vx_uint32 num);
 vx_status createRPPHandle(vx_node node, vxRppHandle ** pHandle, Rpp32u batchSize, Rpp32u deviceType);
 vx_status releaseRPPHandle(vx_node node, vxRppHandle * handle, Rpp32u deviceType);
+bool rppParamsChanged(vxRppParamTracker * tracker, const vx_reference * parameters, vx_uint32 num);
 void fillDescriptionPtrfromDims(RpptDescPtr &descPtr, vxTensorLayout layout, size_t *tensorDims);
 void fillAudioDescriptionPtrFromDims(RpptDescPtr &descPtr, size_t *tensorDims, vxTensorLayout layout = vxTensorLayout::VX_NHW);
 RpptDataType getRpptDataType(vx_enum dataType);
@@ -25,6 +25,7 @@ THE SOFTWARE.
 struct HistogramLocalData
 {
     vxRppHandle *handle;
+    vxRppParamTracker paramTracker;
     RppiSize srcDimensions;
     Rpp32u device_type;
     RppPtr_t pSrc;
@@ -40,14 +41,17 @@ struct HistogramLocalData
 static vx_status VX_CALLBACK refreshHistogram(vx_node node, const vx_reference *parameters, vx_uint32 num, HistogramLocalData *data)
 {
     vx_status status = VX_SUCCESS;
-    STATUS_ERROR_CHECK(vxQueryImage((vx_image)parameters[0], VX_IMAGE_HEIGHT, &data->srcDimensions.height, sizeof(data->srcDimensions.height)));
-    STATUS_ERROR_CHECK(vxQueryImage((vx_image)parameters[0], VX_IMAGE_WIDTH, &data->srcDimensions.width, sizeof(data->srcDimensions.width)));
-    size_t arr_size;
-    vx_status copy_status;
-    STATUS_ERROR_CHECK(vxQueryArray((vx_array)parameters[1], VX_ARRAY_ATTRIBUTE_NUMITEMS, &arr_size, sizeof(arr_size)));
-    data->outputHistogram = (Rpp32u *)malloc(sizeof(Rpp32u) * arr_size);
-    STATUS_ERROR_CHECK(vxCopyArrayRange((vx_array)parameters[1], 0, arr_size, sizeof(Rpp32u), data->outputHistogram, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
-    STATUS_ERROR_CHECK(vxReadScalarValue((vx_scalar)parameters[2], &data->bins));
+    if (rppParamsChanged(&data->paramTracker, parameters, num))
+    {
+        STATUS_ERROR_CHECK(vxQueryImage((vx_image)parameters[0], VX_IMAGE_HEIGHT, &data->srcDimensions.height, sizeof(data->srcDimensions.height)));
+        STATUS_ERROR_CHECK(vxQueryImage((vx_image)parameters[0], VX_IMAGE_WIDTH, &data->srcDimensions.width, sizeof(data->srcDimensions.width)));
+        size_t arr_size;
+        vx_status copy_status;
+        STATUS_ERROR_CHECK(vxQueryArray((vx_array)parameters[1], VX_ARRAY_ATTRIBUTE_NUMITEMS, &arr_size, sizeof(arr_size)));
+        data->outputHistogram = (Rpp32u *)malloc(sizeof(Rpp32u) * arr_size);
+        STATUS_ERROR_CHECK(vxCopyArrayRange((vx_array)parameters[1], 0, arr_size, sizeof(Rpp32u), data->outputHistogram, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+        STATUS_ERROR_CHECK(vxReadScalarValue((vx_scalar)parameters[2], &data->bins));
+    }
     if (data->device_type == AGO_TARGET_AFFINITY_GPU)
     {
 #if ENABLE_OPENCL
@@ -2858,3 +2858,29 @@ vx_status releaseRPPHandle(vx_node node, vxRppHandle *handle, Rpp32u deviceType)
     }
     return VX_SUCCESS;
 }
+
+bool rppParamsChanged(vxRppParamTracker *tracker, const vx_reference *parameters, vx_uint32 num) {
+    // parameters beyond the tracked range can't be compared, so report them as changed
+    bool changed = (tracker->num != num) || (num > RPP_MAX_TRACKED_PARAMS);
+    vx_uint32 count = std::min(num, (vx_uint32)RPP_MAX_TRACKED_PARAMS);
+    for (vx_uint32 i = 0; i < count; i++) {
+        if (tracker->ref[i] != parameters[i]) {
+            tracker->ref[i] = parameters[i];
+            tracker->type[i] = VX_TYPE_INVALID;
+            if (parameters[i])
+                vxQueryReference(parameters[i], VX_REFERENCE_TYPE, &tracker->type[i], sizeof(tracker->type[i]));
+            changed = true;
+        }
+        vx_uint32 write_count = 0;
+        if (tracker->type[i] == VX_TYPE_ARRAY)
+            vxQueryArray((vx_array)parameters[i], VX_ARRAY_WRITE_COUNT, &write_count, sizeof(write_count));
+        else if (tracker->type[i] == VX_TYPE_SCALAR)
+            vxQueryScalar((vx_scalar)parameters[i], VX_SCALAR_WRITE_COUNT, &write_count, sizeof(write_count));
+        if (tracker->write_count[i] != write_count) {
+            tracker->write_count[i] = write_count;
+            changed = true;
+        }
+    }
+    tracker->num = num;
+    return changed;
+}
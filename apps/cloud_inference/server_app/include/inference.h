@@ -53,6 +53,7 @@ THE SOFTWARE.
 #define INFERENCE_SCHEDULER_MODE       LIBRE_INFERENCE_SCHEDULER
 #define INFERENCE_SERVICE_IDLE_TIME    1
 #define DEVICE_QUEUE_FULL_SLEEP_MSEC   1  // msec to sleep when device queue is full
+#define INFERENCE_BATCH_FLUSH         -2  // tag (and image size) that closes a partial batch without ending the sequence
 
 // inference scheduler configuration
 #if INFERENCE_SCHEDULER_MODE == NO_INFERENCE_SCHEDULER
@@ -215,9 +216,11 @@ public:
     InferenceEngine() {}; // default constructor
     InferenceEngine(int sock, Arguments * args, const std::string clientName, InfComCommand * cmd);
     virtual ~InferenceEngine();
+    virtual int initialize();
     virtual int run();
 
 protected:
+    friend class InferencePool;
     // scheduler thread workers
 #if INFERENCE_SCHEDULER_MODE == NO_INFERENCE_SCHEDULER
     // no separate threads needed
@@ -331,6 +334,7 @@ class InferenceEngineHip:public InferenceEngine
 public:
     InferenceEngineHip(int sock_, Arguments * args, const std::string clientName, InfComCommand * cmd);
     ~InferenceEngineHip();
+    int initialize();
     int run();
 
 protected:
@@ -0,0 +1,158 @@
+/*
+Copyright (c) 2017 - 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef INFERENCE_POOL_H
+#define INFERENCE_POOL_H
+
+#include "inference.h"
+#include <atomic>
+#include <chrono>
+#include <deque>
+
+// configuration
+//   INFERENCE_POOL_LINGER_MSEC - keep an idle pool (and its compiled graphs) this long after its last client leaves
+#define INFERENCE_POOL_LINGER_MSEC     30000
+
+// pool states
+#define INFERENCE_POOL_INITIALIZING    0
+#define INFERENCE_POOL_READY           1
+#define INFERENCE_POOL_FAILED          2
+
+// result of one image routed back to the client that submitted it
+struct InferenceResult {
+    int tag;
+    int label;
+    std::vector<unsigned int> topK;
+    std::vector<ObjectBB> boundingBoxes;
+};
+
+//////
+// InferencePool: one inference engine shared by all clients requesting the same model configuration.
+// Images from all attached sessions are scheduled through the engine's single inputQ (so they are
+// batched together) under pool-wide request tags; a router thread maps every result back to the
+// session and client tag it came from. All methods other than the router are called from the server
+// event loop thread; results and wakeups are exchanged through a mutex and the server's eventfd.
+//
+class InferencePool {
+public:
+    InferencePool(const std::string& key, int sock, Arguments * args, const std::string& clientName, InfComCommand * cmd, int wakeupFd);
+    ~InferencePool();
+    static std::string makeKey(const InfComCommand * cmd);
+    const std::string& getKey() { return key; }
+
+    // initialization runs on a separate thread and talks to the client that created the pool
+    void startInitialization();
+    int getState() { return state; }
+    int finishInitialization();
+    bool isInitialized() { return initialized; }
+    void addWaitingClient(int sock, const std::string& clientName);
+    void takeWaitingClients(std::vector<std::tuple<int,std::string,bool>>& clients);
+
+    // session bookkeeping
+    void attach(int sessionId);
+    void detach(int sessionId);
+    bool isIdle(std::chrono::steady_clock::time_point now);
+    int getTopK() { return engine->topK; }
+    int getDetectBoundingBoxes() { return engine->detectBoundingBoxes; }
+    bool getReceiveFileNames() { return engine->receiveFileNames; }
+    Arguments * getArguments() { return engine->args; }
+
+    // scheduling
+    int getInputSlots();
+    void submit(int sessionId, int tag, char * byteStream, int size);
+    void flush();
+    void popResults(int sessionId, std::deque<InferenceResult>& sessionResults);
+    void takeReadySessions(std::vector<int>& sessionIds);
+
+private:
+    void workInitialize();
+    void workResultRouter();
+    void wakeup();
+
+    std::string key;
+    InferenceEngine * engine;
+    int wakeupFd;
+    int engineSock;   // duplicate of the creating client socket used by the engine during initialization
+    std::atomic<int> state;
+    bool initialized;
+    std::thread * threadInitialize;
+    std::thread * threadResultRouter;
+    std::vector<std::tuple<int,std::string,bool>> waitingClients; // <sock,clientName,sendReady>
+    int sessionCount;
+    std::chrono::steady_clock::time_point idleSince;
+    int nextRequestTag;
+    int submittedSinceFlush;
+    // shared with the router thread
+    std::mutex mutex;
+    std::unordered_map<int,std::tuple<int,int>> requests;          // request tag -> <sessionId,client tag>
+    std::unordered_map<int,std::deque<InferenceResult>> results;   // sessionId -> results not yet sent
+    std::vector<int> readySessions;
+};
+
+//////
+// InferenceSession: the lock-step inference protocol of one client, driven by socket readiness
+// instead of a dedicated thread. Every command sent to the client is answered before the next one
+// is sent, so the session is always either IDLE or waiting for exactly one reply. The socket is
+// non-blocking: bytes the client isn't ready to accept stay in txBuffer until it becomes writable.
+//
+class InferenceSession {
+public:
+    InferenceSession(int id, InferencePool * pool, int sock, const std::string& clientName);
+    ~InferenceSession();
+    int getId() { return id; }
+    int getSocket() { return sock; }
+    const std::string& getClientName() { return clientName; }
+    InferencePool * getPool() { return pool; }
+    bool isPolling() { return polling && state == SESSION_IDLE; }
+    bool hasPendingOutput() { return !txBuffer.empty(); }
+
+    // return 0 to keep the session, 1 when it completed, and -1 on error (socket is closed)
+    int start(bool sendReady);
+    int onReadable();
+    int onWritable();
+    int onWakeup();
+    int onIdleTimeout();
+
+private:
+    enum { SESSION_IDLE, SESSION_WAIT_ACK, SESSION_WAIT_IMAGES, SESSION_WAIT_DONE };
+    int advance();
+    int send(const InfComCommand& cmd);
+    int fail(const char * format, ...);
+    int receiveImage(const char * data, size_t available, size_t& consumed);
+    void packResults(std::deque<InferenceResult>& sessionResults);
+
+    int id;
+    InferencePool * pool;
+    int sock;
+    std::string clientName;
+    int state;
+    int expectedCommand;
+    bool polling;
+    bool endOfImageRequested;
+    int imageCountPending;
+    int imagesInFlight;
+    std::vector<char> rxBuffer;
+    std::vector<char> txBuffer;
+    std::deque<InfComCommand> txQueue;
+};
+
+#endif
@@ -35,9 +35,12 @@ THE SOFTWARE.
 #include <netdb.h>
 #include <unistd.h>
 #include <string>
+#include <vector>
 
 int sendBuffer(int sock, const void * buf, size_t len, std::string& clientName);
 int recvBuffer(int sock,       void * buf, size_t len, std::string& clientName);
+int recvAvailable(int sock, std::vector<char>& buf, std::string& clientName);
+int sendAvailable(int sock, std::vector<char>& buf, std::string& clientName);
 
 int sendCommand(int sock, const InfComCommand& cmd, std::string& clientName);
 int recvCommand(int sock,       InfComCommand& cmd, std::string& clientName, int expectedCommand);
@@ -151,7 +151,7 @@ InferenceEngineHip::~InferenceEngineHip()
     PROFILER_SHUTDOWN();
 }
 
-int InferenceEngineHip::run()
+int InferenceEngineHip::initialize()
 {
     //////
     /// make device lock is successful
@@ -448,6 +448,16 @@ int InferenceEngineHip::run()
     ERRCHK(recvCommand(sock, updateCmd, clientName, INFCOM_CMD_INFERENCE_INITIALIZATION));
     info(updateCmd.message);
 
+    return 0;
+}
+
+int InferenceEngineHip::run()
+{
+    //////
+    /// load the model and start the scheduler for this client
+    ///
+    ERRCHK(initialize());
+
     ////////
     /// \brief keep running the inference in loop
     ///
@@ -761,20 +771,31 @@ void InferenceEngineHip::workMasterInputQ()
         char * byteStream = std::get<1>(input);
         int size = std::get<2>(input);
 
-        // check for end of input
-        if(tag < 0 || byteStream == nullptr || size == 0)
-            break;
-        totalInputCount++;
+        // a batch flush closes the partially filled batch without ending the sequence
+        bool flushBatch = (tag == INFERENCE_BATCH_FLUSH);
+        if(flushBatch) {
+            if(inputCountInBatch > 0) {
+                std::tuple<char*,int> flushImage(nullptr,INFERENCE_BATCH_FLUSH);
+                queueDeviceTagQ[gpu]->enqueue(tag);
+                queueDeviceImageQ[gpu]->enqueue(flushImage);
+            }
+        }
+        else {
+            // check for end of input
+            if(tag < 0 || byteStream == nullptr || size == 0)
+                break;
+            totalInputCount++;
 
-        // add the image to selected deviceQ
-        std::tuple<char*,int> image(byteStream,size);
-        queueDeviceTagQ[gpu]->enqueue(tag);
-        queueDeviceImageQ[gpu]->enqueue(image);
+            // add the image to selected deviceQ
+            std::tuple<char*,int> image(byteStream,size);
+            queueDeviceTagQ[gpu]->enqueue(tag);
+            queueDeviceImageQ[gpu]->enqueue(image);
+            inputCountInBatch++;
+        }
         PROFILER_STOP(inference_server_app, workMasterInputQ);
 
-        // at the end of Batch pick another device
-        inputCountInBatch++;
-        if(inputCountInBatch == batchSize) {
+        // at the end of Batch (or a flushed partial batch) pick another device
+        if(inputCountInBatch == batchSize || (flushBatch && inputCountInBatch > 0)) {
             inputCountInBatch = 0;
             gpu = (gpu + 1) % GPUs;
             for(int i = 0; i < GPUs; i++) {
@@ -838,6 +859,9 @@ void InferenceEngineHip::workDeviceInputCopy(int gpu)
                 queueDeviceImageQ[gpu]->dequeue(image);
                 char * byteStream = std::get<0>(image);
                 int size = std::get<1>(image);
+                if(byteStream == nullptr && size == INFERENCE_BATCH_FLUSH) {
+                    break;
+                }
                 if(byteStream == nullptr || size == 0) {
                     printf("workDeviceInputCopy:: Eos reached inputCount: %d\n", inputCount);
                     endOfSequenceReached = true;
@@ -883,6 +907,9 @@ void InferenceEngineHip::workDeviceInputCopy(int gpu)
                 queueDeviceImageQ[gpu]->dequeue(image);
                 char * byteStream = std::get<0>(image);
                 int size = std::get<1>(image);
+                if(byteStream == nullptr && size == INFERENCE_BATCH_FLUSH) {
+                    break;
+                }
                 if(byteStream == nullptr || size == 0) {
                     endOfSequenceReached = true;
                     break;
@@ -1017,6 +1044,9 @@ void InferenceEngineHip::workDeviceOutputCopy(int gpu)
             // get next item from the tag queue and check for end of input
             int tag;
             queueDeviceTagQ[gpu]->dequeue(tag);
+            if(tag == INFERENCE_BATCH_FLUSH) {
+                break;
+            }
             if(tag < 0) {
                 endOfSequenceReached = true;
                 break;
@@ -0,0 +1,548 @@
+/*
+Copyright (c) 2017 - 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "inference_pool.h"
+#include "netutil.h"
+#include "common.h"
+#include <climits>
+#include <stdarg.h>
+
+#if INFERENCE_SCHEDULER_MODE == LIBRE_INFERENCE_SCHEDULER
+
+InferencePool::InferencePool(const std::string& key_, int sock, Arguments * args, const std::string& clientName, InfComCommand * cmd, int wakeupFd_)
+    : key{ key_ }, engine{ nullptr }, wakeupFd{ wakeupFd_ }, engineSock{ -1 }, state{ INFERENCE_POOL_INITIALIZING }, initialized{ false },
+      threadInitialize{ nullptr }, threadResultRouter{ nullptr },
+      sessionCount{ 0 }, idleSince{ std::chrono::steady_clock::now() }, nextRequestTag{ 0 }, submittedSinceFlush{ 0 }
+{
+    // the client that created the pool receives the initialization progress from the engine itself;
+    // the engine closes its own socket on failure, so the server can still notify and close the client
+    engineSock = dup(sock);
+#if ENABLE_OPENCL
+    engine = new InferenceEngine(engineSock, args, clientName, cmd);
+#else
+    engine = new InferenceEngineHip(engineSock, args, clientName, cmd);
+#endif
+    waitingClients.push_back(std::tuple<int,std::string,bool>(sock, clientName, false));
+}
+
+InferencePool::~InferencePool()
+{
+    if(threadInitialize && threadInitialize->joinable()) {
+        threadInitialize->join();
+    }
+    delete threadInitialize;
+    if(threadResultRouter) {
+        // drain the scheduler so that the router sees the endOfSequence from every device
+        engine->inputQ.enqueue(std::tuple<int,char*,int>(-1,nullptr,0));
+        threadResultRouter->join();
+        delete threadResultRouter;
+    }
+    delete engine;
+}
+
+std::string InferencePool::makeKey(const InfComCommand * cmd)
+{
+    // clients share an engine only when model, options, dimensions, GPUs, and result format all match
+    std::string key(cmd->message, strnlen(cmd->message, sizeof(cmd->message)));
+    for(int i = 1; i <= 11; i++) {
+        key += ":" + std::to_string(cmd->data[i]);
+    }
+    return key;
+}
+
+void InferencePool::startInitialization()
+{
+    threadInitialize = new std::thread(&InferencePool::workInitialize, this);
+}
+
+int InferencePool::finishInitialization()
+{
+    if(threadInitialize && threadInitialize->joinable()) {
+        threadInitialize->join();
+    }
+    initialized = true;
+    idleSince = std::chrono::steady_clock::now();
+    return state;
+}
+
+void InferencePool::addWaitingClient(int sock, const std::string& clientName)
+{
+    waitingClients.push_back(std::tuple<int,std::string,bool>(sock, clientName, true));
+}
+
+void InferencePool::takeWaitingClients(std::vector<std::tuple<int,std::string,bool>>& clients)
+{
+    clients.swap(waitingClients);
+    waitingClients.clear();
+}
+
+void InferencePool::attach(int sessionId)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    results[sessionId].clear();
+    sessionCount++;
+}
+
+void InferencePool::detach(int sessionId)
+{
+    // results of images still in flight for this session are dropped by the router
+    std::lock_guard<std::mutex> lock(mutex);
+    results.erase(sessionId);
+    if(--sessionCount == 0) {
+        idleSince = std::chrono::steady_clock::now();
+    }
+}
+
+bool InferencePool::isIdle(std::chrono::steady_clock::time_point now)
+{
+    return initialized && sessionCount == 0 &&
+           std::chrono::duration_cast<std::chrono::milliseconds>(now - idleSince).count() >= INFERENCE_POOL_LINGER_MSEC;
+}
+
+int InferencePool::getInputSlots()
+{
+    return MAX_INPUT_QUEUE_DEPTH - (int)engine->inputQ.size();
+}
+
+void InferencePool::submit(int sessionId, int tag, char * byteStream, int size)
+{
+    int requestTag = nextRequestTag;
+    nextRequestTag = (nextRequestTag == INT_MAX) ? 0 : nextRequestTag + 1;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        requests[requestTag] = std::tuple<int,int>(sessionId, tag);
+    }
+    engine->inputQ.enqueue(std::tuple<int,char*,int>(requestTag, byteStream, size));
+    submittedSinceFlush++;
+}
+
+void InferencePool::flush()
+{
+    // close the partially filled batch so that a waiting client doesn't stall behind it
+    if(submittedSinceFlush > 0) {
+        engine->inputQ.enqueue(std::tuple<int,char*,int>(INFERENCE_BATCH_FLUSH, nullptr, 0));
+        submittedSinceFlush = 0;
+    }
+}
+
+void InferencePool::popResults(int sessionId, std::deque<InferenceResult>& sessionResults)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = results.find(sessionId);
+    if(it != results.end()) {
+        sessionResults.swap(it->second);
+        it->second.clear();
+    }
+}
+
+void InferencePool::takeReadySessions(std::vector<int>& sessionIds)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    sessionIds.swap(readySessions);
+    readySessions.clear();
+}
+
+void InferencePool::wakeup()
+{
+    uint64_t one = 1;
+    if(write(wakeupFd, &one, sizeof(one)) != sizeof(one)) {
+        warning("InferencePool: wakeup failed for %s", key.c_str());
+    }
+}
+
+void InferencePool::workInitialize()
+{
+    int status = (engineSock >= 0) ? engine->initialize() : -1;
+    if(status == 0) {
+        close(engineSock);
+        threadResultRouter = new std::thread(&InferencePool::workResultRouter, this);
+    }
+    state = (status == 0) ? INFERENCE_POOL_READY : INFERENCE_POOL_FAILED;
+    wakeup();
+}
+
+void InferencePool::workResultRouter()
+{
+    info("workResultRouter: started for %s", key.c_str());
+    int totalResultCount = 0, droppedResultCount = 0;
+    for(int endOfSequenceCount = 0; endOfSequenceCount < engine->GPUs; ) {
+        std::tuple<int,int> output;
+        engine->outputQ.dequeue(output);
+        InferenceResult result;
+        int requestTag = std::get<0>(output);
+        result.label = std::get<1>(output);
+        if(requestTag < 0) {
+            endOfSequenceCount++;
+            continue;
+        }
+        // pick up the companion entries in the same order as the output copy stage produced them
+        if(engine->detectBoundingBoxes) {
+            if(result.label >= 0) {
+                engine->OutputQBB.dequeue(result.boundingBoxes);
+            }
+        }
+        else if(engine->topK > 0) {
+            engine->outputQTopk.dequeue(result.topK);
+        }
+        totalResultCount++;
+
+        // route the result to the session that submitted the image
+        bool notify = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto request = requests.find(requestTag);
+            if(request != requests.end()) {
+                int sessionId = std::get<0>(request->second);
+                result.tag = std::get<1>(request->second);
+                requests.erase(request);
+                auto it = results.find(sessionId);
+                if(it != results.end()) {
+                    if(it->second.empty()) {
+                        readySessions.push_back(sessionId);
+                        notify = true;
+                    }
+                    it->second.push_back(result);
+                }
+                else {
+                    droppedResultCount++;
+                }
+            }
+        }
+        if(notify) {
+            wakeup();
+        }
+    }
+    info("workResultRouter: terminated for %s [routed %d results, dropped %d]", key.c_str(), totalResultCount - droppedResultCount, droppedResultCount);
+}
+
+InferenceSession::InferenceSession(int id_, InferencePool * pool_, int sock_, const std::string& clientName_)
+    : id{ id_ }, pool{ pool_ }, sock{ sock_ }, clientName{ clientName_ },
+      state{ SESSION_IDLE }, expectedCommand{ -1 }, polling{ false }, endOfImageRequested{ false },
+      imageCountPending{ -1 }, imagesInFlight{ 0 }
+{
+    pool->attach(id);
+}
+
+InferenceSession::~InferenceSession()
+{
+    pool->detach(id);
+}
+
+int InferenceSession::start(bool sendReady)
+{
+    if(sendReady) {
+        // the engine is already warm: complete the initialization handshake in one step
+        InfComCommand updateCmd = {
+            INFCOM_MAGIC, INFCOM_CMD_INFERENCE_INITIALIZATION, { 100 }, "inference engine is ready"
+        };
+        ERRCHK(send(updateCmd));
+        expectedCommand = INFCOM_CMD_INFERENCE_INITIALIZATION;
+        state = SESSION_WAIT_ACK;
+        return 0;
+    }
+    return advance();
+}
+
+int InferenceSession::onWritable()
+{
+    return sendAvailable(sock, txBuffer, clientName);
+}
+
+int InferenceSession::send(const InfComCommand& cmd)
+{
+    const char * bytes = (const char *)&cmd;
+    txBuffer.insert(txBuffer.end(), bytes, bytes + sizeof(cmd));
+    return sendAvailable(sock, txBuffer, clientName);
+}
+
+int InferenceSession::fail(const char * format, ...)
+{
+    // same as error_close() without waiting for the client to acknowledge INFCOM_CMD_DONE
+    char text[1024];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    printf("ERROR: %s\n", text);
+    InfComCommand cmd = { INFCOM_MAGIC, INFCOM_CMD_DONE, { -1 }, { 0 } };
+    sprintf(cmd.message, "%.40s", text);
+    if(send(cmd) < 0)
+        return -1;
+    close(sock);
+    return -1;
+}
+
+int InferenceSession::onWakeup()
+{
+    return advance();
+}
+
+int InferenceSession::onIdleTimeout()
+{
+    polling = false;
+    return advance();
+}
+
+int InferenceSession::advance()
+{
+    if(state != SESSION_IDLE)
+        return 0;
+
+    // send all the available results to the client
+    if(txQueue.empty()) {
+        std::deque<InferenceResult> sessionResults;
+        pool->popResults(id, sessionResults);
+        imagesInFlight -= (int)sessionResults.size();
+        packResults(sessionResults);
+    }
+    if(!txQueue.empty()) {
+        InfComCommand cmd = txQueue.front();
+        txQueue.pop_front();
+        ERRCHK(send(cmd));
+        expectedCommand = cmd.command;
+        state = SESSION_WAIT_ACK;
+    }
+    else if(endOfImageRequested) {
+        // send INFCOM_CMD_DONE once every submitted image has been answered
+        if(imagesInFlight == 0) {
+            info("runInference: terminated for %s", clientName.c_str());
+            InfComCommand reply = {
+                INFCOM_MAGIC, INFCOM_CMD_DONE, { 0 }, { 0 }
+            };
+            ERRCHK(send(reply));
+            expectedCommand = INFCOM_CMD_DONE;
+            state = SESSION_WAIT_DONE;
+        }
+    }
+    else if(!polling) {
+        // request client to send images upto the number of empty slots in the input queue
+        int imageCountRequested = std::min(pool->getInputSlots(), (INFCOM_MAX_IMAGES_FOR_TOP1_PER_PACKET/2));
+        if(imageCountRequested > 0) {
+            InfComCommand cmd = {
+                INFCOM_MAGIC, INFCOM_CMD_SEND_IMAGES, { imageCountRequested }, { 0 }
+            };
+            ERRCHK(send(cmd));
+            expectedCommand = INFCOM_CMD_SEND_IMAGES;
+            imageCountPending = -1;
+            state = SESSION_WAIT_IMAGES;
+        }
+        else {
+            polling = true;
+        }
+    }
+    return 0;
+}
+
+int InferenceSession::onReadable()
+{
+    ERRCHK(recvAvailable(sock, rxBuffer, clientName));
+
+    // consume every complete reply that has arrived
+    size_t offset = 0;
+    int status = 0;
+    while(status == 0) {
+        const char * data = rxBuffer.data() + offset;
+        size_t available = rxBuffer.size() - offset;
+        if(state == SESSION_IDLE) {
+            break;
+        }
+        else if(state == SESSION_WAIT_IMAGES && imageCountPending > 0) {
+            size_t consumed = 0;
+            ERRCHK(receiveImage(data, available, consumed));
+            if(consumed == 0)
+                break;
+            offset += consumed;
+            imageCountPending--;
+        }
+        else {
+            if(available < sizeof(InfComCommand))
+                break;
+            InfComCommand reply;
+            memcpy(&reply, data, sizeof(reply));
+            offset += sizeof(reply);
+            if(reply.magic != INFCOM_MAGIC || reply.command != expectedCommand) {
+                dumpCommand("reply", reply);
+                return fail("received incorrect response to command %d from %s", expectedCommand, clientName.c_str());
+            }
+            if(state == SESSION_WAIT_DONE) {
+                status = 1;
+                break;
+            }
+            if(state == SESSION_WAIT_IMAGES) {
+                // check of endOfImageRequested and receive images one at a time
+                imageCountPending = reply.data[0];
+                if(imageCountPending < 0) {
+                    endOfImageRequested = true;
+                    imageCountPending = 0;
+                }
+                else if(imageCountPending == 0) {
+                    // client has nothing to send right now: ask again after INFERENCE_SERVICE_IDLE_TIME
+                    polling = true;
+                }
+            }
+        }
+        if(state == SESSION_WAIT_IMAGES && imageCountPending == 0) {
+            // client isn't sending more images now: don't leave its last images in a partial batch
+            if(polling || endOfImageRequested) {
+                pool->flush();
+            }
+            imageCountPending = -1;
+            state = SESSION_IDLE;
+        }
+        else if(state == SESSION_WAIT_ACK) {
+            state = SESSION_IDLE;
+        }
+        if(state == SESSION_IDLE) {
+            status = advance();
+        }
+    }
+    if(status >= 0) {
+        rxBuffer.erase(rxBuffer.begin(), rxBuffer.begin() + offset);
+    }
+    return status;
+}
+
+int InferenceSession::receiveImage(const char * data, size_t available, size_t& consumed)
+{
+    // get header with tag and size info
+    int header[2] = { 0, 0 };
+    if(available < sizeof(header))
+        return 0;
+    memcpy(header, data, sizeof(header));
+    int tag = header[0];
+    int size = header[1];
+    // do sanity check with unreasonable parameters
+    if(tag < 0 || size <= 0 || size > 50000000) {
+        return fail("invalid (tag:%d,size:%d) from %s", tag, size, clientName.c_str());
+    }
+    int eofMarker = 0;
+    size_t messageSize = sizeof(header) + size + sizeof(eofMarker);
+    if(available < messageSize)
+        return 0;
+    const char * payload = data + sizeof(header);
+    memcpy(&eofMarker, payload + size, sizeof(eofMarker));
+    if(eofMarker != INFCOM_EOF_MARKER) {
+        return fail("eofMarker 0x%08x (incorrect)", eofMarker);
+    }
+    char * byteStream = nullptr;
+    if(pool->getReceiveFileNames()) {
+        std::string fileNameDir = pool->getArguments()->getlocalShadowRootDir() + "/";
+        fileNameDir.append(std::string(payload, size));
+        FILE * fp = fopen(fileNameDir.c_str(), "rb");
+        if(!fp) {
+            return fail("filename %s (incorrect)", fileNameDir.c_str());
+        }
+        fseek(fp,0,SEEK_END);
+        int fsize = ftell(fp);
+        fseek(fp,0,SEEK_SET);
+        byteStream = new char [fsize];
+        size = (int)fread(byteStream, 1, fsize, fp);
+        fclose(fp);
+        if (size != fsize) {
+            delete[] byteStream;
+            return fail("error reading %d bytes from file:%s", fsize, fileNameDir.c_str());
+        }
+    }
+    else {
+        byteStream = new char [size];
+        memcpy(byteStream, payload, size);
+    }
+
+    // submit the input (tag,byteStream,size) to the shared scheduler
+    pool->submit(id, tag, byteStream, size);
+    imagesInFlight++;
+    consumed = messageSize;
+    return 0;
+}
+
+static void packBoundingBox(int * data, const ObjectBB& obj)
+{
+    data[0] = (unsigned int)((obj.y*0x7FFF)+0.5)<<16  | (unsigned int)((obj.x*0x7FFF)+0.5);
+    data[1] = (unsigned int)((obj.h*0x7FFF)+0.5)<<16  | (unsigned int)((obj.w*0x7FFF)+0.5);
+    data[2] = (unsigned int) ((obj.confidence*0x3FFFFFFF)+0.5);    // convert float to Q30.1
+    data[3] = obj.label;
+}
+
+void InferenceSession::packResults(std::deque<InferenceResult>& sessionResults)
+{
+    int topK = pool->getTopK();
+    if(pool->getDetectBoundingBoxes()) {
+        for(const InferenceResult& result : sessionResults) {
+            int numBB = (int)result.boundingBoxes.size();
+            if(!numBB) {
+                InfComCommand cmd = {
+                    INFCOM_MAGIC, INFCOM_CMD_BB_INFERENCE_RESULT, { result.tag, 0 }, { 0 }        // no bb detected
+                };
+                txQueue.push_back(cmd);
+                continue;
+            }
+            for(int j = 0; j < numBB; ) {
+                int numBB_per_message = std::min((numBB-j), 3);   // max 3 bb per mesasge
+                int bb_info = (numBB_per_message & 0xFFFF) | (numBB << 16);
+                InfComCommand cmd = {
+                    INFCOM_MAGIC, INFCOM_CMD_BB_INFERENCE_RESULT, { result.tag, bb_info }, { 0 }
+                };
+                for(int k = 0; k < numBB_per_message; k++, j++) {
+                    packBoundingBox(&cmd.data[2 + k * 4], result.boundingBoxes[j]);
+                }
+                txQueue.push_back(cmd);
+            }
+        }
+    }
+    else if(topK < 1) {
+        int maxResults = INFCOM_MAX_IMAGES_FOR_TOP1_PER_PACKET/2;
+        while(!sessionResults.empty()) {
+            int resultCount = std::min((int)sessionResults.size(), maxResults);
+            InfComCommand cmd = {
+                INFCOM_MAGIC, INFCOM_CMD_INFERENCE_RESULT, { resultCount, 0 }, { 0 }
+            };
+            for(int i = 0; i < resultCount; i++) {
+                cmd.data[2 + i * 2 + 0] = sessionResults.front().tag; // tag
+                cmd.data[2 + i * 2 + 1] = sessionResults.front().label; // label
+                sessionResults.pop_front();
+            }
+            txQueue.push_back(cmd);
+        }
+    }
+    else {
+        // send topK labels
+        int maxResults = INFCOM_MAX_IMAGES_FOR_TOP1_PER_PACKET/(topK+1);
+        while(!sessionResults.empty()) {
+            int resultCount = std::min((int)sessionResults.size(), maxResults);
+            InfComCommand cmd = {
+                INFCOM_MAGIC, INFCOM_CMD_TOPK_INFERENCE_RESULT, { resultCount, topK }, { 0 }
+            };
+            for(int i = 0; i < resultCount; i++) {
+                const InferenceResult& result = sessionResults.front();
+                cmd.data[2 + i * (topK+1) + 0] = result.tag; // tag
+                for (int j=0; j<topK && j<(int)result.topK.size(); j++){
+                    cmd.data[3 + i * (topK+1) + j] = result.topK[j]; // label[j]
+                }
+                sessionResults.pop_front();
+            }
+            txQueue.push_back(cmd);
+        }
+    }
+    sessionResults.clear();
+}
+
+#endif
@@ -24,6 +24,7 @@ THE SOFTWARE.
 #include "common.h"
 #include <stdio.h>
 #include <stdarg.h>
+#include <errno.h>
 
 #define INFCOM_DEBUG_DUMP      0 // for debugging network protocol
 #define INFCOM_ENABLE_NODELAY  0 // for debugging network protocol
@@ -64,6 +65,46 @@ int recvBuffer(int sock, void * buf, size_t len, std::string& clientName)
     return 0;
 }
 
+int recvAvailable(int sock, std::vector<char>& buf, std::string& clientName)
+{
+    // append whatever has arrived so far without blocking; returns number of bytes appended
+    int received = 0;
+    for(;;) {
+        size_t offset = buf.size();
+        buf.resize(offset + INFCOM_MAX_PACKET_SIZE);
+        int n = recv(sock, buf.data() + offset, INFCOM_MAX_PACKET_SIZE, MSG_DONTWAIT);
+        buf.resize(offset + std::max(n, 0));
+        if(n > 0) {
+            received += n;
+            continue;
+        }
+        if(n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+            break;
+        close(sock);
+        return error("recv() failed for %s (connection closed after %d bytes)", clientName.c_str(), received);
+    }
+    return received;
+}
+
+int sendAvailable(int sock, std::vector<char>& buf, std::string& clientName)
+{
+    // send as much as the socket accepts without blocking and keep the rest in buf
+    size_t sent = 0;
+    while(sent < buf.size()) {
+        int n = send(sock, buf.data() + sent, buf.size() - sent, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if(n > 0) {
+            sent += n;
+            continue;
+        }
+        if(n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+            break;
+        close(sock);
+        return error("send() failed for %s (%ld bytes pending)", clientName.c_str(), buf.size() - sent);
+    }
+    buf.erase(buf.begin(), buf.begin() + sent);
+    return 0;
+}
+
 int sendCommand(int sock, const InfComCommand& cmd, std::string& clientName)
 {
 #if INFCOM_DEBUG_DUMP
@@ -24,27 +24,26 @@ THE SOFTWARE.
 #include "configure.h"
 #include "compiler.h"
 #include "inference.h"
+#include "inference_pool.h"
 #include "netutil.h"
 #include "shadow.h"
 #include <thread>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unordered_set>
 
-int connection(int sock, Arguments * args, std::string clientName)
-{
-    info("== CONNECTED to %s ================", clientName.c_str());
+// configuration
+//   SERVER_MAX_EPOLL_EVENTS   - number of socket events handled per epoll_wait() call
+//   SERVER_POOL_CHECK_MSEC    - how often idle inference pools are checked for release
+#define SERVER_MAX_EPOLL_EVENTS        64
+#define SERVER_POOL_CHECK_MSEC         1000
 
-    // ask connection mode by sending InfComCommand:INFCOM_CMD_SEND_MODE
-    InfComCommand cmd = {
-        INFCOM_MAGIC, INFCOM_CMD_SEND_MODE, { 0 }, { 0 }
-    };
-    ERRCHK(sendCommand(sock, cmd, clientName));
-    ERRCHK(recvCommand(sock, cmd, clientName, INFCOM_CMD_SEND_MODE));
-    int mode = cmd.data[0];
-    if(mode != INFCOM_MODE_CONFIGURE && mode != INFCOM_MODE_COMPILER && mode != INFCOM_MODE_INFERENCE && mode != INFCOM_MODE_SHADOW) {
-        dumpCommand("reply", cmd);
-        close(sock);
-        return error("received incorrect response to INFCOM_CMD_SEND_MODE from %s", clientName.c_str());
-    }
+int connection(int sock, Arguments * args, std::string clientName, InfComCommand cmd)
+{
     // run proper module
+    int mode = cmd.data[0];
     int status = 0;
     if(mode == INFCOM_MODE_CONFIGURE) {
         status = runConfigure(sock, args, clientName, &cmd);
@@ -80,6 +79,433 @@ int connection(int sock, Arguments * args, std::string clientName)
     return status;
 }
 
+static int setNonBlocking(int sock, bool enable)
+{
+    int flags = fcntl(sock, F_GETFL, 0);
+    if(flags < 0)
+        return -1;
+    flags = enable ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+    return fcntl(sock, F_SETFL, flags);
+}
+
+//////
+// ServerEventLoop: a single thread multiplexes all client sockets with epoll.
+// Inference clients attach to a shared InferencePool per model configuration and are
+// served as InferenceSession state machines; configure, compiler, shadow, and rocAL
+// decode sessions are long blocking exchanges and keep running in their own thread.
+// Sockets are non-blocking while they are owned by the loop: output that a client
+// isn't ready to accept is buffered and sent when epoll reports the socket writable.
+//
+class ServerEventLoop {
+public:
+    ServerEventLoop(Arguments * args, int sockServer);
+    ~ServerEventLoop();
+    int run();
+
+private:
+    int watch(int sock);
+    void unwatch(int sock);
+    int watchOutput(int sock, bool pending);
+    void acceptClients();
+    void receiveMode(int sock);
+    void sendMode(int sock);
+    void handOver(int sock);
+    void rejectClient(int sock, std::string clientName, const char * message);
+    void attachInference(int sock, const std::string& clientName, InfComCommand& cmd);
+    void startSession(InferencePool * pool, int sock, const std::string& clientName, bool sendReady);
+    void updateSession(InferenceSession * session, int status);
+    void endSession(InferenceSession * session, int status);
+    void processWakeup();
+    void processIdleSessions();
+    void releaseIdlePools();
+
+    Arguments * args;
+    int sockServer;
+    int epollFd;
+    int wakeupFd;
+    int nextSessionId;
+    std::unordered_map<int,std::tuple<std::string,std::vector<char>,std::vector<char>>> pendingClients; // sock -> <clientName,received bytes,bytes to send>
+    std::unordered_set<int> outputWatched;   // sockets watched for EPOLLOUT
+    std::unordered_map<std::string,InferencePool *> pools;
+    std::unordered_map<int,InferenceSession *> sessionsBySock;
+    std::unordered_map<int,InferenceSession *> sessionsById;
+};
+
+ServerEventLoop::ServerEventLoop(Arguments * args_, int sockServer_)
+    : args{ args_ }, sockServer{ sockServer_ }, epollFd{ -1 }, wakeupFd{ -1 }, nextSessionId{ 0 }
+{
+}
+
+ServerEventLoop::~ServerEventLoop()
+{
+    for(auto& it : sessionsBySock) {
+        close(it.first);
+        delete it.second;
+    }
+    for(auto& it : pools) {
+        delete it.second;
+    }
+    if(wakeupFd >= 0) {
+        close(wakeupFd);
+    }
+    if(epollFd >= 0) {
+        close(epollFd);
+    }
+}
+
+int ServerEventLoop::watch(int sock)
+{
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = sock;
+    if(epoll_ctl(epollFd, EPOLL_CTL_ADD, sock, &event) < 0) {
+        return error("epoll_ctl(ADD,%d) failed (errno:%d)", sock, errno);
+    }
+    return 0;
+}
+
+void ServerEventLoop::unwatch(int sock)
+{
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, sock, nullptr);
+    outputWatched.erase(sock);
+}
+
+int ServerEventLoop::watchOutput(int sock, bool pending)
+{
+    // wait for EPOLLOUT only while there is buffered output for the socket
+    if(pending == (outputWatched.find(sock) != outputWatched.end()))
+        return 0;
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = pending ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+    event.data.fd = sock;
+    if(epoll_ctl(epollFd, EPOLL_CTL_MOD, sock, &event) < 0) {
+        return error("epoll_ctl(MOD,%d) failed (errno:%d)", sock, errno);
+    }
+    if(pending)
+        outputWatched.insert(sock);
+    else
+        outputWatched.erase(sock);
+    return 0;
+}
+
+int ServerEventLoop::run()
+{
+    epollFd = epoll_create1(0);
+    if(epollFd < 0) {
+        return error("epoll_create1() failed (errno:%d)", errno);
+    }
+    wakeupFd = eventfd(0, EFD_NONBLOCK);
+    if(wakeupFd < 0) {
+        return error("eventfd() failed (errno:%d)", errno);
+    }
+    fcntl(sockServer, F_SETFL, fcntl(sockServer, F_GETFL, 0) | O_NONBLOCK);
+    ERRCHK(watch(sockServer));
+    ERRCHK(watch(wakeupFd));
+
+    struct epoll_event events[SERVER_MAX_EPOLL_EVENTS];
+    for(;;) {
+        // sessions waiting for a client with nothing to send are polled every INFERENCE_SERVICE_IDLE_TIME
+        bool polling = false;
+        for(auto& it : sessionsBySock) {
+            if(it.second->isPolling()) {
+                polling = true;
+                break;
+            }
+        }
+        int timeout = polling ? std::max(INFERENCE_SERVICE_IDLE_TIME, 1) : SERVER_POOL_CHECK_MSEC;
+        int count = epoll_wait(epollFd, events, SERVER_MAX_EPOLL_EVENTS, timeout);
+        if(count < 0) {
+            if(errno == EINTR)
+                continue;
+            return error("epoll_wait() failed (errno:%d)", errno);
+        }
+        for(int i = 0; i < count; i++) {
+            int sock = events[i].data.fd;
+            if(sock == sockServer) {
+                acceptClients();
+                continue;
+            }
+            else if(sock == wakeupFd) {
+                processWakeup();
+                continue;
+            }
+            // flush buffered output first: a socket may be closed by the read that follows
+            if(events[i].events & EPOLLOUT) {
+                if(pendingClients.find(sock) != pendingClients.end()) {
+                    sendMode(sock);
+                }
+                else {
+                    auto it = sessionsBySock.find(sock);
+                    if(it != sessionsBySock.end()) {
+                        updateSession(it->second, it->second->onWritable());
+                    }
+                }
+            }
+            if(events[i].events & ~EPOLLOUT) {
+                if(pendingClients.find(sock) != pendingClients.end()) {
+                    receiveMode(sock);
+                }
+                else {
+                    auto it = sessionsBySock.find(sock);
+                    if(it != sessionsBySock.end()) {
+                        updateSession(it->second, it->second->onReadable());
+                    }
+                }
+            }
+        }
+        if(polling) {
+            processIdleSessions();
+        }
+        releaseIdlePools();
+    }
+    return 0;
+}
+
+void ServerEventLoop::acceptClients()
+{
+    struct sockaddr_in client_addr;
+    socklen_t clientlen = sizeof(client_addr);
+    int sockClient = -1;
+    while ((sockClient = accept4(sockServer, (struct sockaddr *)&client_addr, &clientlen, SOCK_NONBLOCK)) >= 0) {
+        // client info
+        char clientName[256] = "Unknown";
+        inet_ntop(AF_INET, &client_addr.sin_addr, clientName, sizeof(clientName));
+        info("== CONNECTED to %s ================", clientName);
+
+        // ask connection mode by sending InfComCommand:INFCOM_CMD_SEND_MODE
+        clientlen = sizeof(client_addr);
+        InfComCommand cmd = {
+            INFCOM_MAGIC, INFCOM_CMD_SEND_MODE, { 0 }, { 0 }
+        };
+        if(watch(sockClient) < 0) {
+            close(sockClient);
+            continue;
+        }
+        const char * bytes = (const char *)&cmd;
+        pendingClients[sockClient] = std::tuple<std::string,std::vector<char>,std::vector<char>>(
+            std::string(clientName), std::vector<char>(), std::vector<char>(bytes, bytes + sizeof(cmd)));
+        sendMode(sockClient);
+    }
+}
+
+void ServerEventLoop::sendMode(int sock)
+{
+    auto it = pendingClients.find(sock);
+    std::string clientName = std::get<0>(it->second);
+    std::vector<char>& pending = std::get<2>(it->second);
+    if(sendAvailable(sock, pending, clientName) < 0) {
+        outputWatched.erase(sock);
+        pendingClients.erase(it);
+        return;
+    }
+    if(watchOutput(sock, !pending.empty()) < 0) {
+        unwatch(sock);
+        close(sock);
+        pendingClients.erase(it);
+    }
+}
+
+void ServerEventLoop::handOver(int sock)
+{
+    // the socket leaves the event loop: its new owner uses blocking network calls
+    unwatch(sock);
+    setNonBlocking(sock, false);
+}
+
+void ServerEventLoop::rejectClient(int sock, std::string clientName, const char * message)
+{
+    // notify the client without blocking the event loop and close the connection
+    InfComCommand reply = {
+        INFCOM_MAGIC, INFCOM_CMD_DONE, { -1 }, { 0 }
+    };
+    snprintf(reply.message, sizeof(reply.message), "%s", message);
+    const char * bytes = (const char *)&reply;
+    std::vector<char> pending(bytes, bytes + sizeof(reply));
+    if(sendAvailable(sock, pending, clientName) == 0) {
+        close(sock);
+    }
+    info("== disconnected %s ================", clientName.c_str());
+}
+
+void ServerEventLoop::receiveMode(int sock)
+{
+    auto it = pendingClients.find(sock);
+    std::string clientName = std::get<0>(it->second);
+    std::vector<char>& received = std::get<1>(it->second);
+    if(recvAvailable(sock, received, clientName) < 0) {
+        outputWatched.erase(sock);
+        pendingClients.erase(it);
+        return;
+    }
+    if(received.size() < sizeof(InfComCommand))
+        return;
+    InfComCommand cmd;
+    memcpy(&cmd, received.data(), sizeof(cmd));
+    pendingClients.erase(it);
+    handOver(sock);
+
+    int mode = cmd.data[0];
+    if(cmd.magic != INFCOM_MAGIC || cmd.command != INFCOM_CMD_SEND_MODE ||
+       (mode != INFCOM_MODE_CONFIGURE && mode != INFCOM_MODE_COMPILER && mode != INFCOM_MODE_INFERENCE && mode != INFCOM_MODE_SHADOW))
+    {
+        dumpCommand("reply", cmd);
+        close(sock);
+        error("received incorrect response to INFCOM_CMD_SEND_MODE from %s", clientName.c_str());
+        return;
+    }
+#if INFERENCE_SCHEDULER_MODE == LIBRE_INFERENCE_SCHEDULER
+#if ENABLE_OPENCL
+    bool sharedEngine = (mode == INFCOM_MODE_INFERENCE);
+#else
+    bool sharedEngine = (mode == INFCOM_MODE_INFERENCE && cmd.data[11] == 0);
+#endif
+    if(sharedEngine) {
+        attachInference(sock, clientName, cmd);
+        return;
+    }
+#endif
+
+    // run client connection in a separate thread
+    std::thread work(connection, sock, args, clientName, cmd);
+    work.detach();
+}
+
+void ServerEventLoop::attachInference(int sock, const std::string& clientName, InfComCommand& cmd)
+{
+    std::string key = InferencePool::makeKey(&cmd);
+    auto it = pools.find(key);
+    if(it == pools.end()) {
+        // first client for this model: build the engine while other clients keep being served
+        info("inference pool [%s]: initializing for %s", key.c_str(), clientName.c_str());
+        InferencePool * pool = new InferencePool(key, sock, args, clientName, &cmd, wakeupFd);
+        pools[key] = pool;
+        pool->startInitialization();
+    }
+    else if(!it->second->isInitialized()) {
+        it->second->addWaitingClient(sock, clientName);
+    }
+    else {
+        info("inference pool [%s]: attached %s", key.c_str(), clientName.c_str());
+        startSession(it->second, sock, clientName, true);
+    }
+}
+
+void ServerEventLoop::startSession(InferencePool * pool, int sock, const std::string& clientName, bool sendReady)
+{
+    if(setNonBlocking(sock, true) < 0 || watch(sock) < 0) {
+        close(sock);
+        return;
+    }
+    InferenceSession * session = new InferenceSession(nextSessionId++, pool, sock, clientName);
+    sessionsBySock[sock] = session;
+    sessionsById[session->getId()] = session;
+    updateSession(session, session->start(sendReady));
+}
+
+void ServerEventLoop::updateSession(InferenceSession * session, int status)
+{
+    if(status == 0 && watchOutput(session->getSocket(), session->hasPendingOutput()) < 0) {
+        status = 1;
+    }
+    if(status != 0) {
+        endSession(session, status);
+    }
+}
+
+void ServerEventLoop::endSession(InferenceSession * session, int status)
+{
+    // on error the socket has already been closed by the failing network call
+    int sock = session->getSocket();
+    sessionsBySock.erase(sock);
+    sessionsById.erase(session->getId());
+    outputWatched.erase(sock);
+    if(status > 0) {
+        unwatch(sock);
+        close(sock);
+        info("== disconnected %s ================", session->getClientName().c_str());
+    }
+    delete session;
+}
+
+void ServerEventLoop::processWakeup()
+{
+    uint64_t value;
+    while(read(wakeupFd, &value, sizeof(value)) > 0) {
+    }
+
+    std::vector<std::string> failedPools;
+    for(auto& it : pools) {
+        InferencePool * pool = it.second;
+        // pools that just completed their initialization
+        if(!pool->isInitialized() && pool->getState() != INFERENCE_POOL_INITIALIZING) {
+            int state = pool->finishInitialization();
+            std::vector<std::tuple<int,std::string,bool>> clients;
+            pool->takeWaitingClients(clients);
+            for(auto& client : clients) {
+                int sock = std::get<0>(client);
+                std::string clientName = std::get<1>(client);
+                bool sendReady = std::get<2>(client);
+                if(state == INFERENCE_POOL_READY) {
+                    startSession(pool, sock, clientName, sendReady);
+                }
+                else {
+                    // the engine couldn't be created for the clients that were waiting on it,
+                    // including the one that created the pool
+                    rejectClient(sock, clientName, "inference engine initialization failed");
+                }
+            }
+            if(state != INFERENCE_POOL_READY) {
+                error("inference pool [%s]: initialization failed", pool->getKey().c_str());
+                failedPools.push_back(it.first);
+            }
+        }
+        // sessions with newly routed results
+        std::vector<int> sessionIds;
+        pool->takeReadySessions(sessionIds);
+        for(int id : sessionIds) {
+            auto session = sessionsById.find(id);
+            if(session != sessionsById.end()) {
+                updateSession(session->second, session->second->onWakeup());
+            }
+        }
+    }
+    for(auto& key : failedPools) {
+        delete pools[key];
+        pools.erase(key);
+    }
+}
+
+void ServerEventLoop::processIdleSessions()
+{
+    std::vector<InferenceSession *> idleSessions;
+    for(auto& it : sessionsBySock) {
+        if(it.second->isPolling()) {
+            idleSessions.push_back(it.second);
+        }
+    }
+    for(InferenceSession * session : idleSessions) {
+        updateSession(session, session->onIdleTimeout());
+    }
+}
+
+void ServerEventLoop::releaseIdlePools()
+{
+    // release GPUs and graphs of pools that have had no clients for INFERENCE_POOL_LINGER_MSEC
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    for(auto it = pools.begin(); it != pools.end(); ) {
+        if(it->second->isIdle(now)) {
+            info("inference pool [%s]: released after %d msec without clients", it->first.c_str(), INFERENCE_POOL_LINGER_MSEC);
+            delete it->second;
+            it = pools.erase(it);
+        }
+        else {
+            it++;
+        }
+    }
+}
+
 int server(Arguments * args)
 {
     // setup socket address structure and create socket
@@ -110,22 +536,15 @@ int server(Arguments * args)
     }
     info("listening on port %d for annInferenceApp connections ...", args->getPort());
 
-    // accept clients
-    struct sockaddr_in client_addr;
-    socklen_t clientlen = sizeof(client_addr);
-    int sockClient = -1;
-    while ((sockClient = accept(sockServer, (struct sockaddr *)&client_addr, &clientlen)) > 0) {
-        // client info
-        char clientName[256] = "Unknown";
-        inet_ntop(AF_INET, &client_addr.sin_addr, clientName, sizeof(clientName));
-
-        // run client connection in a separate thread
-        std::thread work(connection, sockClient, args, clientName);
-        work.detach();
+    // serve all clients from the event loop
+    int status = 0;
+    {
+        ServerEventLoop eventLoop(args, sockServer);
+        status = eventLoop.run();
     }
 
     // close server
     close(sockServer);
 
-    return 0;
+    return status;
 }
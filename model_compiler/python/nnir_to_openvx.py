@@ -358,17 +358,136 @@ def generateModuleCPP(graph,fileName,virtual_tensor_flag):
 #include <vx_amd_nn.h>
 #include <vx_ext_amd.h>
 #include <stdio.h>
+#include <string.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #define ERROR_CHECK_OBJECT(obj) { vx_status status = vxGetStatus((vx_reference)(obj)); if(status != VX_SUCCESS) { vxAddLogEntry((vx_reference)context, status     , "ERROR: failed with status = (%d) at " __FILE__ "#%d\\n", status, __LINE__); return status; } }
 #define ERROR_CHECK_STATUS(call) { vx_status status = (call); if(status != VX_SUCCESS) { vxAddLogEntry((vx_reference)context, status, "ERROR: failed with status = (%d) at " __FILE__ "#%d\\n", status, __LINE__); return status; } }
 
-static vx_status initializeTensor(vx_context context, vx_tensor tensor, FILE * fp, const char * binaryFilename)
+// weights file: a file magic followed by a (magic,size) header and the data of each variable, and an end-of-file magic.
+// In the aligned container (file magic 0xf00dd1e3 followed by the alignment) the data of each variable starts at a
+// multiple of the alignment, so the file is mapped and the variables are created on the mapped data without a copy.
+typedef struct {
+    const char * binaryFilename;
+    FILE * fp;                  // used when the file is not mapped
+    const vx_uint8 * base;      // mapped file
+    vx_size size;
+    vx_size offset;             // byte position of the next header
+    vx_size alignment;          // alignment of variable data in the file (1 for the legacy container)
+    std::vector<vx_tensor> variables;   // variables created so far, released when the load does not complete
+} weightsFile_t;
+
+#if !defined(_WIN32)
+// the mapping of a file is kept for the life of the process once a load of it completes, since the variables
+// created on it live as long as the graphs using them: a private mapping shares its pages with every process
+// that maps the same file, until a kernel writes to a page
+typedef struct {
+    const vx_uint8 * base;
+    vx_size size;
+    vx_uint32 loads;            // loads in progress on the mapping
+    bool kept;                  // a load of the file has completed
+} weightsMapping_t;
+static std::mutex weightsMappingsLock;
+static std::map<std::string, weightsMapping_t> weightsMappings;
+#endif
+
+static const vx_uint8 * mapWeightsFile(const char * binaryFilename, vx_size * size)
+{
+#if defined(_WIN32)
+    return nullptr;
+#else
+    int fd = open(binaryFilename, O_RDONLY);
+    if(fd < 0)
+        return nullptr;
+    struct stat st;
+    if(fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+    char key[128];
+    snprintf(key, sizeof(key), "%lu:%lu:%ld:%ld", (unsigned long)st.st_dev, (unsigned long)st.st_ino, (long)st.st_size, (long)st.st_mtime);
+    std::lock_guard<std::mutex> lock(weightsMappingsLock);
+    auto it = weightsMappings.find(key);
+    if(it == weightsMappings.end()) {
+        void * ptr = mmap(nullptr, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if(ptr == MAP_FAILED) {
+            close(fd);
+            return nullptr;
+        }
+        weightsMapping_t mapping = { (const vx_uint8 *)ptr, (vx_size)st.st_size, 0, false };
+        it = weightsMappings.insert(std::make_pair(std::string(key), mapping)).first;
+    }
+    close(fd);
+    it->second.loads++;
+    *size = it->second.size;
+    return it->second.base;
+#endif
+}
+
+// ends a load on a mapping: a mapping that no completed load uses goes away with its last load
+static void unmapWeightsFile(const vx_uint8 * base, bool completed)
+{
+#if !defined(_WIN32)
+    std::lock_guard<std::mutex> lock(weightsMappingsLock);
+    for(auto it = weightsMappings.begin(); it != weightsMappings.end(); it++) {
+        if(it->second.base == base) {
+            it->second.loads--;
+            it->second.kept = it->second.kept || completed;
+            if(!it->second.loads && !it->second.kept) {
+                munmap((void *)it->second.base, (size_t)it->second.size);
+                weightsMappings.erase(it);
+            }
+            break;
+        }
+    }
+#endif
+}
+
+static vx_status openWeightsFile(vx_context context, weightsFile_t * weights, const char * binaryFilename)
+{
+    *weights = weightsFile_t();
+    weights->binaryFilename = binaryFilename;
+    weights->fp = fopen(binaryFilename, "rb");
+    if(!weights->fp) {
+        vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: unable to open: %s\\n", binaryFilename);
+        return VX_FAILURE;
+    }
+    vx_uint32 h[2] = { 0, 0 };
+    if(fread(&h[0], 1, sizeof(h[0]), weights->fp) != sizeof(h[0]) || (h[0] != 0xf00dd1e0 && h[0] != 0xf00dd1e3)) {
+        vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: invalid file magic in %s\\n", binaryFilename);
+        fclose(weights->fp);
+        return VX_FAILURE;
+    }
+    weights->offset = sizeof(h[0]);
+    weights->alignment = 1;
+    if(h[0] == 0xf00dd1e3) {
+        if(fread(&h[1], 1, sizeof(h[1]), weights->fp) != sizeof(h[1]) || !h[1] || (h[1] & (h[1] - 1))) {
+            vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: invalid alignment in %s\\n", binaryFilename);
+            fclose(weights->fp);
+            return VX_FAILURE;
+        }
+        weights->offset = sizeof(h);
+        weights->alignment = h[1];
+        weights->base = mapWeightsFile(binaryFilename, &weights->size);
+        if(weights->base) {
+            fclose(weights->fp);
+            weights->fp = nullptr;
+        }
+    }
+    return VX_SUCCESS;
+}
+
+static vx_tensor createVariable(vx_context context, weightsFile_t * weights, vx_size num_of_dims, const vx_size * dims, vx_enum data_type)
 {
-    vx_enum data_type = VX_TYPE_FLOAT32;
-    vx_size num_of_dims = 4, dims[4] = { 1, 1, 1, 1 }, stride[4];
-    ERROR_CHECK_STATUS(vxQueryTensor(tensor, VX_TENSOR_DATA_TYPE, &data_type, sizeof(vx_enum)));
-    ERROR_CHECK_STATUS(vxQueryTensor(tensor, VX_TENSOR_NUMBER_OF_DIMS, &num_of_dims, sizeof(vx_size)));
-    ERROR_CHECK_STATUS(vxQueryTensor(tensor, VX_TENSOR_DIMS, &dims, num_of_dims * sizeof(vx_size)));
     vx_size itemsize = sizeof(float);
     if(data_type == VX_TYPE_UINT8 || data_type == VX_TYPE_INT8) {
         itemsize = sizeof(vx_uint8);
@@ -379,27 +498,106 @@ static vx_status initializeTensor(vx_context context, vx_tensor tensor, FILE * f
     else if(data_type == VX_TYPE_INT64) {
         itemsize = sizeof(vx_int64);
     }
-    vx_size count = dims[0] * dims[1] * dims[2] * dims[3];
-
-    vx_uint32 h[2] = { 0 };
-    fread(h, 1, sizeof(h), fp);
-    if(h[0] != 0xf00dd1e1 || (vx_size)h[1] != (count*itemsize)) {
-      vxAddLogEntry((vx_reference)tensor, VX_FAILURE, "ERROR: invalid data (magic,size)=(0x%x,%d) in %s at byte position %d -- expected size is %ld\\n", h[0], h[1], binaryFilename, ftell(fp)-sizeof(h), count*itemsize);
-      return VX_FAILURE;
+    vx_size stride[6], count = 1;
+    for(vx_size i = 0; i < num_of_dims; i++) {
+        stride[i] = itemsize * count;
+        count *= dims[i];
+    }
+
+    // the data follows the (magic,size) header at the next aligned position
+    vx_uint32 h[2] = { 0, 0 };
+    vx_size offset = ((weights->offset + sizeof(h) + weights->alignment - 1) & ~(weights->alignment - 1)) - sizeof(h);
+    if(weights->base) {
+        if(offset + sizeof(h) <= weights->size)
+            memcpy(h, weights->base + offset, sizeof(h));
+    }
+    else if(fseek(weights->fp, (long)offset, SEEK_SET) != 0 || fread(h, 1, sizeof(h), weights->fp) != sizeof(h)) {
+        h[0] = 0;
+    }
+    if(h[0] != 0xf00dd1e1 || (vx_size)h[1] != (count*itemsize) || (weights->base && offset + sizeof(h) + h[1] > weights->size)) {
+        vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: invalid data (magic,size)=(0x%x,%d) in %s at byte position %ld -- expected size is %ld\\n", h[0], h[1], weights->binaryFilename, offset, count*itemsize);
+        return nullptr;
+    }
+    offset += sizeof(h);
+    weights->offset = offset + h[1];
+
+    vx_tensor tensor = nullptr;
+    if(weights->base) {
+        tensor = vxCreateTensorFromHandle(context, num_of_dims, dims, data_type, 0, stride, (void *)(weights->base + offset), VX_MEMORY_TYPE_HOST);
+        if(vxGetStatus((vx_reference)tensor) == VX_SUCCESS) {
+            // commit without touching the data, so that device buffers get initialized from it
+            vx_map_id map_id;
+            void * ptr;
+            if(vxMapTensorPatch(tensor, num_of_dims, nullptr, nullptr, &map_id, stride, &ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST) == VX_SUCCESS)
+                vxUnmapTensorPatch(tensor, map_id);
+        }
     }
+    else {
+        tensor = vxCreateTensor(context, num_of_dims, dims, data_type, 0);
+        vx_map_id map_id;
+        void * ptr;
+        if(vxGetStatus((vx_reference)tensor) == VX_SUCCESS &&
+           vxMapTensorPatch(tensor, num_of_dims, nullptr, nullptr, &map_id, stride, &ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST) == VX_SUCCESS)
+        {
+            vx_size n = fread(ptr, itemsize, count, weights->fp);
+            vxUnmapTensorPatch(tensor, map_id);
+            if(n != count) {
+                vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: expected char[%ld], but got char[%ld] in %s\\n", count*itemsize, n*itemsize, weights->binaryFilename);
+                vxReleaseTensor(&tensor);
+            }
+        }
+    }
+    if(vxGetStatus((vx_reference)tensor) == VX_SUCCESS)
+        weights->variables.push_back(tensor);
+    return tensor;
+}
 
-    vx_map_id map_id;
-    void * ptr;
-    ERROR_CHECK_STATUS(vxMapTensorPatch(tensor, num_of_dims, nullptr, nullptr, &map_id, stride, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
-    vx_size n = fread(ptr, itemsize, count, fp);
-    if(n != count) {
-        vxAddLogEntry((vx_reference)tensor, VX_FAILURE, "ERROR: expected char[%ld], but got char[%ld] in %s\\n", count*itemsize, n*itemsize, binaryFilename);
+static vx_status closeWeightsFile(vx_context context, weightsFile_t * weights)
+{
+    vx_uint32 magic = 0;
+    if(weights->base) {
+        if(weights->offset + sizeof(magic) <= weights->size)
+            memcpy(&magic, weights->base + weights->offset, sizeof(magic));
+    }
+    else {
+        if(fseek(weights->fp, (long)weights->offset, SEEK_SET) != 0 || fread(&magic, 1, sizeof(magic), weights->fp) != sizeof(magic))
+            magic = 0;
+        fclose(weights->fp);
+        weights->fp = nullptr;
+    }
+    if(magic != 0xf00dd1e2) {
+        vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: invalid eoff magic in %s\\n", weights->binaryFilename);
         return VX_FAILURE;
     }
-    ERROR_CHECK_STATUS(vxUnmapTensorPatch(tensor, map_id));
-
+    weights->variables.clear();
+    if(weights->base) {
+        unmapWeightsFile(weights->base, true);
+        weights->base = nullptr;
+    }
     return VX_SUCCESS;
 }
+
+// releases what a load that did not complete holds: the variables created so far, the file and its mapping
+static void releaseWeightsFile(weightsFile_t * weights)
+{
+    for(auto& tensor : weights->variables)
+        vxReleaseTensor(&tensor);
+    weights->variables.clear();
+    if(weights->fp) {
+        fclose(weights->fp);
+        weights->fp = nullptr;
+    }
+    if(weights->base) {
+        unmapWeightsFile(weights->base, false);
+        weights->base = nullptr;
+    }
+}
+
+// releases a weights file on every return before closeWeightsFile succeeds
+struct weightsFileGuard_t {
+    weightsFile_t * weights;
+    ~weightsFileGuard_t() { releaseWeightsFile(weights); }
+};
 """ )
         if virtual_tensor_flag == 0:
             f.write( \
@@ -423,42 +621,20 @@ static vx_status initializeTensor(vx_context context, vx_tensor tensor, FILE * f
     // create variables
 """ % (', '.join(['vx_tensor ' + tensor.name for tensor in graph.inputs]), \
        ', '.join(['vx_tensor ' + tensor.name for tensor in graph.outputs])))
+        f.write( \
+"""    weightsFile_t weights__variables;
+    ERROR_CHECK_STATUS(openWeightsFile(context, &weights__variables, binaryFilename));
+    weightsFileGuard_t weights__guard = { &weights__variables };
+""")
         for tensor in graph.initializers:
             f.write( \
 """    vx_size dims_%s[%d] = { %s };
-    vx_tensor %s = vxCreateTensor(context, %d, dims_%s, %s, 0);
+    vx_tensor %s = createVariable(context, &weights__variables, %d, dims_%s, %s);
     ERROR_CHECK_OBJECT(%s);
 """ %(tensor.name, len(tensor.shape), ', '.join([str(v) for v in reversed(tensor.shape)]), \
       tensor.name, len(tensor.shape), tensor.name, tensor_type_nnir2openvx[tensor.type], tensor.name))
         f.write( \
-"""
-    // initialize variables
-    FILE * fp__variables = fopen(binaryFilename, "rb");
-    if(!fp__variables) {
-        vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: unable to open: %s\\n", binaryFilename);
-        return VX_FAILURE;
-    }
-    { vx_uint32 magic = 0;
-      fread(&magic, 1, sizeof(magic), fp__variables);
-      if(magic != 0xf00dd1e0) {
-        vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: invalid file magic in %s\\n", binaryFilename);
-        return VX_FAILURE;
-      }
-    }
-""")
-        for tensor in graph.initializers:
-            f.write( \
-"""    ERROR_CHECK_STATUS(initializeTensor(context, %s, fp__variables, binaryFilename));
-""" %(tensor.name))
-        f.write( \
-"""    { vx_uint32 magic = 0;
-      fread(&magic, 1, sizeof(magic), fp__variables);
-      if(magic != 0xf00dd1e2) {
-        vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: invalid eoff magic in %s\\n", binaryFilename);
-        return VX_FAILURE;
-      }
-      fclose(fp__variables);
-    }
+"""    ERROR_CHECK_STATUS(closeWeightsFile(context, &weights__variables));
 
     // create local tensors used in graph
 """)
@@ -2733,26 +2909,33 @@ int main(int argc, const char ** argv)
 }
 """)
 
-def generateBinary(graph,fileName):
+def generateBinary(graph,fileName,weightsAlignment):
     VARIABLES_FILE_MAGIC = 0xF00DD1E0
     VARIABLES_DATA_MAGIC = 0xF00DD1E1
     VARIABLES_EOFF_MAGIC = 0xF00DD1E2
+    VARIABLES_FILE_MAGIC_ALIGNED = 0xF00DD1E3
     print('creating ' + fileName + ' ...')
     with open(fileName, 'wb') as f:
-        f.write(struct.pack('I', VARIABLES_FILE_MAGIC))
+        if weightsAlignment > 0:
+            # aligned container: the data of each variable starts at a multiple of weightsAlignment
+            f.write(struct.pack('II', VARIABLES_FILE_MAGIC_ALIGNED, weightsAlignment))
+        else:
+            f.write(struct.pack('I', VARIABLES_FILE_MAGIC))
         for tensor in graph.initializers:
             binary = graph.binaries[tensor.name]
+            if weightsAlignment > 0:
+                f.write(b'\0' * (-(f.tell() + 8) % weightsAlignment))
             f.write(struct.pack('II', VARIABLES_DATA_MAGIC, len(binary)))
             f.write(binary)
         f.write(struct.pack('I', VARIABLES_EOFF_MAGIC))
 
-def generateCode(graph,argmaxOutput,outputFolder,virtual_tensor_flag):
+def generateCode(graph,argmaxOutput,outputFolder,virtual_tensor_flag,weightsAlignment=64):
     if not os.path.isdir(outputFolder):
         os.mkdir(outputFolder)
     generateCMakeFiles(graph,outputFolder)
     generateModuleH(graph,outputFolder + '/annmodule.h', virtual_tensor_flag)
     generateModuleCPP(graph,outputFolder + '/annmodule.cpp',virtual_tensor_flag)
-    generateBinary(graph,outputFolder + '/weights.bin')
+    generateBinary(graph,outputFolder + '/weights.bin',weightsAlignment)
     generateTestCPP(graph,argmaxOutput,outputFolder + '/anntest.cpp', virtual_tensor_flag)
     generatePythonH(graph,outputFolder + '/annpython.h', virtual_tensor_flag)
     generatePythonCPP(graph,outputFolder + '/annpython.cpp', virtual_tensor_flag)
@@ -2764,6 +2947,9 @@ Usage: python nnir_to_openvx.py [OPTIONS] <nnirInputFolder> <outputFolder>
 
   OPTIONS:
     --virtual_tensor 1                -- to make tensors non-virtual  (default: 1)               
+    --weights_alignment <bytes>       -- alignment of variables in weights.bin, which lets the generated code
+                                         map the file instead of reading it (power of 2, default: 64)
+    --weights_alignment 0             -- write weights.bin without alignment (read with fread)
     --argmax UINT8                    -- argmax at the end with 8-bit output
     --argmax UINT16                   -- argmax at the end with 16-bit output
     --argmax <fileNamePrefix>rgb.txt  -- argmax at the end with RGB color mapping using LUT
@@ -2784,6 +2970,7 @@ Usage: python nnir_to_openvx.py [OPTIONS] <nnirInputFolder> <outputFolder>
     pos = 1
     argmaxOutput = None
     virtual_tensor_flag = 1
+    weightsAlignment = 64
     while len(sys.argv[pos:]) >= 2 and sys.argv[pos][:2] == '--':
         if sys.argv[pos] == '--argmax':
             argmaxOutput = sys.argv[pos+1]
@@ -2802,6 +2989,11 @@ Usage: python nnir_to_openvx.py [OPTIONS] <nnirInputFolder> <outputFolder>
                         argmaxOutput = np.reshape(np.array([int(v) for v in f.read().split()]), [-1, 3]).transpose()
         elif sys.argv[pos] == '--virtual_tensor':
             virtual_tensor_flag = int(sys.argv[pos+1])
+        elif sys.argv[pos] == '--weights_alignment':
+            weightsAlignment = int(sys.argv[pos+1])
+            if weightsAlignment < 0 or (weightsAlignment & (weightsAlignment - 1)) != 0:
+                print('ERROR: invalid weights alignment: %d' % (weightsAlignment))
+                sys.exit(1)
         else:
             if sys.argv[pos] != '--help':
                 print('ERROR: invalid option: %s' % (sys.argv[pos]))
@@ -2824,7 +3016,7 @@ Usage: python nnir_to_openvx.py [OPTIONS] <nnirInputFolder> <outputFolder>
         elif len(tensor.shape) == 4:
             print('#OUTPUT-TENSOR: %s %d %d %d %d ' %(tensor.name, tensor.shape[0], tensor.shape[1], tensor.shape[2], tensor.shape[3]))
     print('creating C code in ' + outputFolder + ' ...')
-    generateCode(graph,argmaxOutput,outputFolder,virtual_tensor_flag)
+    generateCode(graph,argmaxOutput,outputFolder,virtual_tensor_flag,weightsAlignment)
 
 if __name__ == '__main__':
     main()
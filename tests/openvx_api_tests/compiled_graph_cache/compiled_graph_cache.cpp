@@ -0,0 +1,364 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+static int cache_hits = 0, cache_rejects = 0;
+
+static void VX_CALLBACK cache_log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    if (strstr(string, "agoOptimizeDramaCacheLoad: loaded"))
+        cache_hits++;
+    if (strstr(string, "agoOptimizeDramaCacheLoad: ignored"))
+        cache_rejects++;
+    log_callback(context, ref, status, string);
+}
+
+// graph with nodes that the optimizer divides into several kernels and extra virtual data:
+// RGB -> NV12 -> Y -> Gaussian 3x3 (constant border) -> Equalize Histogram -> Not, and MeanStdDev of Y
+static vx_graph create_graph(vx_context context, vx_image input, vx_image output, vx_scalar mean, vx_scalar stddev, const char *cacheDir)
+{
+    vx_uint32 width, height;
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    if (cacheDir)
+        ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_COMPILED_GRAPH_CACHE, cacheDir, strlen(cacheDir) + 1));
+
+    vx_image nv12 = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_NV12);
+    ERROR_CHECK_OBJECT(nv12);
+    vx_image virt[3];
+    for (int i = 0; i < 3; i++)
+    {
+        virt[i] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(virt[i]);
+    }
+    vx_image gauss = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(gauss);
+
+    vx_node nodes[] =
+        {
+            vxColorConvertNode(graph, input, nv12),
+            vxChannelExtractNode(graph, nv12, VX_CHANNEL_Y, virt[0]),
+            vxGaussian3x3Node(graph, virt[0], gauss),
+            vxEqualizeHistNode(graph, gauss, virt[1]),
+            vxNotNode(graph, virt[1], output),
+            vxMeanStdDevNode(graph, virt[0], mean, stddev)};
+
+    vx_border_t border = {VX_BORDER_CONSTANT};
+    border.constant_value.U8 = 64;
+    ERROR_CHECK_STATUS(vxSetNodeAttribute(nodes[2], VX_NODE_BORDER, &border, sizeof(border)));
+    for (vx_size i = 0; i < sizeof(nodes) / sizeof(nodes[0]); i++)
+    {
+        ERROR_CHECK_OBJECT(nodes[i]);
+        ERROR_CHECK_STATUS(vxReleaseNode(&nodes[i]));
+    }
+    ERROR_CHECK_STATUS(vxReleaseImage(&nv12));
+    for (int i = 0; i < 3; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&virt[i]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&gauss));
+    return graph;
+}
+
+// chain of nodes that the optimizer divides and merges: its time dominates vxVerifyGraph of small images
+static vx_graph create_chain_graph(vx_context context, vx_image input, vx_image output, int stages, const char *cacheDir)
+{
+    vx_uint32 width, height;
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    if (cacheDir)
+        ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_COMPILED_GRAPH_CACHE, cacheDir, strlen(cacheDir) + 1));
+    vx_image y = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(y);
+    vx_node node = vxChannelExtractNode(graph, input, VX_CHANNEL_G, y);
+    ERROR_CHECK_OBJECT(node);
+    ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    for (int i = 0; i < stages; i++)
+    {
+        vx_image virt[4];
+        for (int k = 0; k < 4; k++)
+        {
+            virt[k] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+            ERROR_CHECK_OBJECT(virt[k]);
+        }
+        vx_image out = (i == stages - 1) ? output : vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(out);
+        vx_node nodes[] =
+            {
+                vxGaussian3x3Node(graph, y, virt[0]),
+                vxEqualizeHistNode(graph, virt[0], virt[1]),
+                vxNotNode(graph, virt[1], virt[2]),
+                vxDilate3x3Node(graph, virt[2], virt[3]),
+                vxAndNode(graph, virt[3], y, out)};
+        vx_border_t border = {VX_BORDER_CONSTANT};
+        border.constant_value.U8 = (vx_uint8)i;
+        ERROR_CHECK_STATUS(vxSetNodeAttribute(nodes[0], VX_NODE_BORDER, &border, sizeof(border)));
+        ERROR_CHECK_STATUS(vxSetNodeAttribute(nodes[3], VX_NODE_BORDER, &border, sizeof(border)));
+        for (vx_size k = 0; k < sizeof(nodes) / sizeof(nodes[0]); k++)
+        {
+            ERROR_CHECK_OBJECT(nodes[k]);
+            ERROR_CHECK_STATUS(vxReleaseNode(&nodes[k]));
+        }
+        for (int k = 0; k < 4; k++)
+            ERROR_CHECK_STATUS(vxReleaseImage(&virt[k]));
+        ERROR_CHECK_STATUS(vxReleaseImage(&y));
+        y = out;
+    }
+    return graph;
+}
+
+static void write_input(vx_image image, vx_uint32 width, vx_uint32 height)
+{
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    vx_uint8 *ptr = nullptr;
+    ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, 0, &map_id, &addr, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    for (vx_uint32 y = 0; y < height; y++)
+    {
+        vx_uint8 *row = ptr + y * addr.stride_y;
+        for (vx_uint32 x = 0; x < width * 3; x++)
+            row[x] = (vx_uint8)((x * 7 + y * 13 + ((x ^ y) & 0x3f)) & 0xff);
+    }
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+}
+
+static void read_image(vx_image image, vx_uint32 width, vx_uint32 height, std::vector<vx_uint8>& pixels)
+{
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_imagepatch_addressing_t addr = {0};
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    pixels.resize((size_t)width * height);
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, pixels.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+}
+
+static void damage_cache_files(const char *cacheDir)
+{
+    // overwrite the node records at the end of the files: magic, key, and 5 words of header come first
+    DIR *dir = opendir(cacheDir);
+    if (dir)
+    {
+        for (struct dirent *entry; (entry = readdir(dir)) != nullptr;)
+        {
+            if (!strncmp(entry->d_name, "ago-graph-", 10))
+            {
+                FILE *fp = fopen((std::string(cacheDir) + "/" + entry->d_name).c_str(), "r+b");
+                vx_uint32 header[5] = {0};
+                if (fp && !fseek(fp, 16, SEEK_SET) && fread(header, sizeof(header), 1, fp) == 1 && !fseek(fp, -(long)(header[4] * 4), SEEK_END))
+                {
+                    std::vector<vx_uint8> records(header[4] * 4, 0xff);
+                    fwrite(records.data(), 1, records.size(), fp);
+                }
+                if (fp)
+                    fclose(fp);
+            }
+        }
+        closedir(dir);
+    }
+}
+
+static int count_cache_files(const char *cacheDir, bool removeFiles)
+{
+    int count = 0;
+    DIR *dir = opendir(cacheDir);
+    if (dir)
+    {
+        for (struct dirent *entry; (entry = readdir(dir)) != nullptr;)
+        {
+            if (!strncmp(entry->d_name, "ago-graph-", 10))
+            {
+                count++;
+                if (removeFiles)
+                    remove((std::string(cacheDir) + "/" + entry->d_name).c_str());
+            }
+        }
+        closedir(dir);
+    }
+    return count;
+}
+
+int main(int argc, char **argv)
+{
+    vx_uint32 width = 1920, height = 1080;
+    const char *cacheDir = (argc > 1) ? argv[1] : "compiled_graph_cache";
+    mkdir(cacheDir, 0755);
+    count_cache_files(cacheDir, true);
+
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, cache_log_callback, vx_false_e);
+
+    vx_image input_rgb_image = vxCreateImage(context, width, height, VX_DF_IMAGE_RGB);
+    ERROR_CHECK_OBJECT(input_rgb_image);
+    write_input(input_rgb_image, width, height);
+
+    // graph[0]: no cache, graph[1]: populates the cache, graph[2]: loads from the cache,
+    // graph[3]: ignores the damaged file, which the context reads again for another spelling of the directory
+    std::string cacheDirAlias = std::string(cacheDir) + "/.";
+    const char *graphCacheDir[4] = {nullptr, cacheDir, cacheDir, cacheDirAlias.c_str()};
+    const char *graphCacheUse[4] = {"without cache", "with cache miss", "with cache hit", "with damaged cache"};
+    std::vector<vx_uint8> pixels[4];
+    vx_float32 mean[4], stddev[4];
+    for (int i = 0; i < 4; i++)
+    {
+        if (i == 3)
+            damage_cache_files(cacheDir);
+        vx_image output_image = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+        vx_scalar mean_scalar = vxCreateScalar(context, VX_TYPE_FLOAT32, &mean[i]);
+        vx_scalar stddev_scalar = vxCreateScalar(context, VX_TYPE_FLOAT32, &stddev[i]);
+        ERROR_CHECK_OBJECT(output_image);
+        ERROR_CHECK_OBJECT(mean_scalar);
+        ERROR_CHECK_OBJECT(stddev_scalar);
+        vx_graph graph = create_graph(context, input_rgb_image, output_image, mean_scalar, stddev_scalar, graphCacheDir[i]);
+
+        auto start = std::chrono::steady_clock::now();
+        ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+        auto end = std::chrono::steady_clock::now();
+        std::chrono::duration<double> elapsed_seconds = end - start;
+        std::cout << "STATUS: vxVerifyGraph() " << graphCacheUse[i] << " took " << (elapsed_seconds.count() * 1000.0f) << "msec\n";
+
+        ERROR_CHECK_STATUS(vxProcessGraph(graph));
+        read_image(output_image, width, height, pixels[i]);
+        ERROR_CHECK_STATUS(vxCopyScalar(mean_scalar, &mean[i], VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+        ERROR_CHECK_STATUS(vxCopyScalar(stddev_scalar, &stddev[i], VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+
+        ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+        ERROR_CHECK_STATUS(vxReleaseImage(&output_image));
+        ERROR_CHECK_STATUS(vxReleaseScalar(&mean_scalar));
+        ERROR_CHECK_STATUS(vxReleaseScalar(&stddev_scalar));
+    }
+
+    int files = count_cache_files(cacheDir, true);
+    if (files != 1 || cache_hits != 1 || cache_rejects != 1)
+    {
+        printf("ERROR: expected one cache file, one cache hit and one damaged file: found %d files, %d hits and %d damaged\n", files,
+               cache_hits, cache_rejects);
+        return 1;
+    }
+    for (int i = 1; i < 4; i++)
+    {
+        if (pixels[i] != pixels[0] || mean[i] != mean[0] || stddev[i] != stddev[0])
+        {
+            printf("ERROR: output mismatch of graph#%d with compiled graph cache\n", i);
+            return 1;
+        }
+    }
+    printf("STATUS: outputs match\n");
+
+    // best of several runs: a cache hit must take less time than the optimizer
+    vx_uint32 chain_width = 320, chain_height = 240;
+    vx_image chain_input = vxCreateImage(context, chain_width, chain_height, VX_DF_IMAGE_RGB);
+    vx_image chain_output = vxCreateImage(context, chain_width, chain_height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(chain_input);
+    ERROR_CHECK_OBJECT(chain_output);
+    write_input(chain_input, chain_width, chain_height);
+    double best_time[2] = {1e9, 1e9};
+    std::vector<vx_uint8> chain_pixels[2];
+    cache_hits = 0;
+    for (int i = 0; i < 11; i++)
+    {
+        // run#0 populates the cache, odd runs are without cache and even runs load from the cache
+        int cached = (i == 0 || (i & 1) == 0) ? 1 : 0;
+        vx_graph graph = create_chain_graph(context, chain_input, chain_output, 48, cached ? cacheDir : nullptr);
+        auto start = std::chrono::steady_clock::now();
+        ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+        auto end = std::chrono::steady_clock::now();
+        std::chrono::duration<double> elapsed_seconds = end - start;
+        if (i > 0 && elapsed_seconds.count() < best_time[cached])
+            best_time[cached] = elapsed_seconds.count();
+        ERROR_CHECK_STATUS(vxProcessGraph(graph));
+        read_image(chain_output, chain_width, chain_height, chain_pixels[cached]);
+        if (i > 0 && chain_pixels[1] != chain_pixels[0])
+        {
+            printf("ERROR: output mismatch of graph chain with compiled graph cache\n");
+            return 1;
+        }
+        ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    }
+    count_cache_files(cacheDir, true);
+    printf("STATUS: vxVerifyGraph() of graph chain took %.3f msec without cache and %.3f msec with cache hit\n",
+           best_time[0] * 1000.0, best_time[1] * 1000.0);
+    if (cache_hits != 5 || best_time[1] >= best_time[0])
+    {
+        printf("ERROR: expected 5 cache hits faster than the optimizer: found %d hits\n", cache_hits);
+        return 1;
+    }
+    ERROR_CHECK_STATUS(vxReleaseImage(&chain_input));
+    ERROR_CHECK_STATUS(vxReleaseImage(&chain_output));
+
+    ERROR_CHECK_STATUS(vxReleaseImage(&input_rgb_image));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+
+    return 0;
+}
@@ -0,0 +1,233 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <sched.h>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+#define KERNEL_RECORD_AFFINITY (VX_KERNEL_BASE(VX_ID_DEFAULT, 0) + 0x001)
+
+static std::vector<int> get_affinity()
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) != 0)
+    {
+        printf("ERROR: sched_getaffinity failed\n");
+        exit(1);
+    }
+    std::vector<int> cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+    {
+        if (CPU_ISSET(cpu, &set))
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+// CPUs of the thread that executed the last record_affinity node
+static std::vector<int> g_node_affinity;
+
+static vx_status VX_CALLBACK record_affinity_validate(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
+{
+    return vxSetMetaFormatFromReference(metas[1], parameters[0]);
+}
+
+static vx_status VX_CALLBACK record_affinity_process(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    g_node_affinity = get_affinity();
+    return VX_SUCCESS;
+}
+
+static vx_status set_affinity(vx_context context, vx_int32 numa_node, const char *cpu_list)
+{
+    AgoCpuAffinityInfo info = {0};
+    info.numa_node = numa_node;
+    strncpy(info.cpu_list, cpu_list, sizeof(info.cpu_list) - 1);
+    return vxSetContextAttribute(context, VX_CONTEXT_ATTRIBUTE_AMD_CPU_AFFINITY, &info, sizeof(info));
+}
+
+int main(int argc, char **argv)
+{
+    vx_uint32 width = 640, height = 480;
+
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+
+    vx_kernel kernel = vxAddUserKernel(context, "app.test.record_affinity", KERNEL_RECORD_AFFINITY, record_affinity_process, 2,
+                                       record_affinity_validate, nullptr, nullptr);
+    ERROR_CHECK_OBJECT(kernel);
+    ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+    ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 1, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+    ERROR_CHECK_STATUS(vxFinalizeKernel(kernel));
+
+    // no binding by default
+    AgoCpuAffinityInfo info;
+    ERROR_CHECK_STATUS(vxQueryContext(context, VX_CONTEXT_ATTRIBUTE_AMD_CPU_AFFINITY, &info, sizeof(info)));
+    if (info.numa_node != -1 || info.cpu_list[0])
+    {
+        printf("ERROR: unexpected default CPU affinity: numa_node=%d cpu_list=%s\n", info.numa_node, info.cpu_list);
+        return 1;
+    }
+
+    // invalid bindings are rejected
+    if (set_affinity(context, 4096, "") != VX_ERROR_INVALID_VALUE || set_affinity(context, -1, "0-x") != VX_ERROR_INVALID_VALUE ||
+        set_affinity(context, -1, "3-1") != VX_ERROR_INVALID_VALUE || set_affinity(context, -1, "0-4000000000") != VX_ERROR_INVALID_VALUE ||
+        set_affinity(context, -1, "99999999999999999999") != VX_ERROR_INVALID_VALUE)
+    {
+        printf("ERROR: invalid CPU affinity accepted\n");
+        return 1;
+    }
+
+    // bind to the last CPU this process may run on
+    std::vector<int> callerCpus = get_affinity();
+    int cpu = callerCpus.back();
+    std::string cpuList = std::to_string(cpu);
+    ERROR_CHECK_STATUS(set_affinity(context, -1, cpuList.c_str()));
+    ERROR_CHECK_STATUS(vxQueryContext(context, VX_CONTEXT_ATTRIBUTE_AMD_CPU_AFFINITY, &info, sizeof(info)));
+    if (info.numa_node != -1 || cpuList != info.cpu_list)
+    {
+        printf("ERROR: CPU affinity query mismatch: numa_node=%d cpu_list=%s\n", info.numa_node, info.cpu_list);
+        return 1;
+    }
+
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_image input = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image output = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image virt = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(input);
+    ERROR_CHECK_OBJECT(output);
+    ERROR_CHECK_OBJECT(virt);
+    vx_node node = vxCreateGenericNode(graph, kernel);
+    ERROR_CHECK_OBJECT(node);
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 0, (vx_reference)input));
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 1, (vx_reference)virt));
+    vx_node notNode = vxNotNode(graph, virt, output);
+    ERROR_CHECK_OBJECT(notNode);
+
+    // buffers are allocated with the caller bound to the CPU, which shall be restored afterwards
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    if (get_affinity() != callerCpus)
+    {
+        printf("ERROR: vxVerifyGraph didn't restore the CPU affinity of the caller\n");
+        return 1;
+    }
+
+    // scheduled graphs run on the graph thread, which is bound to the CPU
+    ERROR_CHECK_STATUS(vxScheduleGraph(graph));
+    ERROR_CHECK_STATUS(vxWaitGraph(graph));
+    if (g_node_affinity != std::vector<int>{cpu})
+    {
+        printf("ERROR: scheduled graph didn't run on CPU %d (ran on %zu CPUs)\n", cpu, g_node_affinity.size());
+        return 1;
+    }
+
+    // vxProcessGraph runs on the caller, which isn't moved
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    if (g_node_affinity != callerCpus)
+    {
+        printf("ERROR: vxProcessGraph changed the CPU affinity of the caller\n");
+        return 1;
+    }
+
+    // a NUMA node binds to all of its CPUs
+    vx_status status = set_affinity(context, 0, "");
+    if (status == VX_SUCCESS)
+    {
+        ERROR_CHECK_STATUS(vxQueryContext(context, VX_CONTEXT_ATTRIBUTE_AMD_CPU_AFFINITY, &info, sizeof(info)));
+        if (info.numa_node != 0)
+        {
+            printf("ERROR: CPU affinity query mismatch: numa_node=%d\n", info.numa_node);
+            return 1;
+        }
+    }
+    else
+    {
+        printf("STATUS: NUMA node 0 is not available (status = %d)\n", status);
+    }
+
+    // clear the binding
+    ERROR_CHECK_STATUS(set_affinity(context, -1, ""));
+    ERROR_CHECK_STATUS(vxQueryContext(context, VX_CONTEXT_ATTRIBUTE_AMD_CPU_AFFINITY, &info, sizeof(info)));
+    if (info.numa_node != -1 || info.cpu_list[0])
+    {
+        printf("ERROR: CPU affinity wasn't cleared\n");
+        return 1;
+    }
+
+    ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    ERROR_CHECK_STATUS(vxReleaseNode(&notNode));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+    ERROR_CHECK_STATUS(vxReleaseImage(&virt));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+
+    printf("STATUS: CPU affinity OK\n");
+    return 0;
+}
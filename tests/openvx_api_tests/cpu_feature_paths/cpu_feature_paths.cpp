@@ -0,0 +1,186 @@
+/*
+Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+static void fill_image(vx_image image, vx_uint32 width, vx_uint32 height, int seed)
+{
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    vx_uint8 *ptr = nullptr;
+    ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, 0, &map_id, &addr, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    vx_uint32 rowBytes = width * addr.stride_x;
+    vx_uint32 state = 12345 + seed;
+    for (vx_uint32 j = 0; j < height; j++)
+        for (vx_uint32 i = 0; i < rowBytes; i++)
+        {
+            state = state * 1103515245 + 12345;
+            ptr[j * addr.stride_y + i] = (vx_uint8)(state >> 16);
+        }
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+}
+
+static void read_plane(vx_image image, vx_uint32 plane, std::vector<vx_uint8> &pixels)
+{
+    vx_uint32 width = 0, height = 0;
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    vx_uint8 *ptr = nullptr;
+    ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, plane, &map_id, &addr, (void **)&ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    vx_uint32 rows = addr.dim_y * addr.scale_y / VX_SCALE_UNITY, rowBytes = addr.dim_x * addr.scale_x / VX_SCALE_UNITY * addr.stride_x;
+    for (vx_uint32 j = 0; j < rows; j++)
+        pixels.insert(pixels.end(), ptr + j * addr.stride_y, ptr + j * addr.stride_y + rowBytes);
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+}
+
+// runs the kernels that have AVX2/AVX-512 variants and returns all output pixels
+static void run_kernels(vx_uint32 width, vx_uint32 height, std::vector<vx_uint8> &pixels)
+{
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+
+    vx_image input[3] = {vxCreateImage(context, width, height, VX_DF_IMAGE_U8), vxCreateImage(context, width, height, VX_DF_IMAGE_U8),
+                         vxCreateImage(context, width, height, VX_DF_IMAGE_RGBX)};
+    vx_image output[7] = {
+        vxCreateImage(context, width, height, VX_DF_IMAGE_U8),   // box 3x3
+        vxCreateImage(context, width, height, VX_DF_IMAGE_U8),   // gaussian 3x3
+        vxCreateImage(context, width, height, VX_DF_IMAGE_U8),   // add
+        vxCreateImage(context, width, height, VX_DF_IMAGE_S16),  // add
+        vxCreateImage(context, width, height, VX_DF_IMAGE_U8),   // subtract
+        vxCreateImage(context, width, height, VX_DF_IMAGE_U8),   // absdiff
+        vxCreateImage(context, width, height, VX_DF_IMAGE_U8),   // color convert: luma only
+    };
+    for (int i = 0; i < 3; i++)
+    {
+        ERROR_CHECK_OBJECT(input[i]);
+        fill_image(input[i], width, height, i);
+    }
+    for (int i = 0; i < 7; i++)
+        ERROR_CHECK_OBJECT(output[i]);
+    vx_image yuv = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_IYUV);
+    ERROR_CHECK_OBJECT(yuv);
+    vx_node nodes[8] = {
+        vxBox3x3Node(graph, input[0], output[0]),
+        vxGaussian3x3Node(graph, input[0], output[1]),
+        vxAddNode(graph, input[0], input[1], VX_CONVERT_POLICY_SATURATE, output[2]),
+        vxAddNode(graph, input[0], input[1], VX_CONVERT_POLICY_WRAP, output[3]),
+        vxSubtractNode(graph, input[0], input[1], VX_CONVERT_POLICY_SATURATE, output[4]),
+        vxAbsDiffNode(graph, input[0], input[1], output[5]),
+        vxColorConvertNode(graph, input[2], yuv),
+        vxChannelExtractNode(graph, yuv, VX_CHANNEL_Y, output[6]),
+    };
+    for (int i = 0; i < 8; i++)
+    {
+        ERROR_CHECK_OBJECT(nodes[i]);
+        ERROR_CHECK_STATUS(vxReleaseNode(&nodes[i]));
+    }
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+
+    pixels.clear();
+    for (int i = 0; i < 7; i++)
+        read_plane(output[i], 0, pixels);
+
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseImage(&yuv));
+    for (int i = 0; i < 3; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&input[i]));
+    for (int i = 0; i < 7; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&output[i]));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+}
+
+int main(int argc, char **argv)
+{
+    // odd row lengths so that the vector loops and the scalar tails both run
+    vx_uint32 sizes[3][2] = {{1920, 1080}, {334, 68}, {50, 18}};
+    for (int s = 0; s < 3; s++)
+    {
+        vx_uint32 width = sizes[s][0], height = sizes[s][1];
+        std::vector<vx_uint8> pixels[2];
+        // the widest variants supported by this CPU
+        unsetenv("AGO_CPU_FEATURE_MASK");
+        run_kernels(width, height, pixels[0]);
+        // baseline: only SSE4.2 primitives
+        setenv("AGO_CPU_FEATURE_MASK", "0", 1);
+        run_kernels(width, height, pixels[1]);
+        unsetenv("AGO_CPU_FEATURE_MASK");
+        if (pixels[0] != pixels[1])
+        {
+            size_t i = 0;
+            while (pixels[0][i] == pixels[1][i])
+                i++;
+            printf("ERROR: %ux%u outputs differ from the SSE4.2 path at byte %zu of %zu\n", width, height, i, pixels[0].size());
+            return 1;
+        }
+        printf("STATUS: %ux%u outputs match the SSE4.2 path\n", width, height);
+    }
+    return 0;
+}
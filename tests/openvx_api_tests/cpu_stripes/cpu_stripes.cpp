@@ -0,0 +1,186 @@
+/*
+Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+static void fill_image(vx_image image, int seed)
+{
+    vx_uint32 width = 0, height = 0;
+    vx_size planes = 0;
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_PLANES, &planes, sizeof(planes)));
+    vx_uint32 state = 12345 + seed;
+    for (vx_uint32 plane = 0; plane < (vx_uint32)planes; plane++)
+    {
+        vx_rectangle_t rect = {0, 0, width, height};
+        vx_map_id map_id;
+        vx_imagepatch_addressing_t addr;
+        vx_uint8 *ptr = nullptr;
+        ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, plane, &map_id, &addr, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+        vx_uint32 rows = addr.dim_y * addr.scale_y / VX_SCALE_UNITY, rowBytes = addr.dim_x * addr.scale_x / VX_SCALE_UNITY * addr.stride_x;
+        for (vx_uint32 j = 0; j < rows; j++)
+            for (vx_uint32 i = 0; i < rowBytes; i++)
+            {
+                state = state * 1103515245 + 12345;
+                ptr[j * addr.stride_y + i] = (vx_uint8)(state >> 16);
+            }
+        ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+    }
+}
+
+static void read_image(vx_image image, std::vector<vx_uint8> &pixels)
+{
+    vx_uint32 width = 0, height = 0;
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    vx_uint8 *ptr = nullptr;
+    ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, 0, &map_id, &addr, (void **)&ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    for (vx_uint32 j = 0; j < height; j++)
+        pixels.insert(pixels.end(), ptr + j * addr.stride_y, ptr + j * addr.stride_y + width * addr.stride_x);
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+}
+
+// runs the kernels that split their rows into stripes with the given number of graph CPU threads and returns all output pixels
+static void run_kernels(vx_context context, vx_uint32 num_threads, std::vector<vx_uint8> &pixels)
+{
+    vx_uint32 width = 1920, height = 1080;
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_CPU_NUM_THREADS, &num_threads, sizeof(num_threads)));
+
+    vx_image input[2] = {vxCreateImage(context, width, height, VX_DF_IMAGE_U8), vxCreateImage(context, width, height, VX_DF_IMAGE_NV12)};
+    // the scale and warp outputs have odd heights so that the last stripe is shorter than the others
+    vx_image output[4] = {
+        vxCreateImage(context, width, height, VX_DF_IMAGE_U8),   // gaussian 3x3
+        vxCreateImage(context, width, height, VX_DF_IMAGE_RGB),  // NV12 to RGB
+        vxCreateImage(context, 1280, 723, VX_DF_IMAGE_U8),       // scale bilinear
+        vxCreateImage(context, 1000, 611, VX_DF_IMAGE_U8),       // warp affine bilinear
+    };
+    for (int i = 0; i < 2; i++)
+    {
+        ERROR_CHECK_OBJECT(input[i]);
+        fill_image(input[i], i);
+    }
+    for (int i = 0; i < 4; i++)
+        ERROR_CHECK_OBJECT(output[i]);
+    vx_matrix matrix = vxCreateMatrix(context, VX_TYPE_FLOAT32, 2, 3);
+    ERROR_CHECK_OBJECT(matrix);
+    vx_float32 affine[3][2] = {{0.9f, 0.2f}, {-0.15f, 1.1f}, {60.5f, -20.25f}};
+    ERROR_CHECK_STATUS(vxCopyMatrix(matrix, affine, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    vx_node nodes[4] = {
+        vxGaussian3x3Node(graph, input[0], output[0]),
+        vxColorConvertNode(graph, input[1], output[1]),
+        vxScaleImageNode(graph, input[0], output[2], VX_INTERPOLATION_BILINEAR),
+        vxWarpAffineNode(graph, input[0], matrix, VX_INTERPOLATION_BILINEAR, output[3]),
+    };
+    for (int i = 0; i < 4; i++)
+    {
+        ERROR_CHECK_OBJECT(nodes[i]);
+        ERROR_CHECK_STATUS(vxReleaseNode(&nodes[i]));
+    }
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+
+    pixels.clear();
+    for (int i = 0; i < 4; i++)
+        read_image(output[i], pixels);
+
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseMatrix(&matrix));
+    for (int i = 0; i < 2; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&input[i]));
+    for (int i = 0; i < 4; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&output[i]));
+}
+
+int main(int argc, char **argv)
+{
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+
+    // reference: each kernel runs on the graph thread over all rows
+    std::vector<vx_uint8> reference;
+    run_kernels(context, 1, reference);
+    vx_uint32 thread_counts[3] = {2, 3, 8};
+    for (int t = 0; t < 3; t++)
+    {
+        std::vector<vx_uint8> pixels;
+        run_kernels(context, thread_counts[t], pixels);
+        if (pixels != reference)
+        {
+            size_t i = 0;
+            while (pixels[i] == reference[i])
+                i++;
+            printf("ERROR: outputs with %u threads differ from a single thread at byte %zu of %zu\n", thread_counts[t], i, reference.size());
+            return 1;
+        }
+        printf("STATUS: outputs with %u threads match a single thread\n", thread_counts[t]);
+    }
+
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    return 0;
+}
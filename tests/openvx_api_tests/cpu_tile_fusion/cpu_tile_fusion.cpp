@@ -0,0 +1,240 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+#include <vector>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+// chain of element-wise and 3x3 filters connected through virtual images:
+// RGB -> R channel -> Gaussian 3x3 -> Box 3x3 -> Threshold -> Dilate 3x3 -> Not
+static vx_graph create_graph(vx_context context, vx_image input, vx_image output, vx_threshold thresh, vx_bool tileFusion, vx_size& intermediateBytes)
+{
+    vx_uint32 width, height;
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_CPU_TILE_FUSION, &tileFusion, sizeof(tileFusion)));
+
+    vx_image virt[5];
+    for (int i = 0; i < 5; i++)
+    {
+        virt[i] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(virt[i]);
+    }
+    intermediateBytes = 5 * (vx_size)width * height;
+
+    vx_node nodes[] =
+        {
+            vxChannelExtractNode(graph, input, VX_CHANNEL_R, virt[0]),
+            vxGaussian3x3Node(graph, virt[0], virt[1]),
+            vxBox3x3Node(graph, virt[1], virt[2]),
+            vxThresholdNode(graph, virt[2], thresh, virt[3]),
+            vxDilate3x3Node(graph, virt[3], virt[4]),
+            vxNotNode(graph, virt[4], output)};
+
+    for (vx_size i = 0; i < sizeof(nodes) / sizeof(nodes[0]); i++)
+    {
+        ERROR_CHECK_OBJECT(nodes[i]);
+        ERROR_CHECK_STATUS(vxReleaseNode(&nodes[i]));
+    }
+    for (int i = 0; i < 5; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&virt[i]));
+
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    return graph;
+}
+
+static double run_graph(vx_graph graph, int iterations)
+{
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed_seconds = (end - start) / iterations;
+    return elapsed_seconds.count() * 1000.0;
+}
+
+static void read_image(vx_image image, vx_uint32 width, vx_uint32 height, std::vector<vx_uint8>& pixels)
+{
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_imagepatch_addressing_t addr = {0};
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    pixels.resize((size_t)width * height);
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, pixels.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+}
+
+int main(int argc, char **argv)
+{
+    vx_uint32 width = 3840, height = 2160;
+    int iterations = 20;
+
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+
+    vx_image input_rgb_image = vxCreateImage(context, width, height, VX_DF_IMAGE_RGB);
+    vx_image output_image[2] = {vxCreateImage(context, width, height, VX_DF_IMAGE_U8), vxCreateImage(context, width, height, VX_DF_IMAGE_U8)};
+    ERROR_CHECK_OBJECT(input_rgb_image);
+    ERROR_CHECK_OBJECT(output_image[0]);
+    ERROR_CHECK_OBJECT(output_image[1]);
+
+    vx_threshold thresh = vxCreateThresholdForImage(context, VX_THRESHOLD_TYPE_BINARY, VX_DF_IMAGE_U8, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(thresh);
+    vx_int32 value = 100;
+    ERROR_CHECK_STATUS(vxSetThresholdAttribute(thresh, VX_THRESHOLD_THRESHOLD_VALUE, &value, sizeof(value)));
+
+    // fill input with a pattern that exercises the filters
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    vx_uint8 *ptr = nullptr;
+    ERROR_CHECK_STATUS(vxMapImagePatch(input_rgb_image, &rect, 0, &map_id, &addr, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    for (vx_uint32 y = 0; y < height; y++)
+    {
+        vx_uint8 *row = ptr + y * addr.stride_y;
+        for (vx_uint32 x = 0; x < width * 3; x++)
+            row[x] = (vx_uint8)((x * 7 + y * 13 + ((x ^ y) & 0x3f)) & 0xff);
+    }
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(input_rgb_image, map_id));
+
+    vx_size intermediateBytes = 0;
+    vx_graph graph[2];
+    double msec[2];
+    for (int i = 0; i < 2; i++)
+    {
+        graph[i] = create_graph(context, input_rgb_image, output_image[i], thresh, i ? vx_true_e : vx_false_e, intermediateBytes);
+        msec[i] = run_graph(graph[i], iterations);
+    }
+    std::cout << "STATUS: vxProcessGraph() took " << msec[0] << "msec (AVG) without tile fusion\n";
+    std::cout << "STATUS: vxProcessGraph() took " << msec[1] << "msec (AVG) with tile fusion\n";
+    std::cout << "STATUS: intermediate images: " << intermediateBytes << " bytes per frame kept in cache with tile fusion\n";
+
+    // outputs with and without tile fusion must match, except for the undefined border pixels
+    std::vector<vx_uint8> pixels[2];
+    read_image(output_image[0], width, height, pixels[0]);
+    read_image(output_image[1], width, height, pixels[1]);
+    vx_uint32 border = 4, mismatches = 0;
+    for (vx_uint32 y = border; y < height - border; y++)
+    {
+        for (vx_uint32 x = border; x < width - border; x++)
+        {
+            if (pixels[0][y * width + x] != pixels[1][y * width + x])
+                mismatches++;
+        }
+    }
+    if (mismatches)
+    {
+        printf("ERROR: output mismatch at %u pixels with tile fusion\n", mismatches);
+        return 1;
+    }
+    printf("STATUS: outputs match\n");
+
+    // fused nodes report only the time spent in their own tiles, which can't exceed the graph time
+    const char *profileFile = "cpu_tile_fusion_profile.csv";
+    ERROR_CHECK_STATUS(vxQueryGraph(graph[1], VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_INTERNAL_PROFILE, (void *)profileFile, strlen(profileFile) + 1));
+    std::ifstream profile(profileFile);
+    std::string line;
+    std::getline(profile, line);
+    int count = 0, graphCount = 0, nodeCount = 0;
+    float tmp, avg, min, max, graphAvg = 0, graphMax = 0;
+    char dev[8], kernel[128];
+    while (std::getline(profile, line) && sscanf(line.c_str(), "%d,%f,%f,%f,%f,%7[^,],%127s", &count, &tmp, &avg, &min, &max, dev, kernel) == 7)
+    {
+        if (!strcmp(kernel, "GRAPH"))
+        {
+            graphCount = count;
+            graphAvg = avg;
+            graphMax = max;
+        }
+        else if (count != graphCount || min <= 0 || avg > graphAvg || max > graphMax)
+        {
+            printf("ERROR: %s runs %d times with avg %.3fms max %.3fms beyond the graph %d times avg %.3fms max %.3fms\n",
+                   kernel, count, avg, max, graphCount, graphAvg, graphMax);
+            return 1;
+        }
+        else
+            nodeCount++;
+    }
+    if (nodeCount < 2)
+    {
+        printf("ERROR: performance profile has %d nodes\n", nodeCount);
+        return 1;
+    }
+    printf("STATUS: performance of %d fused nodes is within the graph\n", nodeCount);
+
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph[0]));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph[1]));
+    ERROR_CHECK_STATUS(vxReleaseThreshold(&thresh));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input_rgb_image));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output_image[0]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output_image[1]));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+
+    return 0;
+}
@@ -0,0 +1,240 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <atomic>
+#include <thread>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+#define CHECK_TRUE(cond)                                                                        \
+    {                                                                                           \
+        if (!(cond))                                                                            \
+        {                                                                                       \
+            printf("ERROR: check failed: " #cond " at " __FILE__ "#%d\n", __LINE__);            \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+struct completion_log
+{
+    std::atomic<int> count;
+    std::atomic<vx_uint64> lastTicket;
+    std::atomic<bool> outOfOrder;
+};
+
+static void VX_CALLBACK completion_callback(vx_graph graph, vx_uint64 ticket, vx_status status, void *user_data)
+{
+    completion_log *log = (completion_log *)user_data;
+    if (status != VX_SUCCESS || ticket != log->lastTicket + 1)
+        log->outOfOrder = true;
+    log->lastTicket = ticket;
+    log->count++;
+}
+
+// RGB -> R channel -> Median 3x3 -> Gaussian 3x3 -> Box 3x3
+static vx_graph create_graph(vx_context context, vx_image input, vx_image output, vx_uint32 pipelineStages)
+{
+    vx_uint32 width, height;
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_PIPELINE_STAGES, &pipelineStages, sizeof(pipelineStages)));
+
+    vx_image virt[3];
+    for (int i = 0; i < 3; i++)
+    {
+        virt[i] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(virt[i]);
+    }
+
+    vx_node nodes[] =
+        {
+            vxChannelExtractNode(graph, input, VX_CHANNEL_R, virt[0]),
+            vxMedian3x3Node(graph, virt[0], virt[1]),
+            vxGaussian3x3Node(graph, virt[1], virt[2]),
+            vxBox3x3Node(graph, virt[2], output)};
+
+    for (vx_size i = 0; i < sizeof(nodes) / sizeof(nodes[0]); i++)
+    {
+        ERROR_CHECK_OBJECT(nodes[i]);
+        ERROR_CHECK_STATUS(vxReleaseNode(&nodes[i]));
+    }
+    for (int i = 0; i < 3; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&virt[i]));
+
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    return graph;
+}
+
+// several executions outstanding at once: each ticket is waited for separately
+static void run_tickets(vx_graph graph, int frames, const char *mode)
+{
+    completion_log log;
+    log.count = 0;
+    log.lastTicket = 0;
+    log.outOfOrder = false;
+    CHECK_TRUE(vxWaitGraphTicket(graph, 0, 0) == VX_ERROR_INVALID_VALUE);
+    ERROR_CHECK_STATUS(vxSetGraphCompletionCallback(graph, completion_callback, &log));
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<vx_uint64> tickets(frames);
+    for (int frame = 0; frame < frames; frame++)
+    {
+        ERROR_CHECK_STATUS(vxScheduleGraphTicket(graph, &tickets[frame]));
+        CHECK_TRUE(tickets[frame] == (vx_uint64)frame + 1);
+    }
+    CHECK_TRUE(vxWaitGraphTicket(graph, tickets[frames - 1] + 1, 0) == VX_ERROR_INVALID_VALUE);
+    // a bounded wait either times out or reports the execution status
+    vx_status status = vxWaitGraphTicket(graph, tickets[frames - 1], 0);
+    CHECK_TRUE(status == VX_SUCCESS || status == VX_ERROR_GRAPH_SCHEDULED);
+    for (int frame = 0; frame < frames; frame++)
+        ERROR_CHECK_STATUS(vxWaitGraphTicket(graph, tickets[frame], VX_GRAPH_WAIT_FOREVER_AMD));
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed_seconds = (end - start) / frames;
+    std::cout << "STATUS: " << mode << " took " << (elapsed_seconds.count() * 1000.0f) << "msec per frame (AVG)\n";
+
+    // all tickets completed in order and the callback ran for each of them before the wait returned
+    CHECK_TRUE(log.count == frames);
+    CHECK_TRUE(!log.outOfOrder);
+    ERROR_CHECK_STATUS(vxWaitGraphTicket(graph, 0, 0));
+    ERROR_CHECK_STATUS(vxWaitGraph(graph));
+
+    // vxScheduleGraph and vxWaitGraph keep working with the callback removed
+    ERROR_CHECK_STATUS(vxSetGraphCompletionCallback(graph, nullptr, nullptr));
+    ERROR_CHECK_STATUS(vxScheduleGraph(graph));
+    ERROR_CHECK_STATUS(vxScheduleGraph(graph));
+    ERROR_CHECK_STATUS(vxWaitGraph(graph));
+    ERROR_CHECK_STATUS(vxWaitGraphTicket(graph, tickets[frames - 1] + 2, 0));
+    CHECK_TRUE(log.count == frames);
+}
+
+static std::atomic<bool> ticketDone[1024];
+
+static void VX_CALLBACK ticket_callback(vx_graph graph, vx_uint64 ticket, vx_status status, void *user_data)
+{
+    if (status == VX_SUCCESS && ticket < sizeof(ticketDone) / sizeof(ticketDone[0]))
+        ticketDone[ticket] = true;
+}
+
+// two threads schedule the same graph and wait for their own tickets: a wait must not return
+// before that execution finished, even when executions of the other thread complete first
+static void run_concurrent_tickets(vx_graph graph, int frames, const char *mode)
+{
+    for (auto &done : ticketDone)
+        done = false;
+    ERROR_CHECK_STATUS(vxSetGraphCompletionCallback(graph, ticket_callback, nullptr));
+    std::atomic<int> early(0), failed(0);
+    auto scheduler = [&]() {
+        for (int frame = 0; frame < frames; frame++)
+        {
+            vx_uint64 ticket = 0;
+            if (vxScheduleGraphTicket(graph, &ticket) != VX_SUCCESS || vxWaitGraphTicket(graph, ticket, VX_GRAPH_WAIT_FOREVER_AMD) != VX_SUCCESS)
+                failed++;
+            else if (ticket >= sizeof(ticketDone) / sizeof(ticketDone[0]) || !ticketDone[ticket])
+                early++;
+        }
+    };
+    std::thread threads[2] = {std::thread(scheduler), std::thread(scheduler)};
+    for (auto &thread : threads)
+        thread.join();
+    ERROR_CHECK_STATUS(vxWaitGraph(graph));
+    ERROR_CHECK_STATUS(vxSetGraphCompletionCallback(graph, nullptr, nullptr));
+    CHECK_TRUE(failed == 0);
+    CHECK_TRUE(early == 0);
+    std::cout << "STATUS: " << mode << " with two schedulers OK\n";
+}
+
+int main(int argc, char **argv)
+{
+    vx_uint32 width = 1280, height = 720;
+    int frames = 24;
+
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+
+    vx_image input_rgb_image = vxCreateImage(context, width, height, VX_DF_IMAGE_RGB);
+    vx_image output_image[2] = {vxCreateImage(context, width, height, VX_DF_IMAGE_U8), vxCreateImage(context, width, height, VX_DF_IMAGE_U8)};
+    ERROR_CHECK_OBJECT(input_rgb_image);
+    ERROR_CHECK_OBJECT(output_image[0]);
+    ERROR_CHECK_OBJECT(output_image[1]);
+
+    vx_graph graph[2] = {create_graph(context, input_rgb_image, output_image[0], 0),
+                         create_graph(context, input_rgb_image, output_image[1], 2)};
+
+    run_tickets(graph[0], frames, "tickets on graph thread");
+    run_tickets(graph[1], frames, "tickets with 2 pipeline stages");
+    run_concurrent_tickets(graph[0], frames, "tickets on graph thread");
+    run_concurrent_tickets(graph[1], frames, "tickets with 2 pipeline stages");
+
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph[0]));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph[1]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input_rgb_image));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output_image[0]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output_image[1]));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+
+    printf("STATUS: graph completion tickets OK\n");
+    return 0;
+}
@@ -0,0 +1,272 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+// chain of filters connected through virtual images:
+// RGB -> R channel -> Median 3x3 -> Gaussian 3x3 -> Box 3x3 -> Median 3x3 -> Erode 3x3
+static vx_graph create_graph(vx_context context, vx_image input, vx_image output, vx_uint32 pipelineStages)
+{
+    vx_uint32 width, height;
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_PIPELINE_STAGES, &pipelineStages, sizeof(pipelineStages)));
+
+    vx_image virt[5];
+    for (int i = 0; i < 5; i++)
+    {
+        virt[i] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(virt[i]);
+    }
+
+    vx_node nodes[] =
+        {
+            vxChannelExtractNode(graph, input, VX_CHANNEL_R, virt[0]),
+            vxMedian3x3Node(graph, virt[0], virt[1]),
+            vxGaussian3x3Node(graph, virt[1], virt[2]),
+            vxBox3x3Node(graph, virt[2], virt[3]),
+            vxMedian3x3Node(graph, virt[3], virt[4]),
+            vxErode3x3Node(graph, virt[4], output)};
+
+    for (vx_size i = 0; i < sizeof(nodes) / sizeof(nodes[0]); i++)
+    {
+        ERROR_CHECK_OBJECT(nodes[i]);
+        ERROR_CHECK_STATUS(vxReleaseNode(&nodes[i]));
+    }
+    for (int i = 0; i < 5; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&virt[i]));
+
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    return graph;
+}
+
+static void write_input(vx_image image, vx_uint32 width, vx_uint32 height, int frame)
+{
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    vx_uint8 *ptr = nullptr;
+    ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, 0, &map_id, &addr, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    for (vx_uint32 y = 0; y < height; y++)
+    {
+        vx_uint8 *row = ptr + y * addr.stride_y;
+        for (vx_uint32 x = 0; x < width * 3; x++)
+            row[x] = (vx_uint8)((x * 7 + y * 13 + frame * 29 + ((x ^ (y + frame)) & 0x3f)) & 0xff);
+    }
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+}
+
+static void read_image(vx_image image, vx_uint32 width, vx_uint32 height, std::vector<vx_uint8>& pixels)
+{
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_imagepatch_addressing_t addr = {0};
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    pixels.resize((size_t)width * height);
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, pixels.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+}
+
+static void fill_image(vx_image image, vx_uint32 width, vx_uint32 height, vx_uint8 value)
+{
+    std::vector<vx_uint8> pixels((size_t)width * height, value);
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_imagepatch_addressing_t addr = {0};
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, pixels.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+}
+
+// an input read only by a node past the first stage must still be consumed before vxScheduleGraph returns:
+// Not(in1) -> Median 3x3 -> And(in2) with in2 overwritten right after each vxScheduleGraph
+static int check_late_input(vx_context context, vx_uint32 pipelineStages)
+{
+    vx_uint32 width = 4096, height = 4096;
+    vx_image in1 = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image in2 = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image out = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(in1);
+    ERROR_CHECK_OBJECT(in2);
+    ERROR_CHECK_OBJECT(out);
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_PIPELINE_STAGES, &pipelineStages, sizeof(pipelineStages)));
+    vx_image v1 = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    vx_image v2 = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(v1);
+    ERROR_CHECK_OBJECT(v2);
+    vx_node nodes[] = {vxNotNode(graph, in1, v1), vxMedian3x3Node(graph, v1, v2), vxAndNode(graph, v2, in2, out)};
+    for (vx_size i = 0; i < sizeof(nodes) / sizeof(nodes[0]); i++)
+    {
+        ERROR_CHECK_OBJECT(nodes[i]);
+        ERROR_CHECK_STATUS(vxReleaseNode(&nodes[i]));
+    }
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+
+    fill_image(in1, width, height, 0xf8);
+    int failures = 0;
+    std::vector<vx_uint8> pixels;
+    for (int frame = 0; frame < 5; frame++)
+    {
+        fill_image(in2, width, height, 0x03);
+        ERROR_CHECK_STATUS(vxScheduleGraph(graph));
+        fill_image(in2, width, height, 0xff);
+        ERROR_CHECK_STATUS(vxWaitGraph(graph));
+        read_image(out, width, height, pixels);
+        if (pixels[(height / 2) * width + width / 2] != 0x03)
+        {
+            printf("ERROR: frame %d output is %d instead of 3: input overwritten after vxScheduleGraph was still read\n", frame, pixels[(height / 2) * width + width / 2]);
+            failures++;
+        }
+    }
+
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseImage(&v1));
+    ERROR_CHECK_STATUS(vxReleaseImage(&v2));
+    ERROR_CHECK_STATUS(vxReleaseImage(&in1));
+    ERROR_CHECK_STATUS(vxReleaseImage(&in2));
+    ERROR_CHECK_STATUS(vxReleaseImage(&out));
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    vx_uint32 width = 1920, height = 1080;
+    vx_uint32 pipelineStages = 3;
+    int frames = 30;
+
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+
+    vx_image input_rgb_image = vxCreateImage(context, width, height, VX_DF_IMAGE_RGB);
+    vx_image output_image[2] = {vxCreateImage(context, width, height, VX_DF_IMAGE_U8), vxCreateImage(context, width, height, VX_DF_IMAGE_U8)};
+    ERROR_CHECK_OBJECT(input_rgb_image);
+    ERROR_CHECK_OBJECT(output_image[0]);
+    ERROR_CHECK_OBJECT(output_image[1]);
+
+    vx_graph graph[2] = {create_graph(context, input_rgb_image, output_image[0], 0),
+                         create_graph(context, input_rgb_image, output_image[1], pipelineStages)};
+
+    // one frame at a time
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        write_input(input_rgb_image, width, height, frame);
+        ERROR_CHECK_STATUS(vxProcessGraph(graph[0]));
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed_seconds = (end - start) / frames;
+    std::cout << "STATUS: vxProcessGraph() took " << (elapsed_seconds.count() * 1000.0f) << "msec per frame (AVG)\n";
+
+    // consecutive frames overlap across pipeline stages: inputs can be overwritten once vxScheduleGraph returns
+    start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        write_input(input_rgb_image, width, height, frame);
+        ERROR_CHECK_STATUS(vxScheduleGraph(graph[1]));
+    }
+    ERROR_CHECK_STATUS(vxWaitGraph(graph[1]));
+    end = std::chrono::steady_clock::now();
+    elapsed_seconds = (end - start) / frames;
+    std::cout << "STATUS: vxScheduleGraph() with " << pipelineStages << " pipeline stages took " << (elapsed_seconds.count() * 1000.0f) << "msec per frame (AVG)\n";
+
+    // outputs of last frame must match, except for the undefined border pixels
+    std::vector<vx_uint8> pixels[2];
+    read_image(output_image[0], width, height, pixels[0]);
+    read_image(output_image[1], width, height, pixels[1]);
+    vx_uint32 border = 6, mismatches = 0;
+    for (vx_uint32 y = border; y < height - border; y++)
+    {
+        for (vx_uint32 x = border; x < width - border; x++)
+        {
+            if (pixels[0][y * width + x] != pixels[1][y * width + x])
+                mismatches++;
+        }
+    }
+    if (mismatches)
+    {
+        printf("ERROR: output mismatch at %u pixels with pipeline stages\n", mismatches);
+        return 1;
+    }
+    printf("STATUS: outputs match\n");
+
+    if (check_late_input(context, pipelineStages))
+        return 1;
+    printf("STATUS: inputs read past the first stage can be overwritten once vxScheduleGraph returns\n");
+
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph[0]));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph[1]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input_rgb_image));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output_image[0]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output_image[1]));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+
+    return 0;
+}
@@ -0,0 +1,246 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+// NV12 -> RGB -> R channel -> box 3x3, with input and output as graph parameters
+static vx_graph create_graph(vx_context context, vx_image input, vx_image output)
+{
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_uint32 width = 0, height = 0;
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_image rgb = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_RGB);
+    vx_image chan = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    vx_node nodes[3] = {
+        vxColorConvertNode(graph, input, rgb),
+        vxChannelExtractNode(graph, rgb, VX_CHANNEL_R, chan),
+        vxBox3x3Node(graph, chan, output),
+    };
+    for (int i = 0; i < 3; i++)
+        ERROR_CHECK_OBJECT(nodes[i]);
+    vx_parameter param = vxGetParameterByIndex(nodes[0], 0);
+    ERROR_CHECK_STATUS(vxAddParameterToGraph(graph, param));
+    ERROR_CHECK_STATUS(vxReleaseParameter(&param));
+    param = vxGetParameterByIndex(nodes[2], 1);
+    ERROR_CHECK_STATUS(vxAddParameterToGraph(graph, param));
+    ERROR_CHECK_STATUS(vxReleaseParameter(&param));
+    for (int i = 0; i < 3; i++)
+        ERROR_CHECK_STATUS(vxReleaseNode(&nodes[i]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&rgb));
+    ERROR_CHECK_STATUS(vxReleaseImage(&chan));
+    return graph;
+}
+
+static vx_image create_input(vx_context context, vx_uint32 width, vx_uint32 height, int seed)
+{
+    vx_image image = vxCreateImage(context, width, height, VX_DF_IMAGE_NV12);
+    ERROR_CHECK_OBJECT(image);
+    for (vx_uint32 plane = 0; plane < 2; plane++)
+    {
+        vx_rectangle_t rect = {0, 0, width, height};
+        vx_map_id map_id;
+        vx_imagepatch_addressing_t addr;
+        vx_uint8 *ptr = nullptr;
+        ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, plane, &map_id, &addr, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+        vx_uint32 rows = plane ? height / 2 : height;
+        for (vx_uint32 j = 0; j < rows; j++)
+            for (vx_uint32 i = 0; i < width; i++)
+                ptr[j * addr.stride_y + i] = (vx_uint8)((i * (3 + plane) + j * 5 + seed * 41 + ((i ^ j) & 0x1f)) & 0xff);
+        ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+    }
+    return image;
+}
+
+static void read_image(vx_image image, vx_uint32 width, vx_uint32 height, std::vector<vx_uint8> &pixels)
+{
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_imagepatch_addressing_t addr = {0};
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    pixels.resize((size_t)width * height);
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, pixels.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+}
+
+int main(int argc, char **argv)
+{
+    vx_uint32 width = 1920, height = 1080;
+
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+
+    vx_image input[2] = {create_input(context, width, height, 0), create_input(context, width, height, 1)};
+    vx_image output[3] = {vxCreateImage(context, width, height, VX_DF_IMAGE_U8), vxCreateImage(context, width, height, VX_DF_IMAGE_U8),
+                          vxCreateImage(context, width, height, VX_DF_IMAGE_U8)};
+    for (int i = 0; i < 3; i++)
+        ERROR_CHECK_OBJECT(output[i]);
+
+    // reference: second input processed by a graph verified for it
+    vx_graph graph_ref = create_graph(context, input[1], output[2]);
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph_ref));
+    ERROR_CHECK_STATUS(vxProcessGraph(graph_ref));
+    std::vector<vx_uint8> pixels[2];
+    read_image(output[2], width, height, pixels[1]);
+
+    vx_graph graph = create_graph(context, input[0], output[0]);
+    auto start = std::chrono::steady_clock::now();
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> verify_time = end - start;
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+
+    // switch both graph parameters to objects of same layout: the graph stays verified
+    start = std::chrono::steady_clock::now();
+    ERROR_CHECK_STATUS(vxSetGraphParameterByIndex(graph, 0, (vx_reference)input[1]));
+    ERROR_CHECK_STATUS(vxSetGraphParameterByIndex(graph, 1, (vx_reference)output[1]));
+    end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> rebind_time = end - start;
+    if (vxIsGraphVerified(graph) != vx_true_e)
+    {
+        printf("ERROR: graph is not verified after switching parameters\n");
+        return 1;
+    }
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    read_image(output[1], width, height, pixels[0]);
+    if (pixels[0] != pixels[1])
+    {
+        printf("ERROR: output mismatch after switching parameters\n");
+        return 1;
+    }
+    printf("STATUS: outputs match\n");
+
+    // images of different dimensions: the next verify only validates the nodes that depend on them
+    vx_uint32 width_small = width / 2, height_small = height / 2;
+    vx_image input_small = create_input(context, width_small, height_small, 2);
+    vx_image output_small[2] = {vxCreateImage(context, width_small, height_small, VX_DF_IMAGE_U8),
+                                vxCreateImage(context, width_small, height_small, VX_DF_IMAGE_U8)};
+    for (int i = 0; i < 2; i++)
+        ERROR_CHECK_OBJECT(output_small[i]);
+    vx_graph graph_small = create_graph(context, input_small, output_small[1]);
+    ERROR_CHECK_STATUS(vxProcessGraph(graph_small));
+    std::vector<vx_uint8> pixels_small[2];
+    read_image(output_small[1], width_small, height_small, pixels_small[1]);
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph_small));
+    ERROR_CHECK_STATUS(vxSetGraphParameterByIndex(graph, 0, (vx_reference)input_small));
+    ERROR_CHECK_STATUS(vxSetGraphParameterByIndex(graph, 1, (vx_reference)output_small[0]));
+    if (vxIsGraphVerified(graph) != vx_false_e)
+    {
+        printf("ERROR: graph stays verified after switching to a different size\n");
+        return 1;
+    }
+    start = std::chrono::steady_clock::now();
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> resize_time = end - start;
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    read_image(output_small[0], width_small, height_small, pixels_small[0]);
+    if (pixels_small[0] != pixels_small[1])
+    {
+        printf("ERROR: output mismatch after switching to a different size\n");
+        return 1;
+    }
+    // back to the original size, verified implicitly by vxProcessGraph
+    ERROR_CHECK_STATUS(vxSetGraphParameterByIndex(graph, 0, (vx_reference)input[1]));
+    ERROR_CHECK_STATUS(vxSetGraphParameterByIndex(graph, 1, (vx_reference)output[1]));
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    read_image(output[1], width, height, pixels[0]);
+    if (vxIsGraphVerified(graph) != vx_true_e || pixels[0] != pixels[1])
+    {
+        printf("ERROR: output mismatch after switching back to the original size\n");
+        return 1;
+    }
+    printf("STATUS: outputs match after switching to %dx%d and back\n", width_small, height_small);
+
+    // an object with a different format can't be switched into a verified graph
+    if (vxSetGraphParameterByIndex(graph, 0, (vx_reference)output[2]) != VX_ERROR_NOT_SUPPORTED)
+    {
+        printf("ERROR: switching to a different format was accepted\n");
+        return 1;
+    }
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    read_image(output[1], width, height, pixels[0]);
+    if (vxIsGraphVerified(graph) != vx_true_e || pixels[0] != pixels[1])
+    {
+        printf("ERROR: graph changed after rejected parameter\n");
+        return 1;
+    }
+    printf("STATUS: vxVerifyGraph() took %.3f msec, switching two parameters took %.3f msec, verify after resize took %.3f msec\n",
+           verify_time.count() * 1.0e3, rebind_time.count() * 1.0e3, resize_time.count() * 1.0e3);
+
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph_ref));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input_small));
+    for (int i = 0; i < 2; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&output_small[i]));
+    for (int i = 0; i < 2; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&input[i]));
+    for (int i = 0; i < 3; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&output[i]));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+
+    return 0;
+}
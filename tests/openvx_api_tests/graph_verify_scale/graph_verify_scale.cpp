@@ -0,0 +1,199 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <cstdlib>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+// build a DAG of numNodes additions over virtual images: v[i] = v[i-1] + v[i-2] (with wrap),
+// where v[-1] and v[-2] are the input images and v[numNodes-1] is the output image;
+// when reverseOrder is set the nodes are added to the graph consumers first
+static vx_graph create_graph(vx_context context, vx_image input[2], vx_image output, vx_uint32 numNodes, bool reverseOrder)
+{
+    vx_uint32 width, height;
+    ERROR_CHECK_STATUS(vxQueryImage(output, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(output, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    std::vector<vx_image> images(numNodes + 2);
+    images[0] = input[0];
+    images[1] = input[1];
+    for (vx_uint32 i = 0; i < numNodes - 1; i++)
+    {
+        images[2 + i] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(images[2 + i]);
+    }
+    images[numNodes + 1] = output;
+    for (vx_uint32 n = 0; n < numNodes; n++)
+    {
+        vx_uint32 i = reverseOrder ? numNodes - 1 - n : n;
+        vx_node node = vxAddNode(graph, images[i + 1], images[i], VX_CONVERT_POLICY_WRAP, images[i + 2]);
+        ERROR_CHECK_OBJECT(node);
+        ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    }
+    for (vx_uint32 i = 0; i < numNodes - 1; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&images[2 + i]));
+    return graph;
+}
+
+static void write_input(vx_image image, vx_uint8 value)
+{
+    vx_uint32 width, height;
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_imagepatch_addressing_t addr = {0};
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    std::vector<vx_uint8> pixels((size_t)width * height, value);
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, pixels.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+}
+
+static vx_uint32 count_mismatches(vx_image image, vx_uint8 value)
+{
+    vx_uint32 width, height;
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_imagepatch_addressing_t addr = {0};
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    std::vector<vx_uint8> pixels((size_t)width * height);
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, pixels.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    vx_uint32 mismatches = 0;
+    for (vx_uint8 pixel : pixels)
+    {
+        if (pixel != value)
+            mismatches++;
+    }
+    return mismatches;
+}
+
+int main(int argc, char **argv)
+{
+    vx_uint32 width = 64, height = 16;
+    vx_uint32 numNodes = 5000;
+    if (argc > 1)
+        numNodes = (vx_uint32)atoi(argv[1]);
+    if (numNodes < 2)
+    {
+        printf("ERROR: need at least 2 nodes\n");
+        return 1;
+    }
+
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+
+    vx_image input[2], output;
+    for (int i = 0; i < 2; i++)
+    {
+        input[i] = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(input[i]);
+        write_input(input[i], (vx_uint8)(3 + i * 4));
+    }
+    output = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(output);
+
+    // expected output: fibonacci sequence modulo 256
+    vx_uint8 a = 3, b = 7, expected = 0;
+    for (vx_uint32 n = 0; n < numNodes; n++)
+    {
+        expected = (vx_uint8)(a + b);
+        a = b;
+        b = expected;
+    }
+
+    for (int reverseOrder = 0; reverseOrder <= 1; reverseOrder++)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        vx_graph graph = create_graph(context, input, output, numNodes, reverseOrder ? true : false);
+        auto t1 = std::chrono::steady_clock::now();
+        ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+        auto t2 = std::chrono::steady_clock::now();
+        ERROR_CHECK_STATUS(vxProcessGraph(graph));
+        std::chrono::duration<double> createTime = t1 - t0, verifyTime = t2 - t1;
+        std::cout << "STATUS: " << numNodes << " nodes added in " << (reverseOrder ? "reverse" : "forward")
+                  << " order: create took " << createTime.count() * 1000.0 << "msec, vxVerifyGraph() took "
+                  << verifyTime.count() * 1000.0 << "msec\n";
+        vx_uint32 mismatches = count_mismatches(output, expected);
+        if (mismatches)
+        {
+            printf("ERROR: output mismatch at %u pixels (%s order)\n", mismatches, reverseOrder ? "reverse" : "forward");
+            return 1;
+        }
+        write_input(output, 0);
+        ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    }
+
+    for (int i = 0; i < 2; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&input[i]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+
+    printf("STATUS: graph verify scale OK\n");
+    return 0;
+}
@@ -0,0 +1,307 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+// NV12 -> RGB
+static vx_graph create_graph(vx_context context, vx_image input, vx_image output)
+{
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_node node = vxColorConvertNode(graph, input, output);
+    ERROR_CHECK_OBJECT(node);
+    ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    return graph;
+}
+
+static void fill_nv12(vx_uint8 *y, vx_uint8 *uv, vx_uint32 width, vx_uint32 height, int frame)
+{
+    for (vx_uint32 j = 0; j < height; j++)
+        for (vx_uint32 i = 0; i < width; i++)
+            y[j * width + i] = (vx_uint8)((i * 3 + j * 5 + frame * 41) & 0xff);
+    for (vx_uint32 j = 0; j < height / 2; j++)
+        for (vx_uint32 i = 0; i < width; i++)
+            uv[j * width + i] = (vx_uint8)((i * 11 + j * 7 + frame * 23 + ((i ^ j) & 0x1f)) & 0xff);
+}
+
+static void read_image(vx_image image, vx_uint32 width, vx_uint32 height, std::vector<vx_uint8>& pixels)
+{
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_imagepatch_addressing_t addr = {0};
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 3;
+    addr.stride_y = width * 3;
+    pixels.resize((size_t)width * height * 3);
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, pixels.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+}
+
+static void read_u8_image(vx_image image, vx_uint32 width, vx_uint32 height, std::vector<vx_uint8>& pixels)
+{
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_imagepatch_addressing_t addr = {0};
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    pixels.resize((size_t)width * height);
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, pixels.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+}
+
+// Not -> Median 3x3 -> Gaussian 3x3 -> And with the input (lateInput) or with itself, so that the input is read
+// by the first level only or also by the last level
+static vx_graph create_pipelined_graph(vx_context context, vx_image input, vx_image output, vx_uint32 pipelineStages, bool lateInput)
+{
+    vx_uint32 width, height;
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_PIPELINE_STAGES, &pipelineStages, sizeof(pipelineStages)));
+    vx_image virt[3];
+    for (int i = 0; i < 3; i++)
+    {
+        virt[i] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(virt[i]);
+    }
+    vx_node nodes[] = {
+        vxNotNode(graph, input, virt[0]),
+        vxMedian3x3Node(graph, virt[0], virt[1]),
+        vxGaussian3x3Node(graph, virt[1], virt[2]),
+        vxAndNode(graph, virt[2], lateInput ? input : virt[2], output)};
+    for (vx_size i = 0; i < sizeof(nodes) / sizeof(nodes[0]); i++)
+    {
+        ERROR_CHECK_OBJECT(nodes[i]);
+        ERROR_CHECK_STATUS(vxReleaseNode(&nodes[i]));
+    }
+    for (int i = 0; i < 3; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&virt[i]));
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    return graph;
+}
+
+// with pipeline stages the ring can advance and the previous slot can be rewritten once vxScheduleGraph returns,
+// while earlier frames are still running in later stages
+static int check_pipelined_ring(vx_context context, vx_uint32 width, vx_uint32 height, int frames, bool lateInput)
+{
+    const vx_uint32 slots = 2;
+    std::vector<vx_uint8> ringMemory[slots], frameMemory((size_t)width * height);
+    void *ringPtrs[slots];
+    for (vx_uint32 slot = 0; slot < slots; slot++)
+    {
+        ringMemory[slot].resize((size_t)width * height);
+        ringPtrs[slot] = ringMemory[slot].data();
+    }
+    vx_imagepatch_addressing_t addr = {0};
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    vx_image input_ring = vxCreateImageFromHandle(context, VX_DF_IMAGE_U8, &addr, ringPtrs, VX_MEMORY_TYPE_HOST);
+    vx_image input_copy = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image output_image[2] = {vxCreateImage(context, width, height, VX_DF_IMAGE_U8), vxCreateImage(context, width, height, VX_DF_IMAGE_U8)};
+    ERROR_CHECK_OBJECT(input_ring);
+    ERROR_CHECK_OBJECT(input_copy);
+    ERROR_CHECK_OBJECT(output_image[0]);
+    ERROR_CHECK_OBJECT(output_image[1]);
+    ERROR_CHECK_STATUS(vxSetHandleRing((vx_reference)input_ring, ringPtrs, 1, slots));
+    vx_graph graph[2] = {create_pipelined_graph(context, input_ring, output_image[0], 3, lateInput),
+                         create_pipelined_graph(context, input_copy, output_image[1], 0, lateInput)};
+
+    vx_uint32 current = 0;
+    for (int frame = 0; frame < frames; frame++)
+    {
+        for (vx_uint32 i = 0; i < width * height; i++)
+            frameMemory[i] = (vx_uint8)((i * 3 + (i / width) * 5 + frame * 41) & 0xff);
+        vx_uint32 next = (current + 1) % slots;
+        ringMemory[next] = frameMemory;
+        ERROR_CHECK_STATUS(vxAdvanceHandleRing((vx_reference)input_ring, &current));
+        ERROR_CHECK_STATUS(vxScheduleGraph(graph[0]));
+        std::fill(ringMemory[current].begin(), ringMemory[current].end(), 0xff);
+    }
+    ERROR_CHECK_STATUS(vxWaitGraph(graph[0]));
+
+    // reference: last frame copied into a regular image
+    vx_rectangle_t rect = {0, 0, width, height};
+    ERROR_CHECK_STATUS(vxCopyImagePatch(input_copy, &rect, 0, &addr, frameMemory.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxProcessGraph(graph[1]));
+    std::vector<vx_uint8> pixels[2];
+    read_u8_image(output_image[0], width, height, pixels[0]);
+    read_u8_image(output_image[1], width, height, pixels[1]);
+    bool mismatch = (pixels[0] != pixels[1]);
+
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph[0]));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph[1]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input_ring));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input_copy));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output_image[0]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output_image[1]));
+    if (mismatch)
+        printf("ERROR: pipelined output mismatch with the input read %s\n", lateInput ? "by the last level" : "by the first level only");
+    return mismatch ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    vx_uint32 width = 1920, height = 1080;
+    const vx_uint32 slots = 3;
+    int frames = 10;
+
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+
+    // ring of host buffers owned by the application
+    std::vector<vx_uint8> ringMemory[slots][2];
+    void *ringPtrs[slots * 2];
+    for (vx_uint32 slot = 0; slot < slots; slot++)
+    {
+        ringMemory[slot][0].resize((size_t)width * height);
+        ringMemory[slot][1].resize((size_t)width * height / 2);
+        ringPtrs[slot * 2 + 0] = ringMemory[slot][0].data();
+        ringPtrs[slot * 2 + 1] = ringMemory[slot][1].data();
+    }
+    vx_imagepatch_addressing_t addr[2] = {{0}, {0}};
+    for (int plane = 0; plane < 2; plane++)
+    {
+        addr[plane].dim_x = width;
+        addr[plane].dim_y = plane ? height / 2 : height;
+        addr[plane].stride_x = plane ? 2 : 1;
+        addr[plane].stride_y = width;
+    }
+    vx_image input_ring = vxCreateImageFromHandle(context, VX_DF_IMAGE_NV12, addr, ringPtrs, VX_MEMORY_TYPE_HOST);
+    vx_image input_copy = vxCreateImage(context, width, height, VX_DF_IMAGE_NV12);
+    vx_image output_image[2] = {vxCreateImage(context, width, height, VX_DF_IMAGE_RGB), vxCreateImage(context, width, height, VX_DF_IMAGE_RGB)};
+    ERROR_CHECK_OBJECT(input_ring);
+    ERROR_CHECK_OBJECT(input_copy);
+    ERROR_CHECK_OBJECT(output_image[0]);
+    ERROR_CHECK_OBJECT(output_image[1]);
+    ERROR_CHECK_STATUS(vxSetHandleRing((vx_reference)input_ring, ringPtrs, 2, slots));
+
+    vx_graph graph[2] = {create_graph(context, input_ring, output_image[0]), create_graph(context, input_copy, output_image[1])};
+
+    // frame N is written into the slot after the current one, then the ring advances to it
+    vx_uint32 current = 0;
+    std::vector<vx_uint8> pixels[2];
+    for (int frame = 0; frame < frames; frame++)
+    {
+        vx_uint32 next = (current + 1) % slots;
+        fill_nv12(ringMemory[next][0].data(), ringMemory[next][1].data(), width, height, frame);
+        ERROR_CHECK_STATUS(vxAdvanceHandleRing((vx_reference)input_ring, &current));
+        if (current != next)
+        {
+            printf("ERROR: ring advanced to slot %u instead of %u\n", current, next);
+            return 1;
+        }
+        ERROR_CHECK_STATUS(vxProcessGraph(graph[0]));
+
+        // reference: same frame copied into a regular image
+        for (vx_uint32 plane = 0; plane < 2; plane++)
+        {
+            vx_rectangle_t rect = {0, 0, width, height};
+            ERROR_CHECK_STATUS(vxCopyImagePatch(input_copy, &rect, plane, &addr[plane], ringMemory[current][plane].data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+        }
+        ERROR_CHECK_STATUS(vxProcessGraph(graph[1]));
+
+        read_image(output_image[0], width, height, pixels[0]);
+        read_image(output_image[1], width, height, pixels[1]);
+        if (pixels[0] != pixels[1])
+        {
+            printf("ERROR: output mismatch at frame %d\n", frame);
+            return 1;
+        }
+    }
+    printf("STATUS: outputs match\n");
+
+    if (check_pipelined_ring(context, width, height, frames, false) || check_pipelined_ring(context, width, height, frames, true))
+        return 1;
+    printf("STATUS: pipelined outputs match\n");
+
+    // cost of switching the input buffers
+    int iterations = 100000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        ERROR_CHECK_STATUS(vxAdvanceHandleRing((vx_reference)input_ring, nullptr));
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed_seconds = (end - start) / iterations;
+    std::cout << "STATUS: vxAdvanceHandleRing() took " << (elapsed_seconds.count() * 1.0e9) << "nsec (AVG)\n";
+    ERROR_CHECK_STATUS(vxSetHandleRing((vx_reference)input_ring, nullptr, 2, 0));
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        ERROR_CHECK_STATUS(vxSwapImageHandle(input_ring, &ringPtrs[(i % slots) * 2], nullptr, 2));
+    end = std::chrono::steady_clock::now();
+    elapsed_seconds = (end - start) / iterations;
+    std::cout << "STATUS: vxSwapImageHandle() took " << (elapsed_seconds.count() * 1.0e9) << "nsec (AVG)\n";
+
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph[0]));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph[1]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input_ring));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input_copy));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output_image[0]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output_image[1]));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+
+    return 0;
+}
@@ -0,0 +1,284 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+// sparse Harris response: random peaks with a falloff, like the output of the score kernel
+static void generate_response(vector<float> &vc, int width, int height, int numPeaks)
+{
+    vc.assign((size_t)width * height, 0.0f);
+    srand(42);
+    for (int i = 0; i < numPeaks; i++)
+    {
+        int px = 3 + rand() % (width - 6), py = 3 + rand() % (height - 6);
+        float peak = 1.0f + (float)(rand() % 100000);
+        for (int y = max(py - 2, 3); y <= min(py + 2, height - 4); y++)
+            for (int x = max(px - 2, 3); x <= min(px + 2, width - 4); x++)
+            {
+                float v = peak / (1 + (x - px) * (x - px) + (y - py) * (y - py));
+                vc[(size_t)y * width + x] = max(vc[(size_t)y * width + x], v);
+            }
+    }
+}
+
+// reference: 3x3 local maxima, sorted by strength, then a brute-force min_distance check against every picked corner
+static vector<vx_keypoint_t> reference_pick(const vector<float> &vc, int width, int height, float min_distance)
+{
+    vector<long long> list;
+    for (int y = 1; y < height - 1; y++)
+    {
+        for (int x = 1; x < width - 1; x++)
+        {
+            const float *p9 = &vc[(size_t)(y - 1) * width + x - 1], *p0 = p9 + width, *p1 = p0 + width;
+            if (p0[1] >= p9[0] && p0[1] >= p9[1] && p0[1] >= p9[2] && p0[1] >= p0[0] && p0[1] > p0[2] &&
+                p0[1] > p1[0] && p0[1] > p1[1] && p0[1] > p1[2])
+            {
+                unsigned int s;
+                memcpy(&s, &p0[1], sizeof(s));
+                list.push_back((long long)(((unsigned long long)s << 32) | ((unsigned long long)(y & 0xffff) << 16) | (x & 0xffff)));
+            }
+        }
+    }
+    sort(list.begin(), list.end(), greater<long long>());
+    int min_dist2 = min_distance > 2.0f ? (int)ceilf(min_distance * min_distance) : 0;
+    vector<vx_keypoint_t> picked;
+    for (long long key : list)
+    {
+        int x = (int)(key & 0xffff), y = (int)((key >> 16) & 0xffff);
+        bool found = false;
+        for (const vx_keypoint_t &kp : picked)
+        {
+            if ((kp.x - x) * (kp.x - x) + (kp.y - y) * (kp.y - y) < min_dist2)
+            {
+                found = true;
+                break;
+            }
+        }
+        if (!found)
+        {
+            vx_keypoint_t kp = {};
+            kp.x = x;
+            kp.y = y;
+            kp.strength = vc[(size_t)y * width + x];
+            kp.tracking_status = 1;
+            picked.push_back(kp);
+        }
+    }
+    return picked;
+}
+
+// runs the HVC sort-and-pick kernel on a response image and returns the time per frame in msec
+static float run_pick(vx_context context, const vector<float> &vc, int width, int height, float min_distance,
+                      vector<vx_keypoint_t> &corners, vx_size &numCorners, int iterations)
+{
+    vx_image image = vxCreateImage(context, width, height, VX_DF_IMAGE_F32_AMD);
+    ERROR_CHECK_OBJECT(image);
+    vx_rectangle_t rect = {0, 0, (vx_uint32)width, (vx_uint32)height};
+    vx_imagepatch_addressing_t addr = {0};
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = sizeof(float);
+    addr.stride_y = width * sizeof(float);
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, (void *)vc.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    vx_size capacity = (size_t)width * height / 4;
+    vx_array array = vxCreateArray(context, VX_TYPE_KEYPOINT, capacity);
+    ERROR_CHECK_OBJECT(array);
+    vx_scalar num = vxCreateScalar(context, VX_TYPE_SIZE, &numCorners);
+    ERROR_CHECK_OBJECT(num);
+    vx_scalar dist = vxCreateScalar(context, VX_TYPE_FLOAT32, &min_distance);
+    ERROR_CHECK_OBJECT(dist);
+
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_kernel kernel = vxGetKernelByName(context, "com.amd.openvx.HarrisMergeSortAndPick_XY_HVC");
+    ERROR_CHECK_OBJECT(kernel);
+    vx_node node = vxCreateGenericNode(graph, kernel);
+    ERROR_CHECK_OBJECT(node);
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 0, (vx_reference)array));
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 1, (vx_reference)num));
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 2, (vx_reference)image));
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 3, (vx_reference)dist));
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+
+    auto t0 = chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++)
+        ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    auto t1 = chrono::high_resolution_clock::now();
+
+    ERROR_CHECK_STATUS(vxCopyScalar(num, &numCorners, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    vx_size numItems = 0;
+    ERROR_CHECK_STATUS(vxQueryArray(array, VX_ARRAY_NUMITEMS, &numItems, sizeof(numItems)));
+    corners.resize(numItems);
+    if (numItems)
+        ERROR_CHECK_STATUS(vxCopyArrayRange(array, 0, numItems, sizeof(vx_keypoint_t), corners.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+
+    ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&dist));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&num));
+    ERROR_CHECK_STATUS(vxReleaseArray(&array));
+    ERROR_CHECK_STATUS(vxReleaseImage(&image));
+    return chrono::duration<float, milli>(t1 - t0).count() / iterations;
+}
+
+// runs vxHarrisCornersNode on a 4K U8 image and returns the time per frame in msec
+static float run_harris(vx_context context, const vector<vx_uint8> &pixels, int width, int height, float min_distance,
+                        vx_size &numCorners, int iterations)
+{
+    vx_image image = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(image);
+    vx_rectangle_t rect = {0, 0, (vx_uint32)width, (vx_uint32)height};
+    vx_imagepatch_addressing_t addr = {0};
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, (void *)pixels.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    vx_float32 strength_thresh = 0.0005f, sensitivity = 0.04f;
+    vx_scalar thresh = vxCreateScalar(context, VX_TYPE_FLOAT32, &strength_thresh);
+    vx_scalar dist = vxCreateScalar(context, VX_TYPE_FLOAT32, &min_distance);
+    vx_scalar sens = vxCreateScalar(context, VX_TYPE_FLOAT32, &sensitivity);
+    vx_scalar num = vxCreateScalar(context, VX_TYPE_SIZE, &numCorners);
+    vx_array array = vxCreateArray(context, VX_TYPE_KEYPOINT, 100000);
+    ERROR_CHECK_OBJECT(array);
+
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_node node = vxHarrisCornersNode(graph, image, thresh, dist, sens, 3, 3, array, num);
+    ERROR_CHECK_OBJECT(node);
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+
+    auto t0 = chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++)
+        ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    auto t1 = chrono::high_resolution_clock::now();
+    ERROR_CHECK_STATUS(vxCopyScalar(num, &numCorners, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+
+    ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseArray(&array));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&num));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&sens));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&dist));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&thresh));
+    ERROR_CHECK_STATUS(vxReleaseImage(&image));
+    return chrono::duration<float, milli>(t1 - t0).count() / iterations;
+}
+
+int main(int argc, char **argv)
+{
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+
+    const float distances[] = {1.5f, 3.0f, 5.0f, 10.0f, 20.0f, 40.0f};
+
+    // check the picked corners against a brute-force reference
+    {
+        const int width = 640, height = 480;
+        vector<float> vc;
+        generate_response(vc, width, height, 4000);
+        for (float min_distance : distances)
+        {
+            vector<vx_keypoint_t> corners;
+            vx_size numCorners = 0;
+            run_pick(context, vc, width, height, min_distance, corners, numCorners, 1);
+            vector<vx_keypoint_t> ref = reference_pick(vc, width, height, min_distance);
+            bool match = (numCorners == ref.size() && corners.size() == ref.size());
+            for (size_t i = 0; match && i < ref.size(); i++)
+                match = (corners[i].x == ref[i].x && corners[i].y == ref[i].y && corners[i].strength == ref[i].strength);
+            if (!match)
+            {
+                printf("ERROR: min_distance %.1f: %d corners picked, reference has %d\n", min_distance, (int)numCorners, (int)ref.size());
+                return -1;
+            }
+        }
+    }
+
+    // benchmark over min_distance on a 4K frame
+    {
+        const int width = 3840, height = 2160, iterations = 5;
+        vector<float> vc;
+        generate_response(vc, width, height, 200000);
+        vector<vx_uint8> pixels((size_t)width * height);
+        for (size_t i = 0; i < pixels.size(); i++)
+            pixels[i] = (vx_uint8)(((i % width) / 8 + (i / width) / 8) % 2 ? 200 : 50) ^ (vx_uint8)(rand() & 15);
+        printf("%10s %14s %14s %14s %14s\n", "min_dist", "pick(ms)", "corners", "harris(ms)", "corners");
+        for (float min_distance : distances)
+        {
+            vector<vx_keypoint_t> corners;
+            vx_size numPicked = 0, numHarris = 0;
+            float msecPick = run_pick(context, vc, width, height, min_distance, corners, numPicked, iterations);
+            float msecHarris = run_harris(context, pixels, width, height, min_distance, numHarris, iterations);
+            printf("%10.1f %14.3f %14d %14.3f %14d\n", min_distance, msecPick, (int)numPicked, msecHarris, (int)numHarris);
+        }
+    }
+
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    printf("harris_nms: test passed\n");
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <cstdlib>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <VX/vxu.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+static AgoMemoryPoolInfo query_pool(vx_context context)
+{
+    AgoMemoryPoolInfo info;
+    ERROR_CHECK_STATUS(vxQueryContext(context, VX_CONTEXT_ATTRIBUTE_AMD_MEMORY_POOL_INFO, &info, sizeof(info)));
+    return info;
+}
+
+// number of pixels in plane 0 that are different from value
+static vx_uint32 count_not_equal(vx_image image, vx_uint8 value)
+{
+    vx_uint32 width, height;
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_imagepatch_addressing_t addr = {0};
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    std::vector<vx_uint8> pixels((size_t)width * height);
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, pixels.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    vx_uint32 count = 0;
+    for (auto pixel : pixels)
+    {
+        if (pixel != value)
+            count++;
+    }
+    return count;
+}
+
+// create a context that runs one graph with virtual intermediates: out = (not(in) | not(in)) + in = 255
+// and release it; graphs keep their buffers until the context is released
+static double run_context(vx_uint32 width, vx_uint32 height)
+{
+    auto start = std::chrono::steady_clock::now();
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+    vx_image input = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image output = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(input);
+    ERROR_CHECK_OBJECT(output);
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    vx_uint8 *ptr = nullptr;
+    ERROR_CHECK_STATUS(vxMapImagePatch(input, &rect, 0, &map_id, &addr, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    for (vx_uint32 y = 0; y < height; y++)
+        for (vx_uint32 x = 0; x < width; x++)
+            ptr[y * addr.stride_y + x] = (vx_uint8)(x * 7 + y * 13);
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(input, map_id));
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_image virt[2] = {vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8), vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8)};
+    ERROR_CHECK_OBJECT(virt[0]);
+    ERROR_CHECK_OBJECT(virt[1]);
+    vx_node nodes[] = {
+        vxNotNode(graph, input, virt[0]),
+        vxOrNode(graph, virt[0], virt[0], virt[1]),
+        vxAddNode(graph, virt[1], input, VX_CONVERT_POLICY_WRAP, output),
+    };
+    for (auto node : nodes)
+        ERROR_CHECK_OBJECT(node);
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    vx_uint32 mismatches = count_not_equal(output, 255);
+    if (mismatches)
+    {
+        printf("ERROR: graph output mismatch at %u pixels\n", mismatches);
+        exit(1);
+    }
+    // data not produced by a graph shall still read as zero when its buffer comes from the pool
+    vx_image fresh = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(fresh);
+    vx_uint32 nonzero = count_not_equal(fresh, 0);
+    if (nonzero)
+    {
+        printf("ERROR: new image has %u non-zero pixels\n", nonzero);
+        exit(1);
+    }
+    for (auto& node : nodes)
+        ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    ERROR_CHECK_STATUS(vxReleaseImage(&virt[0]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&virt[1]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&fresh));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed_seconds = end - start;
+    return elapsed_seconds.count() * 1000.0;
+}
+
+int main(int argc, char **argv)
+{
+    vx_uint32 width = 1920, height = 1080;
+    int iterations = 20;
+
+    // frame sized buffers use huge page blocks, which are counted once when they get allocated
+    setenv("AGO_MEMORY_POOL_HUGE_PAGES", "1", 0);
+
+    // the pool is shared by all contexts in the process: query it from a context that allocates nothing
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+    AgoMemoryPoolInfo initial = query_pool(context);
+
+    // first context allocates from the system, its buffers stay in the pool after release
+    double msecFirst = run_context(width, height);
+    AgoMemoryPoolInfo first = query_pool(context);
+    if (first.alloc_count <= initial.alloc_count || first.bytes_in_use != initial.bytes_in_use || first.bytes_pooled <= initial.bytes_pooled ||
+        first.bytes_huge_pages <= initial.bytes_huge_pages)
+    {
+        printf("ERROR: unexpected pool statistics after first context: alloc_count=%llu bytes_in_use=%llu bytes_pooled=%llu bytes_huge_pages=%llu\n",
+            (unsigned long long)first.alloc_count, (unsigned long long)first.bytes_in_use, (unsigned long long)first.bytes_pooled,
+            (unsigned long long)first.bytes_huge_pages);
+        return 1;
+    }
+
+    // later contexts with the same graph are served from the pool
+    double msecTotal = 0;
+    for (int i = 0; i < iterations; i++)
+        msecTotal += run_context(width, height);
+    AgoMemoryPoolInfo last = query_pool(context);
+    vx_uint64 allocs = last.alloc_count - first.alloc_count;
+    vx_uint64 hits = last.pool_hit_count - first.pool_hit_count;
+    printf("STATUS: %llu allocations with %llu pool hits, %llu bytes in use (peak %llu), %llu bytes pooled\n",
+        (unsigned long long)allocs, (unsigned long long)hits, (unsigned long long)last.bytes_in_use,
+        (unsigned long long)last.bytes_in_use_peak, (unsigned long long)last.bytes_pooled);
+    std::cout << "STATUS: first context took " << msecFirst << "msec, later contexts took " << msecTotal / iterations << "msec (AVG)\n";
+    if (allocs < (vx_uint64)iterations * 3 || hits != allocs)
+    {
+        printf("ERROR: expected all of the %llu allocations to be served from the pool, got %llu\n", (unsigned long long)allocs, (unsigned long long)hits);
+        return 1;
+    }
+    if (last.bytes_in_use != initial.bytes_in_use || last.bytes_in_use_peak != first.bytes_in_use_peak || last.bytes_pooled != first.bytes_pooled)
+    {
+        printf("ERROR: buffers leaked or not reused: bytes_in_use=%llu (expected %llu) bytes_in_use_peak=%llu (expected %llu)\n",
+            (unsigned long long)last.bytes_in_use, (unsigned long long)initial.bytes_in_use,
+            (unsigned long long)last.bytes_in_use_peak, (unsigned long long)first.bytes_in_use_peak);
+        return 1;
+    }
+    if (last.bytes_huge_pages != first.bytes_huge_pages)
+    {
+        printf("ERROR: pool hits counted as huge page allocations: bytes_huge_pages=%llu (expected %llu)\n",
+            (unsigned long long)last.bytes_huge_pages, (unsigned long long)first.bytes_huge_pages);
+        return 1;
+    }
+
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+
+    // releasing the last context gives the pooled buffers back to the system
+    context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    AgoMemoryPoolInfo trimmed = query_pool(context);
+    if (trimmed.bytes_pooled != 0 || trimmed.bytes_huge_pages != initial.bytes_huge_pages)
+    {
+        printf("ERROR: pool not trimmed after the last context: bytes_pooled=%llu bytes_huge_pages=%llu (expected %llu)\n",
+            (unsigned long long)trimmed.bytes_pooled, (unsigned long long)trimmed.bytes_huge_pages,
+            (unsigned long long)initial.bytes_huge_pages);
+        return 1;
+    }
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+
+    printf("STATUS: memory pool OK\n");
+    return 0;
+}
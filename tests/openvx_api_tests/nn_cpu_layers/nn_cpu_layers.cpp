@@ -0,0 +1,438 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include <VX/vx.h>
+#include <VX/vx_khr_nn.h>
+#include <vx_ext_amd.h>
+#include <vx_amd_nn.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+static size_t tensor_count(const vector<vx_size> &dims)
+{
+    size_t count = 1;
+    for (vx_size d : dims)
+        count *= d;
+    return count;
+}
+
+// creates a float tensor and, if data is given, copies it in (densely packed, dims[0] innermost)
+static vx_tensor create_tensor(vx_context context, const vector<vx_size> &dims, const vector<float> *data)
+{
+    vx_tensor tensor = vxCreateTensor(context, dims.size(), dims.data(), VX_TYPE_FLOAT32, 0);
+    ERROR_CHECK_OBJECT(tensor);
+    if (data)
+    {
+        vector<vx_size> start(dims.size(), 0), stride(dims.size());
+        stride[0] = sizeof(float);
+        for (size_t i = 1; i < dims.size(); i++)
+            stride[i] = stride[i - 1] * dims[i - 1];
+        ERROR_CHECK_STATUS(vxCopyTensorPatch(tensor, dims.size(), start.data(), dims.data(), stride.data(), (void *)data->data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    }
+    return tensor;
+}
+
+static vector<float> read_tensor(vx_tensor tensor, const vector<vx_size> &dims)
+{
+    vector<float> data(tensor_count(dims));
+    vector<vx_size> start(dims.size(), 0), stride(dims.size());
+    stride[0] = sizeof(float);
+    for (size_t i = 1; i < dims.size(); i++)
+        stride[i] = stride[i - 1] * dims[i - 1];
+    ERROR_CHECK_STATUS(vxCopyTensorPatch(tensor, dims.size(), start.data(), dims.data(), stride.data(), data.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    return data;
+}
+
+// verifies the graph, processes it the given number of times and returns the time per run in msec
+static float process_graph(vx_graph graph, int iterations)
+{
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    auto t0 = chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++)
+        ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    auto t1 = chrono::high_resolution_clock::now();
+    return chrono::duration<float, milli>(t1 - t0).count() / iterations;
+}
+
+static vector<float> random_float(size_t count, float range)
+{
+    vector<float> data(count);
+    for (size_t i = 0; i < count; i++)
+        data[i] = (float)(rand() % 2001 - 1000) * range / 1000.0f;
+    return data;
+}
+
+static bool compare(const vector<float> &out, const vector<float> &ref, float tolerance)
+{
+    for (size_t i = 0; i < out.size(); i++)
+    {
+        if (!(fabsf(out[i] - ref[i]) <= tolerance * (1.0f + fabsf(ref[i]))))
+        {
+            printf("  [%zu] %f != %f\n", i, out[i], ref[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool check(const char *name, bool match)
+{
+    printf("%-44s %s\n", name, match ? "OK" : "MISMATCH");
+    return match;
+}
+
+struct ConvShape
+{
+    int N, C, H, W, K, kernel, stride, pad, dilation, groups;
+    float leaky_alpha;      // < 0: no fused activation
+};
+
+// runs a convolution node (optionally grouped and with fused leaky relu) on cpuThreads CPU threads of the graph
+// and checks it against a direct convolution
+static float run_convolution(vx_context context, const ConvShape &s, vx_uint32 cpuThreads, int iterations, bool &match)
+{
+    int extent = (s.kernel - 1) * s.dilation + 1;
+    int OH = (s.H + 2 * s.pad - extent) / s.stride + 1, OW = (s.W + 2 * s.pad - extent) / s.stride + 1;
+    int Cg = s.C / s.groups, Kg = s.K / s.groups;
+    vector<vx_size> idims = {(vx_size)s.W, (vx_size)s.H, (vx_size)s.C, (vx_size)s.N};
+    vector<vx_size> wdims = {(vx_size)s.kernel, (vx_size)s.kernel, (vx_size)Cg, (vx_size)s.K};
+    vector<vx_size> bdims = {(vx_size)s.K}, odims = {(vx_size)OW, (vx_size)OH, (vx_size)s.K, (vx_size)s.N};
+    vector<float> in = random_float(tensor_count(idims), 1.0f), wt = random_float(tensor_count(wdims), 0.5f), bias = random_float(s.K, 1.0f);
+    vx_tensor tin = create_tensor(context, idims, &in), twt = create_tensor(context, wdims, &wt);
+    vx_tensor tbias = create_tensor(context, bdims, &bias), tout = create_tensor(context, odims, nullptr);
+    vx_nn_convolution_params_t params = {(vx_size)s.pad, (vx_size)s.pad, VX_CONVERT_POLICY_SATURATE, VX_ROUND_POLICY_TO_NEAREST_EVEN,
+                                         VX_NN_DS_SIZE_ROUNDING_FLOOR, (vx_size)(s.dilation - 1), (vx_size)(s.dilation - 1)};
+    vx_scalar sparams = vxCreateScalarWithSize(context, VX_TYPE_NN_CONVOLUTION_PARAMS, &params, sizeof(params));
+    vx_scalar salpha = vxCreateScalar(context, VX_TYPE_FLOAT32, &s.leaky_alpha);
+    vx_scalar sgroups = vxCreateScalar(context, VX_TYPE_INT32, &s.groups);
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_CPU_NUM_THREADS, &cpuThreads, sizeof(cpuThreads)));
+    vx_kernel kernel = vxGetKernelByEnum(context, VX_KERNEL_CONVOLUTION_LAYER);
+    ERROR_CHECK_OBJECT(kernel);
+    vx_node node = vxCreateGenericNode(graph, kernel);
+    ERROR_CHECK_OBJECT(node);
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 0, (vx_reference)tin));
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 1, (vx_reference)twt));
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 2, (vx_reference)tbias));
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 3, (vx_reference)sparams));
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 4, (vx_reference)tout));
+    if (s.leaky_alpha >= 0)
+        ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 5, (vx_reference)salpha));
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 6, (vx_reference)sgroups));
+    float msec = process_graph(graph, iterations);
+    vector<float> out = read_tensor(tout, odims), ref(out.size());
+    for (int n = 0; n < s.N; n++)
+    {
+        for (int k = 0; k < s.K; k++)
+        {
+            int g = k / Kg;
+            for (int oy = 0; oy < OH; oy++)
+            {
+                for (int ox = 0; ox < OW; ox++)
+                {
+                    double sum = bias[k];
+                    for (int c = 0; c < Cg; c++)
+                    {
+                        for (int ky = 0; ky < s.kernel; ky++)
+                        {
+                            int y = oy * s.stride - s.pad + ky * s.dilation;
+                            if (y < 0 || y >= s.H)
+                                continue;
+                            for (int kx = 0; kx < s.kernel; kx++)
+                            {
+                                int x = ox * s.stride - s.pad + kx * s.dilation;
+                                if (x < 0 || x >= s.W)
+                                    continue;
+                                sum += (double)in[(((size_t)n * s.C + g * Cg + c) * s.H + y) * s.W + x] *
+                                       wt[(((size_t)k * Cg + c) * s.kernel + ky) * s.kernel + kx];
+                            }
+                        }
+                    }
+                    if (s.leaky_alpha >= 0 && sum < 0)
+                        sum *= s.leaky_alpha;
+                    ref[(((size_t)n * s.K + k) * OH + oy) * OW + ox] = (float)sum;
+                }
+            }
+        }
+    }
+    match = compare(out, ref, 1e-4f);
+    ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&sparams));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&salpha));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&sgroups));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tin));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&twt));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tbias));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tout));
+    return msec;
+}
+
+static bool test_pooling(vx_context context)
+{
+    bool ok = true;
+    const int N = 2, C = 5, H = 13, W = 17, kernel = 3, stride = 2, pad = 1;
+    const int OH = (H + 2 * pad - kernel) / stride + 1, OW = (W + 2 * pad - kernel) / stride + 1;
+    vector<vx_size> idims = {(vx_size)W, (vx_size)H, (vx_size)C, (vx_size)N}, odims = {(vx_size)OW, (vx_size)OH, (vx_size)C, (vx_size)N};
+    vector<float> in = random_float(tensor_count(idims), 4.0f);
+    vx_tensor tin = create_tensor(context, idims, &in);
+    vx_tensor tmax = create_tensor(context, odims, nullptr), tavg = create_tensor(context, odims, nullptr);
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(vxPoolingLayer(graph, tin, VX_NN_POOLING_MAX, kernel, kernel, pad, pad, VX_NN_DS_SIZE_ROUNDING_FLOOR, tmax));
+    ERROR_CHECK_OBJECT(vxPoolingLayer(graph, tin, VX_NN_POOLING_AVG, kernel, kernel, pad, pad, VX_NN_DS_SIZE_ROUNDING_FLOOR, tavg));
+    process_graph(graph, 1);
+    vector<float> omax = read_tensor(tmax, odims), oavg = read_tensor(tavg, odims);
+    vector<float> rmax(omax.size()), ravg(oavg.size());
+    for (int p = 0; p < N * C; p++)
+    {
+        for (int oy = 0; oy < OH; oy++)
+        {
+            for (int ox = 0; ox < OW; ox++)
+            {
+                float vmax = -INFINITY, sum = 0;
+                int count = 0;
+                for (int y = max(0, oy * stride - pad); y < min(H, oy * stride - pad + kernel); y++)
+                {
+                    for (int x = max(0, ox * stride - pad); x < min(W, ox * stride - pad + kernel); x++)
+                    {
+                        float v = in[((size_t)p * H + y) * W + x];
+                        vmax = max(vmax, v);
+                        sum += v;
+                        count++;
+                    }
+                }
+                rmax[((size_t)p * OH + oy) * OW + ox] = vmax;
+                ravg[((size_t)p * OH + oy) * OW + ox] = sum / count;
+            }
+        }
+    }
+    ok &= check("pooling max 3x3 stride 2 pad 1", compare(omax, rmax, 0.0f));
+    ok &= check("pooling avg 3x3 stride 2 pad 1", compare(oavg, ravg, 1e-5f));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tin));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tmax));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tavg));
+    return ok;
+}
+
+static bool test_activation_softmax_batchnorm(vx_context context)
+{
+    bool ok = true;
+    const int N = 2, C = 7, H = 5, W = 11;
+    const size_t plane = (size_t)H * W;
+    vector<vx_size> dims = {(vx_size)W, (vx_size)H, (vx_size)C, (vx_size)N}, cdims = {(vx_size)C};
+    vector<float> in = random_float(tensor_count(dims), 3.0f);
+    vector<float> mean = random_float(C, 1.0f), var = random_float(C, 1.0f), scale = random_float(C, 2.0f), bias = random_float(C, 1.0f);
+    for (float &v : var)
+        v = fabsf(v) + 0.1f;
+    const float eps = 1e-5f;
+    vx_tensor tin = create_tensor(context, dims, &in);
+    vx_tensor tmean = create_tensor(context, cdims, &mean), tvar = create_tensor(context, cdims, &var);
+    vx_tensor tscale = create_tensor(context, cdims, &scale), tbias = create_tensor(context, cdims, &bias);
+    vx_tensor trelu = create_tensor(context, dims, nullptr), ttanh = create_tensor(context, dims, nullptr);
+    vx_tensor tlogistic = create_tensor(context, dims, nullptr), tsoftmax = create_tensor(context, dims, nullptr);
+    vx_tensor tbn = create_tensor(context, dims, nullptr);
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(vxActivationLayer(graph, tin, VX_NN_ACTIVATION_RELU, 0.0f, 0.0f, trelu));
+    ERROR_CHECK_OBJECT(vxActivationLayer(graph, tin, VX_NN_ACTIVATION_HYPERBOLIC_TAN, 1.0f, 1.0f, ttanh));
+    ERROR_CHECK_OBJECT(vxActivationLayer(graph, tin, VX_NN_ACTIVATION_LOGISTIC, 0.0f, 0.0f, tlogistic));
+    ERROR_CHECK_OBJECT(vxSoftmaxLayer(graph, tin, tsoftmax));
+    ERROR_CHECK_OBJECT(vxBatchNormalizationLayer(graph, tin, tmean, tvar, tscale, tbias, eps, tbn));
+    process_graph(graph, 1);
+    vector<float> orelu = read_tensor(trelu, dims), otanh = read_tensor(ttanh, dims), ologistic = read_tensor(tlogistic, dims);
+    vector<float> osoftmax = read_tensor(tsoftmax, dims), obn = read_tensor(tbn, dims);
+    vector<float> rrelu(in.size()), rtanh(in.size()), rlogistic(in.size()), rsoftmax(in.size()), rbn(in.size());
+    for (size_t i = 0; i < in.size(); i++)
+    {
+        int c = (int)((i / plane) % C);
+        rrelu[i] = max(0.0f, in[i]);
+        rtanh[i] = tanhf(in[i]);
+        rlogistic[i] = 1.0f / (1.0f + expf(-in[i]));
+        rbn[i] = (in[i] - mean[c]) / sqrtf(var[c] + eps) * scale[c] + bias[c];
+    }
+    for (int n = 0; n < N; n++)
+    {
+        for (size_t j = 0; j < plane; j++)
+        {
+            double sum = 0;
+            for (int c = 0; c < C; c++)
+                sum += exp((double)in[((size_t)n * C + c) * plane + j]);
+            for (int c = 0; c < C; c++)
+            {
+                size_t i = ((size_t)n * C + c) * plane + j;
+                rsoftmax[i] = (float)(exp((double)in[i]) / sum);
+            }
+        }
+    }
+    ok &= check("activation relu", compare(orelu, rrelu, 0.0f));
+    ok &= check("activation tanh", compare(otanh, rtanh, 1e-5f));
+    ok &= check("activation logistic", compare(ologistic, rlogistic, 1e-5f));
+    ok &= check("softmax over channels", compare(osoftmax, rsoftmax, 1e-5f));
+    ok &= check("batch normalization", compare(obn, rbn, 1e-5f));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tin));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tmean));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tvar));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tscale));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tbias));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&trelu));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&ttanh));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tlogistic));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tsoftmax));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tbn));
+    return ok;
+}
+
+static bool test_fully_connected(vx_context context)
+{
+    const int N = 3, C = 9, H = 4, W = 5, M = 37, K = C * H * W;
+    vector<vx_size> idims = {(vx_size)W, (vx_size)H, (vx_size)C, (vx_size)N}, wdims = {(vx_size)W, (vx_size)H, (vx_size)C, (vx_size)M};
+    vector<vx_size> bdims = {(vx_size)M}, odims = {1, 1, (vx_size)M, (vx_size)N};
+    vector<float> in = random_float(tensor_count(idims), 1.0f), wt = random_float(tensor_count(wdims), 0.5f), bias = random_float(M, 1.0f);
+    vx_tensor tin = create_tensor(context, idims, &in), twt = create_tensor(context, wdims, &wt);
+    vx_tensor tbias = create_tensor(context, bdims, &bias), tout = create_tensor(context, odims, nullptr);
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(vxFullyConnectedLayer(graph, tin, twt, tbias, VX_CONVERT_POLICY_SATURATE, VX_ROUND_POLICY_TO_NEAREST_EVEN, tout));
+    process_graph(graph, 1);
+    vector<float> out = read_tensor(tout, odims), ref(out.size());
+    for (int n = 0; n < N; n++)
+    {
+        for (int m = 0; m < M; m++)
+        {
+            double sum = bias[m];
+            for (int k = 0; k < K; k++)
+                sum += (double)in[(size_t)n * K + k] * wt[(size_t)m * K + k];
+            ref[(size_t)n * M + m] = (float)sum;
+        }
+    }
+    bool ok = check("fully connected with bias", compare(out, ref, 1e-4f));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tin));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&twt));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tbias));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tout));
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+    ERROR_CHECK_STATUS(vxLoadKernels(context, "vx_nn"));
+    srand(42);
+
+    // check each layer against a direct reference
+    bool ok = true, match = false;
+    const ConvShape checks[] = {
+        {2, 13, 11, 9, 19, 3, 1, 1, 1, 1, -1.0f},   // 3x3 same padding with bias
+        {1, 8, 15, 14, 12, 3, 2, 1, 1, 1, 0.0f},    // 3x3 stride 2 with fused relu
+        {2, 24, 7, 10, 40, 1, 1, 0, 1, 1, -1.0f},   // pointwise
+        {1, 6, 12, 12, 9, 3, 1, 2, 2, 3, 0.1f},     // grouped, dilated with fused leaky relu
+        {1, 5, 9, 9, 7, 5, 2, 2, 1, 1, -1.0f},      // 5x5 stride 2
+    };
+    for (vx_uint32 cpuThreads : {1u, 4u})
+    {
+        for (const ConvShape &s : checks)
+        {
+            char name[64];
+            sprintf(name, "convolution %dx%d s%d d%d g%d threads %u", s.kernel, s.kernel, s.stride, s.dilation, s.groups, cpuThreads);
+            run_convolution(context, s, cpuThreads, 1, match);
+            ok &= check(name, match);
+        }
+    }
+    ok &= test_pooling(context);
+    ok &= test_activation_softmax_batchnorm(context);
+    ok &= test_fully_connected(context);
+    if (!ok)
+    {
+        printf("ERROR: nn_cpu_layers: mismatch against reference\n");
+        return -1;
+    }
+
+    // convolution timing at typical image classification layer sizes on all the CPU threads
+    vx_uint32 cpuThreads = max(thread::hardware_concurrency(), 1u);
+    printf("%6s %6s %6s %6s %6s %12s %12s\n", "C", "HxW", "K", "kernel", "stride", "msec", "GFLOPS");
+    const ConvShape sizes[] = {
+        {1, 64, 56, 56, 64, 3, 1, 1, 1, 1, 0.0f},
+        {1, 256, 28, 28, 128, 1, 1, 0, 1, 1, 0.0f},
+        {1, 128, 28, 28, 256, 3, 2, 1, 1, 1, 0.0f},
+    };
+    for (const ConvShape &s : sizes)
+    {
+        float msec = run_convolution(context, s, cpuThreads, 5, match);
+        int OH = (s.H + 2 * s.pad - s.kernel) / s.stride + 1, OW = (s.W + 2 * s.pad - s.kernel) / s.stride + 1;
+        double gflops = 2.0 * s.N * s.K * OH * OW * s.C * s.kernel * s.kernel / (msec * 1e6);
+        printf("%6d %3dx%-3d %6d %6d %6d %12.3f %12.2f\n", s.C, s.H, s.W, s.K, s.kernel, s.stride, msec, gflops);
+        if (!match)
+        {
+            printf("ERROR: nn_cpu_layers: convolution mismatch at C=%d K=%d kernel=%d\n", s.C, s.K, s.kernel);
+            return -1;
+        }
+    }
+
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    printf("nn_cpu_layers: test passed\n");
+    return 0;
+}
@@ -0,0 +1,352 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+struct TraceEvent
+{
+    std::string name;
+    std::string ph;
+    unsigned tid;
+    unsigned frame;
+    double ts;
+};
+
+// extract the value of "key": from a single-line trace event
+static std::string get_field(const std::string &line, const std::string &key)
+{
+    std::string tag = "\"" + key + "\":";
+    size_t pos = line.find(tag);
+    if (pos == std::string::npos)
+        return "";
+    pos += tag.length();
+    if (line[pos] == '"')
+        return line.substr(pos + 1, line.find('"', pos + 1) - pos - 1);
+    return line.substr(pos, line.find_first_of(",}", pos) - pos);
+}
+
+static bool read_trace(const char *fileName, std::vector<TraceEvent> &events)
+{
+    std::ifstream file(fileName);
+    if (!file)
+        return false;
+    std::string line;
+    std::getline(file, line);
+    if (line != "{\"traceEvents\":[")
+        return false;
+    events.clear();
+    while (std::getline(file, line))
+    {
+        std::string ph = get_field(line, "ph");
+        if (ph == "B" || ph == "E" || ph == "b" || ph == "e")
+        {
+            TraceEvent event;
+            event.name = get_field(line, "name");
+            event.ph = ph;
+            event.tid = (unsigned)std::stoul(get_field(line, "tid"));
+            event.frame = (unsigned)std::stoul(get_field(line, "frame"));
+            event.ts = std::stod(get_field(line, "ts"));
+            if ((ph == "b" || ph == "e") && get_field(line, "id") != get_field(line, "frame"))
+                return false;
+            events.push_back(event);
+        }
+        else if (line.compare(0, 2, "],") == 0)
+            return true;
+    }
+    return false;
+}
+
+// every thread must have a well nested begin/end sequence in time order, and every graph execution
+// an async begin/end pair of its frame that encloses the node executions of that frame
+static bool check_trace(const char *traceFile, int frames, int nodes)
+{
+    std::vector<TraceEvent> events;
+    if (!read_trace(traceFile, events))
+    {
+        printf("ERROR: unable to parse %s\n", traceFile);
+        return false;
+    }
+    std::map<unsigned, std::vector<std::string>> stacks;
+    std::map<unsigned, double> lastTime;
+    std::map<unsigned, std::pair<double, double>> graphSpans;
+    int graphCount = 0, nodeCount = 0;
+    for (auto &event : events)
+    {
+        if (event.ph == "b" || event.ph == "e")
+        {
+            if (event.name != "GRAPH" || (event.ph == "b") != (graphSpans.count(event.frame) == 0))
+            {
+                printf("ERROR: unmatched async event %s %s of frame %u\n", event.ph.c_str(), event.name.c_str(), event.frame);
+                return false;
+            }
+            if (event.ph == "b")
+                graphSpans[event.frame] = std::make_pair(event.ts, -1.0);
+            else
+            {
+                graphSpans[event.frame].second = event.ts;
+                graphCount++;
+            }
+            continue;
+        }
+        // a stage handing a frame to the next stage can wake up after that frame completed, so check nodes only
+        if (event.name != "GRAPH" && (!graphSpans.count(event.frame) || event.ts < graphSpans[event.frame].first ||
+                                      (graphSpans[event.frame].second >= 0 && event.ts > graphSpans[event.frame].second)))
+        {
+            printf("ERROR: event %s on thread %u is outside the execution of frame %u\n", event.name.c_str(), event.tid, event.frame);
+            return false;
+        }
+        if (lastTime.count(event.tid) && event.ts < lastTime[event.tid])
+        {
+            printf("ERROR: timestamps out of order on thread %u\n", event.tid);
+            return false;
+        }
+        lastTime[event.tid] = event.ts;
+        auto &stack = stacks[event.tid];
+        if (event.ph == "B")
+            stack.push_back(event.name);
+        else if (stack.empty() || stack.back() != event.name)
+        {
+            printf("ERROR: unmatched end event %s on thread %u\n", event.name.c_str(), event.tid);
+            return false;
+        }
+        else
+        {
+            stack.pop_back();
+            if (event.name != "GRAPH")
+                nodeCount++;
+        }
+    }
+    for (auto &span : graphSpans)
+    {
+        if (span.second.second < 0)
+        {
+            printf("ERROR: unmatched async begin of frame %u\n", span.first);
+            return false;
+        }
+    }
+    for (auto &stack : stacks)
+    {
+        if (!stack.second.empty())
+        {
+            printf("ERROR: unmatched begin event %s on thread %u\n", stack.second.back().c_str(), stack.first);
+            return false;
+        }
+    }
+    printf("STATUS: %d events from %d threads: %d graph executions, %d node executions\n",
+           (int)events.size(), (int)stacks.size(), graphCount, nodeCount);
+    if (graphCount < frames || nodeCount < frames * nodes)
+    {
+        printf("ERROR: expected at least %d graph and %d node executions\n", frames, frames * nodes);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    vx_uint32 width = 640, height = 480;
+    int frames = 10;
+    const char *traceFile = "performance_trace.json";
+
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+
+    // four independent CPU nodes, so that entries come from the worker pool threads too
+    vx_image input = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(input);
+    vx_image output[4];
+    for (int i = 0; i < 4; i++)
+    {
+        output[i] = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(output[i]);
+    }
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_uint32 num_threads = 4;
+    ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_CPU_NUM_THREADS, &num_threads, sizeof(num_threads)));
+    vx_node nodes[4] = {
+        vxBox3x3Node(graph, input, output[0]),
+        vxGaussian3x3Node(graph, input, output[1]),
+        vxMedian3x3Node(graph, input, output[2]),
+        vxNotNode(graph, input, output[3]),
+    };
+    for (int i = 0; i < 4; i++)
+    {
+        ERROR_CHECK_OBJECT(nodes[i]);
+        ERROR_CHECK_STATUS(vxReleaseNode(&nodes[i]));
+    }
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    ERROR_CHECK_STATUS(vxDirective((vx_reference)graph, VX_DIRECTIVE_AMD_ENABLE_PROFILE_CAPTURE));
+    for (int frame = 0; frame < frames; frame++)
+        ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    // the file name must be terminated within the given size
+    if (vxQueryGraph(graph, VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_TRACE, (void *)traceFile, 0) != VX_ERROR_INVALID_PARAMETERS ||
+        vxQueryGraph(graph, VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_TRACE, (void *)traceFile, strlen(traceFile)) != VX_ERROR_INVALID_PARAMETERS)
+    {
+        printf("ERROR: trace dump accepts a file name that isn't terminated within size\n");
+        return 1;
+    }
+    ERROR_CHECK_STATUS(vxQueryGraph(graph, VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_TRACE, (void *)traceFile, strlen(traceFile) + 1));
+
+    if (!check_trace(traceFile, frames, 4))
+        return 1;
+
+    // entries are consumed by the dump: a second dump without processing is empty
+    std::vector<TraceEvent> events;
+    ERROR_CHECK_STATUS(vxQueryGraph(graph, VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_TRACE, (void *)traceFile, strlen(traceFile) + 1));
+    if (!read_trace(traceFile, events) || !events.empty())
+    {
+        printf("ERROR: second trace dump is not empty\n");
+        return 1;
+    }
+    printf("STATUS: trace is well formed\n");
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+
+    // chain of nodes run one row tile at a time: each node still gets its own begin/end pair
+    graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_bool tileFusion = vx_true_e;
+    ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_CPU_TILE_FUSION, &tileFusion, sizeof(tileFusion)));
+    vx_image virt[2] = {vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8), vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8)};
+    ERROR_CHECK_OBJECT(virt[0]);
+    ERROR_CHECK_OBJECT(virt[1]);
+    vx_node chain[3] = {
+        vxGaussian3x3Node(graph, input, virt[0]),
+        vxBox3x3Node(graph, virt[0], virt[1]),
+        vxNotNode(graph, virt[1], output[0]),
+    };
+    for (int i = 0; i < 3; i++)
+    {
+        ERROR_CHECK_OBJECT(chain[i]);
+        ERROR_CHECK_STATUS(vxReleaseNode(&chain[i]));
+    }
+    ERROR_CHECK_STATUS(vxReleaseImage(&virt[0]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&virt[1]));
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    ERROR_CHECK_STATUS(vxDirective((vx_reference)graph, VX_DIRECTIVE_AMD_ENABLE_PROFILE_CAPTURE));
+    for (int frame = 0; frame < frames; frame++)
+        ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    ERROR_CHECK_STATUS(vxQueryGraph(graph, VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_TRACE, (void *)traceFile, strlen(traceFile) + 1));
+    if (!check_trace(traceFile, frames, 3))
+        return 1;
+    printf("STATUS: trace of tile fused nodes is well formed\n");
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+
+    // frames of a pipelined graph overlap and end on a stage worker thread
+    graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_uint32 pipelineStages = 3;
+    ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_PIPELINE_STAGES, &pipelineStages, sizeof(pipelineStages)));
+    vx_image stageVirt[3];
+    for (int i = 0; i < 3; i++)
+    {
+        stageVirt[i] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(stageVirt[i]);
+    }
+    vx_node stages[4] = {
+        vxMedian3x3Node(graph, input, stageVirt[0]),
+        vxGaussian3x3Node(graph, stageVirt[0], stageVirt[1]),
+        vxBox3x3Node(graph, stageVirt[1], stageVirt[2]),
+        vxMedian3x3Node(graph, stageVirt[2], output[0]),
+    };
+    for (int i = 0; i < 4; i++)
+    {
+        ERROR_CHECK_OBJECT(stages[i]);
+        ERROR_CHECK_STATUS(vxReleaseNode(&stages[i]));
+    }
+    for (int i = 0; i < 3; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&stageVirt[i]));
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    ERROR_CHECK_STATUS(vxDirective((vx_reference)graph, VX_DIRECTIVE_AMD_ENABLE_PROFILE_CAPTURE));
+    for (int frame = 0; frame < frames; frame++)
+        ERROR_CHECK_STATUS(vxScheduleGraph(graph));
+    ERROR_CHECK_STATUS(vxWaitGraph(graph));
+    ERROR_CHECK_STATUS(vxQueryGraph(graph, VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_TRACE, (void *)traceFile, strlen(traceFile) + 1));
+    if (!check_trace(traceFile, frames, 4))
+        return 1;
+    printf("STATUS: trace of pipelined frames is well formed\n");
+
+    // the text profile doesn't consume the trace entries once profiling is disabled
+    for (int frame = 0; frame < frames; frame++)
+        ERROR_CHECK_STATUS(vxScheduleGraph(graph));
+    ERROR_CHECK_STATUS(vxWaitGraph(graph));
+    ERROR_CHECK_STATUS(vxDirective((vx_reference)graph, VX_DIRECTIVE_AMD_DISABLE_PROFILE_CAPTURE));
+    const char *profileFile = "performance_profile.csv";
+    ERROR_CHECK_STATUS(vxQueryGraph(graph, VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_INTERNAL_PROFILE, (void *)profileFile, strlen(profileFile) + 1));
+    ERROR_CHECK_STATUS(vxQueryGraph(graph, VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_TRACE, (void *)traceFile, strlen(traceFile) + 1));
+    if (!check_trace(traceFile, frames, 4))
+        return 1;
+    printf("STATUS: trace entries kept by the profile dump with profiling disabled\n");
+
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    for (int i = 0; i < 4; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&output[i]));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+
+    return 0;
+}
@@ -0,0 +1,372 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+static size_t tensor_count(const vector<vx_size> &dims)
+{
+    size_t count = 1;
+    for (vx_size d : dims)
+        count *= d;
+    return count;
+}
+
+// creates a tensor and, if data is given, copies it in (densely packed, dims[0] innermost)
+template <typename T>
+static vx_tensor create_tensor(vx_context context, const vector<vx_size> &dims, vx_enum data_type, vx_int8 fixed_point_pos, const vector<T> *data)
+{
+    vx_tensor tensor = vxCreateTensor(context, dims.size(), dims.data(), data_type, fixed_point_pos);
+    ERROR_CHECK_OBJECT(tensor);
+    if (data)
+    {
+        vector<vx_size> start(dims.size(), 0), stride(dims.size());
+        stride[0] = sizeof(T);
+        for (size_t i = 1; i < dims.size(); i++)
+            stride[i] = stride[i - 1] * dims[i - 1];
+        ERROR_CHECK_STATUS(vxCopyTensorPatch(tensor, dims.size(), start.data(), dims.data(), stride.data(), (void *)data->data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    }
+    return tensor;
+}
+
+template <typename T>
+static vector<T> read_tensor(vx_tensor tensor, const vector<vx_size> &dims)
+{
+    vector<T> data(tensor_count(dims));
+    vector<vx_size> start(dims.size(), 0), stride(dims.size());
+    stride[0] = sizeof(T);
+    for (size_t i = 1; i < dims.size(); i++)
+        stride[i] = stride[i - 1] * dims[i - 1];
+    ERROR_CHECK_STATUS(vxCopyTensorPatch(tensor, dims.size(), start.data(), dims.data(), stride.data(), data.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    return data;
+}
+
+// verifies the graph, processes it the given number of times and returns the time per run in msec
+static float process_graph(vx_graph graph, int iterations)
+{
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    auto t0 = chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++)
+        ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    auto t1 = chrono::high_resolution_clock::now();
+    return chrono::duration<float, milli>(t1 - t0).count() / iterations;
+}
+
+template <typename T>
+static vector<T> random_data(size_t count, int lo, int hi)
+{
+    vector<T> data(count);
+    for (size_t i = 0; i < count; i++)
+        data[i] = (T)(lo + rand() % (hi - lo + 1));
+    return data;
+}
+
+static vector<float> random_float(size_t count)
+{
+    vector<float> data(count);
+    for (size_t i = 0; i < count; i++)
+        data[i] = (float)(rand() % 2001 - 1000) / 100.0f;
+    return data;
+}
+
+static bool check(const char *name, bool match)
+{
+    printf("%-40s %s\n", name, match ? "OK" : "MISMATCH");
+    return match;
+}
+
+// index of an element of a broadcast input: dimensions of size 1 always use index 0
+static size_t broadcast_index(size_t i, const vector<vx_size> &odims, const vector<vx_size> &idims)
+{
+    size_t index = 0, scale = 1;
+    for (size_t d = 0; d < odims.size(); d++)
+    {
+        size_t coord = i % odims[d];
+        i /= odims[d];
+        if (idims[d] != 1)
+            index += coord * scale;
+        scale *= idims[d];
+    }
+    return index;
+}
+
+static bool test_elementwise(vx_context context)
+{
+    bool ok = true;
+    // float add with broadcast of a per-row bias, and float multiply with scale
+    {
+        vector<vx_size> odims = {67, 9, 3}, bdims = {67, 1, 1};
+        vector<float> a = random_float(tensor_count(odims)), b = random_float(tensor_count(bdims));
+        vx_tensor ta = create_tensor(context, odims, VX_TYPE_FLOAT32, 0, &a);
+        vx_tensor tb = create_tensor(context, bdims, VX_TYPE_FLOAT32, 0, &b);
+        vx_tensor tadd = create_tensor<float>(context, odims, VX_TYPE_FLOAT32, 0, nullptr);
+        vx_tensor tmul = create_tensor<float>(context, odims, VX_TYPE_FLOAT32, 0, nullptr);
+        vx_float32 scale = 0.5f;
+        vx_scalar sscale = vxCreateScalar(context, VX_TYPE_FLOAT32, &scale);
+        vx_graph graph = vxCreateGraph(context);
+        ERROR_CHECK_OBJECT(vxTensorAddNode(graph, ta, tb, VX_CONVERT_POLICY_SATURATE, tadd));
+        ERROR_CHECK_OBJECT(vxTensorMultiplyNode(graph, ta, tb, sscale, VX_CONVERT_POLICY_SATURATE, VX_ROUND_POLICY_TO_ZERO, tmul));
+        process_graph(graph, 1);
+        vector<float> add = read_tensor<float>(tadd, odims), mul = read_tensor<float>(tmul, odims);
+        bool addMatch = true, mulMatch = true;
+        for (size_t i = 0; i < add.size(); i++)
+        {
+            float bv = b[broadcast_index(i, odims, bdims)];
+            addMatch &= (add[i] == a[i] + bv);
+            mulMatch &= (fabsf(mul[i] - a[i] * bv * scale) <= 1e-5f * fabsf(a[i] * bv * scale));
+        }
+        ok &= check("tensor_add F32 broadcast", addMatch);
+        ok &= check("tensor_multiply F32 broadcast", mulMatch);
+        ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+        ERROR_CHECK_STATUS(vxReleaseScalar(&sscale));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&ta));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&tb));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&tadd));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&tmul));
+    }
+    // U8 saturated subtract and S16 wrapped add
+    {
+        vector<vx_size> dims = {45, 7};
+        vector<vx_uint8> a8 = random_data<vx_uint8>(tensor_count(dims), 0, 255), b8 = random_data<vx_uint8>(tensor_count(dims), 0, 255);
+        vector<vx_int16> a16 = random_data<vx_int16>(tensor_count(dims), -32768, 32767), b16 = random_data<vx_int16>(tensor_count(dims), -32768, 32767);
+        vx_tensor ta8 = create_tensor(context, dims, VX_TYPE_UINT8, 0, &a8);
+        vx_tensor tb8 = create_tensor(context, dims, VX_TYPE_UINT8, 0, &b8);
+        vx_tensor to8 = create_tensor<vx_uint8>(context, dims, VX_TYPE_UINT8, 0, nullptr);
+        vx_tensor ta16 = create_tensor(context, dims, VX_TYPE_INT16, 8, &a16);
+        vx_tensor tb16 = create_tensor(context, dims, VX_TYPE_INT16, 8, &b16);
+        vx_tensor to16 = create_tensor<vx_int16>(context, dims, VX_TYPE_INT16, 8, nullptr);
+        vx_tensor tm16 = create_tensor<vx_int16>(context, dims, VX_TYPE_INT16, 8, nullptr);
+        vx_float32 scale = 1.0f;
+        vx_scalar sscale = vxCreateScalar(context, VX_TYPE_FLOAT32, &scale);
+        vx_graph graph = vxCreateGraph(context);
+        ERROR_CHECK_OBJECT(vxTensorSubtractNode(graph, ta8, tb8, VX_CONVERT_POLICY_SATURATE, to8));
+        ERROR_CHECK_OBJECT(vxTensorAddNode(graph, ta16, tb16, VX_CONVERT_POLICY_WRAP, to16));
+        ERROR_CHECK_OBJECT(vxTensorMultiplyNode(graph, ta16, tb16, sscale, VX_CONVERT_POLICY_SATURATE, VX_ROUND_POLICY_TO_NEAREST_EVEN, tm16));
+        process_graph(graph, 1);
+        vector<vx_uint8> o8 = read_tensor<vx_uint8>(to8, dims);
+        vector<vx_int16> o16 = read_tensor<vx_int16>(to16, dims), m16 = read_tensor<vx_int16>(tm16, dims);
+        bool subMatch = true, addMatch = true, mulMatch = true;
+        for (size_t i = 0; i < o8.size(); i++)
+        {
+            subMatch &= (o8[i] == (vx_uint8)max(0, (int)a8[i] - (int)b8[i]));
+            addMatch &= (o16[i] == (vx_int16)(a16[i] + b16[i]));
+            double v = nearbyint((double)a16[i] * b16[i] / 256.0);
+            mulMatch &= (m16[i] == (vx_int16)min(32767.0, max(-32768.0, v)));
+        }
+        ok &= check("tensor_subtract U8 saturate", subMatch);
+        ok &= check("tensor_add S16 Q7.8 wrap", addMatch);
+        ok &= check("tensor_multiply S16 Q7.8 saturate", mulMatch);
+        ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+        ERROR_CHECK_STATUS(vxReleaseScalar(&sscale));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&ta8));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&tb8));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&to8));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&ta16));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&tb16));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&to16));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&tm16));
+    }
+    return ok;
+}
+
+static bool test_lookup_transpose_convert(vx_context context)
+{
+    bool ok = true;
+    vector<vx_size> dims = {37, 19, 3};
+    vector<vx_uint8> a = random_data<vx_uint8>(tensor_count(dims), 0, 255);
+    vector<vx_uint8> table(256);
+    for (int i = 0; i < 256; i++)
+        table[i] = (vx_uint8)(255 - i / 2);
+    vx_lut lut = vxCreateLUT(context, VX_TYPE_UINT8, 256);
+    ERROR_CHECK_OBJECT(lut);
+    ERROR_CHECK_STATUS(vxCopyLUT(lut, table.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    vector<vx_size> tdims01 = {19, 37, 3}, tdims12 = {37, 3, 19};
+    vx_tensor ta = create_tensor(context, dims, VX_TYPE_UINT8, 0, &a);
+    vx_tensor tlut = create_tensor<vx_uint8>(context, dims, VX_TYPE_UINT8, 0, nullptr);
+    vx_tensor tt01 = create_tensor<vx_uint8>(context, tdims01, VX_TYPE_UINT8, 0, nullptr);
+    vx_tensor tt12 = create_tensor<vx_uint8>(context, tdims12, VX_TYPE_UINT8, 0, nullptr);
+    vx_tensor tf = create_tensor<float>(context, dims, VX_TYPE_FLOAT32, 0, nullptr);
+    vx_float32 norm = 255.0f, offset = 128.0f;
+    vx_scalar snorm = vxCreateScalar(context, VX_TYPE_FLOAT32, &norm);
+    vx_scalar soffset = vxCreateScalar(context, VX_TYPE_FLOAT32, &offset);
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(vxTensorTableLookupNode(graph, ta, lut, tlut));
+    ERROR_CHECK_OBJECT(vxTensorTransposeNode(graph, ta, tt01, 0, 1));
+    ERROR_CHECK_OBJECT(vxTensorTransposeNode(graph, ta, tt12, 1, 2));
+    ERROR_CHECK_OBJECT(vxTensorConvertDepthNode(graph, ta, VX_CONVERT_POLICY_SATURATE, snorm, soffset, tf));
+    process_graph(graph, 1);
+    vector<vx_uint8> olut = read_tensor<vx_uint8>(tlut, dims);
+    vector<vx_uint8> o01 = read_tensor<vx_uint8>(tt01, tdims01), o12 = read_tensor<vx_uint8>(tt12, tdims12);
+    vector<float> of = read_tensor<float>(tf, dims);
+    bool lutMatch = true, t01Match = true, t12Match = true, cvtMatch = true;
+    for (size_t z = 0; z < dims[2]; z++)
+    {
+        for (size_t y = 0; y < dims[1]; y++)
+        {
+            for (size_t x = 0; x < dims[0]; x++)
+            {
+                size_t i = (z * dims[1] + y) * dims[0] + x;
+                lutMatch &= (olut[i] == table[a[i]]);
+                t01Match &= (o01[(z * dims[0] + x) * dims[1] + y] == a[i]);
+                t12Match &= (o12[(y * dims[2] + z) * dims[0] + x] == a[i]);
+                cvtMatch &= (fabsf(of[i] - ((float)a[i] - offset) / norm) <= 1e-6f);
+            }
+        }
+    }
+    ok &= check("tensor_table_lookup U8", lutMatch);
+    ok &= check("tensor_transpose U8 dims 0,1", t01Match);
+    ok &= check("tensor_transpose U8 dims 1,2", t12Match);
+    ok &= check("tensor_convert_depth U8 to F32", cvtMatch);
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&snorm));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&soffset));
+    ERROR_CHECK_STATUS(vxReleaseLUT(&lut));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&ta));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tlut));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tt01));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tt12));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tf));
+    return ok;
+}
+
+// C = A * B + bias with A: MxK, B: KxN; matrices are stored with dims[0] as columns and may be transposed
+static float run_matmul(vx_context context, int M, int N, int K, bool transposeB, bool withBias, int iterations, bool &match)
+{
+    vector<float> a = random_float((size_t)M * K), b = random_float((size_t)K * N), c = random_float((size_t)M * N);
+    vector<vx_size> adims = {(vx_size)K, (vx_size)M}, cdims = {(vx_size)N, (vx_size)M};
+    vector<vx_size> bdims = transposeB ? vector<vx_size>{(vx_size)K, (vx_size)N} : vector<vx_size>{(vx_size)N, (vx_size)K};
+    vx_tensor ta = create_tensor(context, adims, VX_TYPE_FLOAT32, 0, &a);
+    vx_tensor tb = create_tensor(context, bdims, VX_TYPE_FLOAT32, 0, &b);
+    vx_tensor tc = withBias ? create_tensor(context, cdims, VX_TYPE_FLOAT32, 0, &c) : nullptr;
+    vx_tensor to = create_tensor<float>(context, cdims, VX_TYPE_FLOAT32, 0, nullptr);
+    vx_tensor_matrix_multiply_params_t params = {vx_false_e, transposeB ? vx_true_e : vx_false_e, vx_false_e};
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(vxTensorMatrixMultiplyNode(graph, ta, tb, tc, &params, to));
+    float msec = process_graph(graph, iterations);
+    vector<float> out = read_tensor<float>(to, cdims);
+    match = true;
+    for (int m = 0; m < M; m++)
+    {
+        for (int n = 0; n < N; n++)
+        {
+            double sum = withBias ? c[(size_t)m * N + n] : 0.0, mag = fabs(sum);
+            for (int k = 0; k < K; k++)
+            {
+                double bv = transposeB ? b[(size_t)n * K + k] : b[(size_t)k * N + n];
+                sum += (double)a[(size_t)m * K + k] * bv;
+                mag += fabs((double)a[(size_t)m * K + k] * bv);
+            }
+            match &= (fabs(out[(size_t)m * N + n] - sum) <= 1e-5 * mag + 1e-5);
+        }
+    }
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&ta));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&tb));
+    if (tc)
+        ERROR_CHECK_STATUS(vxReleaseTensor(&tc));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&to));
+    return msec;
+}
+
+int main(int argc, char **argv)
+{
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+    srand(42);
+
+    // check each tensor kernel against a scalar reference
+    bool ok = test_elementwise(context);
+    ok &= test_lookup_transpose_convert(context);
+    bool match = false;
+    run_matmul(context, 17, 29, 33, false, true, 1, match);
+    ok &= check("tensor_matrix_multiply F32 with bias", match);
+    run_matmul(context, 6, 21, 40, true, false, 1, match);
+    ok &= check("tensor_matrix_multiply F32 transposed B", match);
+    if (!ok)
+    {
+        printf("ERROR: tensor_ops: mismatch against reference\n");
+        return -1;
+    }
+
+    // matrix multiply timing at typical fully connected layer sizes
+    printf("%8s %8s %8s %12s %12s\n", "M", "N", "K", "msec", "GFLOPS");
+    const int sizes[][3] = {{1, 1000, 2048}, {64, 256, 256}, {256, 256, 256}};
+    for (const auto &size : sizes)
+    {
+        float msec = run_matmul(context, size[0], size[1], size[2], false, false, 5, match);
+        double gflops = 2.0 * size[0] * size[1] * size[2] / (msec * 1e6);
+        printf("%8d %8d %8d %12.3f %12.2f\n", size[0], size[1], size[2], msec, gflops);
+        if (!match)
+        {
+            printf("ERROR: tensor_ops: matrix multiply mismatch at %dx%dx%d\n", size[0], size[1], size[2]);
+            return -1;
+        }
+    }
+
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    printf("tensor_ops: test passed\n");
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*
+Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+static vx_uint32 callback_count = 0;
+
+static vx_action VX_CALLBACK node_callback(vx_node node)
+{
+    callback_count++;
+    return VX_ACTION_CONTINUE;
+}
+
+static void fill_image(vx_image image, int seed)
+{
+    vx_uint32 width = 0, height = 0;
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    vx_uint8 *ptr = nullptr;
+    ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, 0, &map_id, &addr, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    vx_uint32 state = 12345 + seed;
+    for (vx_uint32 j = 0; j < height; j++)
+        for (vx_uint32 i = 0; i < width; i++)
+        {
+            state = state * 1103515245 + 12345;
+            ptr[j * addr.stride_y + i] = (vx_uint8)(state >> 16);
+        }
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+}
+
+static void read_image(vx_image image, std::vector<vx_uint8> &pixels)
+{
+    vx_uint32 width = 0, height = 0;
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    vx_uint8 *ptr = nullptr;
+    ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, 0, &map_id, &addr, (void **)&ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    for (vx_uint32 j = 0; j < height; j++)
+        pixels.insert(pixels.end(), ptr + j * addr.stride_y, ptr + j * addr.stride_y + width * addr.stride_x);
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+}
+
+// runs a graph with six independent filters on the first level feeding three combining nodes, an add and a final xor
+// for a few frames with the given number of graph CPU threads; returns the real outputs of the last frame
+// and checks the inverted image against the host and that every node callback fired
+static int run_graph(vx_context context, vx_uint32 num_threads, bool schedule, std::vector<vx_uint8> &pixels)
+{
+    vx_uint32 width = 640, height = 480, frames = 4;
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_CPU_NUM_THREADS, &num_threads, sizeof(num_threads)));
+
+    vx_image input = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image inverted = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image output = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(input);
+    ERROR_CHECK_OBJECT(inverted);
+    ERROR_CHECK_OBJECT(output);
+    vx_image level1[5], level2[4];
+    for (int i = 0; i < 5; i++)
+    {
+        level1[i] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(level1[i]);
+    }
+    for (int i = 0; i < 4; i++)
+    {
+        level2[i] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(level2[i]);
+    }
+    vx_node nodes[11] = {
+        vxNotNode(graph, input, inverted),
+        vxBox3x3Node(graph, input, level1[0]),
+        vxGaussian3x3Node(graph, input, level1[1]),
+        vxDilate3x3Node(graph, input, level1[2]),
+        vxErode3x3Node(graph, input, level1[3]),
+        vxMedian3x3Node(graph, input, level1[4]),
+        vxAbsDiffNode(graph, level1[0], level1[1], level2[0]),
+        vxOrNode(graph, level1[2], level1[3], level2[1]),
+        vxAndNode(graph, inverted, level1[4], level2[2]),
+        vxAddNode(graph, level2[0], level2[1], VX_CONVERT_POLICY_SATURATE, level2[3]),
+        vxXorNode(graph, level2[3], level2[2], output),
+    };
+    for (int i = 0; i < 11; i++)
+    {
+        ERROR_CHECK_OBJECT(nodes[i]);
+        ERROR_CHECK_STATUS(vxAssignNodeCallback(nodes[i], node_callback));
+    }
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+
+    callback_count = 0;
+    for (vx_uint32 frame = 0; frame < frames; frame++)
+    {
+        fill_image(input, frame);
+        if (schedule)
+        {
+            ERROR_CHECK_STATUS(vxScheduleGraph(graph));
+            ERROR_CHECK_STATUS(vxWaitGraph(graph));
+        }
+        else
+        {
+            ERROR_CHECK_STATUS(vxProcessGraph(graph));
+        }
+    }
+    if (callback_count != 11 * frames)
+    {
+        printf("ERROR: %u node callbacks for %u frames of 11 nodes with %u threads\n", callback_count, frames, num_threads);
+        return 1;
+    }
+
+    std::vector<vx_uint8> in, inv;
+    read_image(input, in);
+    read_image(inverted, inv);
+    for (size_t i = 0; i < in.size(); i++)
+        if (inv[i] != (vx_uint8)~in[i])
+        {
+            printf("ERROR: inverted pixel %zu is %d instead of %d with %u threads\n", i, inv[i], (vx_uint8)~in[i], num_threads);
+            return 1;
+        }
+    pixels = inv;
+    read_image(output, pixels);
+
+    for (int i = 0; i < 11; i++)
+        ERROR_CHECK_STATUS(vxReleaseNode(&nodes[i]));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    for (int i = 0; i < 5; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&level1[i]));
+    for (int i = 0; i < 4; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&level2[i]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    ERROR_CHECK_STATUS(vxReleaseImage(&inverted));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    // the pool workers are created by the first graph with more than one thread and must be stopped
+    // when the context is released, so the second context starts with a new pool
+    std::vector<vx_uint8> reference;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        vx_context context = vxCreateContext();
+        ERROR_CHECK_OBJECT(context);
+        vxRegisterLogCallback(context, log_callback, vx_false_e);
+
+        // reference: all nodes run on the graph thread one after another
+        if (pass == 0 && run_graph(context, 1, false, reference))
+            return 1;
+        vx_uint32 thread_counts[3] = {2, 4, 8};
+        for (int t = 0; t < 3; t++)
+        {
+            for (int schedule = 0; schedule < 2; schedule++)
+            {
+                std::vector<vx_uint8> pixels;
+                if (run_graph(context, thread_counts[t], schedule != 0, pixels))
+                    return 1;
+                if (pixels != reference)
+                {
+                    printf("ERROR: outputs with %u threads differ from a single thread\n", thread_counts[t]);
+                    return 1;
+                }
+            }
+            printf("STATUS: outputs with %u threads match a single thread\n", thread_counts[t]);
+        }
+
+        ERROR_CHECK_STATUS(vxReleaseContext(&context));
+        printf("STATUS: context %d released with its worker pool\n", pass);
+    }
+    return 0;
+}
@@ -0,0 +1,223 @@
+/*
+Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+static void fill_image(vx_image image, int seed)
+{
+    vx_uint32 width = 0, height = 0;
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    vx_uint8 *ptr = nullptr;
+    ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, 0, &map_id, &addr, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    vx_uint32 state = 12345 + seed;
+    for (vx_uint32 j = 0; j < height; j++)
+        for (vx_uint32 i = 0; i < width; i++)
+        {
+            state = state * 1103515245 + 12345;
+            ptr[j * addr.stride_y + i] = (vx_uint8)(state >> 16);
+        }
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+}
+
+static void read_image(vx_image image, std::vector<vx_uint8> &pixels)
+{
+    vx_uint32 width = 0, height = 0;
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    vx_uint8 *ptr = nullptr;
+    ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, 0, &map_id, &addr, (void **)&ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    for (vx_uint32 j = 0; j < height; j++)
+        pixels.insert(pixels.end(), ptr + j * addr.stride_y, ptr + j * addr.stride_y + width * addr.stride_x);
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+}
+
+static vx_uint64 bytes_in_use(vx_context context)
+{
+    AgoMemoryPoolInfo info;
+    ERROR_CHECK_STATUS(vxQueryContext(context, VX_CONTEXT_ATTRIBUTE_AMD_MEMORY_POOL_INFO, &info, sizeof(info)));
+    return info.bytes_in_use;
+}
+
+// chain of num_stages element-wise nodes through virtual images, where only two of them are live at a time:
+// returns the host memory allocated by the first execution of the graph
+static vx_uint64 verify_chain(vx_context context, vx_image input, vx_image output, int num_stages)
+{
+    vx_uint32 width = 0, height = 0;
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_image src = input;
+    for (int i = 0; i < num_stages; i++)
+    {
+        vx_image dst = (i == num_stages - 1) ? output : vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(dst);
+        vx_node node = vxAddNode(graph, src, input, VX_CONVERT_POLICY_WRAP, dst);
+        ERROR_CHECK_OBJECT(node);
+        ERROR_CHECK_STATUS(vxReleaseNode(&node));
+        if (src != input)
+            ERROR_CHECK_STATUS(vxReleaseImage(&src));
+        src = dst;
+    }
+    vx_uint64 bytes = bytes_in_use(context);
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    bytes = bytes_in_use(context) - bytes;
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    return bytes;
+}
+
+// virtual images with overlapping lifetimes: returns the output pixels
+static void run_branches(vx_context context, vx_image input, std::vector<vx_uint8> &pixels)
+{
+    vx_uint32 width = 0, height = 0;
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_image virt[5];
+    for (int i = 0; i < 5; i++)
+    {
+        virt[i] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(virt[i]);
+    }
+    vx_image output = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(output);
+    vx_node nodes[] = {
+        vxNotNode(graph, input, virt[0]),
+        vxBox3x3Node(graph, input, virt[1]),
+        vxAddNode(graph, virt[0], virt[1], VX_CONVERT_POLICY_SATURATE, virt[2]),
+        vxGaussian3x3Node(graph, virt[2], virt[3]),
+        vxSubtractNode(graph, virt[3], virt[0], VX_CONVERT_POLICY_SATURATE, virt[4]),
+        vxAbsDiffNode(graph, virt[4], virt[1], output),
+    };
+    for (auto &node : nodes)
+    {
+        ERROR_CHECK_OBJECT(node);
+        ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    }
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    pixels.clear();
+    read_image(output, pixels);
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    for (int i = 0; i < 5; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&virt[i]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+}
+
+int main(int argc, char **argv)
+{
+    vx_uint32 width = 1280, height = 720;
+    int num_stages = 6;
+
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+    vx_image input = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image output = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(input);
+    ERROR_CHECK_OBJECT(output);
+    fill_image(input, 0);
+
+    // AGO_BUFFER_MERGE_FLAGS bit 0 gives every virtual image its own buffer
+    unsetenv("AGO_BUFFER_MERGE_FLAGS");
+    verify_chain(context, input, output, num_stages); // leave out one-time allocations of the first graph
+    vx_uint64 bytes_arena = verify_chain(context, input, output, num_stages);
+    vx_uint64 bytes_arena_long = verify_chain(context, input, output, 2 * num_stages);
+    std::vector<vx_uint8> pixels[2];
+    run_branches(context, input, pixels[0]);
+    setenv("AGO_BUFFER_MERGE_FLAGS", "1", 1);
+    vx_uint64 bytes_separate = verify_chain(context, input, output, num_stages);
+    run_branches(context, input, pixels[1]);
+    unsetenv("AGO_BUFFER_MERGE_FLAGS");
+
+    // the arena holds the two live images of the chain instead of all of the virtual images
+    vx_uint64 image_size = (vx_uint64)width * height;
+    printf("STATUS: %d virtual images need %.1f MB in the arena and %.1f MB in separate buffers\n", num_stages - 1,
+           bytes_arena / 1048576.0, bytes_separate / 1048576.0);
+    if (bytes_arena_long != bytes_arena || bytes_separate < bytes_arena + (vx_uint64)(num_stages - 3) * image_size)
+    {
+        printf("ERROR: the arena isn't sized to the live images\n");
+        return 1;
+    }
+    // buffers that are live at the same time never share arena space
+    if (pixels[0] != pixels[1])
+    {
+        printf("ERROR: outputs with the arena differ from outputs with separate buffers\n");
+        return 1;
+    }
+    printf("STATUS: outputs with the arena match outputs with separate buffers\n");
+
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    return 0;
+}
@@ -0,0 +1,285 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <cstdlib>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <VX/vxu.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+static void write_input(vx_image image, int seed)
+{
+    vx_uint32 width, height;
+    vx_df_image format;
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_FORMAT, &format, sizeof(format)));
+    vx_uint32 bytes = (format == VX_DF_IMAGE_RGB) ? 3 : 1;
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    vx_uint8 *ptr = nullptr;
+    ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, 0, &map_id, &addr, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    for (vx_uint32 y = 0; y < height; y++)
+    {
+        vx_uint8 *row = ptr + y * addr.stride_y;
+        for (vx_uint32 x = 0; x < width * bytes; x++)
+            row[x] = (vx_uint8)((x * 7 + y * 13 + seed * 29 + ((x ^ (y + seed)) & 0x3f)) & 0xff);
+    }
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+}
+
+// compare plane 0 of two images, except for the undefined border pixels
+static vx_uint32 count_mismatches(vx_image image1, vx_image image2, vx_uint32 border)
+{
+    vx_uint32 width, height;
+    ERROR_CHECK_STATUS(vxQueryImage(image1, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(image1, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    vx_rectangle_t rect = {0, 0, width, height};
+    vx_imagepatch_addressing_t addr = {0};
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    std::vector<vx_uint8> pixels[2];
+    pixels[0].resize((size_t)width * height);
+    pixels[1].resize((size_t)width * height);
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image1, &rect, 0, &addr, pixels[0].data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image2, &rect, 0, &addr, pixels[1].data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    vx_uint32 mismatches = 0;
+    for (vx_uint32 y = border; y < height - border; y++)
+    {
+        for (vx_uint32 x = border; x < width - border; x++)
+        {
+            if (pixels[0][y * width + x] != pixels[1][y * width + x])
+                mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+// reference result from a graph built for this call only
+static void gaussian_reference(vx_context context, vx_image input, vx_image output)
+{
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_node node = vxGaussian3x3Node(graph, input, output);
+    ERROR_CHECK_OBJECT(node);
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+}
+
+static double time_gaussian(vx_context context, vx_image input, vx_image output, int iterations)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        ERROR_CHECK_STATUS(vxuGaussian3x3(context, input, output));
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed_seconds = (end - start) / iterations;
+    return elapsed_seconds.count() * 1000.0;
+}
+
+int main(int argc, char **argv)
+{
+    vx_uint32 width = 640, height = 480;
+    int iterations = 200;
+
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+
+    vx_image input[2], output[2], reference;
+    for (int i = 0; i < 2; i++)
+    {
+        input[i] = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+        output[i] = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(input[i]);
+        ERROR_CHECK_OBJECT(output[i]);
+        write_input(input[i], i);
+    }
+    reference = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(reference);
+
+    // second call reuses the graph of the first one with both images switched
+    ERROR_CHECK_STATUS(vxuGaussian3x3(context, input[0], output[0]));
+    ERROR_CHECK_STATUS(vxuGaussian3x3(context, input[1], output[1]));
+    for (int i = 0; i < 2; i++)
+    {
+        gaussian_reference(context, input[i], reference);
+        vx_uint32 mismatches = count_mismatches(output[i], reference, 1);
+        if (mismatches)
+        {
+            printf("ERROR: vxuGaussian3x3 output #%d mismatch at %u pixels\n", i, mismatches);
+            return 1;
+        }
+    }
+
+    // arguments swapped or repeated between calls with the same layout
+    vx_image sum[3];
+    for (int i = 0; i < 3; i++)
+    {
+        sum[i] = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(sum[i]);
+    }
+    ERROR_CHECK_STATUS(vxuSubtract(context, input[0], input[1], VX_CONVERT_POLICY_SATURATE, sum[0]));
+    ERROR_CHECK_STATUS(vxuSubtract(context, input[1], input[0], VX_CONVERT_POLICY_SATURATE, sum[1]));
+    ERROR_CHECK_STATUS(vxuAbsDiff(context, input[0], input[1], sum[2]));
+    ERROR_CHECK_STATUS(vxuAdd(context, sum[0], sum[1], VX_CONVERT_POLICY_SATURATE, output[0]));
+    if (count_mismatches(output[0], sum[2], 0))
+    {
+        printf("ERROR: vxuSubtract with swapped inputs doesn't match vxuAbsDiff\n");
+        return 1;
+    }
+    ERROR_CHECK_STATUS(vxuAdd(context, input[0], input[0], VX_CONVERT_POLICY_WRAP, output[0]));
+    ERROR_CHECK_STATUS(vxuAdd(context, input[1], input[1], VX_CONVERT_POLICY_WRAP, output[1]));
+    ERROR_CHECK_STATUS(vxuAdd(context, input[1], input[0], VX_CONVERT_POLICY_WRAP, sum[0]));
+    ERROR_CHECK_STATUS(vxuSubtract(context, sum[0], input[0], VX_CONVERT_POLICY_WRAP, sum[1]));
+    ERROR_CHECK_STATUS(vxuAdd(context, sum[1], input[1], VX_CONVERT_POLICY_WRAP, sum[2]));
+    if (count_mismatches(output[1], sum[2], 0))
+    {
+        printf("ERROR: vxuAdd with repeated input mismatch\n");
+        return 1;
+    }
+
+    // multi-plane outputs and scalars created per call
+    vx_image rgb[2], iyuv[2];
+    for (int i = 0; i < 2; i++)
+    {
+        rgb[i] = vxCreateImage(context, width, height, VX_DF_IMAGE_RGB);
+        iyuv[i] = vxCreateImage(context, width, height, VX_DF_IMAGE_IYUV);
+        ERROR_CHECK_OBJECT(rgb[i]);
+        ERROR_CHECK_OBJECT(iyuv[i]);
+        write_input(rgb[i], 5 + i);
+        ERROR_CHECK_STATUS(vxuColorConvert(context, rgb[i], iyuv[i]));
+        ERROR_CHECK_STATUS(vxuChannelExtract(context, iyuv[i], VX_CHANNEL_Y, sum[i]));
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        ERROR_CHECK_STATUS(vxuColorConvert(context, rgb[i], iyuv[1 - i]));
+        ERROR_CHECK_STATUS(vxuChannelExtract(context, iyuv[1 - i], VX_CHANNEL_Y, output[0]));
+        if (count_mismatches(output[0], sum[i], 0))
+        {
+            printf("ERROR: vxuColorConvert output #%d mismatch\n", i);
+            return 1;
+        }
+    }
+    ERROR_CHECK_STATUS(vxuMultiply(context, input[0], input[1], 0.5f, VX_CONVERT_POLICY_SATURATE, VX_ROUND_POLICY_TO_ZERO, output[0]));
+    ERROR_CHECK_STATUS(vxuMultiply(context, input[0], input[1], 1.0f / 256, VX_CONVERT_POLICY_SATURATE, VX_ROUND_POLICY_TO_ZERO, output[1]));
+    if (!count_mismatches(output[0], output[1], 0))
+    {
+        printf("ERROR: vxuMultiply didn't use the new scale\n");
+        return 1;
+    }
+
+    // cached graphs don't keep the objects of the caller: their buffers are freed once the caller releases them
+    AgoMemoryPoolInfo poolInfo[2];
+    ERROR_CHECK_STATUS(vxQueryContext(context, VX_CONTEXT_ATTRIBUTE_AMD_MEMORY_POOL_INFO, &poolInfo[0], sizeof(poolInfo[0])));
+    for (int i = 0; i < 2; i++)
+    {
+        vx_image image[2] = {vxCreateImage(context, width * 2, height * 2, VX_DF_IMAGE_U8), vxCreateImage(context, width * 2, height * 2, VX_DF_IMAGE_U8)};
+        ERROR_CHECK_OBJECT(image[0]);
+        ERROR_CHECK_OBJECT(image[1]);
+        write_input(image[0], 7 + i);
+        ERROR_CHECK_STATUS(vxuGaussian3x3(context, image[0], image[1]));
+        vx_float32 mean = 0, stddev = 0;
+        ERROR_CHECK_STATUS(vxuMeanStdDev(context, image[1], &mean, &stddev));
+        ERROR_CHECK_STATUS(vxReleaseImage(&image[0]));
+        ERROR_CHECK_STATUS(vxReleaseImage(&image[1]));
+        ERROR_CHECK_STATUS(vxQueryContext(context, VX_CONTEXT_ATTRIBUTE_AMD_MEMORY_POOL_INFO, &poolInfo[1], sizeof(poolInfo[1])));
+        if (poolInfo[1].bytes_in_use >= poolInfo[0].bytes_in_use + width * 2 * height * 2)
+        {
+            printf("ERROR: released images still hold %lld bytes after vxu call #%d\n", (long long)(poolInfo[1].bytes_in_use - poolInfo[0].bytes_in_use), i);
+            return 1;
+        }
+    }
+
+    double msecCached = time_gaussian(context, input[0], output[0], iterations);
+    std::cout << "STATUS: vxuGaussian3x3() with graph cache took " << msecCached << "msec per call (AVG)\n";
+
+    for (int i = 0; i < 2; i++)
+    {
+        ERROR_CHECK_STATUS(vxReleaseImage(&input[i]));
+        ERROR_CHECK_STATUS(vxReleaseImage(&output[i]));
+        ERROR_CHECK_STATUS(vxReleaseImage(&rgb[i]));
+        ERROR_CHECK_STATUS(vxReleaseImage(&iyuv[i]));
+    }
+    for (int i = 0; i < 3; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&sum[i]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&reference));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+
+    // same calls without the cache: every call creates and verifies a graph
+    setenv("AGO_VXU_GRAPH_CACHE_SIZE", "0", 1);
+    context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vx_image image[2] = {vxCreateImage(context, width, height, VX_DF_IMAGE_U8), vxCreateImage(context, width, height, VX_DF_IMAGE_U8)};
+    ERROR_CHECK_OBJECT(image[0]);
+    ERROR_CHECK_OBJECT(image[1]);
+    double msecUncached = time_gaussian(context, image[0], image[1], iterations);
+    std::cout << "STATUS: vxuGaussian3x3() without graph cache took " << msecUncached << "msec per call (AVG)\n";
+    ERROR_CHECK_STATUS(vxReleaseImage(&image[0]));
+    ERROR_CHECK_STATUS(vxReleaseImage(&image[1]));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+
+    printf("STATUS: vxu graph cache OK\n");
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <iostream>
+
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+
+    vx_pixel_value_t value = {};
+    value.U8 = 17;
+    vx_image input = vxCreateUniformImage(context, 64, 48, VX_DF_IMAGE_U8, &value);
+    ERROR_CHECK_OBJECT(input);
+
+    // host writes bump the count, reads don't
+    vx_array array = vxCreateArray(context, VX_TYPE_FLOAT32, 4);
+    vx_scalar scalar = vxCreateScalar(context, VX_TYPE_FLOAT32, nullptr);
+    vx_scalar mean = vxCreateScalar(context, VX_TYPE_FLOAT32, nullptr);
+    vx_scalar stddev = vxCreateScalar(context, VX_TYPE_FLOAT32, nullptr);
+    ERROR_CHECK_OBJECT(array);
+    ERROR_CHECK_OBJECT(scalar);
+    ERROR_CHECK_OBJECT(mean);
+    ERROR_CHECK_OBJECT(stddev);
+    vx_float32 values[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+    vx_uint32 array_count[4] = {0}, scalar_count[3] = {0}, mean_count[3] = {0};
+    ERROR_CHECK_STATUS(vxQueryArray(array, VX_ARRAY_WRITE_COUNT, &array_count[0], sizeof(vx_uint32)));
+    ERROR_CHECK_STATUS(vxAddArrayItems(array, 4, values, sizeof(vx_float32)));
+    ERROR_CHECK_STATUS(vxQueryArray(array, VX_ARRAY_WRITE_COUNT, &array_count[1], sizeof(vx_uint32)));
+    ERROR_CHECK_STATUS(vxCopyArrayRange(array, 0, 4, sizeof(vx_float32), values, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxQueryArray(array, VX_ARRAY_WRITE_COUNT, &array_count[2], sizeof(vx_uint32)));
+    ERROR_CHECK_STATUS(vxCopyArrayRange(array, 1, 2, sizeof(vx_float32), values, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxQueryArray(array, VX_ARRAY_WRITE_COUNT, &array_count[3], sizeof(vx_uint32)));
+    ERROR_CHECK_STATUS(vxQueryScalar(scalar, VX_SCALAR_WRITE_COUNT, &scalar_count[0], sizeof(vx_uint32)));
+    ERROR_CHECK_STATUS(vxCopyScalar(scalar, &values[0], VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxQueryScalar(scalar, VX_SCALAR_WRITE_COUNT, &scalar_count[1], sizeof(vx_uint32)));
+    ERROR_CHECK_STATUS(vxCopyScalar(scalar, &values[1], VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxQueryScalar(scalar, VX_SCALAR_WRITE_COUNT, &scalar_count[2], sizeof(vx_uint32)));
+    if (array_count[1] == array_count[0] || array_count[2] != array_count[1] || array_count[3] == array_count[2] ||
+        scalar_count[1] != scalar_count[0] || scalar_count[2] == scalar_count[1])
+    {
+        printf("ERROR: unexpected write counts: array %u %u %u %u scalar %u %u %u\n", array_count[0], array_count[1], array_count[2],
+               array_count[3], scalar_count[0], scalar_count[1], scalar_count[2]);
+        return 1;
+    }
+    // node outputs count as written on every execution
+    vx_graph graph_stat = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph_stat);
+    vx_node node = vxMeanStdDevNode(graph_stat, input, mean, stddev);
+    ERROR_CHECK_OBJECT(node);
+    ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph_stat));
+    ERROR_CHECK_STATUS(vxQueryScalar(mean, VX_SCALAR_WRITE_COUNT, &mean_count[0], sizeof(vx_uint32)));
+    ERROR_CHECK_STATUS(vxProcessGraph(graph_stat));
+    ERROR_CHECK_STATUS(vxQueryScalar(mean, VX_SCALAR_WRITE_COUNT, &mean_count[1], sizeof(vx_uint32)));
+    ERROR_CHECK_STATUS(vxScheduleGraph(graph_stat));
+    ERROR_CHECK_STATUS(vxWaitGraph(graph_stat));
+    ERROR_CHECK_STATUS(vxQueryScalar(mean, VX_SCALAR_WRITE_COUNT, &mean_count[2], sizeof(vx_uint32)));
+    if (mean_count[1] == mean_count[0] || mean_count[2] == mean_count[1])
+    {
+        printf("ERROR: node output write count not updated: %u %u %u\n", mean_count[0], mean_count[1], mean_count[2]);
+        return 1;
+    }
+    printf("STATUS: write counts updated\n");
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph_stat));
+    ERROR_CHECK_STATUS(vxReleaseArray(&array));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&scalar));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&mean));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&stddev));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    return 0;
+}
@@ -63,6 +63,9 @@ void show_usage(const char * program, bool detail)
 	printf("  -frames:[<start>:]<end>|eof|live\n");
 	printf("      Run the graph/node for specified frames or until eof or just as live.\n");
 	printf("      Use live to indicate that input is live until aborted by user.\n");
+	printf("  -io-frames:<count>\n");
+	printf("      Number of frames in flight for background file read/write/compare\n");
+	printf("      of images. Use 0 for synchronous I/O. The default value is 2.\n");
 	printf("  -affinity:CPU|GPU[<device-index>]\n");
 	printf("      Set context affinity to CPU or GPU.\n");
 	printf("  -dump-profile\n");
@@ -105,6 +108,7 @@ int main(int argc, char * argv[])
 	int arg, frameStart = 0, frameEnd = 1;
 	bool frameCountSpecified = false;
 	int waitKeyDelayInMilliSeconds = -1; // -ve indicates no user preference
+	int framesInFlight = -1; // -ve indicates no user preference
 	bool enableFullProfile = false, disableNodeFlushForCL = false;
 	std::string dumpDataConfig = "";
 	std::string discardCommandList = "";
@@ -150,6 +154,11 @@ int main(int argc, char * argv[])
 					}
 				}
 			}
+			else if (!_strnicmp(argv[arg], "-io-frames:", 11)) {
+				if (sscanf(&argv[arg][11], "%i", &framesInFlight) != 1 || framesInFlight < 0) {
+					printf("ERROR: invalid -io-frames option\n"); return -1;
+				}
+			}
 			else if (!_strnicmp(argv[arg], "-affinity:", 10)) {
 				if (!_strnicmp(&argv[arg][10], "cpu", 3)) defaultTargetAffinity = AGO_TARGET_AFFINITY_CPU;
 				else if (!_strnicmp(&argv[arg][10], "gpu", 3)) defaultTargetAffinity = AGO_TARGET_AFFINITY_GPU;
@@ -225,6 +234,9 @@ int main(int argc, char * argv[])
 		}
 		engine.SetConfigOptions(verbose, discardCompareErrors, enableDumpProfile, enableDumpGDF, waitKeyDelayInMilliSeconds);
 		engine.SetFrameCountOptions(enableMultiFrameProcessing, framesEofRequested, frameCountSpecified, frameStart, frameEnd);
+		if (framesInFlight >= 0) {
+			engine.SetFramesInFlight(framesInFlight);
+		}
 		fflush(stdout);
 		// pass parameters to the engine: note that shell takes no extra parameters whereas node and file take extra parameter
 		for (int i = 0, j = 0; i < argCount; i++) {
@@ -73,6 +73,7 @@ CVxEngine::CVxEngine()
 	m_frameCountSpecified = false;
 	m_frameStart = 0;
 	m_frameEnd = 0;
+	m_framesInFlight = 2; // default is 2 frames of background file I/O per object
 	m_waitKeyDelayInMilliSeconds = 1; // default is 1ms
 	m_disableCompare = false;
 	m_numGraphProcessed = 0;
@@ -326,6 +327,7 @@ int CVxEngine::ProcessGraph(std::vector<const char *> * graphNameList, size_t be
 		m_usingMultiFrameCapture |= it->second->IsUsingMultiFrameCapture();
 		it->second->SetVerbose(m_verbose);
 		it->second->SetDiscardCompareErrors(m_discardCompareErrors);
+		it->second->SetFramesInFlight(m_framesInFlight);
 		it->second->Finalize();
 	}
 	if (m_frameCountSpecified) {
@@ -457,6 +459,8 @@ int CVxEngine::ProcessGraph(std::vector<const char *> * graphNameList, size_t be
 			break;
 		}
 	}
+	// wait for background I/O of the last frames and report deferred compare mismatches
+	if (FinishFrames() < 0) throw - 1;
 	// print the execution time statistics
 	int64_t end_time = utilGetClockCounter();
 	int64_t frequency = utilGetClockFrequency();
@@ -1204,6 +1208,16 @@ int CVxEngine::CompareFrame(int frameNumber)
 	return 0;
 }
 
+int CVxEngine::FinishFrames()
+{
+	int status = 0;
+	for (auto it = m_paramMap.begin(); it != m_paramMap.end(); ++it){
+		if (it->second->FinishFrames() < 0)
+			status = -1;
+	}
+	return status;
+}
+
 void CVxEngine::SetFrameCountOptions(bool enableMultiFrameProcessing, bool framesEofRequested, bool frameCountSpecified, int frameStart, int frameEnd)
 {
 	m_enableMultiFrameProcessing = enableMultiFrameProcessing;
@@ -1213,6 +1227,11 @@ void CVxEngine::SetFrameCountOptions(bool enableMultiFrameProcessing, bool frame
 	m_frameEnd = frameEnd;
 }
 
+void CVxEngine::SetFramesInFlight(int framesInFlight)
+{
+	m_framesInFlight = framesInFlight;
+}
+
 void CVxEngine::SetConfigOptions(bool verbose, bool discardCompareErrors, bool enableDumpProfile, bool enableDumpGDF, int waitKeyDelayInMilliSeconds)
 {
 	m_verbose = verbose;
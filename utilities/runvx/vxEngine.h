@@ -33,6 +33,7 @@ public:
 	int Initialize(int paramCount, int defaultTargetAffinity, int defaultTargetInfo, bool enableScheduleGraph, bool disableVirtual, bool enableFullProfile, bool disableNodeFlushForCL, std::string discardCommandList);
 	void SetConfigOptions(bool verbose, bool discardCompareErrors, bool enableDumpProfile, bool enableDumpGDF, int waitKeyDelayInMilliSeconds);
 	void SetFrameCountOptions(bool enableMultiFrameProcessing, bool framesEofRequested, bool frameCountSpecified, int frameStart, int frameEnd);
+	void SetFramesInFlight(int framesInFlight);
 	int SetGraphOptimizerFlags(vx_uint32 graph_optimizer_flags);
 	void SetDumpDataConfig(std::string dumpDataConfig);
 	int SetParameter(int index, const char * param);
@@ -53,6 +54,7 @@ protected:
 	int ReadFrame(int frameNumber);
 	int WriteFrame(int frameNumber);
 	int CompareFrame(int frameNumber);
+	int FinishFrames();
 	void MeasureFrame(int frameNumber, int status, std::vector<vx_graph>& graphList);
 	float GetMedianRunTime();
 	void PerformanceStatistics(int status, std::vector<vx_graph>& graphList);
@@ -86,6 +88,7 @@ private:
 	bool m_frameCountSpecified;
 	int m_frameStart;
 	int m_frameEnd;
+	int m_framesInFlight;
 	int m_waitKeyDelayInMilliSeconds;
 	bool m_disableCompare;
 	int m_numGraphProcessed;
@@ -23,6 +23,37 @@ THE SOFTWARE.
 #define _CRT_SECURE_NO_WARNINGS
 #include "vxImage.h"
 
+// check if the file extension needs OpenCV imwrite, i.e., a compressed image file
+static bool IsCompressedImageFileName(const char * fileName)
+{
+#if ENABLE_OPENCV
+	int extpos = (int)strlen(fileName) - 1;
+	while (extpos > 0 && fileName[extpos] != '.')
+		extpos--;
+	return !_stricmp(&fileName[extpos], ".jpg") || !_stricmp(&fileName[extpos], ".jpeg") ||
+		!_stricmp(&fileName[extpos], ".jpe") || !_stricmp(&fileName[extpos], ".png") ||
+		!_stricmp(&fileName[extpos], ".bmp") || !_stricmp(&fileName[extpos], ".tif") ||
+		!_stricmp(&fileName[extpos], ".ppm") || !_stricmp(&fileName[extpos], ".tiff") ||
+		!_stricmp(&fileName[extpos], ".pgm") || !_stricmp(&fileName[extpos], ".pbm");
+#else
+	return false;
+#endif
+}
+
+#if ENABLE_OPENCV
+// OpenCV Mat type for frames of an image format encoded with imwrite (-1: not supported)
+static int GetCvMatTypeForEncode(vx_df_image format)
+{
+	if (format == VX_DF_IMAGE_U8) return CV_8UC1;
+	else if (format == VX_DF_IMAGE_S16) return CV_16UC1; // CV_16SC1 is not supported
+	else if (format == VX_DF_IMAGE_U16) return CV_16UC1;
+	else if (format == VX_DF_IMAGE_RGB) return CV_8UC3;
+	else if (format == VX_DF_IMAGE_RGBX) return CV_8UC4;
+	else if (format == VX_DF_IMAGE_F32_AMD) return CV_32FC1;
+	return -1;
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////
 // class CVxParamImage
 //
@@ -78,6 +109,17 @@ CVxParamImage::CVxParamImage()
 	m_captureHeight = 0;
 	m_colorIndexDefault = 0;
 	m_radiusDefault = 2.0;
+
+	// background file I/O
+	m_ioWorker = nullptr;
+	m_asyncRead = false;
+	m_asyncCapture = false;
+	m_asyncWrite = false;
+	m_asyncCompare = false;
+	m_readSlotIndex = 0;
+	m_writeSlotIndex = 0;
+	m_compareSlotIndex = 0;
+	m_readFrameNext = -1;
 }
 
 CVxParamImage::~CVxParamImage()
@@ -87,6 +129,13 @@ CVxParamImage::~CVxParamImage()
 
 int CVxParamImage::Shutdown(void)
 {
+	// complete pending background I/O before the files and the image go away
+	if (m_ioWorker) {
+		delete m_ioWorker;
+		m_ioWorker = nullptr;
+	}
+	m_asyncRead = m_asyncCapture = m_asyncWrite = m_asyncCompare = false;
+	m_readFrameNext = -1;
 	if (m_compareCountMatches > 0 && m_compareCountMismatches == 0) {
 		printf("OK: image %s MATCHED for %d frame(s) of %s\n", m_useCheckSumForCompare ? "CHECKSUM" : "COMPARE", m_compareCountMatches, GetVxObjectName());
 	}
@@ -676,6 +725,9 @@ int CVxParamImage::Finalize()
 		}
 	}
 
+	// set up background file I/O, when requested
+	SetupAsyncIO();
+
 	if (m_useSyncOpenCLWriteDirective) {
 		// process user requested directives (required for uniform images)
 		ERROR_CHECK_AND_WARN(vxDirective((vx_reference)m_image, VX_DIRECTIVE_AMD_COPY_TO_OPENCL), VX_ERROR_NOT_ALLOCATED);
@@ -705,63 +757,40 @@ int CVxParamImage::ReadFrame(int frameNumber)
 			// no data available, report that no more frames available
 			return 1;
 		}
-		VideoCapture * pCap = (VideoCapture *)m_cvCapDev;
 		Mat * pMat = (Mat *)m_cvCapMat;
-        //Get Mat type, bevor get a new frame from VideoCapture.
-        int type = pMat->type();
-		int timeout = 0;
-		*pCap >> *pMat;
-        //change Mat type.
-        if(type == CV_8U){ /*CV_8U convert to gray*/
-            cvtColor( *pMat, *pMat, CV_BGR2GRAY );
-        }
-		if (!pMat->data) {
+		vx_uint32 captureWidth = 0, captureHeight = 0;
+		if (m_asyncCapture) {
+			if (m_readFrameNext < 0) {
+				// start decoding m_framesInFlight frames in the background
+				for (size_t i = 0; i < m_readSlots.size(); i++) {
+					IoSlot * slot = &m_readSlots[i];
+					slot->ticket = m_ioWorker->Submit([this, slot] { CaptureFrameJob(slot); });
+				}
+				m_readSlotIndex = 0;
+			}
+			// pick up the decoded frame and queue the decode of a later frame into the same slot
+			IoSlot * slot = &m_readSlots[m_readSlotIndex];
+			m_ioWorker->Wait(slot->ticket);
+			if (!slot->error.empty()) ReportError("%s", slot->error.c_str());
+			if (!slot->mat.data) {
+				// no data available, report that no more frames available
+				m_cvReadEofOccured = true;
+				return 1;
+			}
+			std::swap(*pMat, slot->mat);
+			captureWidth = slot->captureWidth;
+			captureHeight = slot->captureHeight;
+			slot->ticket = m_ioWorker->Submit([this, slot] { CaptureFrameJob(slot); });
+			m_readSlotIndex = (m_readSlotIndex + 1) % m_readSlots.size();
+			m_readFrameNext = frameNumber + 1;
+		}
+		else if (!CaptureFrame(pMat, &captureWidth, &captureHeight)) {
 			// no data available, report that no more frames available
 			m_cvReadEofOccured = true;
 			return 1;
 		}
-		else if (!m_gotCaptureVideoSize) {
-			m_captureWidth = pMat->cols;
-			m_captureHeight = pMat->rows;
-			m_gotCaptureVideoSize = true;
-			bool doResize = !m_doNotResizeCapturedImages && (pMat->cols != m_width || pMat->rows != m_height);
-			printf("OK: capturing %dx%d image(s) into %dx%d RGB image buffer%s\n", m_captureWidth, m_captureHeight, m_width, m_height, doResize ? " with resize" : "");
-		}
-
-		// resize image using bicubic interpolation, if needed
-		bool doResize = !m_doNotResizeCapturedImages && (pMat->cols != m_width || pMat->rows != m_height);
-		if (doResize) {
-			// resize the captured video to specifed buffer size
-			resize(*pMat, *pMat, Size(m_width, m_height), 0, 0, INTER_CUBIC);
-		}
-
-		// copy Mat into image
-		// NOTE: currently only supports U8, S16, RGB, RGBX image formats
-		if (m_format == VX_DF_IMAGE_U8 || m_format == VX_DF_IMAGE_S16 || m_format == VX_DF_IMAGE_RGB || m_format == VX_DF_IMAGE_RGBX) {
-			vx_rectangle_t rect = { 0, 0, min(m_width, (vx_uint32)pMat->cols), min(m_height, (vx_uint32)pMat->rows) };
-			vx_imagepatch_addressing_t addr = { 0 };
-			vx_uint8 * dst = NULL;
-			ERROR_CHECK(vxAccessImagePatch(m_image, &rect, 0, &addr, (void **)&dst, VX_WRITE_ONLY));
-			vx_int32 rowSize = ((vx_int32)pMat->step < addr.stride_y) ? (vx_int32)pMat->step : addr.stride_y;
-			for (vx_uint32 y = 0; y < rect.end_y; y++) {
-				if (m_format == VX_DF_IMAGE_RGB) {
-					// convert BGR to RGB
-					vx_uint8 * pDst = (vx_uint8 *)dst + y * addr.stride_y;
-					vx_uint8 * pSrc = (vx_uint8 *)pMat->data + y * pMat->step;
-					for (vx_uint32 x = 0; x < m_width; x++) {
-						pDst[0] = pSrc[2];
-						pDst[1] = pSrc[1];
-						pDst[2] = pSrc[0];
-						pDst += 3;
-						pSrc += 3;
-					}
-				}
-				else {
-					memcpy(dst + y * addr.stride_y, pMat->data + y * pMat->step, rowSize);
-				}
-			}
-			ERROR_CHECK(vxCommitImagePatch(m_image, &rect, 0, &addr, dst));
-		}
+		if (CopyCapturedFrame(pMat, captureWidth, captureHeight) < 0)
+			return -1;
 	}
 	else if (m_cvImage) {
 		// read image from camera
@@ -785,11 +814,33 @@ int CVxParamImage::ReadFrame(int frameNumber)
 	}
 #endif
 
+	if (m_asyncRead) {
+		if (frameNumber != m_readFrameNext) {
+			// (re)start prefetching of m_framesInFlight frames from the requested frame
+			StopAsyncRead();
+			for (size_t i = 0; i < m_readSlots.size(); i++)
+				SubmitRead(i, frameNumber + (int)i);
+			m_readSlotIndex = 0;
+		}
+		// pick up the prefetched frame and queue the read of a later frame into the same slot
+		IoSlot * slot = &m_readSlots[m_readSlotIndex];
+		m_ioWorker->Wait(slot->ticket);
+		if (!slot->error.empty()) ReportError("%s", slot->error.c_str());
+		bool eofDetected = ReadImageFromBuffer(m_image, &m_rectFull, slot->buf.data(), slot->size) ? true : false;
+		SubmitRead(m_readSlotIndex, frameNumber + (int)m_readSlots.size());
+		m_readSlotIndex = (m_readSlotIndex + 1) % m_readSlots.size();
+		m_readFrameNext = frameNumber + 1;
+		if (eofDetected) {
+			// report the caller that end of file has been detected -- no frames available in input
+			return 1;
+		}
+	}
+
 	// make sure that input file is open when OpenCV camera is not active and input filename is specified
 #if ENABLE_OPENCV
 	if (!m_cvImage)
 #endif
-	if (!m_fpRead) {
+	if (!m_asyncRead && !m_fpRead) {
 		if (m_fileNameRead.length() > 0) {
 			char fileName[MAX_FILE_NAME_LENGTH];
 			snprintf(fileName, sizeof(fileName), m_fileNameRead.c_str(), frameNumber, m_width, m_height);
@@ -801,7 +852,7 @@ int CVxParamImage::ReadFrame(int frameNumber)
 		}
 	}
 
-	if (m_fpRead) {
+	if (!m_asyncRead && m_fpRead) {
 		// update m_countFrames to be able to repeat after every m_repeatFrames
 		if (m_repeatFrames != 0) {
 			if (m_countFrames == m_repeatFrames) {
@@ -838,6 +889,70 @@ int CVxParamImage::ReadFrame(int frameNumber)
 }
 
 #if ENABLE_OPENCV
+// read next frame from OpenCV capture device: returns false when no more frames are available
+//   NOTE: called from m_ioWorker thread when capture is decoded in the background
+bool CVxParamImage::CaptureFrame(Mat * pMat, vx_uint32 * captureWidth, vx_uint32 * captureHeight)
+{
+	VideoCapture * pCap = (VideoCapture *)m_cvCapDev;
+	*pCap >> *pMat;
+	if (!pMat->data)
+		return false;
+	// U8 images are captured as gray
+	if (m_format == VX_DF_IMAGE_U8) {
+		cvtColor(*pMat, *pMat, CV_BGR2GRAY);
+	}
+	*captureWidth = pMat->cols;
+	*captureHeight = pMat->rows;
+	// resize image using bicubic interpolation, if needed
+	bool doResize = !m_doNotResizeCapturedImages && (pMat->cols != m_width || pMat->rows != m_height);
+	if (doResize) {
+		// resize the captured video to specifed buffer size
+		resize(*pMat, *pMat, Size(m_width, m_height), 0, 0, INTER_CUBIC);
+	}
+	return true;
+}
+
+// copy captured frame into image
+int CVxParamImage::CopyCapturedFrame(Mat * pMat, vx_uint32 captureWidth, vx_uint32 captureHeight)
+{
+	if (!m_gotCaptureVideoSize) {
+		m_captureWidth = captureWidth;
+		m_captureHeight = captureHeight;
+		m_gotCaptureVideoSize = true;
+		bool doResize = !m_doNotResizeCapturedImages && (captureWidth != m_width || captureHeight != m_height);
+		printf("OK: capturing %dx%d image(s) into %dx%d RGB image buffer%s\n", m_captureWidth, m_captureHeight, m_width, m_height, doResize ? " with resize" : "");
+	}
+
+	// copy Mat into image
+	// NOTE: currently only supports U8, S16, RGB, RGBX image formats
+	if (m_format == VX_DF_IMAGE_U8 || m_format == VX_DF_IMAGE_S16 || m_format == VX_DF_IMAGE_RGB || m_format == VX_DF_IMAGE_RGBX) {
+		vx_rectangle_t rect = { 0, 0, min(m_width, (vx_uint32)pMat->cols), min(m_height, (vx_uint32)pMat->rows) };
+		vx_imagepatch_addressing_t addr = { 0 };
+		vx_uint8 * dst = NULL;
+		ERROR_CHECK(vxAccessImagePatch(m_image, &rect, 0, &addr, (void **)&dst, VX_WRITE_ONLY));
+		vx_int32 rowSize = ((vx_int32)pMat->step < addr.stride_y) ? (vx_int32)pMat->step : addr.stride_y;
+		for (vx_uint32 y = 0; y < rect.end_y; y++) {
+			if (m_format == VX_DF_IMAGE_RGB) {
+				// convert BGR to RGB
+				vx_uint8 * pDst = (vx_uint8 *)dst + y * addr.stride_y;
+				vx_uint8 * pSrc = (vx_uint8 *)pMat->data + y * pMat->step;
+				for (vx_uint32 x = 0; x < m_width; x++) {
+					pDst[0] = pSrc[2];
+					pDst[1] = pSrc[1];
+					pDst[2] = pSrc[0];
+					pDst += 3;
+					pSrc += 3;
+				}
+			}
+			else {
+				memcpy(dst + y * addr.stride_y, pMat->data + y * pMat->step, rowSize);
+			}
+		}
+		ERROR_CHECK(vxCommitImagePatch(m_image, &rect, 0, &addr, dst));
+	}
+	return 0;
+}
+
 int CVxParamImage::ViewFrame(int frameNumber)
 {
 	if (m_cvDispMat) {
@@ -1130,7 +1245,17 @@ int CVxParamImage::ViewFrame(int frameNumber)
 			if (m_usingDisplay) {
 				imshow(m_displayName, *pOutputImage);
 			}
-			if (m_usingWriter) {
+			if (m_usingWriter && m_asyncWrite) {
+				// wait for the slot to become free and encode a copy of the frame in the background
+				IoSlot * slot = &m_writeSlots[m_writeSlotIndex];
+				m_ioWorker->Wait(slot->ticket);
+				if (!slot->error.empty()) ReportError("%s", slot->error.c_str());
+				pOutputImage->copyTo(slot->mat);
+				slot->frameNumber = frameNumber;
+				slot->ticket = m_ioWorker->Submit([this, slot] { EncodeFrameJob(slot); });
+				m_writeSlotIndex = (m_writeSlotIndex + 1) % m_writeSlots.size();
+			}
+			else if (m_usingWriter) {
 				((VideoWriter *)m_cvWriter)->write(*pOutputImage);
 			}
 		}
@@ -1146,21 +1271,26 @@ int CVxParamImage::WriteFrame(int frameNumber)
 		return -1;
 #endif
 
+	if (m_asyncWrite && !m_usingWriter) {
+		// wait for the slot to become free and report errors of its earlier write
+		IoSlot * slot = &m_writeSlots[m_writeSlotIndex];
+		m_ioWorker->Wait(slot->ticket);
+		if (!slot->error.empty()) ReportError("%s", slot->error.c_str());
+		// copy vx_image into the slot and write it into file in the background
+		WriteImageToBuffer(m_image, &m_rectFull, slot->buf.data());
+		slot->frameNumber = frameNumber;
+		slot->ticket = m_ioWorker->Submit([this, slot] { WriteFrameJob(slot); });
+		m_writeSlotIndex = (m_writeSlotIndex + 1) % m_writeSlots.size();
+		return 0;
+	}
+
 	if (!m_fpWrite) {
 		if (m_fileNameWrite.length() > 0 && !m_usingWriter) {
 			char fileName[MAX_FILE_NAME_LENGTH];
 			snprintf(fileName, sizeof(fileName), m_fileNameWrite.c_str(), frameNumber, m_width, m_height);
 #if ENABLE_OPENCV
             // check if openCV imwrite need to be used
-            int extpos = (int)strlen(fileName) - 1;
-            while (extpos > 0 && fileName[extpos] != '.')
-                extpos--;
- 
-            if (!_stricmp(&fileName[extpos], ".jpg") || !_stricmp(&fileName[extpos], ".jpeg") ||
-                !_stricmp(&fileName[extpos], ".jpe") || !_stricmp(&fileName[extpos], ".png") ||
-                !_stricmp(&fileName[extpos], ".bmp") || !_stricmp(&fileName[extpos], ".tif") ||
-                !_stricmp(&fileName[extpos], ".ppm") || !_stricmp(&fileName[extpos], ".tiff") ||
-                !_stricmp(&fileName[extpos], ".pgm") || !_stricmp(&fileName[extpos], ".pbm"))
+            if (IsCompressedImageFileName(fileName))
             {
                 WriteImageCompressed(m_image, &m_rectFull,fileName);
                 return 0;
@@ -1187,6 +1317,28 @@ int CVxParamImage::WriteFrame(int frameNumber)
 
 int CVxParamImage::CompareFrame(int frameNumber)
 {
+	if (m_asyncCompare) {
+		// wait for the slot to become free and pick up the result of its earlier compare
+		IoSlot * slot = &m_compareSlots[m_compareSlotIndex];
+		m_ioWorker->Wait(slot->ticket);
+		int status = PickUpCompare(slot);
+		// copy the compare region of vx_image into the slot and compare it in the background
+		for (size_t plane = 0; plane < m_comparePlaneLayout.size(); plane++) {
+			const ComparePlaneLayout& layout = m_comparePlaneLayout[plane];
+			vx_imagepatch_addressing_t addr = { 0 };
+			vx_uint8 * base_ptr = nullptr;
+			ERROR_CHECK(vxAccessImagePatch(m_image, &m_rectCompare, (vx_uint32)plane, &addr, (void **)&base_ptr, VX_READ_ONLY));
+			for (vx_uint32 y = 0; y < layout.height; y++) {
+				memcpy(slot->buf.data() + layout.offset + y * layout.rowBytes, base_ptr + y * addr.stride_y, layout.rowBytes);
+			}
+			ERROR_CHECK(vxCommitImagePatch(m_image, &m_rectCompare, (vx_uint32)plane, &addr, base_ptr));
+		}
+		slot->frameNumber = frameNumber;
+		slot->ticket = m_ioWorker->Submit([this, slot] { CompareFrameJob(slot); });
+		m_compareSlotIndex = (m_compareSlotIndex + 1) % m_compareSlots.size();
+		return status;
+	}
+
 	// make sure that compare reference data is opened
 	if (!m_fpCompare) {
 		if (m_fileNameCompare.length() > 0) {
@@ -1259,3 +1411,315 @@ int CVxParamImage::CompareFrame(int frameNumber)
 
 	return 0;
 }
+
+int CVxParamImage::FinishFrames()
+{
+	if (!m_ioWorker)
+		return 0;
+
+	// stop prefetching and wait for all pending writes and compares
+	StopAsyncRead();
+	m_ioWorker->WaitAll();
+
+	// report errors and compare results not picked up by WriteFrame/CompareFrame yet, oldest frame first
+	int status = 0;
+	for (size_t i = 0; i < m_writeSlots.size(); i++) {
+		IoSlot * slot = &m_writeSlots[(m_writeSlotIndex + i) % m_writeSlots.size()];
+		if (!slot->error.empty()) ReportError("%s", slot->error.c_str());
+	}
+	for (size_t i = 0; i < m_compareSlots.size(); i++) {
+		IoSlot * slot = &m_compareSlots[(m_compareSlotIndex + i) % m_compareSlots.size()];
+		if (PickUpCompare(slot) < 0) status = -1;
+	}
+
+	return status;
+}
+
+// report the result of the background compare in the slot against the frame it belongs to
+int CVxParamImage::PickUpCompare(IoSlot * slot)
+{
+	if (!slot->report.empty()) {
+		fputs(slot->report.c_str(), stdout);
+		slot->report.clear();
+	}
+	if (!slot->error.empty()) ReportError("%s", slot->error.c_str());
+	int status = slot->status;
+	slot->status = 0;
+	if (status > 0) {
+		m_compareCountMatches++;
+	}
+	else if (status < 0) {
+		m_compareCountMismatches++;
+		if (!m_discardCompareErrors) return -1;
+	}
+	return 0;
+}
+
+void CVxParamImage::SetupAsyncIO()
+{
+	// complete background I/O of an earlier graph run
+	if (m_ioWorker) {
+		StopAsyncRead();
+		m_ioWorker->WaitAll();
+	}
+	m_asyncRead = m_asyncCapture = m_asyncWrite = m_asyncCompare = false;
+	if (m_framesInFlight <= 0)
+		return;
+
+	// file I/O, OpenCV capture decode, and imwrite/VideoWriter encode are moved into background;
+	// display and checksum compares stay synchronous
+	bool usingCapture = false, asyncEncode = false;
+#if ENABLE_OPENCV
+	usingCapture = (m_cvCapDev || m_cvImage);
+	m_asyncCapture = (m_cvCapMat && m_cvCapDev);
+	asyncEncode = m_usingWriter || (m_planes == 1 && GetCvMatTypeForEncode(m_format) >= 0);
+#endif
+	m_asyncRead = !usingCapture && m_fileNameRead.length() > 0;
+	m_asyncWrite = m_fileNameWrite.length() > 0 && (asyncEncode || !IsCompressedImageFileName(m_fileNameWrite.c_str()));
+	m_asyncCompare = m_fileNameCompare.length() > 0 && !m_useCheckSumForCompare && !m_generateCheckSumForCompare;
+	if (!m_asyncRead && !m_asyncCapture && !m_asyncWrite && !m_asyncCompare)
+		return;
+
+	// allocate staging buffers for frames in flight
+	size_t frameSizeIO = WriteImageToBuffer(m_image, &m_rectFull, nullptr);
+	IoSlot slotInit = { };
+	slotInit.fileOffset = -1;
+	if (m_asyncRead || m_asyncCapture) {
+		// capture frames are decoded into IoSlot::mat
+		m_readSlots.assign(m_framesInFlight, slotInit);
+		for (auto it = m_readSlots.begin(); it != m_readSlots.end(); it++)
+			it->buf.resize(m_asyncRead ? frameSizeIO : 0);
+		m_readSlotIndex = 0;
+		m_readFrameNext = -1;
+	}
+	if (m_asyncWrite) {
+		// frames for VideoWriter are copied into IoSlot::mat
+		m_writeSlots.assign(m_framesInFlight, slotInit);
+		for (auto it = m_writeSlots.begin(); it != m_writeSlots.end(); it++)
+			it->buf.resize(m_usingWriter ? 0 : frameSizeIO);
+		m_writeSlotIndex = 0;
+	}
+	if (m_asyncCompare) {
+		// compare region of each plane gets packed into the slot; reference is in file layout (same as CompareImage)
+		m_comparePlaneLayout.clear();
+		size_t offset = 0, refOffset = 0;
+		for (vx_uint32 plane = 0; plane < (vx_uint32)m_planes; plane++) {
+			vx_imagepatch_addressing_t addr = { 0 };
+			vx_uint8 * base_ptr = nullptr;
+			ERROR_CHECK(vxAccessImagePatch(m_image, &m_rectCompare, plane, &addr, (void **)&base_ptr, VX_READ_ONLY));
+			ERROR_CHECK(vxCommitImagePatch(m_image, &m_rectCompare, plane, &addr, base_ptr));
+			ComparePlaneLayout layout;
+			layout.width = ((addr.dim_x * addr.scale_x) / VX_SCALE_UNITY);
+			layout.height = ((addr.dim_y * addr.scale_y) / VX_SCALE_UNITY);
+			vx_uint32 plane_width = ((m_width * addr.scale_x) / VX_SCALE_UNITY);
+			vx_uint32 plane_height = ((m_height * addr.scale_y) / VX_SCALE_UNITY);
+			vx_uint32 start_x = ((m_rectCompare.start_x * addr.scale_x) / VX_SCALE_UNITY);
+			vx_uint32 start_y = ((m_rectCompare.start_y * addr.scale_y) / VX_SCALE_UNITY);
+			bool isU1 = (m_format == VX_DF_IMAGE_U1_AMD);
+			layout.rowBytes = isU1 ? ((layout.width + 7) >> 3) : (layout.width * addr.stride_x);
+			layout.refStride = isU1 ? ((plane_width + 7) >> 3) : (plane_width * addr.stride_x);
+			layout.refOffset = refOffset + start_y * layout.refStride + start_x * addr.stride_x;
+			layout.offset = offset;
+			m_comparePlaneLayout.push_back(layout);
+			offset += layout.height * layout.rowBytes;
+			refOffset += plane_height * layout.refStride;
+		}
+		m_compareSlots.assign(m_framesInFlight, slotInit);
+		for (auto it = m_compareSlots.begin(); it != m_compareSlots.end(); it++) {
+			it->buf.resize(offset);
+			it->ref.resize(m_frameSize);
+		}
+		m_compareSlotIndex = 0;
+		m_compareObjectName = GetVxObjectName();
+	}
+	if (!m_ioWorker) {
+		NULLPTR_CHECK(m_ioWorker = new CVxIoWorker);
+	}
+}
+
+void CVxParamImage::SubmitRead(size_t index, int frameNumber)
+{
+	IoSlot * slot = &m_readSlots[index];
+	slot->frameNumber = frameNumber;
+	slot->ticket = m_ioWorker->Submit([this, slot] { ReadFrameJob(slot); });
+}
+
+void CVxParamImage::StopAsyncRead()
+{
+	if (m_readFrameNext < 0)
+		return;
+	m_ioWorker->WaitAll();
+	if (m_asyncCapture) {
+		// decoded frames can't be pushed back into the capture device: keep them for the next ReadFrame
+		return;
+	}
+	// roll back the input file to the oldest frame that was prefetched but not consumed
+	IoSlot * slot = &m_readSlots[m_readSlotIndex];
+	if (slot->fileOffset >= 0) {
+		if (m_fpRead) fseek(m_fpRead, slot->fileOffset, SEEK_SET);
+	}
+	else if (m_fpRead) {
+		fclose(m_fpRead);
+		m_fpRead = nullptr;
+	}
+	m_countFrames = slot->countFrames;
+	m_readFrameNext = -1;
+}
+
+// runs on m_ioWorker thread: same as synchronous ReadFrame, but reads into the slot
+void CVxParamImage::ReadFrameJob(IoSlot * slot)
+{
+	slot->error.clear();
+	slot->size = 0;
+	slot->fileOffset = m_fpRead ? ftell(m_fpRead) : -1;
+	slot->countFrames = m_countFrames;
+	if (!m_fpRead) {
+		char fileName[MAX_FILE_NAME_LENGTH];
+		snprintf(fileName, sizeof(fileName), m_fileNameRead.c_str(), slot->frameNumber, m_width, m_height);
+		m_fpRead = fopen(fileName, "rb");
+		if (!m_fpRead) {
+			slot->error = std::string("ERROR: unable to open: ") + fileName + "\n";
+			return;
+		}
+		if (!m_fileNameForReadHasIndex && m_captureFrameStart > 0) {
+			// skip to specified frame when starting frame is specified
+			fseek(m_fpRead, m_captureFrameStart*(long)m_frameSize, SEEK_SET);
+		}
+	}
+	// update m_countFrames to be able to repeat after every m_repeatFrames
+	if (m_repeatFrames != 0) {
+		if (m_countFrames == m_repeatFrames) {
+			// seek back to beginning after every m_repeatFrames frames
+			fseek(m_fpRead, m_captureFrameStart*(long)m_frameSize, SEEK_SET);
+			m_countFrames = 0;
+		}
+		else {
+			m_countFrames++;
+		}
+	}
+	slot->size = fread(slot->buf.data(), 1, slot->buf.size(), m_fpRead);
+	// close file if file names has indices (i.e., only one frame per file requested)
+	if (m_fileNameForReadHasIndex) {
+		fclose(m_fpRead);
+		m_fpRead = nullptr;
+	}
+}
+
+// runs on m_ioWorker thread: write the frame in the slot into file
+void CVxParamImage::WriteFrameJob(IoSlot * slot)
+{
+	slot->error.clear();
+#if ENABLE_OPENCV
+	if (IsCompressedImageFileName(m_fileNameWrite.c_str())) {
+		// encode the frame with OpenCV imwrite: the slot has rows without padding, same as Mat
+		char fileName[MAX_FILE_NAME_LENGTH];
+		snprintf(fileName, sizeof(fileName), m_fileNameWrite.c_str(), slot->frameNumber, m_width, m_height);
+		try {
+			Mat mat(m_height, m_width, GetCvMatTypeForEncode(m_format), slot->buf.data());
+			if (!imwrite(fileName, mat))
+				slot->error = std::string("ERROR: unable to create: ") + fileName + "\n";
+		}
+		catch (const cv::Exception& e) {
+			slot->error = std::string("ERROR: imwrite(") + fileName + ") failed: " + e.what() + "\n";
+		}
+		return;
+	}
+#endif
+	if (!m_fpWrite) {
+		char fileName[MAX_FILE_NAME_LENGTH];
+		snprintf(fileName, sizeof(fileName), m_fileNameWrite.c_str(), slot->frameNumber, m_width, m_height);
+		m_fpWrite = fopen(fileName, "wb+");
+		if (!m_fpWrite) {
+			slot->error = std::string("ERROR: unable to create: ") + fileName + "\n";
+			return;
+		}
+	}
+	fwrite(slot->buf.data(), 1, slot->buf.size(), m_fpWrite);
+	// close the file if one frame gets written per file
+	if (m_fileNameForWriteHasIndex) {
+		fclose(m_fpWrite);
+		m_fpWrite = nullptr;
+	}
+}
+
+// runs on m_ioWorker thread: compare the region in the slot with reference from file
+//   the result is picked up by the main thread with PickUpCompare: 1 for match, -1 for mismatch
+void CVxParamImage::CompareFrameJob(IoSlot * slot)
+{
+	slot->error.clear();
+	slot->report.clear();
+	slot->status = 0;
+	if (!m_fpCompare) {
+		snprintf(m_fileNameCompareCurrent, sizeof(m_fileNameCompareCurrent), m_fileNameCompare.c_str(), slot->frameNumber, m_width, m_height);
+		m_fpCompare = fopen(m_fileNameCompareCurrent, "rb");
+		if (!m_fpCompare) {
+			slot->error = std::string("ERROR: unable to open: ") + m_fileNameCompareCurrent + "\n";
+			return;
+		}
+	}
+	// read data from frame
+	if (m_frameSize != fread(slot->ref.data(), 1, m_frameSize, m_fpCompare)) {
+		char message[512];
+		snprintf(message, sizeof(message), "ERROR: image data missing for frame#%d in %s\n", slot->frameNumber, m_fileNameCompareCurrent);
+		slot->error = message;
+		return;
+	}
+	// compare image to reference plane by plane
+	size_t errorPixelCountTotal = 0;
+	for (size_t plane = 0; plane < m_comparePlaneLayout.size(); plane++) {
+		const ComparePlaneLayout& layout = m_comparePlaneLayout[plane];
+		size_t errorPixelCount = ComparePlane(m_format, slot->buf.data() + layout.offset, layout.rowBytes, slot->ref.data() + layout.refOffset, layout.refStride,
+			layout.width, layout.height, m_comparePixelErrorMin, m_comparePixelErrorMax);
+		errorPixelCountTotal += errorPixelCount;
+		if (errorPixelCount > 0) {
+			char message[512];
+			snprintf(message, sizeof(message), "ERROR: Image COMPARE MISMATCHED %s plane#%d " VX_FMT_SIZE "-pixel(s) with frame#%d of %s\n", m_compareObjectName.c_str(), (int)plane, errorPixelCount, slot->frameNumber, m_fileNameCompareCurrent);
+			slot->report += message;
+		}
+	}
+	if (!errorPixelCountTotal) {
+		if (m_verbose) {
+			char message[512];
+			snprintf(message, sizeof(message), "OK: image COMPARE MATCHED for %s with frame#%d of %s\n", m_compareObjectName.c_str(), slot->frameNumber, m_fileNameCompareCurrent);
+			slot->report += message;
+		}
+		slot->status = 1;
+	}
+	else {
+		slot->status = -1;
+	}
+	// close the file if user requested separate file for each compare data
+	if (m_fileNameForCompareHasIndex) {
+		fclose(m_fpCompare);
+		m_fpCompare = nullptr;
+	}
+}
+
+#if ENABLE_OPENCV
+// runs on m_ioWorker thread: decode the next frame of the capture device into the slot
+//   no frame in the slot means that no more frames are available
+void CVxParamImage::CaptureFrameJob(IoSlot * slot)
+{
+	slot->error.clear();
+	try {
+		if (!CaptureFrame(&slot->mat, &slot->captureWidth, &slot->captureHeight))
+			slot->mat.release();
+	}
+	catch (const cv::Exception& e) {
+		slot->mat.release();
+		slot->error = std::string("ERROR: OpenCV capture(") + m_cameraName + ") failed: " + e.what() + "\n";
+	}
+}
+
+// runs on m_ioWorker thread: encode the frame in the slot with VideoWriter
+void CVxParamImage::EncodeFrameJob(IoSlot * slot)
+{
+	slot->error.clear();
+	try {
+		((VideoWriter *)m_cvWriter)->write(slot->mat);
+	}
+	catch (const cv::Exception& e) {
+		slot->error = std::string("ERROR: VideoWriter(") + m_fileNameWrite + ") failed: " + e.what() + "\n";
+	}
+}
+#endif
@@ -40,12 +40,15 @@ public:
 	virtual int ReadFrame(int frameNumber);
 	virtual int WriteFrame(int frameNumber);
 	virtual int CompareFrame(int frameNumber);
+	virtual int FinishFrames();
 	virtual int Shutdown();
 	virtual void DisableWaitForKeyPress();
 
 protected:
 #if ENABLE_OPENCV
 	int ViewFrame(int frameNumber);
+	bool CaptureFrame(cv::Mat * pMat, vx_uint32 * captureWidth, vx_uint32 * captureHeight);
+	int CopyCapturedFrame(cv::Mat * pMat, vx_uint32 captureWidth, vx_uint32 captureHeight);
 #endif
 
 private:
@@ -100,6 +103,59 @@ private:
 	int m_countInitializeIO;
 	int m_colorIndexDefault;
 	float m_radiusDefault;
+
+	// background file I/O: a ring of m_framesInFlight staging buffers per direction
+	//   reads prefetch upcoming frames; writes and compares work on copies of already processed frames
+	struct IoSlot {
+		std::vector<vx_uint8> buf;     // frame data in file layout (compare: packed compare region)
+		std::vector<vx_uint8> ref;     // reference frame data for compare
+#if ENABLE_OPENCV
+		cv::Mat mat;                   // decoded capture frame, or frame to encode with VideoWriter
+		vx_uint32 captureWidth;        // size of the captured frame before resize
+		vx_uint32 captureHeight;
+#endif
+		int64_t ticket;                // CVxIoWorker ticket of the last job using this slot
+		int frameNumber;
+		size_t size;                   // number of bytes read into buf
+		long fileOffset;               // m_fpRead position before the read (-1 when file was not open)
+		int countFrames;               // m_countFrames before the read
+		int status;                    // compare result: -1 for mismatch (unless discarded)
+		std::string error;             // error message to be reported by the main thread
+		std::string report;            // compare result messages to be printed by the main thread
+	};
+	struct ComparePlaneLayout {
+		size_t offset;                 // offset of the plane region in IoSlot::buf
+		size_t rowBytes;               // bytes per region row in IoSlot::buf
+		size_t refOffset;              // offset of the plane region in reference frame
+		size_t refStride;              // bytes per row in reference frame
+		vx_uint32 width;
+		vx_uint32 height;
+	};
+	CVxIoWorker * m_ioWorker;
+	bool m_asyncRead;
+	bool m_asyncCapture;
+	bool m_asyncWrite;
+	bool m_asyncCompare;
+	std::vector<IoSlot> m_readSlots;
+	std::vector<IoSlot> m_writeSlots;
+	std::vector<IoSlot> m_compareSlots;
+	size_t m_readSlotIndex;
+	size_t m_writeSlotIndex;
+	size_t m_compareSlotIndex;
+	int m_readFrameNext;           // frame number expected by next ReadFrame (-1 if no prefetch is active)
+	std::vector<ComparePlaneLayout> m_comparePlaneLayout;
+	std::string m_compareObjectName;
+	void SetupAsyncIO();
+	void SubmitRead(size_t index, int frameNumber);
+	void StopAsyncRead();
+	int PickUpCompare(IoSlot * slot);
+	void ReadFrameJob(IoSlot * slot);
+	void WriteFrameJob(IoSlot * slot);
+	void CompareFrameJob(IoSlot * slot);
+#if ENABLE_OPENCV
+	void CaptureFrameJob(IoSlot * slot);
+	void EncodeFrameJob(IoSlot * slot);
+#endif
 };
 
 
@@ -48,6 +48,7 @@ public:
 	void SetCaptureFrameStart(vx_uint32 frameStart) { m_captureFrameStart = frameStart; }
 	void SetVerbose(bool verbose) { m_verbose = verbose; }
 	void SetDiscardCompareErrors(bool discardCompareErrors) { m_discardCompareErrors = discardCompareErrors; }
+	void SetFramesInFlight(int framesInFlight) { m_framesInFlight = framesInFlight; }
 	bool IsVirtualObject() { return m_isVirtualObject; }
 
 	// Initialize: create OpenVX object and further uses InitializeIO to input/output initialization
@@ -79,6 +80,9 @@ public:
 	virtual int ReadFrame(int frameNumber) = 0;
 	virtual int WriteFrame(int frameNumber) = 0;
 	virtual int CompareFrame(int frameNumber) = 0;
+	// FinishFrames: wait for background I/O of earlier frames to complete after the last frame
+	//   returns 0 on SUCCESS, else error code (e.g., deferred compare mismatch)
+	virtual int FinishFrames();
 
 	// helper functions
 	//   GetDisplayName -- returns DISPLAY name specified as part of ":W,DISPLAY-<name>" I/O request
@@ -117,6 +121,8 @@ protected:
 	FILE * m_fpCompare;
 	bool m_verbose;
 	bool m_discardCompareErrors;
+	// number of frames that can be in flight for background file I/O (0: synchronous I/O)
+	int m_framesInFlight;
 	bool m_isVirtualObject;
 	bool m_useSyncOpenCLWriteDirective;
 	// for multi-frame capture support
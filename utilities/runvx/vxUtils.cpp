@@ -376,6 +376,68 @@ void CHasher::Shutdown(){
 #endif
 }
 
+///////////////////////////////////////////
+// class CVxIoWorker for background frame I/O
+CVxIoWorker::CVxIoWorker()
+{
+	m_submitted = 0;
+	m_completed = 0;
+	m_quit = false;
+	m_thread = std::thread(&CVxIoWorker::WorkerLoop, this);
+}
+
+CVxIoWorker::~CVxIoWorker()
+{
+	// finish all pending jobs before exiting
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_quit = true;
+	}
+	m_jobAvailable.notify_one();
+	m_thread.join();
+}
+
+int64_t CVxIoWorker::Submit(std::function<void()> job)
+{
+	int64_t ticket;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_jobs.push_back(std::move(job));
+		ticket = ++m_submitted;
+	}
+	m_jobAvailable.notify_one();
+	return ticket;
+}
+
+void CVxIoWorker::Wait(int64_t ticket)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_jobDone.wait(lock, [&] { return m_completed >= ticket; });
+}
+
+void CVxIoWorker::WaitAll()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_jobDone.wait(lock, [&] { return m_completed >= m_submitted; });
+}
+
+void CVxIoWorker::WorkerLoop()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	for (;;) {
+		m_jobAvailable.wait(lock, [&] { return m_quit || !m_jobs.empty(); });
+		if (m_jobs.empty())
+			break;
+		std::function<void()> job = std::move(m_jobs.front());
+		m_jobs.pop_front();
+		lock.unlock();
+		job();
+		lock.lock();
+		m_completed++;
+		m_jobDone.notify_all();
+	}
+}
+
 // Compute checksum of rectangular region specified within an image
 void ComputeChecksum(char checkSumString[64], vx_image image, vx_rectangle_t * rectRegion)
 {
@@ -441,6 +503,42 @@ size_t ComparePixelsU001(vx_uint8 * pImg, size_t img_stride_y, vx_uint8 * pRef,
 	return errorPixelCount;
 }
 
+// Compare a plane region held in host memory with reference and return number of pixels mismatching
+size_t ComparePlane(vx_df_image format, vx_uint8 * pImg, size_t img_stride_y, vx_uint8 * pRef, size_t ref_stride_y, vx_uint32 width, vx_uint32 height, float errLimitMin, float errLimitMax)
+{
+	// set pixel type
+	vx_enum pixelType = VX_TYPE_UINT8; // default
+	if (format == VX_DF_IMAGE_S16) pixelType = VX_TYPE_INT16;
+	else if (format == VX_DF_IMAGE_U16) pixelType = VX_TYPE_UINT16;
+	else if (format == VX_DF_IMAGE_S32) pixelType = VX_TYPE_INT32;
+	else if (format == VX_DF_IMAGE_U32) pixelType = VX_TYPE_UINT32;
+	else if (format == VX_DF_IMAGE_F32_AMD || format == VX_DF_IMAGE_F32x3_AMD) pixelType = VX_TYPE_FLOAT32;
+	// compare pixels
+	size_t errorPixelCount = 0;
+	if (pixelType == VX_TYPE_INT16) {
+		errorPixelCount = ComparePixels((vx_int16 *)pImg, img_stride_y, (vx_int16 *)pRef, ref_stride_y, width, height, (vx_int32)errLimitMin, (vx_int32)errLimitMax);
+	}
+	else if (pixelType == VX_TYPE_UINT16) {
+		errorPixelCount = ComparePixels((vx_uint16 *)pImg, img_stride_y, (vx_uint16 *)pRef, ref_stride_y, width, height, (vx_int32)errLimitMin, (vx_int32)errLimitMax);
+	}
+	else if (pixelType == VX_TYPE_INT32) {
+		errorPixelCount = ComparePixels((vx_int32 *)pImg, img_stride_y, (vx_int32 *)pRef, ref_stride_y, width, height, (vx_int64)errLimitMin, (vx_int64)errLimitMax);
+	}
+	else if (pixelType == VX_TYPE_UINT32) {
+		errorPixelCount = ComparePixels((vx_uint32 *)pImg, img_stride_y, (vx_uint32 *)pRef, ref_stride_y, width, height, (vx_int64)errLimitMin, (vx_int64)errLimitMax);
+	}
+	else if (pixelType == VX_TYPE_FLOAT32) {
+		errorPixelCount = ComparePixels((vx_float32 *)pImg, img_stride_y, (vx_float32 *)pRef, ref_stride_y, width, height, (vx_float32)errLimitMin, (vx_float32)errLimitMax);
+	}
+	else if (format == VX_DF_IMAGE_U1_AMD) {
+		errorPixelCount = ComparePixelsU001((vx_uint8 *)pImg, img_stride_y, (vx_uint8 *)pRef, ref_stride_y, width, height);
+	}
+	else {
+		errorPixelCount = ComparePixels((vx_uint8 *)pImg, img_stride_y, (vx_uint8 *)pRef, ref_stride_y, width, height, (vx_int32)errLimitMin, (vx_int32)errLimitMax);
+	}
+	return errorPixelCount;
+}
+
 // Compare rectangular region specified within an image and return number of pixels mismatching
 size_t CompareImage(vx_image image, vx_rectangle_t * rectRegion, vx_uint8 * refImage, float errLimitMin, float errLimitMax, int frameNumber, const char * fileNameRef)
 {
@@ -451,13 +549,6 @@ size_t CompareImage(vx_image image, vx_rectangle_t * rectRegion, vx_uint8 * refI
 	ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_HEIGHT, &image_height, sizeof(image_height)));
 	ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &format, sizeof(format)));
 	ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_PLANES, &num_planes, sizeof(num_planes)));
-	// set pixel type and compute frame size in bytes
-	vx_enum pixelType = VX_TYPE_UINT8; // default
-	if (format == VX_DF_IMAGE_S16) pixelType = VX_TYPE_INT16;
-	else if (format == VX_DF_IMAGE_U16) pixelType = VX_TYPE_UINT16;
-	else if (format == VX_DF_IMAGE_S32) pixelType = VX_TYPE_INT32;
-	else if (format == VX_DF_IMAGE_U32) pixelType = VX_TYPE_UINT32;
-	else if (format == VX_DF_IMAGE_F32_AMD || format == VX_DF_IMAGE_F32x3_AMD) pixelType = VX_TYPE_FLOAT32;
 	// compare plane by plane
 	vx_size errorPixelCountTotal = 0;
 	vx_uint8 * pRefPlane = refImage;
@@ -473,28 +564,7 @@ size_t CompareImage(vx_image image, vx_rectangle_t * rectRegion, vx_uint8 * refI
 		vx_uint32 start_x = ((rectRegion->start_x * addr.scale_x) / VX_SCALE_UNITY);
 		vx_uint32 start_y = ((rectRegion->start_y * addr.scale_y) / VX_SCALE_UNITY);
 		vx_uint8 * pRef = pRefPlane + start_y * plane_width_in_bytes + start_x * addr.stride_x;
-		vx_size errorPixelCount = 0;
-		if (pixelType == VX_TYPE_INT16) {
-			errorPixelCount = ComparePixels((vx_int16 *)base_ptr, addr.stride_y, (vx_int16 *)pRef, plane_width_in_bytes, region_width, region_height, (vx_int32)errLimitMin, (vx_int32)errLimitMax);
-		}
-		else if (pixelType == VX_TYPE_UINT16) {
-			errorPixelCount = ComparePixels((vx_uint16 *)base_ptr, addr.stride_y, (vx_uint16 *)pRef, plane_width_in_bytes, region_width, region_height, (vx_int32)errLimitMin, (vx_int32)errLimitMax);
-		}
-		else if (pixelType == VX_TYPE_INT32) {
-			errorPixelCount = ComparePixels((vx_int32 *)base_ptr, addr.stride_y, (vx_int32 *)pRef, plane_width_in_bytes, region_width, region_height, (vx_int64)errLimitMin, (vx_int64)errLimitMax);
-		}
-		else if (pixelType == VX_TYPE_UINT32) {
-			errorPixelCount = ComparePixels((vx_uint32 *)base_ptr, addr.stride_y, (vx_uint32 *)pRef, plane_width_in_bytes, region_width, region_height, (vx_int64)errLimitMin, (vx_int64)errLimitMax);
-		}
-		else if (pixelType == VX_TYPE_FLOAT32) {
-			errorPixelCount = ComparePixels((vx_float32 *)base_ptr, addr.stride_y, (vx_float32 *)pRef, plane_width_in_bytes, region_width, region_height, (vx_float32)errLimitMin, (vx_float32)errLimitMax);
-		}
-		else if (format == VX_DF_IMAGE_U1_AMD) {
-			errorPixelCount = ComparePixelsU001((vx_uint8 *)base_ptr, addr.stride_y, (vx_uint8 *)pRef, plane_width_in_bytes, region_width, region_height);
-		}
-		else {
-			errorPixelCount = ComparePixels((vx_uint8 *)base_ptr, addr.stride_y, (vx_uint8 *)pRef, plane_width_in_bytes, region_width, region_height, (vx_int32)errLimitMin, (vx_int32)errLimitMax);
-		}
+		vx_size errorPixelCount = ComparePlane(format, base_ptr, addr.stride_y, pRef, plane_width_in_bytes, region_width, region_height, errLimitMin, errLimitMax);
 		ERROR_CHECK(vxCommitImagePatch(image, rectRegion, plane, &addr, base_ptr));
 		// report results
 		errorPixelCountTotal += errorPixelCount;
@@ -576,6 +646,67 @@ int WriteImage(vx_image image, vx_rectangle_t * rectFull, FILE * fp)
 	return 0;
 }
 
+// read image from host buffer with size bytes in ReadImage file layout
+int ReadImageFromBuffer(vx_image image, vx_rectangle_t * rectFull, const vx_uint8 * buf, size_t size)
+{
+	// get number of planes, image width in bytes for single plane 
+	vx_size num_planes = 0;
+	ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_PLANES, &num_planes, sizeof(num_planes)));
+	vx_size width_in_bytes = (num_planes == 1) ? CalculateImageWidthInBytes(image) : 0;
+	// copy all image planes into vx_image and check if the buffer ends early (same as EOF in ReadImage)
+	bool eofDetected = false;
+	for (vx_uint32 plane = 0; plane < (vx_uint32)num_planes; plane++) {
+		vx_imagepatch_addressing_t addr;
+		vx_uint8 * dst = NULL;
+		ERROR_CHECK(vxAccessImagePatch(image, rectFull, plane, &addr, (void **)&dst, VX_WRITE_ONLY));
+		vx_size width = (addr.dim_x * addr.scale_x) / VX_SCALE_UNITY;
+		if (addr.stride_x != 0)
+			width_in_bytes = (width * addr.stride_x);
+		for (vx_uint32 y = 0; y < addr.dim_y; y += addr.step_y){
+			vx_uint8 *dstp = (vx_uint8 *)vxFormatImagePatchAddress2d(dst, 0, y, &addr);
+			vx_size count = min(width_in_bytes, size);
+			memcpy(dstp, buf, count);
+			buf += count;
+			size -= count;
+			if (count != width_in_bytes) {
+				eofDetected = true;
+				break;
+			}
+		}
+		ERROR_CHECK(vxCommitImagePatch(image, rectFull, plane, &addr, dst));
+	}
+	// return 1 if EOF detected, other 0
+	return eofDetected ? 1 : 0;
+}
+
+// write image into host buffer in WriteImage file layout
+size_t WriteImageToBuffer(vx_image image, vx_rectangle_t * rectFull, vx_uint8 * buf)
+{
+	// get number of planes, image width in bytes for single plane 
+	vx_size num_planes = 0;
+	ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_PLANES, &num_planes, sizeof(num_planes)));
+	vx_size width_in_bytes = (num_planes == 1) ? CalculateImageWidthInBytes(image) : 0;
+	// copy all image planes from vx_image
+	size_t size = 0;
+	for (vx_uint32 plane = 0; plane < (vx_uint32)num_planes; plane++) {
+		vx_imagepatch_addressing_t addr;
+		vx_uint8 * src = NULL;
+		ERROR_CHECK(vxAccessImagePatch(image, rectFull, plane, &addr, (void **)&src, VX_READ_ONLY));
+		vx_size width = (addr.dim_x * addr.scale_x) / VX_SCALE_UNITY;
+		if (addr.stride_x != 0)
+			width_in_bytes = (width * addr.stride_x);
+		for (vx_uint32 y = 0; y < addr.dim_y; y += addr.step_y){
+			if (buf) {
+				vx_uint8 *srcp = (vx_uint8 *)vxFormatImagePatchAddress2d(src, 0, y, &addr);
+				memcpy(buf + size, srcp, width_in_bytes);
+			}
+			size += width_in_bytes;
+		}
+		ERROR_CHECK(vxCommitImagePatch(image, rectFull, plane, &addr, src));
+	}
+	return size;
+}
+
 #if ENABLE_OPENCV
 // write image compressed
 int WriteImageCompressed(vx_image image, vx_rectangle_t * rectFull, const char * fileName) 
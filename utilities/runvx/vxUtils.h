@@ -48,6 +48,11 @@ THE SOFTWARE.
 #include <map>
 #include <list>
 #include <algorithm>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #if _WIN32
 #include <Windows.h>
@@ -162,6 +167,35 @@ private:
 
 };
 
+///////////////////////////////////////////////////////////////////////////
+// class CVxIoWorker for background frame I/O
+//   runs queued jobs in submission order on a single background thread
+//   Submit -- queue a job and return its ticket
+//   Wait -- return once the job with the given ticket (and all jobs before it) completed
+//   NOTE: jobs must not throw; they have to save errors for the caller
+///////////////////////////////////////////////////////////////////////////
+class CVxIoWorker {
+public:
+	CVxIoWorker();
+	~CVxIoWorker();
+
+	int64_t Submit(std::function<void()> job);
+	void Wait(int64_t ticket);
+	void WaitAll();
+
+private:
+	void WorkerLoop();
+
+	std::thread m_thread;
+	std::mutex m_mutex;
+	std::condition_variable m_jobAvailable;
+	std::condition_variable m_jobDone;
+	std::deque<std::function<void()>> m_jobs;
+	int64_t m_submitted;
+	int64_t m_completed;
+	bool m_quit;
+};
+
 ///////////////////////////////////////////////////////////////////////////
 // utility functions
 ///////////////////////////////////////////////////////////////////////////
@@ -184,12 +218,18 @@ vx_enum ovxName2Enum(const char * name);
 void ComputeChecksum(char checkSumString[64], vx_image image, vx_rectangle_t * rectRegion);
 // compare rectangular region specified within an image and return number of pixels mismatching
 size_t CompareImage(vx_image image, vx_rectangle_t * rectRegion, vx_uint8 * refImage, float errLimitMin, float errLimitMax, int frameNumber, const char * fileNameRef);
+// compare a plane region held in host memory with reference and return number of pixels mismatching
+size_t ComparePlane(vx_df_image format, vx_uint8 * pImg, size_t img_stride_y, vx_uint8 * pRef, size_t ref_stride_y, vx_uint32 width, vx_uint32 height, float errLimitMin, float errLimitMax);
 // get image width in bytes from image
 vx_size CalculateImageWidthInBytes(vx_image image);
 // read image
 int ReadImage(vx_image image, vx_rectangle_t * rectFull, FILE * fp);
 // write image
 int WriteImage(vx_image image, vx_rectangle_t * rectFull, FILE * fp);
+// read image from host buffer with size bytes in ReadImage file layout (returns 1 if buffer is short, otherwise 0)
+int ReadImageFromBuffer(vx_image image, vx_rectangle_t * rectFull, const vx_uint8 * buf, size_t size);
+// write image into host buffer in WriteImage file layout and return the number of bytes (only counts when buf is nullptr)
+size_t WriteImageToBuffer(vx_image image, vx_rectangle_t * rectFull, vx_uint8 * buf);
 // write image compressed
 int WriteImageCompressed(vx_image image, vx_rectangle_t * rectFull, const char * fileName);
 